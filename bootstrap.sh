@@ -73,7 +73,7 @@ if $boehmgc ; then
     tar xzf $version.tar.gz || exit $?
     cd $version
   fi
-  ./configure --prefix=$dir --disable-debug --disable-dependency-tracking --enable-cplusplus || exit $?
+  ./configure --prefix=$dir --disable-debug --disable-dependency-tracking --enable-cplusplus --enable-threads=posix || exit $?
   make || exit $?
   make install #the install can generate errors but still working fine ... 
   cd ..
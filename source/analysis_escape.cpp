@@ -0,0 +1,299 @@
+// =========================================================================== //
+//                                                                             //
+// Copyright 2026 agent.                                                       //
+//                                                                             //
+//   Licensed under the Apache License, Version 2.0 (the "License");           //
+//   you may not use this file except in compliance with the License.          //
+//   You may obtain a copy of the License at                                   //
+//                                                                             //
+//       http://www.apache.org/licenses/LICENSE-2.0                            //
+//                                                                             //
+//   Unless required by applicable law or agreed to in writing, software       //
+//   distributed under the License is distributed on an "AS IS" BASIS,         //
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  //
+//   See the License for the specific language governing permissions and       //
+//  limitations under the License.                                             //
+//                                                                             //
+// =========================================================================== //
+
+
+// Header files
+#include <cassert>
+#include "analysis_escape.h"
+#include "analysis_livevars.h"
+#include "functions.h"
+#include "stmtsequence.h"
+#include "assignstmt.h"
+#include "exprstmt.h"
+#include "ifelsestmt.h"
+#include "loopstmts.h"
+#include "unaryopexpr.h"
+#include "binaryopexpr.h"
+
+// Escape analysis state, gathered in a single pass over the body
+struct EscapeState
+{
+	// Number of definitions of each variable
+	std::map<const SymbolExpr*, size_t> defCounts;
+	
+	// Definitions producing fresh objects
+	std::map<const SymbolExpr*, const AssignStmt*> freshDefs;
+	
+	// Variables whose value may escape
+	Expression::SymbolSet escaped;
+	
+	// Assignment and expression statements, in program order
+	std::vector<const Statement*> stmts;
+};
+
+/***************************************************************
+* Function: producesFreshObject()
+* Purpose : Test if an expression always produces a new object
+* Initial : agent on October 18, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+static bool producesFreshObject(const Expression* pExpr)
+{
+	// Switch on the expression type
+	switch (pExpr->getExprType())
+	{
+		// Arithmetic, comparison and logical operators create new objects
+		case Expression::ExprType::BINARY_OP:
+		return true;
+		
+		// Unary operators other than the unary plus create new objects
+		case Expression::ExprType::UNARY_OP:
+		return ((const UnaryOpExpr*)pExpr)->getOperator() != UnaryOpExpr::PLUS;
+		
+		// Other expressions may return existing objects
+		default:
+		return false;
+	}
+}
+
+/***************************************************************
+* Function: findEscapes()
+* Purpose : Find the variables escaping from an expression
+* Initial : agent on October 18, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+static void findEscapes(const Expression* pExpr, bool operandPos, EscapeState& state)
+{
+	// If this is a symbol
+	if (pExpr->getExprType() == Expression::ExprType::SYMBOL)
+	{
+		// Symbols only read as operators operands do not escape, anything
+		// else (calls, indexing, copies, conditions) may keep a reference
+		if (operandPos == false)
+			state.escaped.insert((SymbolExpr*)pExpr);
+		
+		return;
+	}
+	
+	// Lambda expressions capture the variables they use
+	if (pExpr->getExprType() == Expression::ExprType::LAMBDA)
+	{
+		Expression::SymbolSet uses = pExpr->getSymbolUses();
+		state.escaped.insert(uses.begin(), uses.end());
+		return;
+	}
+	
+	// Operator operands are read without being retained
+	bool subOperandPos = producesFreshObject(pExpr);
+	
+	// Recurse on the sub-expressions
+	Expression::ExprVector subExprs = pExpr->getSubExprs();
+	for (Expression::ExprVector::const_iterator itr = subExprs.begin(); itr != subExprs.end(); ++itr)
+		if (*itr != NULL)
+			findEscapes(*itr, subOperandPos, state);
+}
+
+/***************************************************************
+* Function: findEscapes()
+* Purpose : Gather escape information for a statement sequence
+* Initial : agent on October 18, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+static void findEscapes(const StmtSequence* pStmtSeq, EscapeState& state)
+{
+	// Get a reference to the statement vector
+	const StmtSequence::StmtVector& stmts = pStmtSeq->getStatements();
+	
+	// For each statement
+	for (StmtSequence::StmtVector::const_iterator stmtItr = stmts.begin(); stmtItr != stmts.end(); ++stmtItr)
+	{
+		// Get a pointer to the statement
+		const Statement* pStmt = *stmtItr;
+		
+		// Switch on the statement type
+		switch (pStmt->getStmtType())
+		{
+			// Assignment statement
+			case Statement::ASSIGN:
+			{
+				// Get a typed pointer to the statement
+				const AssignStmt* pAssignStmt = (const AssignStmt*)pStmt;
+				
+				// Count the definitions made by the statement
+				Expression::SymbolSet defs = pAssignStmt->getSymbolDefs();
+				for (Expression::SymbolSet::iterator itr = defs.begin(); itr != defs.end(); ++itr)
+					state.defCounts[*itr] += 1;
+				
+				// Get the left expressions
+				AssignStmt::ExprVector leftExprs = pAssignStmt->getLeftExprs();
+				
+				// If this assigns a fresh object to a single variable, note it
+				if (leftExprs.size() == 1 && leftExprs[0]->getExprType() == Expression::ExprType::SYMBOL &&
+					producesFreshObject(pAssignStmt->getRightExpr()))
+					state.freshDefs[(SymbolExpr*)leftExprs[0]] = pAssignStmt;
+				
+				// Symbols read by indexed left expressions escape
+				for (AssignStmt::ExprVector::iterator itr = leftExprs.begin(); itr != leftExprs.end(); ++itr)
+					if ((*itr)->getExprType() != Expression::ExprType::SYMBOL)
+						findEscapes(*itr, false, state);
+				
+				// Find the escapes in the right expression
+				findEscapes(pAssignStmt->getRightExpr(), false, state);
+				
+				// Note the statement
+				state.stmts.push_back(pStmt);
+			}
+			break;
+			
+			// Expression statement
+			case Statement::EXPR:
+			{
+				// Find the escapes in the expression
+				findEscapes(((const ExprStmt*)pStmt)->getExpression(), false, state);
+				
+				// Note the statement
+				state.stmts.push_back(pStmt);
+			}
+			break;
+			
+			// If-else statement
+			case Statement::IF_ELSE:
+			{
+				// Get a typed pointer to the statement
+				const IfElseStmt* pIfStmt = (const IfElseStmt*)pStmt;
+				
+				// The condition is not a free point, its variables escape
+				Expression::SymbolSet uses = pIfStmt->getCondition()->getSymbolUses();
+				state.escaped.insert(uses.begin(), uses.end());
+				
+				// Process the if and else blocks
+				findEscapes(pIfStmt->getIfBlock(), state);
+				findEscapes(pIfStmt->getElseBlock(), state);
+			}
+			break;
+			
+			// Loop statement
+			case Statement::LOOP:
+			{
+				// Get a typed pointer to the statement
+				const LoopStmt* pLoopStmt = (const LoopStmt*)pStmt;
+				
+				// The index and test variables are read by the loop itself
+				if (pLoopStmt->getIndexVar()) state.escaped.insert(pLoopStmt->getIndexVar());
+				if (pLoopStmt->getTestVar()) state.escaped.insert(pLoopStmt->getTestVar());
+				
+				// Process the loop statement sequences
+				findEscapes(pLoopStmt->getInitSeq(), state);
+				findEscapes(pLoopStmt->getTestSeq(), state);
+				findEscapes(pLoopStmt->getBodySeq(), state);
+				findEscapes(pLoopStmt->getIncrSeq(), state);
+			}
+			break;
+			
+			// Other statement types
+			default:
+			{
+				// Conservatively let any variable used escape
+				Expression::SymbolSet uses = pStmt->getSymbolUses();
+				state.escaped.insert(uses.begin(), uses.end());
+			}
+		}
+	}
+}
+
+/***************************************************************
+* Function: computeEscapeInfo()
+* Purpose : Find where non-escaping temporaries die
+* Initial : agent on October 18, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+AnalysisInfo* computeEscapeInfo(
+	const ProgFunction* pFunction,
+	const StmtSequence* pFuncBody,
+	const TypeSetString& inArgTypes,
+	bool returnBottom
+)
+{
+	// Create a new escape info object
+	EscapeInfo* pEscapeInfo = new EscapeInfo();
+	
+	// If bottom should be returned, return no information
+	if (returnBottom)
+		return pEscapeInfo;
+	
+	// Get the live variable information for the function
+	const LiveVarInfo* pLiveVarInfo = (const LiveVarInfo*)AnalysisManager::requestInfo(
+		&computeLiveVars,
+		pFunction,
+		pFuncBody,
+		inArgTypes
+	);
+	
+	// Gather the definitions and escaping variables
+	EscapeState state;
+	findEscapes(pFuncBody, state);
+	
+	// Parameters are bound outside of the body and outputs are returned
+	const ProgFunction::ParamVector& inParams = pFunction->getInParams();
+	const ProgFunction::ParamVector& outParams = pFunction->getOutParams();
+	state.escaped.insert(inParams.begin(), inParams.end());
+	state.escaped.insert(outParams.begin(), outParams.end());
+	
+	// For each fresh definition
+	for (std::map<const SymbolExpr*, const AssignStmt*>::iterator itr = state.freshDefs.begin(); itr != state.freshDefs.end(); ++itr)
+	{
+		// Temporaries must be defined only once and never escape
+		if (state.defCounts[itr->first] == 1 && state.escaped.find((SymbolExpr*)itr->first) == state.escaped.end())
+			pEscapeInfo->tempDefMap[itr->first] = itr->second;
+	}
+	
+	// For each assignment or expression statement
+	for (std::vector<const Statement*>::iterator stmtItr = state.stmts.begin(); stmtItr != state.stmts.end(); ++stmtItr)
+	{
+		// Get a pointer to the statement
+		const Statement* pStmt = *stmtItr;
+		
+		// Get the live variables after the statement
+		LiveVarMap::const_iterator liveItr = pLiveVarInfo->liveVarMap.find(pStmt);
+		assert (liveItr != pLiveVarInfo->liveVarMap.end());
+		const Expression::SymbolSet& liveSet = liveItr->second;
+		
+		// For each variable used by the statement
+		Expression::SymbolSet uses = pStmt->getSymbolUses();
+		for (Expression::SymbolSet::iterator useItr = uses.begin(); useItr != uses.end(); ++useItr)
+		{
+			// Find the temporary definition for this variable
+			EscapeInfo::TempDefMap::iterator defItr = pEscapeInfo->tempDefMap.find(*useItr);
+			
+			// If this is not a temporary or the statement redefines it, skip it
+			if (defItr == pEscapeInfo->tempDefMap.end() || defItr->second == pStmt)
+				continue;
+			
+			// If the value is dead after this statement, it can be freed here
+			if (liveSet.find(*useItr) == liveSet.end())
+				pEscapeInfo->freeVarMap[pStmt].insert(*useItr);
+		}
+	}
+	
+	// Return the escape info object
+	return pEscapeInfo;
+}
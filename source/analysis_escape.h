@@ -0,0 +1,66 @@
+// =========================================================================== //
+//                                                                             //
+// Copyright 2026 agent.                                                       //
+//                                                                             //
+//   Licensed under the Apache License, Version 2.0 (the "License");           //
+//   you may not use this file except in compliance with the License.          //
+//   You may obtain a copy of the License at                                   //
+//                                                                             //
+//       http://www.apache.org/licenses/LICENSE-2.0                            //
+//                                                                             //
+//   Unless required by applicable law or agreed to in writing, software       //
+//   distributed under the License is distributed on an "AS IS" BASIS,         //
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  //
+//   See the License for the specific language governing permissions and       //
+//  limitations under the License.                                             //
+//                                                                             //
+// =========================================================================== //
+
+
+// Include guards
+#ifndef ANALYSIS_ESCAPE_H_
+#define ANALYSIS_ESCAPE_H_
+
+// Header files
+#include <map>
+#include <unordered_map>
+#include "analysismanager.h"
+#include "expressions.h"
+
+class StmtSequence;
+class IIRNode;
+
+// Dead temporary map type definition
+class TempFreeMap : public std::unordered_map<const IIRNode*, Expression::SymbolSet> {};
+
+/***************************************************************
+* Class   : EscapeInfo
+* Purpose : Store temporary escape/lifetime analysis information
+* Initial : agent on October 18, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+class EscapeInfo : public AnalysisInfo
+{
+public:
+	
+	// Variables whose value dies at each statement, if they
+	// still hold the value produced by their definition
+	TempFreeMap freeVarMap;
+	
+	// Temporary definition map type definition
+	typedef std::map<const SymbolExpr*, const AssignStmt*> TempDefMap;
+	
+	// Definitions producing values that never escape
+	TempDefMap tempDefMap;
+};
+
+// Function to compute the escape information for a function body
+AnalysisInfo* computeEscapeInfo(
+	const ProgFunction* pFunction,
+	const StmtSequence* pFuncBody,
+	const TypeSetString& inArgTypes,
+	bool returnBottom
+);
+
+#endif // #ifndef ANALYSIS_ESCAPE_H_
@@ -32,20 +32,26 @@
 #include "profiling.h"
 #include "dotexpr.h"
 #include "paramexpr.h"
+#include "assignstmt.h"
+#include "typefeedback.h"
+
+// Type inference info receiving the speculated types, if speculating
+static TypeInferInfo* s_pSpecInfo = NULL;
 
 
 /***************************************************************
-* Function: computeTypeInfo(ProgFunction, ...)
+* Function: inferFuncTypes()
 * Purpose : Perform type inference on a function body
-* Initial : Maxime Chevalier-Boisvert on April 17, 2009
+* Initial : agent on October 18, 2026
 ****************************************************************
 Revisions and bug fixes:
 */
-AnalysisInfo* computeTypeInfo(
+static TypeInferInfo* inferFuncTypes(
     const ProgFunction* pFunction,
     const StmtSequence* pFuncBody,
     const TypeSetString& inArgTypes,
-    bool returnBottom
+    bool returnBottom,
+    bool speculate
 )
 {
     // Create a type inference info object
@@ -118,6 +124,10 @@ AnalysisInfo* computeTypeInfo(
     TypeMapVector breakPoints;
     TypeMapVector contPoints;
 
+    // Speculate in this function body only, not in the callees analyzed
+    TypeInferInfo* pOuterSpecInfo = s_pSpecInfo;
+    s_pSpecInfo = speculate? pTypeInferInfo:NULL;
+
     // Perform type inference on the function body
     inferTypes(
         pFuncBody,
@@ -134,6 +144,9 @@ AnalysisInfo* computeTypeInfo(
         pTypeInferInfo->exprTypeMap
     );
 
+    // Restore the speculation state of the enclosing analysis
+    s_pSpecInfo = pOuterSpecInfo;
+
     // Ensure that there are no unmatched break or continue points
     assert (breakPoints.empty() && contPoints.empty());
 
@@ -178,6 +191,92 @@ AnalysisInfo* computeTypeInfo(
     return pTypeInferInfo;
 }
 
+/***************************************************************
+* Function: computeTypeInfo(ProgFunction, ...)
+* Purpose : Perform type inference on a function body
+* Initial : Maxime Chevalier-Boisvert on April 17, 2009
+****************************************************************
+Revisions and bug fixes:
+*/
+AnalysisInfo* computeTypeInfo(
+    const ProgFunction* pFunction,
+    const StmtSequence* pFuncBody,
+    const TypeSetString& inArgTypes,
+    bool returnBottom
+)
+{
+    // Infer the types without speculating
+    return inferFuncTypes(pFunction, pFuncBody, inArgTypes, returnBottom, false);
+}
+
+/***************************************************************
+* Function: computeSpecTypeInfo(ProgFunction, ...)
+* Purpose : Perform type inference on a function body, using
+*           type feedback for the values of unknown types
+* Initial : agent on October 18, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+AnalysisInfo* computeSpecTypeInfo(
+    const ProgFunction* pFunction,
+    const StmtSequence* pFuncBody,
+    const TypeSetString& inArgTypes,
+    bool returnBottom
+)
+{
+    // Infer the types, speculating where type feedback is available
+    return inferFuncTypes(pFunction, pFuncBody, inArgTypes, returnBottom, true);
+}
+
+/***************************************************************
+* Function: speculateTypes()
+* Purpose : Speculate on the type of an assigned value
+* Initial : agent on October 18, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+static void speculateTypes(
+    const AssignStmt* pAssignStmt,
+    TypeSetString& typeSetStr
+)
+{
+    // Get the left and right expressions
+    const AssignStmt::ExprVector& leftExprs = pAssignStmt->getLeftExprs();
+    const Expression* pRightExpr = pAssignStmt->getRightExpr();
+    Expression::ExprType rightType = pRightExpr->getExprType();
+
+    // Only values assigned to a variable by compiled code can be guarded
+    // Note: unsuppressed assignments are executed by the interpreter
+    if (leftExprs.size() != 1 || leftExprs[0]->getExprType() != Expression::ExprType::SYMBOL ||
+        pAssignStmt->getSuppressFlag() == false ||
+        (rightType != Expression::ExprType::DOT && rightType != Expression::ExprType::CELL_INDEX &&
+         rightType != Expression::ExprType::PARAM))
+        return;
+
+    // If the type of the value is known, there is nothing to speculate on
+    if (typeSetStr.empty() == false && typeSetStr[0].size() == 1)
+    {
+        s_pSpecInfo->feedbackSites.erase(pRightExpr);
+        s_pSpecInfo->specTypes.erase(pRightExpr);
+        return;
+    }
+
+    // Type feedback is useful for this expression
+    s_pSpecInfo->feedbackSites.insert(pRightExpr);
+
+    // If a stable type was observed for the value, assume it
+    TypeInfo specType;
+    if (TypeFeedback::getSpecType(pRightExpr, specType))
+    {
+        s_pSpecInfo->specTypes[pRightExpr] = specType;
+        typeSetStr = typeSetStrMake(specType);
+    }
+    else
+    {
+        s_pSpecInfo->specTypes.erase(pRightExpr);
+    }
+}
+
 /***************************************************************
 * Function: inferTypes(StmtSequence, ...)
 * Purpose : Perform type inference on a statement sequence
@@ -922,6 +1021,9 @@ TypeSet inferTypesRecursive(
 * Initial : Maxime Chevalier-Boisvert on April 20, 2009
 ****************************************************************
 Revisions and bug fixes:
+
+agent on October 18, 2026
+Values of unknown types may be given speculated types.
 */
 void inferTypes(
     const AssignStmt* pAssignStmt,
@@ -945,6 +1047,10 @@ void inferTypes(
         exprTypeMap
     );
 
+    // If speculating, assume the observed type of a value of unknown type
+    if (s_pSpecInfo != NULL)
+        speculateTypes(pAssignStmt, typeSetStr);
+
     // Get the vector of left-side expressions
     const AssignStmt::ExprVector& leftExprs = pAssignStmt->getLeftExprs();
 
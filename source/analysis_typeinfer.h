@@ -67,12 +67,18 @@ typedef std::unordered_map<const IIRNode*, VarTypeMap > TypeInfoMap;
 //typedef std::map<const Expression*, TypeSetString> ExprTypeMap;
 typedef std::unordered_map<const Expression*, TypeSetString > ExprTypeMap;
 
+// Speculated type map type definition
+typedef std::map<const Expression*, TypeInfo> SpecTypeMap;
+
 /***************************************************************
 * Class   : TypeInferInfo
 * Purpose : Store type inference analysis information
 * Initial : Maxime Chevalier-Boisvert on May 5, 2009
 ****************************************************************
 Revisions and bug fixes:
+
+agent on October 18, 2026
+Added the speculated assignment types.
 */
 class TypeInferInfo : public AnalysisInfo
 {
@@ -92,6 +98,12 @@ public:
 	
 	// Map of possible expression types
 	ExprTypeMap exprTypeMap;
+	
+	// Assigned expressions whose value types are unknown
+	std::set<const Expression*> feedbackSites;
+	
+	// Types speculated from type feedback for assigned expressions
+	SpecTypeMap specTypes;
 };
 
 // Function to perform type inference on a function body
@@ -102,6 +114,14 @@ AnalysisInfo* computeTypeInfo(
 	bool returnBottom
 );
 
+// Function to perform type inference on a function body, speculating on type feedback
+AnalysisInfo* computeSpecTypeInfo(
+	const ProgFunction* pFunction,
+	const StmtSequence* pFuncBody,
+	const TypeSetString& inArgTypes,
+	bool returnBottom
+);
+
 // Function to perform type inference on a statement sequence
 void inferTypes(
 	const StmtSequence* pStmtSeq,
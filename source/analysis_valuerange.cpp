@@ -0,0 +1,889 @@
+// =========================================================================== //
+//                                                                             //
+// Copyright 2026 agent.                                                       //
+//                                                                             //
+//   Licensed under the Apache License, Version 2.0 (the "License");           //
+//   you may not use this file except in compliance with the License.          //
+//   You may obtain a copy of the License at                                   //
+//                                                                             //
+//       http://www.apache.org/licenses/LICENSE-2.0                            //
+//                                                                             //
+//   Unless required by applicable law or agreed to in writing, software       //
+//   distributed under the License is distributed on an "AS IS" BASIS,         //
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  //
+//   See the License for the specific language governing permissions and       //
+//  limitations under the License.                                             //
+//                                                                             //
+// =========================================================================== //
+
+
+// Header files
+#include <cassert>
+#include <cmath>
+#include "analysis_valuerange.h"
+#include "analysis_typeinfer.h"
+#include "functions.h"
+#include "stmtsequence.h"
+#include "assignstmt.h"
+#include "exprstmt.h"
+#include "ifelsestmt.h"
+#include "loopstmts.h"
+#include "paramexpr.h"
+#include "binaryopexpr.h"
+#include "constexprs.h"
+#include "symbolexpr.h"
+
+// Maximum number of definitions followed when evaluating a value
+const size_t MAX_EVAL_DEPTH = 8;
+
+// Largest constant offset tracked, to avoid any overflow
+const int64 MAX_OFFSET = int64(1) << 30;
+
+// Position of a statement in a sequence of the function body
+struct SeqFrame
+{
+	// Statement sequence and index of the current statement in it
+	const StmtSequence* pSeq;
+	size_t pos;
+
+	// Loop whose iterations repeat this sequence (NULL if none)
+	const LoopStmt* pLoop;
+};
+
+// Path from the function body to a statement
+typedef std::vector<SeqFrame> SeqPath;
+
+// Value range analysis state
+struct RangeState
+{
+	// Type inference information for the function
+	const TypeInferInfo* pTypeInferInfo;
+
+	// Variables of the function (parameters and defined symbols)
+	Expression::SymbolSet variables;
+
+	// Analysis information being computed
+	ValueRangeInfo* pInfo;
+};
+
+// Context of the evaluation of loop bounds
+struct EvalContext
+{
+	// Loop whose bounds are evaluated and its position (NULL for index values)
+	const LoopStmt* pLoop;
+	const SeqPath* pLoopPath;
+
+	// Shallowest sequence in which definitions may be looked up
+	size_t minLevel;
+};
+
+/***************************************************************
+* Function: findSymbolDef()
+* Purpose : Find the definition of a symbol reaching a position
+* Initial : agent on October 18, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+static const Statement* findSymbolDef(const SymbolExpr* pSymbol, SeqPath& path, size_t minLevel)
+{
+	// Until the definition is found
+	for (;;)
+	{
+		// Get the innermost sequence of the path
+		SeqFrame& frame = path.back();
+		const StmtSequence::StmtVector& stmts = frame.pSeq->getStatements();
+
+		// For each statement preceding the current position
+		while (frame.pos > 0)
+		{
+			// Move to the preceding statement
+			--frame.pos;
+			const Statement* pStmt = stmts[frame.pos];
+
+			// If this statement defines the symbol, it is the reaching definition
+			Expression::SymbolSet defs = pStmt->getSymbolDefs();
+			if (defs.find((SymbolExpr*)pSymbol) != defs.end())
+				return pStmt;
+		}
+
+		// Do not look past the shallowest allowed sequence
+		if (path.size() <= minLevel + 1)
+			return NULL;
+
+		// If the sequence is repeated by a loop which defines the symbol,
+		// a later definition may reach the position through the back edge
+		if (frame.pLoop != NULL)
+		{
+			Expression::SymbolSet loopDefs = frame.pLoop->getSymbolDefs();
+			if (loopDefs.find((SymbolExpr*)pSymbol) != loopDefs.end())
+				return NULL;
+		}
+
+		// Continue in the enclosing sequence, before the current statement
+		path.pop_back();
+	}
+}
+
+/***************************************************************
+* Function: mayResize()
+* Purpose : Test if a statement may shrink or replace an array
+* Initial : agent on October 18, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+static bool mayResize(const StmtSequence* pSeq, const SymbolExpr* pArray, const RangeState& state);
+static bool mayResize(const Statement* pStmt, const SymbolExpr* pArray, const RangeState& state)
+{
+	// If the statement does not define the array, it cannot resize it
+	Expression::SymbolSet defs = pStmt->getSymbolDefs();
+	if (defs.find((SymbolExpr*)pArray) == defs.end())
+		return false;
+
+	// Switch on the statement type
+	switch (pStmt->getStmtType())
+	{
+		// Assignment statement
+		case Statement::ASSIGN:
+		{
+			// Get a typed pointer to the statement
+			const AssignStmt* pAssignStmt = (const AssignStmt*)pStmt;
+			Expression::ExprVector leftExprs = pAssignStmt->getLeftExprs();
+
+			// Only single indexed assignments can leave the array in place
+			if (leftExprs.size() != 1 || leftExprs[0]->getExprType() != Expression::ExprType::PARAM ||
+				((ParamExpr*)leftExprs[0])->getExpr() != pArray)
+				return true;
+
+			// Get the type of the assigned value
+			Expression* pRightExpr = pAssignStmt->getRightExpr();
+			TypeSet rightTypes;
+			if (pRightExpr->getExprType() == Expression::ExprType::SYMBOL)
+			{
+				TypeInfoMap::const_iterator stmtTypeItr = state.pTypeInferInfo->preTypeMap.find(pStmt);
+				assert (stmtTypeItr != state.pTypeInferInfo->preTypeMap.end());
+				VarTypeMap::const_iterator typeItr = stmtTypeItr->second.find((SymbolExpr*)pRightExpr);
+				if (typeItr != stmtTypeItr->second.end())
+					rightTypes = typeItr->second;
+			}
+			else
+			{
+				ExprTypeMap::const_iterator typeItr = state.pTypeInferInfo->exprTypeMap.find(pRightExpr);
+				if (typeItr != state.pTypeInferInfo->exprTypeMap.end() && typeItr->second.size() == 1)
+					rightTypes = typeItr->second[0];
+			}
+
+			// Scalar writes may only grow the array, others may shrink it (e.g.: a(i) = [])
+			return !(rightTypes.size() == 1 && rightTypes.begin()->isScalar());
+		}
+
+		// If-else statement
+		case Statement::IF_ELSE:
+		{
+			// Get a typed pointer to the statement
+			const IfElseStmt* pIfStmt = (const IfElseStmt*)pStmt;
+
+			// Test both branches
+			return mayResize(pIfStmt->getIfBlock(), pArray, state) || mayResize(pIfStmt->getElseBlock(), pArray, state);
+		}
+
+		// Loop statement
+		case Statement::LOOP:
+		{
+			// Get a typed pointer to the statement
+			const LoopStmt* pLoopStmt = (const LoopStmt*)pStmt;
+
+			// Test all the loop sequences
+			return
+				mayResize(pLoopStmt->getInitSeq(), pArray, state) ||
+				mayResize(pLoopStmt->getTestSeq(), pArray, state) ||
+				mayResize(pLoopStmt->getBodySeq(), pArray, state) ||
+				mayResize(pLoopStmt->getIncrSeq(), pArray, state);
+		}
+
+		// Other statements may redefine the array
+		default:
+		return true;
+	}
+}
+static bool mayResize(const StmtSequence* pSeq, const SymbolExpr* pArray, const RangeState& state)
+{
+	// Get the statements of the sequence
+	const StmtSequence::StmtVector& stmts = pSeq->getStatements();
+
+	// Test each statement of the sequence
+	for (size_t i = 0; i < stmts.size(); ++i)
+		if (mayResize(stmts[i], pArray, state))
+			return true;
+
+	// The array cannot be resized
+	return false;
+}
+
+/***************************************************************
+* Function: isArrayStable()
+* Purpose : Test that the size of an array read at some point
+*           still bounds its size when the loop executes
+* Initial : agent on October 18, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+static bool isArrayStable(const SymbolExpr* pArray, const SeqPath& evalPath, const EvalContext& context, const RangeState& state)
+{
+	// Get the path of the loop
+	const SeqPath& loopPath = *context.pLoopPath;
+
+	// The evaluation path is a prefix of the loop path
+	size_t evalLevel = evalPath.size() - 1;
+	assert (evalLevel < loopPath.size() && evalPath[evalLevel].pSeq == loopPath[evalLevel].pSeq);
+
+	// For each sequence from the evaluation point to the loop
+	for (size_t level = evalLevel; level < loopPath.size(); ++level)
+	{
+		// Get the statements of this sequence
+		const SeqFrame& frame = loopPath[level];
+		const StmtSequence::StmtVector& stmts = frame.pSeq->getStatements();
+
+		// If this sequence is repeated by a loop entered after the
+		// evaluation point, the whole loop must preserve the array
+		if (level > evalLevel && frame.pLoop != NULL && mayResize(frame.pLoop, pArray, state))
+			return false;
+
+		// The statements executed before the loop must preserve the array
+		size_t startPos = (level == evalLevel)? (evalPath[level].pos + 1):0;
+		for (size_t i = startPos; i < frame.pos && i < stmts.size(); ++i)
+			if (mayResize(stmts[i], pArray, state))
+				return false;
+	}
+
+	// The loop test, body and incrementation may only grow the array
+	return
+		mayResize(context.pLoop->getTestSeq(), pArray, state) == false &&
+		mayResize(context.pLoop->getBodySeq(), pArray, state) == false &&
+		mayResize(context.pLoop->getIncrSeq(), pArray, state) == false;
+}
+
+/***************************************************************
+* Function: getConstValue()
+* Purpose : Get the value of an integer-valued constant
+* Initial : agent on October 18, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+static bool getConstValue(const Expression* pExpr, int64& value)
+{
+	// If this is an integer constant
+	if (pExpr->getExprType() == Expression::ExprType::INT_CONST)
+	{
+		value = ((const IntConstExpr*)pExpr)->getValue();
+		return value > -MAX_OFFSET && value < MAX_OFFSET;
+	}
+
+	// If this is a floating-point constant with an integer value
+	if (pExpr->getExprType() == Expression::ExprType::FP_CONST)
+	{
+		float64 fpValue = ((const FPConstExpr*)pExpr)->getValue();
+		if (fpValue <= -MAX_OFFSET || fpValue >= MAX_OFFSET || std::floor(fpValue) != fpValue)
+			return false;
+		value = (int64)fpValue;
+		return true;
+	}
+
+	// Other expressions are not constants
+	return false;
+}
+
+/***************************************************************
+* Function: evalSizeQuery()
+* Purpose : Evaluate a query of the size of an array
+* Initial : agent on October 18, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+static bool evalSizeQuery(
+	const ParamExpr* pParamExpr,
+	size_t outIndex,
+	size_t numOuts,
+	const SeqPath& path,
+	const EvalContext& context,
+	const RangeState& state,
+	SymValue& value
+)
+{
+	// Array sizes are only tracked for loop bounds
+	if (context.pLoop == NULL)
+		return false;
+
+	// The function must be a library function applied to an array variable
+	const ParamExpr::ExprVector& args = pParamExpr->getArguments();
+	if (pParamExpr->getExpr()->getExprType() != Expression::ExprType::SYMBOL ||
+		state.variables.find((SymbolExpr*)pParamExpr->getExpr()) != state.variables.end() ||
+		args.empty() || args[0]->getExprType() != Expression::ExprType::SYMBOL ||
+		state.variables.find((SymbolExpr*)args[0]) == state.variables.end())
+		return false;
+
+	// Get the function name and the array variable
+	const std::string& funcName = ((SymbolExpr*)pParamExpr->getExpr())->getSymName();
+	value.pArray = (SymbolExpr*)args[0];
+	value.offset = 0;
+
+	// Identify the queried size
+	int64 dimIndex = 0;
+	if (funcName == "numel" && args.size() == 1 && numOuts == 1)
+	{
+		value.kind = SymValue::NUMEL;
+		value.dim = 0;
+	}
+	else if (funcName == "length" && args.size() == 1 && numOuts == 1)
+	{
+		value.kind = SymValue::LENGTH;
+		value.dim = 0;
+	}
+	else if (funcName == "size" && args.size() == 2 && numOuts == 1 && getConstValue(args[1], dimIndex) && dimIndex >= 1)
+	{
+		value.kind = SymValue::SIZE;
+		value.dim = dimIndex - 1;
+	}
+	else if (funcName == "size" && args.size() == 1 && numOuts >= 2)
+	{
+		// The last output is the product of the remaining dimension sizes
+		value.kind = (outIndex + 1 < numOuts)? SymValue::SIZE:SymValue::TRAILING;
+		value.dim = outIndex;
+	}
+	else
+	{
+		return false;
+	}
+
+	// The array must not shrink before or during the loop
+	return isArrayStable(value.pArray, path, context, state);
+}
+
+/***************************************************************
+* Function: evalExpr()
+* Purpose : Evaluate an expression as a symbolic value
+* Initial : agent on October 18, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+static bool evalExpr(
+	const Expression* pExpr,
+	const SeqPath& path,
+	const EvalContext& context,
+	const RangeState& state,
+	size_t depth,
+	SymValue& value
+)
+{
+	// Switch on the expression type
+	switch (pExpr->getExprType())
+	{
+		// Numerical constants
+		case Expression::ExprType::INT_CONST:
+		case Expression::ExprType::FP_CONST:
+		{
+			value.kind = SymValue::CONSTANT;
+			value.pArray = NULL;
+			value.dim = 0;
+			return getConstValue(pExpr, value.offset);
+		}
+
+		// Symbols are evaluated at their definition
+		case Expression::ExprType::SYMBOL:
+		{
+			// Limit the number of definitions followed
+			if (depth == 0)
+				return false;
+
+			// Find the definition reaching this position
+			SeqPath defPath = path;
+			const Statement* pDefStmt = findSymbolDef((const SymbolExpr*)pExpr, defPath, context.minLevel);
+			if (pDefStmt == NULL || pDefStmt->getStmtType() != Statement::ASSIGN)
+				return false;
+
+			// Find the symbol among the assigned expressions
+			const AssignStmt* pAssignStmt = (const AssignStmt*)pDefStmt;
+			Expression::ExprVector leftExprs = pAssignStmt->getLeftExprs();
+			size_t outIndex = 0;
+			while (outIndex < leftExprs.size() && leftExprs[outIndex] != pExpr)
+				++outIndex;
+			if (outIndex == leftExprs.size())
+				return false;
+
+			// If this is a single assignment, evaluate the assigned expression
+			if (leftExprs.size() == 1)
+				return evalExpr(pAssignStmt->getRightExpr(), defPath, context, state, depth - 1, value);
+
+			// Otherwise, only multiple size outputs are supported
+			if (pAssignStmt->getRightExpr()->getExprType() != Expression::ExprType::PARAM)
+				return false;
+			return evalSizeQuery((const ParamExpr*)pAssignStmt->getRightExpr(), outIndex, leftExprs.size(), defPath, context, state, value);
+		}
+
+		// Array size queries
+		case Expression::ExprType::PARAM:
+		return evalSizeQuery((const ParamExpr*)pExpr, 0, 1, path, context, state, value);
+
+		// Additions and subtractions of constants
+		case Expression::ExprType::BINARY_OP:
+		{
+			// Get a typed pointer to the expression
+			const BinaryOpExpr* pBinOpExpr = (const BinaryOpExpr*)pExpr;
+
+			// Only additions and subtractions are supported
+			if (pBinOpExpr->getOperator() != BinaryOpExpr::PLUS && pBinOpExpr->getOperator() != BinaryOpExpr::MINUS)
+				return false;
+
+			// Evaluate both operands
+			SymValue leftVal;
+			SymValue rightVal;
+			if (!evalExpr(pBinOpExpr->getLeftExpr(), path, context, state, depth, leftVal) ||
+				!evalExpr(pBinOpExpr->getRightExpr(), path, context, state, depth, rightVal))
+				return false;
+
+			// If this is a subtraction, the right operand must be constant
+			if (pBinOpExpr->getOperator() == BinaryOpExpr::MINUS)
+			{
+				if (rightVal.kind != SymValue::CONSTANT)
+					return false;
+				value = leftVal;
+				value.offset = leftVal.offset - rightVal.offset;
+			}
+
+			// Otherwise, one of the operands must be constant
+			else
+			{
+				if (leftVal.kind != SymValue::CONSTANT && rightVal.kind != SymValue::CONSTANT)
+					return false;
+				value = (leftVal.kind != SymValue::CONSTANT)? leftVal:rightVal;
+				value.offset = leftVal.offset + rightVal.offset;
+			}
+
+			// Ensure the offset remains in the tracked range
+			return value.offset > -MAX_OFFSET && value.offset < MAX_OFFSET;
+		}
+
+		// Other expressions are not evaluated
+		default:
+		return false;
+	}
+}
+
+/***************************************************************
+* Function: getIndexOffset()
+* Purpose : Express an index as the loop index plus a constant
+* Initial : agent on October 18, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+static bool getIndexOffset(
+	const Expression* pExpr,
+	const SeqPath& path,
+	const InductionVar& indVar,
+	size_t bodyLevel,
+	const RangeState& state,
+	size_t depth,
+	int64& offset
+)
+{
+	// Constant offsets may be defined anywhere before the access
+	EvalContext constContext = { NULL, NULL, 0 };
+
+	// If this is a symbol
+	if (pExpr->getExprType() == Expression::ExprType::SYMBOL)
+	{
+		// If this is the loop index or the loop variable
+		if (pExpr == indVar.pIndexVar || pExpr == indVar.pLoopVar)
+		{
+			offset = 0;
+			return true;
+		}
+
+		// Limit the number of definitions followed
+		if (depth == 0)
+			return false;
+
+		// Find the definition reaching this position in the current loop iteration
+		SeqPath defPath = path;
+		const Statement* pDefStmt = findSymbolDef((const SymbolExpr*)pExpr, defPath, bodyLevel);
+		if (pDefStmt == NULL || pDefStmt->getStmtType() != Statement::ASSIGN ||
+			((const AssignStmt*)pDefStmt)->getLeftExprs().size() != 1)
+			return false;
+
+		// Express the assigned value as an offset from the loop index
+		return getIndexOffset(((const AssignStmt*)pDefStmt)->getRightExpr(), defPath, indVar, bodyLevel, state, depth - 1, offset);
+	}
+
+	// Otherwise, the index must be an addition or subtraction
+	if (pExpr->getExprType() != Expression::ExprType::BINARY_OP)
+		return false;
+	const BinaryOpExpr* pBinOpExpr = (const BinaryOpExpr*)pExpr;
+
+	// Declare values for the index offset and the constant operand
+	int64 indexOffset = 0;
+	SymValue constVal;
+
+	// Handle the i + c, c + i and i - c forms
+	if (pBinOpExpr->getOperator() == BinaryOpExpr::PLUS &&
+		evalExpr(pBinOpExpr->getRightExpr(), path, constContext, state, depth, constVal) &&
+		getIndexOffset(pBinOpExpr->getLeftExpr(), path, indVar, bodyLevel, state, depth, indexOffset))
+		offset = indexOffset + constVal.offset;
+	else if (pBinOpExpr->getOperator() == BinaryOpExpr::PLUS &&
+		evalExpr(pBinOpExpr->getLeftExpr(), path, constContext, state, depth, constVal) &&
+		getIndexOffset(pBinOpExpr->getRightExpr(), path, indVar, bodyLevel, state, depth, indexOffset))
+		offset = indexOffset + constVal.offset;
+	else if (pBinOpExpr->getOperator() == BinaryOpExpr::MINUS &&
+		evalExpr(pBinOpExpr->getRightExpr(), path, constContext, state, depth, constVal) &&
+		getIndexOffset(pBinOpExpr->getLeftExpr(), path, indVar, bodyLevel, state, depth, indexOffset))
+		offset = indexOffset - constVal.offset;
+	else
+		return false;
+
+	// Ensure the offset remains in the tracked range
+	return offset > -MAX_OFFSET && offset < MAX_OFFSET;
+}
+
+/***************************************************************
+* Function: getInductionVar()
+* Purpose : Compute the value range of a loop index
+* Initial : agent on October 18, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+static bool getInductionVar(const LoopStmt* pLoopStmt, const SeqPath& loopPath, const RangeState& state, InductionVar& indVar)
+{
+	// The loop must have an index variable
+	indVar.pIndexVar = pLoopStmt->getIndexVar();
+	indVar.pLoopVar = NULL;
+	if (indVar.pIndexVar == NULL)
+		return false;
+
+	// Get the test and incrementation statements
+	const StmtSequence::StmtVector& testStmts = pLoopStmt->getTestSeq()->getStatements();
+	const StmtSequence::StmtVector& incrStmts = pLoopStmt->getIncrSeq()->getStatements();
+
+	// The test and incrementation must each be a single assignment
+	if (testStmts.size() != 1 || testStmts[0]->getStmtType() != Statement::ASSIGN ||
+		incrStmts.size() != 1 || incrStmts[0]->getStmtType() != Statement::ASSIGN)
+		return false;
+
+	// Get the right expressions of the test and incrementation statements
+	const Expression* pTestExpr = ((AssignStmt*)testStmts[0])->getRightExpr();
+	const Expression* pIncrExpr = ((AssignStmt*)incrStmts[0])->getRightExpr();
+
+	// The test must be of the form i <= end and the incrementation of the form i = i + step
+	if (pTestExpr->getExprType() != Expression::ExprType::BINARY_OP ||
+		pIncrExpr->getExprType() != Expression::ExprType::BINARY_OP)
+		return false;
+	const BinaryOpExpr* pTestOp = (const BinaryOpExpr*)pTestExpr;
+	const BinaryOpExpr* pIncrOp = (const BinaryOpExpr*)pIncrExpr;
+	Expression::ExprVector incrLeftExprs = ((AssignStmt*)incrStmts[0])->getLeftExprs();
+	if (pTestOp->getOperator() != BinaryOpExpr::LESS_THAN_EQ ||
+		pTestOp->getLeftExpr() != indVar.pIndexVar ||
+		pIncrOp->getOperator() != BinaryOpExpr::PLUS ||
+		pIncrOp->getLeftExpr() != indVar.pIndexVar ||
+		incrLeftExprs.size() != 1 || incrLeftExprs[0] != indVar.pIndexVar)
+		return false;
+
+	// Get the symbols defined by the test sequence and the loop body
+	Expression::SymbolSet iterDefs = pLoopStmt->getTestSeq()->getSymbolDefs();
+	Expression::SymbolSet bodyDefs = pLoopStmt->getBodySeq()->getSymbolDefs();
+	iterDefs.insert(bodyDefs.begin(), bodyDefs.end());
+
+	// The index must only be updated by the incrementation
+	if (iterDefs.find((SymbolExpr*)indVar.pIndexVar) != iterDefs.end())
+		return false;
+
+	// The start, step and end values are evaluated after the initialization sequence
+	SeqPath initPath = loopPath;
+	SeqFrame initFrame = { pLoopStmt->getInitSeq(), pLoopStmt->getInitSeq()->getStatements().size(), NULL };
+	initPath.push_back(initFrame);
+	EvalContext context = { pLoopStmt, &initPath, 0 };
+
+	// The step must be a positive integer constant which is not redefined
+	SymValue stepVal;
+	const Expression* pStepExpr = pIncrOp->getRightExpr();
+	if ((pStepExpr->getExprType() == Expression::ExprType::SYMBOL && iterDefs.find((SymbolExpr*)pStepExpr) != iterDefs.end()) ||
+		evalExpr(pStepExpr, initPath, context, state, MAX_EVAL_DEPTH, stepVal) == false ||
+		stepVal.kind != SymValue::CONSTANT || stepVal.offset < 1)
+		return false;
+
+	// Evaluate the lowest index value
+	indVar.hasLower = evalExpr(indVar.pIndexVar, initPath, context, state, MAX_EVAL_DEPTH, indVar.lower);
+
+	// Evaluate the highest index value, if the end value is not redefined
+	const Expression* pEndExpr = pTestOp->getRightExpr();
+	indVar.hasUpper =
+		!(pEndExpr->getExprType() == Expression::ExprType::SYMBOL && iterDefs.find((SymbolExpr*)pEndExpr) != iterDefs.end()) &&
+		evalExpr(pEndExpr, initPath, context, state, MAX_EVAL_DEPTH, indVar.upper);
+
+	// With an integer start and step, the index only takes integer values
+	indVar.isIntegral = indVar.hasLower;
+
+	// Get the first statement of the body
+	const StmtSequence::StmtVector& bodyStmts = pLoopStmt->getBodySeq()->getStatements();
+	const Statement* pFirstStmt = bodyStmts.empty()? NULL:bodyStmts[0];
+
+	// If the body starts by copying the index to the loop variable
+	if (pFirstStmt != NULL && pFirstStmt->getStmtType() == Statement::ASSIGN &&
+		((AssignStmt*)pFirstStmt)->getLeftExprs().size() == 1 &&
+		((AssignStmt*)pFirstStmt)->getLeftExprs()[0]->getExprType() == Expression::ExprType::SYMBOL &&
+		((AssignStmt*)pFirstStmt)->getRightExpr() == indVar.pIndexVar)
+	{
+		// Get the loop variable
+		const SymbolExpr* pLoopVar = (SymbolExpr*)((AssignStmt*)pFirstStmt)->getLeftExprs()[0];
+
+		// The loop variable takes the index values if nothing else redefines it
+		bool redefined = false;
+		for (size_t i = 1; i < bodyStmts.size() && !redefined; ++i)
+		{
+			Expression::SymbolSet defs = bodyStmts[i]->getSymbolDefs();
+			redefined = defs.find((SymbolExpr*)pLoopVar) != defs.end();
+		}
+		if (!redefined)
+			indVar.pLoopVar = pLoopVar;
+	}
+
+	// The induction variable was identified
+	return true;
+}
+
+/***************************************************************
+* Function: isUpperBound()
+* Purpose : Test if an array size bounds an index
+* Initial : agent on October 18, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+static bool isUpperBound(const SymValue& bound, const SymbolExpr* pArray, size_t dim, size_t numIndices)
+{
+	// The bound must be a size of the indexed array
+	if (bound.kind == SymValue::CONSTANT || bound.pArray != pArray)
+		return false;
+
+	// A single index is bounded by the element count (the length
+	// never exceeds it, and both are zero for empty arrays)
+	if (numIndices == 1)
+		return bound.kind == SymValue::NUMEL || bound.kind == SymValue::LENGTH;
+
+	// The first of two indices is bounded by the row count
+	if (dim == 0)
+		return bound.kind == SymValue::SIZE && bound.dim == 0;
+
+	// The last of two indices is bounded by the column count, or by the
+	// product of the trailing dimension sizes
+	return (bound.kind == SymValue::SIZE || bound.kind == SymValue::TRAILING) && bound.dim == 1;
+}
+
+/***************************************************************
+* Function: findSafeIndices()
+* Purpose : Find the array accesses in a loop body whose indices
+*           are bounded by the range of the loop index
+* Initial : agent on October 18, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+static void findSafeIndices(const Expression* pExpr, const SeqPath& path, const InductionVar& indVar, size_t bodyLevel, RangeState& state)
+{
+	// If this is an access with one or two indices into an array variable
+	if (pExpr->getExprType() == Expression::ExprType::PARAM &&
+		((const ParamExpr*)pExpr)->getExpr()->getExprType() == Expression::ExprType::SYMBOL &&
+		state.variables.find((SymbolExpr*)((const ParamExpr*)pExpr)->getExpr()) != state.variables.end() &&
+		((const ParamExpr*)pExpr)->getArguments().size() >= 1 &&
+		((const ParamExpr*)pExpr)->getArguments().size() <= 2)
+	{
+		// Get a typed pointer to the expression
+		const ParamExpr* pParamExpr = (const ParamExpr*)pExpr;
+		const ParamExpr::ExprVector& args = pParamExpr->getArguments();
+		const SymbolExpr* pArray = (const SymbolExpr*)pParamExpr->getExpr();
+
+		// Get the proved indices of this access
+		std::vector<bool>& safeIndices = state.pInfo->safeIndexMap[pParamExpr];
+		safeIndices.resize(args.size(), false);
+
+		// For each index
+		for (size_t i = 0; i < args.size(); ++i)
+		{
+			// Express the index as an offset from the loop index
+			int64 offset;
+			if (!getIndexOffset(args[i], path, indVar, bodyLevel, state, MAX_EVAL_DEPTH, offset))
+				continue;
+
+			// The index is safe if the index range shifted by the offset lies within the array
+			if (indVar.hasLower && indVar.lower.kind == SymValue::CONSTANT && indVar.lower.offset + offset >= 1 &&
+				indVar.hasUpper && isUpperBound(indVar.upper, pArray, i, args.size()) && indVar.upper.offset + offset <= 0)
+				safeIndices[i] = true;
+		}
+	}
+
+	// Find the safe indices in the sub-expressions
+	Expression::ExprVector subExprs = pExpr->getSubExprs();
+	for (size_t i = 0; i < subExprs.size(); ++i)
+		if (subExprs[i] != NULL)
+			findSafeIndices(subExprs[i], path, indVar, bodyLevel, state);
+}
+static void findSafeIndices(const StmtSequence* pSeq, const LoopStmt* pSeqLoop, SeqPath& path, const InductionVar& indVar, size_t bodyLevel, RangeState& state)
+{
+	// Add this sequence to the path
+	SeqFrame frame = { pSeq, 0, pSeqLoop };
+	path.push_back(frame);
+
+	// For each statement in the sequence
+	const StmtSequence::StmtVector& stmts = pSeq->getStatements();
+	for (size_t i = 0; i < stmts.size(); ++i)
+	{
+		// Update the current position
+		path.back().pos = i;
+		const Statement* pStmt = stmts[i];
+
+		// Switch on the statement type
+		switch (pStmt->getStmtType())
+		{
+			// Assignment statement
+			case Statement::ASSIGN:
+			{
+				// Find the safe indices in the left and right expressions
+				const AssignStmt* pAssignStmt = (const AssignStmt*)pStmt;
+				Expression::ExprVector leftExprs = pAssignStmt->getLeftExprs();
+				for (size_t j = 0; j < leftExprs.size(); ++j)
+					findSafeIndices(leftExprs[j], path, indVar, bodyLevel, state);
+				findSafeIndices(pAssignStmt->getRightExpr(), path, indVar, bodyLevel, state);
+			}
+			break;
+
+			// Expression statement
+			case Statement::EXPR:
+			findSafeIndices(((const ExprStmt*)pStmt)->getExpression(), path, indVar, bodyLevel, state);
+			break;
+
+			// If-else statement
+			case Statement::IF_ELSE:
+			{
+				const IfElseStmt* pIfStmt = (const IfElseStmt*)pStmt;
+				findSafeIndices(pIfStmt->getCondition(), path, indVar, bodyLevel, state);
+				findSafeIndices(pIfStmt->getIfBlock(), NULL, path, indVar, bodyLevel, state);
+				findSafeIndices(pIfStmt->getElseBlock(), NULL, path, indVar, bodyLevel, state);
+			}
+			break;
+
+			// Nested loop statement
+			case Statement::LOOP:
+			{
+				const LoopStmt* pLoopStmt = (const LoopStmt*)pStmt;
+				findSafeIndices(pLoopStmt->getInitSeq(), NULL, path, indVar, bodyLevel, state);
+				findSafeIndices(pLoopStmt->getTestSeq(), pLoopStmt, path, indVar, bodyLevel, state);
+				findSafeIndices(pLoopStmt->getBodySeq(), pLoopStmt, path, indVar, bodyLevel, state);
+				findSafeIndices(pLoopStmt->getIncrSeq(), pLoopStmt, path, indVar, bodyLevel, state);
+			}
+			break;
+
+			// Other statements contain no accesses
+			default:
+			break;
+		}
+	}
+
+	// Remove this sequence from the path
+	path.pop_back();
+}
+
+/***************************************************************
+* Function: findRanges()
+* Purpose : Compute the index ranges of the loops in a sequence
+* Initial : agent on October 18, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+static void findRanges(const StmtSequence* pSeq, const LoopStmt* pSeqLoop, SeqPath& path, RangeState& state)
+{
+	// Add this sequence to the path
+	SeqFrame frame = { pSeq, 0, pSeqLoop };
+	path.push_back(frame);
+
+	// For each statement in the sequence
+	const StmtSequence::StmtVector& stmts = pSeq->getStatements();
+	for (size_t i = 0; i < stmts.size(); ++i)
+	{
+		// Update the current position
+		path.back().pos = i;
+		const Statement* pStmt = stmts[i];
+
+		// If this is an if-else statement, process both branches
+		if (pStmt->getStmtType() == Statement::IF_ELSE)
+		{
+			findRanges(((const IfElseStmt*)pStmt)->getIfBlock(), NULL, path, state);
+			findRanges(((const IfElseStmt*)pStmt)->getElseBlock(), NULL, path, state);
+		}
+
+		// If this is a loop statement
+		else if (pStmt->getStmtType() == Statement::LOOP)
+		{
+			// Get a typed pointer to the statement
+			const LoopStmt* pLoopStmt = (const LoopStmt*)pStmt;
+
+			// If the range of the loop index can be computed
+			InductionVar indVar;
+			if (getInductionVar(pLoopStmt, path, state, indVar))
+			{
+				// Store the induction variable
+				state.pInfo->inductionVars[pLoopStmt] = indVar;
+
+				// Find the array accesses bounded by the loop index in the body
+				size_t bodyLevel = path.size();
+				findSafeIndices(pLoopStmt->getBodySeq(), pLoopStmt, path, indVar, bodyLevel, state);
+			}
+
+			// Process the nested loops
+			findRanges(pLoopStmt->getBodySeq(), pLoopStmt, path, state);
+		}
+	}
+
+	// Remove this sequence from the path
+	path.pop_back();
+}
+
+/***************************************************************
+* Function: computeValueRanges()
+* Purpose : Compute the value ranges of loop indices and the
+*           array accesses they keep within bounds
+* Initial : agent on October 18, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+AnalysisInfo* computeValueRanges(
+	const ProgFunction* pFunction,
+	const StmtSequence* pFuncBody,
+	const TypeSetString& inArgTypes,
+	bool returnBottom
+)
+{
+	// Create a new value range info object
+	ValueRangeInfo* pRangeInfo = new ValueRangeInfo();
+
+	// If we should return bottom, return no information
+	if (returnBottom)
+		return pRangeInfo;
+
+	// Declare the analysis state
+	RangeState state;
+	state.pInfo = pRangeInfo;
+
+	// Get the type inference information for this function
+	state.pTypeInferInfo = (const TypeInferInfo*)AnalysisManager::requestInfo(
+		&computeTypeInfo,
+		pFunction,
+		pFuncBody,
+		inArgTypes
+	);
+
+	// The variables are the parameters and the symbols defined in the body
+	const ProgFunction::ParamVector& inParams = pFunction->getInParams();
+	state.variables = pFuncBody->getSymbolDefs();
+	state.variables.insert(inParams.begin(), inParams.end());
+
+	// Compute the loop index ranges in the function body
+	SeqPath path;
+	findRanges(pFuncBody, NULL, path, state);
+
+	// Return the value range information
+	return pRangeInfo;
+}
@@ -0,0 +1,135 @@
+// =========================================================================== //
+//                                                                             //
+// Copyright 2026 agent.                                                       //
+//                                                                             //
+//   Licensed under the Apache License, Version 2.0 (the "License");           //
+//   you may not use this file except in compliance with the License.          //
+//   You may obtain a copy of the License at                                   //
+//                                                                             //
+//       http://www.apache.org/licenses/LICENSE-2.0                            //
+//                                                                             //
+//   Unless required by applicable law or agreed to in writing, software       //
+//   distributed under the License is distributed on an "AS IS" BASIS,         //
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  //
+//   See the License for the specific language governing permissions and       //
+//  limitations under the License.                                             //
+//                                                                             //
+// =========================================================================== //
+
+// Include guards
+#ifndef ANALYSIS_VALUERANGE_H_
+#define ANALYSIS_VALUERANGE_H_
+
+// Header files
+#include <map>
+#include <vector>
+#include "analysismanager.h"
+#include "expressions.h"
+#include "platform.h"
+
+class StmtSequence;
+class LoopStmt;
+class ParamExpr;
+class SymbolExpr;
+
+/***************************************************************
+* Class   : SymValue
+* Purpose : Symbolic integer value, as a constant offset added
+*           to an optional array size
+* Initial : agent on October 18, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+struct SymValue
+{
+	// Enumerate the array size kinds
+	enum Kind
+	{
+		CONSTANT,	// offset only
+		NUMEL,		// numel(a) + offset
+		LENGTH,		// length(a) + offset
+		SIZE,		// size(a, dim+1) + offset
+		TRAILING	// product of the sizes from dim+1 on, + offset
+	};
+
+	// Kind of array size
+	Kind kind;
+
+	// Array whose size is used (NULL for constants)
+	const SymbolExpr* pArray;
+
+	// Zero-based dimension for sizes
+	size_t dim;
+
+	// Constant offset
+	int64 offset;
+};
+
+/***************************************************************
+* Class   : InductionVar
+* Purpose : Value range of the index variable of a range loop
+* Initial : agent on October 18, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+struct InductionVar
+{
+	// Loop index variable
+	const SymbolExpr* pIndexVar;
+
+	// Loop variable copied from the index (NULL if none)
+	const SymbolExpr* pLoopVar;
+
+	// Lowest and highest values taken by the index, if known
+	bool hasLower;
+	bool hasUpper;
+	SymValue lower;
+	SymValue upper;
+
+	// Indicates that the index only takes integer values
+	bool isIntegral;
+};
+
+/***************************************************************
+* Class   : ValueRangeInfo
+* Purpose : Store value range analysis information
+* Initial : agent on October 18, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+class ValueRangeInfo : public AnalysisInfo
+{
+public:
+
+	// Method to test if an array access index is proved to be within bounds
+	bool isIndexInBounds(const ParamExpr* pExpr, size_t dim) const
+	{
+		// Find the proved indices for this access
+		SafeIndexMap::const_iterator itr = safeIndexMap.find(pExpr);
+
+		// Test if this index was proved within bounds
+		return (itr != safeIndexMap.end() && dim < itr->second.size() && itr->second[dim]);
+	}
+
+	// Induction variable map type definition
+	typedef std::map<const LoopStmt*, InductionVar> InductionVarMap;
+
+	// Induction variables of the range loops
+	InductionVarMap inductionVars;
+
+	// Safe index map type definition
+	typedef std::map<const ParamExpr*, std::vector<bool> > SafeIndexMap;
+
+	// Array accesses whose indices are proved within bounds, by dimension
+	SafeIndexMap safeIndexMap;
+};
+
+// Function to compute the value range information for a function body
+AnalysisInfo* computeValueRanges(
+	const ProgFunction* pFunction,
+	const StmtSequence* pFuncBody,
+	const TypeSetString& inArgTypes,
+	bool returnBottom
+);
+
+#endif // #ifndef ANALYSIS_VALUERANGE_H_
@@ -99,6 +99,28 @@ const AnalysisInfo* AnalysisManager::requestInfo(
 	return cachedInfo.pInfo;
 }
 
+/***************************************************************
+* Function: AnalysisManager::clearInfo()
+* Purpose : Discard the cached information of one analysis run
+* Initial : agent on October 18, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+void AnalysisManager::clearInfo(
+	AnalysisFunc pAnalysis,
+	const ProgFunction* pFunction,
+	const StmtSequence* pFuncBody,
+	const TypeSetString& inArgTypes
+)
+{
+	// Find the corresponding cache entry
+	CacheMap::iterator cacheItr = s_cacheMap.find(CacheKey(pAnalysis, pFunction, pFuncBody, inArgTypes));
+	
+	// If the entry exists and the analysis is not running, remove it
+	if (cacheItr != s_cacheMap.end() && cacheItr->second.running == false)
+		s_cacheMap.erase(cacheItr);
+}
+
 /***************************************************************
 * Function: AnalysisManager::clearCache()
 * Purpose : Clear the analysis info cache
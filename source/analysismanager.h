@@ -78,6 +78,14 @@ public:
 		const TypeSetString& inArgTypes
 	);
 	
+	// Method to discard the cached information of one analysis run
+	static void clearInfo(
+		AnalysisFunc pAnalysis,
+		const ProgFunction* pFunction,
+		const StmtSequence* pFuncBody,
+		const TypeSetString& inArgTypes
+	);
+	
 	// Method to clear the analysis info cache
 	static void clearCache();
 	
@@ -0,0 +1,204 @@
+// =========================================================================== //
+//                                                                             //
+// Copyright 2026 agent.                                                       //
+//                                                                             //
+//   Licensed under the Apache License, Version 2.0 (the "License");           //
+//   you may not use this file except in compliance with the License.          //
+//   You may obtain a copy of the License at                                   //
+//                                                                             //
+//       http://www.apache.org/licenses/LICENSE-2.0                            //
+//                                                                             //
+//   Unless required by applicable law or agreed to in writing, software       //
+//   distributed under the License is distributed on an "AS IS" BASIS,         //
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  //
+//   See the License for the specific language governing permissions and       //
+//  limitations under the License.                                             //
+//                                                                             //
+// =========================================================================== //
+
+
+// Header files
+#include <cassert>
+#include <gc/gc.h>
+#include "bufferpool.h"
+#include "profiling.h"
+
+// Maximum cache size config variable (in megabytes)
+ConfigVar BufferPool::s_poolSizeVar("buffer_pool_size", ConfigVar::INT, "256", 0, 4096);
+
+// Cached buffer tables
+void* BufferPool::s_freeBufs[BufferPool::NUM_CLASSES][BufferPool::CLASS_SLOTS];
+size_t BufferPool::s_numFree[BufferPool::NUM_CLASSES];
+
+// Total size of the cached buffers
+size_t BufferPool::s_cachedBytes = 0;
+
+// Mutex protecting the cached buffer tables
+pthread_mutex_t BufferPool::s_mutex = PTHREAD_MUTEX_INITIALIZER;
+
+/***************************************************************
+* Function: BufferPool::registerConfigVars()
+* Purpose : Register the buffer pool config variables
+* Initial : agent on October 18, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+void BufferPool::registerConfigVars()
+{
+	// Register the maximum cache size
+	ConfigManager::registerVar(&s_poolSizeVar);
+}
+
+/***************************************************************
+* Function: BufferPool::acquire()
+* Purpose : Obtain an atomic buffer of at least the given size
+* Initial : agent on October 18, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+void* BufferPool::acquire(size_t numBytes)
+{
+	// If buffers of this size are not pooled, allocate directly
+	if (isPooled(numBytes) == false)
+		return GC_MALLOC_ATOMIC_IGNORE_OFF_PAGE(numBytes);
+
+	// Find the size class to allocate from
+	size_t index = classAbove(numBytes);
+
+	// Try to take a cached buffer of this class
+	void* pBuffer = NULL;
+	pthread_mutex_lock(&s_mutex);
+	if (s_numFree[index] > 0)
+	{
+		size_t slot = --s_numFree[index];
+		pBuffer = s_freeBufs[index][slot];
+		s_freeBufs[index][slot] = NULL;
+		s_cachedBytes -= classSize(index);
+	}
+	pthread_mutex_unlock(&s_mutex);
+
+	// If a cached buffer was found, reuse it
+	if (pBuffer != NULL)
+	{
+		PROF_INCR_COUNTER(Profiler::BUFFER_REUSE_COUNT);
+		return pBuffer;
+	}
+
+	// Otherwise, allocate a buffer of the full class size
+	// Note: this is done outside the lock since the allocation
+	// may trigger a collection, which other threads releasing
+	// buffers into the pool should not wait for
+	return GC_MALLOC_ATOMIC_IGNORE_OFF_PAGE(classSize(index));
+}
+
+/***************************************************************
+* Function: BufferPool::release()
+* Purpose : Return a buffer that is no longer in use
+* Initial : agent on October 18, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+void BufferPool::release(void* pBuffer)
+{
+	// Only buffers allocated on their own in the collected
+	// heap may be recycled (not inline or mapped elements)
+	if (pBuffer == NULL || GC_base(pBuffer) != pBuffer)
+		return;
+
+	// Get the usable size of the buffer
+	size_t numBytes = GC_size(pBuffer);
+
+	// If buffers of this size are not pooled, free it now
+	if (isPooled(numBytes) == false)
+	{
+		GC_FREE(pBuffer);
+		return;
+	}
+
+	// Find the size class this buffer can serve
+	size_t index = classBelow(numBytes);
+
+	// Get the maximum cache size in bytes
+	size_t maxBytes = size_t(s_poolSizeVar.getIntValue()) << 20;
+
+	// Cache the buffer if there is room for it
+	bool cached = false;
+	pthread_mutex_lock(&s_mutex);
+	if (s_numFree[index] < CLASS_SLOTS && s_cachedBytes + classSize(index) <= maxBytes)
+	{
+		s_freeBufs[index][s_numFree[index]++] = pBuffer;
+		s_cachedBytes += classSize(index);
+		cached = true;
+	}
+	pthread_mutex_unlock(&s_mutex);
+
+	// If the buffer was not cached, give it back to the collector
+	if (cached == false)
+	{
+		GC_FREE(pBuffer);
+		return;
+	}
+
+	// Increment the recycled buffer count
+	PROF_INCR_COUNTER(Profiler::BUFFER_RECYCLE_COUNT);
+}
+
+/***************************************************************
+* Function: BufferPool::classSize()
+* Purpose : Get the buffer size of a size class
+* Initial : agent on October 18, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+size_t BufferPool::classSize(size_t index)
+{
+	// Each power of two is split into evenly spaced sub-classes
+	size_t base = MIN_POOLED_BYTES << (index / SUB_CLASSES);
+	return base + (base / SUB_CLASSES) * (index % SUB_CLASSES);
+}
+
+/***************************************************************
+* Function: BufferPool::classAbove()
+* Purpose : Get the smallest class at least as large as a size
+* Initial : agent on October 18, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+size_t BufferPool::classAbove(size_t numBytes)
+{
+	assert (isPooled(numBytes));
+
+	// Skip the powers of two below the size
+	size_t index = 0;
+	while ((MIN_POOLED_BYTES << (index / SUB_CLASSES + 1)) <= numBytes)
+		index += SUB_CLASSES;
+
+	// Find the first sub-class large enough
+	while (classSize(index) < numBytes)
+		++index;
+
+	// Return the class index
+	return index;
+}
+
+/***************************************************************
+* Function: BufferPool::classBelow()
+* Purpose : Get the largest class no larger than a size
+* Initial : agent on October 18, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+size_t BufferPool::classBelow(size_t numBytes)
+{
+	assert (isPooled(numBytes));
+
+	// Find the smallest class at least as large as the size
+	size_t index = classAbove(numBytes);
+
+	// If that class is larger, step down to the one below
+	if (classSize(index) > numBytes)
+		--index;
+
+	// Return the class index
+	return index;
+}
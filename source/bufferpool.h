@@ -0,0 +1,93 @@
+// =========================================================================== //
+//                                                                             //
+// Copyright 2026 agent.                                                       //
+//                                                                             //
+//   Licensed under the Apache License, Version 2.0 (the "License");           //
+//   you may not use this file except in compliance with the License.          //
+//   You may obtain a copy of the License at                                   //
+//                                                                             //
+//       http://www.apache.org/licenses/LICENSE-2.0                            //
+//                                                                             //
+//   Unless required by applicable law or agreed to in writing, software       //
+//   distributed under the License is distributed on an "AS IS" BASIS,         //
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  //
+//   See the License for the specific language governing permissions and       //
+//  limitations under the License.                                             //
+//                                                                             //
+// =========================================================================== //
+
+
+// Include guards
+#ifndef BUFFERPOOL_H_
+#define BUFFERPOOL_H_
+
+// Header files
+#include <pthread.h>
+#include "platform.h"
+#include "configmanager.h"
+
+/***************************************************************
+* Class   : BufferPool
+* Purpose : Recycle large matrix element buffers by size class
+* Initial : agent on October 18, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+class BufferPool
+{
+public:
+
+	// Method to register the buffer pool config variables
+	static void registerConfigVars();
+
+	// Method to obtain an atomic buffer of at least the given size
+	static void* acquire(size_t numBytes);
+
+	// Method to return a buffer that is no longer in use
+	static void release(void* pBuffer);
+
+	// Method to test if buffers of a given size are pooled
+	static bool isPooled(size_t numBytes) { return numBytes >= MIN_POOLED_BYTES && numBytes <= classSize(NUM_CLASSES - 1); }
+
+	// Smallest buffer size worth recycling
+	static const size_t MIN_POOLED_BYTES = 4096;
+
+	// Maximum cache size config variable (in megabytes)
+	static ConfigVar s_poolSizeVar;
+
+private:
+
+	// Number of size classes per power of two
+	static const size_t SUB_CLASSES = 4;
+
+	// Total number of size classes
+	static const size_t NUM_CLASSES = 18 * SUB_CLASSES;
+
+	// Number of cached buffers per size class
+	static const size_t CLASS_SLOTS = 8;
+
+	// Method to get the buffer size of a size class
+	static size_t classSize(size_t index);
+
+	// Method to get the smallest class at least as large as a size
+	static size_t classAbove(size_t numBytes);
+
+	// Method to get the largest class no larger than a size
+	static size_t classBelow(size_t numBytes);
+
+	// Cached buffers, by size class
+	// Note: this table lives in the data segment, where the
+	// garbage collector scans it, keeping cached buffers alive
+	static void* s_freeBufs[NUM_CLASSES][CLASS_SLOTS];
+
+	// Number of cached buffers in each size class
+	static size_t s_numFree[NUM_CLASSES];
+
+	// Total size of the cached buffers
+	static size_t s_cachedBytes;
+
+	// Mutex protecting the cached buffer tables
+	static pthread_mutex_t s_mutex;
+};
+
+#endif // #ifndef BUFFERPOOL_H_
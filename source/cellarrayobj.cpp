@@ -17,7 +17,12 @@
 // =========================================================================== //
 
 // Header files
+#include <algorithm>
+#include <cassert>
+#include <cstring>
 #include "cellarrayobj.h"
+#include "chararrayobj.h"
+#include "profiling.h"
 
 /***************************************************************
 * Function: MatrixObj<DataObject*>::allocMatrix()
@@ -25,6 +30,10 @@
 * Initial : Maxime Chevalier-Boisvert on February 18, 2009
 ****************************************************************
 Revisions and bug fixes:
+
+agent on October 18, 2026
+Small cell arrays store their elements inline.
+Clear the packed element pointer shared with the inline buffer.
 */
 template <> void MatrixObj<DataObject*>::allocMatrix()
 {
@@ -33,12 +42,39 @@ template <> void MatrixObj<DataObject*>::allocMatrix()
 	for (size_t i = 1; i < m_size.size(); ++i)
 		m_numElements *= m_size[i];
 	
+	// If the elements fit in the inline buffer, store them there
+	// Note: matrix objects are not atomic, so the GC scans this buffer
+	if (m_numElements * sizeof(DataObject*) <= INLINE_BYTES)
+	{
+		m_pElements = (DataObject**)m_inlineData.bytes;
+		return;
+	}
+	
+	// If the elements were stored inline, the packed element
+	// pointer holds an old element, clear it
+	// Note: a packed cell array reallocating its own buffer keeps its packing
+	if (isInline())
+		m_inlineData.pPacked = NULL;
+	
 	// Allocate memory for the matrix elements
 	// Note that the memory is garbage-collected
 	// This allocation is non-atomic to support cell arrays
 	m_pElements = (DataObject**)GC_MALLOC_IGNORE_OFF_PAGE(m_numElements * sizeof(DataObject*));
 }
 
+/***************************************************************
+* Function: MatrixObj<DataObject*>::releaseBuffer()
+* Purpose : Buffer release method for cell arrays
+* Initial : agent on October 18, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+template <> void MatrixObj<DataObject*>::releaseBuffer(DataObject** pBuffer)
+{
+	// Cell buffers are scanned by the collector and may not
+	// be handed out as atomic buffers, leave them to the GC
+}
+
 /***************************************************************
 * Function: MatrixObj<DataObject*>::toString()
 * Purpose : Obtain a string representation of a cell array
@@ -153,3 +189,447 @@ template <> std::string MatrixObj<DataObject*>::toString() const
 	// Return the output string
 	return output;
 }
+
+/***************************************************************
+* Function: MatrixObj<DataObject*>::loadElements()
+* Purpose : Get the elements of a cell array for reading
+* Initial : agent on October 18, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+template <> DataObject* const* MatrixObj<DataObject*>::loadElements() const
+{
+	// If the cell array is not packed, its elements can be read directly
+	if (!isPacked())
+		return m_pElements;
+	
+	// Box the elements into a temporary buffer, the cell array stays packed
+	DataObject** pElements = (DataObject**)GC_MALLOC_IGNORE_OFF_PAGE(m_numElements * sizeof(DataObject*));
+	for (size_t i = 0; i < m_numElements; ++i)
+		pElements[i] = loadElem(m_pElements + i);
+	
+	// Return the boxed elements
+	return pElements;
+}
+
+/***************************************************************
+* Function: MatrixObj<DataObject*>::unpackElements()
+* Purpose : Box the packed elements of a cell array
+* Initial : agent on October 18, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+template <> void MatrixObj<DataObject*>::unpackElements()
+{
+	// If the cell array is not packed, there is nothing to do
+	if (!isPacked())
+		return;
+	
+	// Box the elements in a buffer of our own
+	unshare();
+	
+	// Box each element still in packed form
+	const PackedCells* pPacked = m_inlineData.pPacked;
+	for (size_t i = 0; i < m_numElements; ++i)
+	{
+		if (m_pElements[i] == NULL)
+			m_pElements[i] = pPacked->boxElem(i);
+	}
+	
+	// The cell array now has generic storage
+	m_inlineData.pPacked = NULL;
+}
+
+/***************************************************************
+* Function: MatrixObj<DataObject*>::copyPacking()
+* Purpose : Let a copy of a cell array share its packed elements
+* Initial : agent on October 18, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+template <> void MatrixObj<DataObject*>::copyPacking(MatrixObj* pCopy) const
+{
+	// The packed elements are never modified, so they can be shared
+	if (isPacked())
+		pCopy->m_inlineData.pPacked = m_inlineData.pPacked;
+}
+
+/***************************************************************
+* Function: MatrixObj<DataObject*>::concatPacked()
+* Purpose : Fill a new cell array by packing the elements of
+*           two others, one after the other
+* Initial : agent on October 18, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+template <> bool MatrixObj<DataObject*>::concatPacked(const MatrixObj* pMatrixA, const MatrixObj* pMatrixB)
+{
+	// Ensure that the elements are not stored inline
+	assert (!isInline() && m_numElements == pMatrixA->m_numElements + pMatrixB->m_numElements);
+	
+	// Attempt to pack the elements of both cell arrays
+	PackedCells* pPacked = PackedCells::concat(pMatrixA, pMatrixB);
+	
+	// If some element is not a row of the packed type, stop
+	if (pPacked == NULL)
+		return false;
+	
+	// Replace the initial elements by the packed values
+	memset(m_pElements, 0, m_numElements * sizeof(DataObject*));
+	m_inlineData.pPacked = pPacked;
+	
+	// Count the packed cell array
+	PROF_INCR_COUNTER(Profiler::CELL_PACK_COUNT);
+	
+	// Packing succeeded
+	return true;
+}
+
+/***************************************************************
+* Function: PackedCells::PackedCells()
+* Purpose : Constructor for packed cell array elements
+* Initial : agent on October 18, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+PackedCells::PackedCells(DataObject::Type elemType, size_t numElems, size_t numValues, bool fixedLength)
+: m_elemType(elemType),
+  m_numElems(numElems),
+  m_numRows(0),
+  m_numValues(0),
+  m_rowLength(fixedLength? (numValues / std::max(numElems, size_t(1))):0),
+  m_pOffsets(NULL)
+{
+	// If the rows differ in length, allocate the row offsets
+	if (!fixedLength)
+	{
+		m_pOffsets = (size_t*)GC_MALLOC_ATOMIC((numElems + 1) * sizeof(size_t));
+		m_pOffsets[0] = 0;
+	}
+	
+	// Allocate the packed values
+	// Note: the values hold no pointers, so the allocation is atomic
+	m_pData = (byte*)GC_MALLOC_ATOMIC_IGNORE_OFF_PAGE(std::max(numValues, size_t(1)) * getValueSize());
+}
+
+/***************************************************************
+* Function: PackedCells::appendRow()
+* Purpose : Append a row to the packed values
+* Initial : agent on October 18, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+void PackedCells::appendRow(const void* pRow, size_t length)
+{
+	// Ensure that there is room for the row
+	assert (m_numRows < m_numElems);
+	
+	// Copy the row values after the previous rows
+	memcpy(m_pData + m_numValues * getValueSize(), pRow, length * getValueSize());
+	m_numValues += length;
+	
+	// Record the end of the row
+	++m_numRows;
+	if (m_pOffsets)
+		m_pOffsets[m_numRows] = m_numValues;
+}
+
+/***************************************************************
+* Function: PackedCells::boxElem()
+* Purpose : Create an object for a packed element
+* Initial : agent on October 18, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+DataObject* PackedCells::boxElem(size_t index) const
+{
+	// Ensure that the index is valid
+	assert (index < m_numRows);
+	
+	// Get the row length and the address of its values
+	size_t length = getRowLength(index);
+	const byte* pRow = getRowData(index);
+	
+	// If the elements are strings, create a character array
+	if (m_elemType == DataObject::Type::CHARARRAY)
+		return new CharArrayObj(std::string((const char*)pRow, length));
+	
+	// Otherwise, create a real row vector
+	MatrixF64Obj* pMatrix = new MatrixF64Obj(1, length);
+	memcpy(pMatrix->getElements(), pRow, length * sizeof(float64));
+	return pMatrix;
+}
+
+/***************************************************************
+* Function: static PackedCells::pack()
+* Purpose : Pack the elements of a cell array if they are all
+*           character or real row vectors
+* Initial : agent on October 18, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+bool PackedCells::pack(CellArrayObj* pCellArray)
+{
+	// If the cell array is already packed, there is nothing to do
+	if (pCellArray->isPacked())
+		return true;
+	
+	// Get the number of elements
+	size_t numElems = pCellArray->getNumElems();
+	
+	// If the cell array is too small to benefit from packing, stop
+	if (numElems < MIN_PACK_ELEMS)
+		return false;
+	
+	// Get the type of the first element
+	DataObject** pElements = pCellArray->m_pElements;
+	if (pElements[0] == NULL)
+		return false;
+	DataObject::Type elemType = pElements[0]->getType();
+	
+	// Only strings and real vectors can be packed
+	if (elemType != DataObject::Type::CHARARRAY && elemType != DataObject::Type::MATRIX_F64)
+		return false;
+	
+	// Ensure that all elements are row vectors of this type,
+	// and count the values to pack
+	size_t numValues = 0;
+	bool fixedLength = true;
+	for (size_t i = 0; i < numElems; ++i)
+	{
+		const DataObject* pElem = pElements[i];
+		
+		if (pElem == NULL || pElem->getType() != elemType)
+			return false;
+		
+		const DimVector& size = ((const BaseMatrixObj*)pElem)->getSize();
+		
+		if (size.size() != 2 || size[0] != 1)
+			return false;
+		
+		numValues += size[1];
+		fixedLength = fixedLength && (size[1] == ((const BaseMatrixObj*)pElements[0])->getSize()[1]);
+	}
+	
+	// Copy the element values into packed storage
+	PackedCells* pPacked = new PackedCells(elemType, numElems, numValues, fixedLength);
+	for (size_t i = 0; i < numElems; ++i)
+	{
+		if (elemType == DataObject::Type::CHARARRAY)
+		{
+			const MatrixObj<char>* pString = (const MatrixObj<char>*)pElements[i];
+			pPacked->appendRow(pString->getElements(), pString->getNumElems());
+		}
+		else
+		{
+			const MatrixF64Obj* pVector = (const MatrixF64Obj*)pElements[i];
+			pPacked->appendRow(pVector->getElements(), pVector->getNumElems());
+		}
+	}
+	
+	// Drop the boxed elements, the packed values replace them
+	// Note: sub-arrays sharing the old buffer keep their elements
+	pCellArray->unshare();
+	memset(pCellArray->m_pElements, 0, numElems * sizeof(DataObject*));
+	pCellArray->m_inlineData.pPacked = pPacked;
+	
+	// Count the packed cell array
+	PROF_INCR_COUNTER(Profiler::CELL_PACK_COUNT);
+	
+	// Packing succeeded
+	return true;
+}
+
+/***************************************************************
+* Function: static PackedCells::packStrings()
+* Purpose : Create a column cell array of strings
+* Initial : agent on October 18, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+CellArrayObj* PackedCells::packStrings(const std::vector<std::string>& strings)
+{
+	// Create a column cell array
+	CellArrayObj* pCellArray = new CellArrayObj(strings.size(), 1);
+	
+	// If the cell array is too small to benefit from packing,
+	// store the strings as character arrays
+	if (strings.size() < MIN_PACK_ELEMS)
+	{
+		for (size_t i = 0; i < strings.size(); ++i)
+			pCellArray->m_pElements[i] = new CharArrayObj(strings[i]);
+		
+		return pCellArray;
+	}
+	
+	// Count the characters to pack
+	size_t numValues = 0;
+	bool fixedLength = true;
+	for (size_t i = 0; i < strings.size(); ++i)
+	{
+		numValues += strings[i].length();
+		fixedLength = fixedLength && (strings[i].length() == strings[0].length());
+	}
+	
+	// Copy the strings into packed storage
+	PackedCells* pPacked = new PackedCells(DataObject::Type::CHARARRAY, strings.size(), numValues, fixedLength);
+	for (size_t i = 0; i < strings.size(); ++i)
+		pPacked->appendRow(strings[i].data(), strings[i].length());
+	
+	// Attach the packed strings to the cell array
+	// Note: the element pointers were initialized to NULL
+	pCellArray->m_inlineData.pPacked = pPacked;
+	
+	// Count the packed cell array
+	PROF_INCR_COUNTER(Profiler::CELL_PACK_COUNT);
+	
+	// Return the new cell array
+	return pCellArray;
+}
+
+/***************************************************************
+* Function: static PackedCells::get()
+* Purpose : Get the packed elements of a cell array
+* Initial : agent on October 18, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+const PackedCells* PackedCells::get(const CellArrayObj* pCellArray)
+{
+	// Return the packed elements, if the cell array is packed
+	return pCellArray->isPacked()? pCellArray->m_inlineData.pPacked:NULL;
+}
+
+/***************************************************************
+* Function: static PackedCells::copyElem()
+* Purpose : Get a copy of a cell array element
+* Initial : agent on October 18, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+DataObject* PackedCells::copyElem(const CellArrayObj* pCellArray, size_t index)
+{
+	// Ensure that the index is valid
+	assert (index < pCellArray->getNumElems());
+	
+	// Get the element pointer
+	DataObject* pElem = pCellArray->m_pElements[index];
+	
+	// A packed element is boxed into a new object, which needs no copy
+	if (pElem == NULL && pCellArray->isPacked())
+		return pCellArray->m_inlineData.pPacked->boxElem(index);
+	
+	// Otherwise, copy the element
+	return pElem->copy();
+}
+
+/***************************************************************
+* Function: static PackedCells::getRow()
+* Purpose : Get the values of a cell array element that is a
+*           row vector of the given type, without boxing it
+* Initial : agent on October 18, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+bool PackedCells::getRow(const CellArrayObj* pCellArray, size_t index, DataObject::Type elemType, const void*& pRow, size_t& length)
+{
+	// Ensure that the index is valid
+	assert (index < pCellArray->getNumElems());
+	
+	// Get the element pointer
+	const DataObject* pElem = pCellArray->m_pElements[index];
+	
+	// If the element is packed, read its row from the packed values
+	if (pElem == NULL && pCellArray->isPacked())
+	{
+		const PackedCells* pPacked = pCellArray->m_inlineData.pPacked;
+		
+		if (pPacked->m_elemType != elemType)
+			return false;
+		
+		pRow = pPacked->getRowData(index);
+		length = pPacked->getRowLength(index);
+		return true;
+	}
+	
+	// Otherwise, the element must be a row vector of this type
+	if (pElem == NULL || pElem->getType() != elemType)
+		return false;
+	
+	const DimVector& size = ((const BaseMatrixObj*)pElem)->getSize();
+	
+	if (size.size() != 2 || size[0] != 1)
+		return false;
+	
+	// Get the address of the row values
+	if (elemType == DataObject::Type::CHARARRAY)
+		pRow = ((const MatrixObj<char>*)pElem)->getElements();
+	else
+		pRow = ((const MatrixF64Obj*)pElem)->getElements();
+	
+	// Get the row length
+	length = size[1];
+	return true;
+}
+
+/***************************************************************
+* Function: static PackedCells::concat()
+* Purpose : Pack the elements of two cell arrays, one after the
+*           other, if they are rows of the same type
+* Initial : agent on October 18, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+PackedCells* PackedCells::concat(const CellArrayObj* pCellArrayA, const CellArrayObj* pCellArrayB)
+{
+	// Ensure that one of the cell arrays is packed
+	assert (pCellArrayA->isPacked() || pCellArrayB->isPacked());
+	
+	// Use the type of the packed elements
+	const PackedCells* pPacked = pCellArrayA->isPacked()? pCellArrayA->m_inlineData.pPacked:pCellArrayB->m_inlineData.pPacked;
+	DataObject::Type elemType = pPacked->m_elemType;
+	
+	// Get the cell arrays to pack, in order
+	const CellArrayObj* cellArrays[2] = { pCellArrayA, pCellArrayB };
+	
+	// Ensure that all elements are rows of this type,
+	// and count the values to pack
+	size_t numElems = 0;
+	size_t numValues = 0;
+	size_t firstLength = 0;
+	bool fixedLength = true;
+	for (size_t c = 0; c < 2; ++c)
+	{
+		for (size_t i = 0; i < cellArrays[c]->getNumElems(); ++i)
+		{
+			const void* pRow;
+			size_t length;
+			
+			if (!getRow(cellArrays[c], i, elemType, pRow, length))
+				return NULL;
+			
+			if (numElems == 0)
+				firstLength = length;
+			
+			fixedLength = fixedLength && (length == firstLength);
+			numValues += length;
+			++numElems;
+		}
+	}
+	
+	// Copy the element values into packed storage
+	PackedCells* pNewPacked = new PackedCells(elemType, numElems, numValues, fixedLength);
+	for (size_t c = 0; c < 2; ++c)
+	{
+		for (size_t i = 0; i < cellArrays[c]->getNumElems(); ++i)
+		{
+			const void* pRow;
+			size_t length;
+			getRow(cellArrays[c], i, elemType, pRow, length);
+			pNewPacked->appendRow(pRow, length);
+		}
+	}
+	
+	// Return the packed elements
+	return pNewPacked;
+}
@@ -21,15 +21,112 @@
 #define CELLARRAYOBJ_H_
 
 // Header files
+#include <string>
+#include <vector>
 #include "matrixobjs.h"
 
 // Cell array type definition
 typedef MatrixObj<DataObject*> CellArrayObj;
 
+/***************************************************************
+* Class   : PackedCells
+* Purpose : Packed storage for the elements of a cell array
+*           holding only character or real row vectors
+* Initial : agent on October 18, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+class PackedCells : public gc
+{
+public:
+
+	// Method to pack the elements of a cell array, if they allow it
+	static bool pack(CellArrayObj* pCellArray);
+
+	// Method to create a column cell array of strings, packed if large enough
+	static CellArrayObj* packStrings(const std::vector<std::string>& strings);
+
+	// Method to get the packed elements of a cell array, if any
+	static const PackedCells* get(const CellArrayObj* pCellArray);
+
+	// Method to get a copy of a cell array element, boxing it if packed
+	static DataObject* copyElem(const CellArrayObj* pCellArray, size_t index);
+
+	// Method to get the values of a cell array element that is a row of the given type
+	static bool getRow(const CellArrayObj* pCellArray, size_t index, DataObject::Type elemType, const void*& pRow, size_t& length);
+
+	// Method to pack the elements of two cell arrays, one after the other
+	static PackedCells* concat(const CellArrayObj* pCellArrayA, const CellArrayObj* pCellArrayB);
+
+	// Method to box a packed element
+	DataObject* boxElem(size_t index) const;
+
+	// Accessor to get the type of the packed elements
+	DataObject::Type getElemType() const { return m_elemType; }
+
+	// Accessor to get the number of packed elements
+	size_t getNumElems() const { return m_numElems; }
+
+	// Method to get the length of a packed row
+	size_t getRowLength(size_t index) const { return m_pOffsets? (m_pOffsets[index + 1] - m_pOffsets[index]):m_rowLength; }
+
+	// Minimum number of elements for a cell array to be packed
+	static const size_t MIN_PACK_ELEMS = 64;
+
+private:
+
+	// Constructor
+	PackedCells(DataObject::Type elemType, size_t numElems, size_t numValues, bool fixedLength);
+
+	// Method to append a row to the packed data
+	void appendRow(const void* pRow, size_t length);
+
+	// Method to get the size of the packed values
+	size_t getValueSize() const { return (m_elemType == DataObject::Type::CHARARRAY)? sizeof(char):sizeof(float64); }
+
+	// Method to get the address of the values of a packed row
+	const byte* getRowData(size_t index) const { return m_pData + (m_pOffsets? m_pOffsets[index]:(index * m_rowLength)) * getValueSize(); }
+
+	// Type of the packed elements
+	DataObject::Type m_elemType;
+
+	// Number of packed elements
+	size_t m_numElems;
+
+	// Number of rows appended so far
+	size_t m_numRows;
+
+	// Number of values appended so far
+	size_t m_numValues;
+
+	// Length of every row, when the rows have the same length
+	size_t m_rowLength;
+
+	// Offset of each row in the packed values, NULL if the rows have the same length
+	// Note: there is one more offset than there are rows
+	size_t* m_pOffsets;
+
+	// Packed values of all rows, stored contiguously
+	byte* m_pData;
+};
+
 // Template specialization of the matrix allocation method for cell arrays
 template <> void MatrixObj<DataObject*>::allocMatrix();
 
+// Template specialization of the buffer recycling method for cell arrays
+template <> void MatrixObj<DataObject*>::releaseBuffer(DataObject** pBuffer);
+
 // Template specialization of the string representation method for cell arrays
 template <> std::string MatrixObj<DataObject*>::toString() const;
 
+// Template specializations of the packed element methods for cell arrays
+template <> inline bool MatrixObj<DataObject*>::isPacked() const
+{ return !isInline() && m_inlineData.pPacked != NULL; }
+template <> inline DataObject* MatrixObj<DataObject*>::loadElem(DataObject* const* pAddr) const
+{ return (*pAddr == NULL && isPacked())? m_inlineData.pPacked->boxElem(pAddr - m_pElements):*pAddr; }
+template <> DataObject* const* MatrixObj<DataObject*>::loadElements() const;
+template <> void MatrixObj<DataObject*>::unpackElements();
+template <> void MatrixObj<DataObject*>::copyPacking(MatrixObj* pCopy) const;
+template <> bool MatrixObj<DataObject*>::concatPacked(const MatrixObj* pMatrixA, const MatrixObj* pMatrixB);
+
 #endif // #ifndef CELLARRAYOBJ_H_ 
@@ -17,13 +17,17 @@
 // =========================================================================== //
 
 #include <stdexcept>
+#include <algorithm>
 #include <cstdlib>
 #include <string>
 #include <sstream>
 #include <iostream>
 #include <fstream>
 #include <ctime>
+#include <cstring>
+#include <cerrno>
 #include <unistd.h>
+#include <dirent.h>
 
 #include "client.h"
 #include "filesystem.h"
@@ -48,12 +52,39 @@ const std::string Client::FRONTEND_ENTRY_POINT = "natlab.sh";
 // Compiler front-end command arguments
 const std::string Client::FRONTEND_ARGUMENTS =  " -matlab -xml -quiet -server &";
 
-// mutual exclusion object
-pthread_mutex_t Client::mutex = PTHREAD_MUTEX_INITIALIZER;
+// pool of open frontend connections
+std::vector<Client::Connection*> Client::connections;
+
+// replies of prefetched files
+Client::PrefetchMap Client::prefetched;
+
+// number of prefetch batches being processed
+int Client::activeBatches = 0;
+
+// guards the prefetched replies and the batch count
+pthread_mutex_t Client::prefetchMutex = PTHREAD_MUTEX_INITIALIZER;
+
+// signaled when a prefetched reply arrives or a batch ends
+pthread_cond_t Client::prefetchCond = PTHREAD_COND_INITIALIZER;
+
+// number of frontend connections kept open
+ConfigVar Client::s_connectionsVar("frontend_connections", ConfigVar::INT, "1", 1, 16);
+
+// prefetch the M-files of the starting directory
+ConfigVar Client::s_prefetchDirVar("frontend_prefetch_dir", ConfigVar::BOOL, "false");
 
 // initialize heartbeat thread id
 pthread_t Client::hb = 0;
 
+// guards the heartbeat stop flag
+pthread_mutex_t Client::hbMutex = PTHREAD_MUTEX_INITIALIZER;
+
+// signaled when the heartbeat thread must stop
+pthread_cond_t Client::hbCond = PTHREAD_COND_INITIALIZER;
+
+// indicates that the heartbeat thread must stop
+bool Client::hbStop = false;
+
 /*******************************************************************
 * Function: Client::Client()
 * Purpose : Default constructor
@@ -72,12 +103,31 @@ Revisions and bug fixes:
 */
 Client::~Client() {}
 
+/*******************************************************************
+* Function: Client::registerConfigVars()
+* Purpose : Register the client configuration variables
+* Initial : agent on October 18, 2026
+********************************************************************
+Revisions and bug fixes:
+*/
+void Client::registerConfigVars()
+{
+	// register the connection pool size
+	ConfigManager::registerVar(&s_connectionsVar);
+
+	// register the directory prefetch flag
+	ConfigManager::registerVar(&s_prefetchDirVar);
+}
+
 /*******************************************************************
 * Function: Client::start()
 * Purpose : Start Natlab without establishing a connection
 * Initial : Nurudeen A. Lameed on May 15, 2009
 ********************************************************************
 Revisions and bug fixes:
+
+agent on October 18, 2026
+Moved the process launch into launchFrontend.
 */
 void Client::start(const char* svrName, const int svrPortNo)
 {
@@ -85,8 +135,28 @@ void Client::start(const char* svrName, const int svrPortNo)
 	serverName = svrName;
 	
 	// test whether the port is free
-	validatePortNo(svrPortNo);
+	serverPortNo = validatePortNo(svrPortNo);
 	
+	// start natlab on the selected port
+	launchFrontend(serverPortNo);
+
+	// create a client socket
+	if (!socketStream)
+	{
+		ClientSocket::startUP();
+		socketStream = new ClientSocket();
+	}
+}
+
+/*******************************************************************
+* Function: Client::launchFrontend()
+* Purpose : Start a natlab process listening on a given port
+* Initial : agent on October 18, 2026
+********************************************************************
+Revisions and bug fixes:
+*/
+void Client::launchFrontend(const int portNo)
+{
 	// open a string stream
 	std::ostringstream command;
 	
@@ -101,17 +171,10 @@ void Client::start(const char* svrName, const int svrPortNo)
   }
 
 	// form the command to start natlab in server mode
-        command << bin	<< " -sp " << serverPortNo << " " << FRONTEND_ARGUMENTS;
+        command << bin	<< " -sp " << portNo << " " << FRONTEND_ARGUMENTS;
 
 	// start the service as a background process.
 	system(command.str().c_str());
-
-	// create a client socket
-	if (!socketStream)
-	{
-		ClientSocket::startUP();
-		socketStream = new ClientSocket();
-	}
 }
 
 /*******************************************************************
@@ -120,8 +183,11 @@ void Client::start(const char* svrName, const int svrPortNo)
 * Initial : Nurudeen A. Lameed on June 17, 2009
 ********************************************************************
 Revisions and bug fixes:
+
+agent on October 18, 2026
+Returns the selected port rather than storing it.
 */
-void Client::validatePortNo(const int svrPortNo)
+int Client::validatePortNo(const int svrPortNo)
 {
 	// copy server port no
 	int portNo = svrPortNo;
@@ -144,8 +210,8 @@ void Client::validatePortNo(const int svrPortNo)
 		}
 	}
 	
-	// store the selected port 
-	serverPortNo = portNo;
+	// return the selected port 
+	return portNo;
 }
 
 /*******************************************************************
@@ -154,8 +220,40 @@ void Client::validatePortNo(const int svrPortNo)
 * Initial : Nurudeen A. Lameed on May 15, 2009
 ********************************************************************
 Revisions and bug fixes:
+
+agent on October 18, 2026
+The retry loop moved to connectSocket; the heartbeat thread is now
+created by openSocketStream once the whole pool is connected.
 */
 void Client::connect()
+{
+	try
+	{
+		// try to connect to the server
+		connectSocket(socketStream, serverPortNo);
+	}
+	catch (ConnectionError& )
+	{
+		// free up socketStream
+		delete socketStream;
+		socketStream = 0;
+
+		// rethrow the exception
+		throw;
+	}
+
+	// the primary connection comes first in the pool
+	addConnection(socketStream, serverPortNo);
+}
+
+/*******************************************************************
+* Function: Client::connectSocket()
+* Purpose : connect a socket to natlab, retrying until it is up
+* Initial : agent on October 18, 2026
+********************************************************************
+Revisions and bug fixes:
+*/
+void Client::connectSocket(ClientSocket* pSocket, const int portNo)
 {
 	if (!serverName)
 	{
@@ -166,26 +264,20 @@ void Client::connect()
 	// to connect to the server; give up after 5s.
 	int elapsedTime = 0;
 	
-	while (!(socketStream->isConnected()) )
+	while (!(pSocket->isConnected()) )
 	{
 		try
 		{
 		    sleep(1); // a delay of 1s
 		    
 		    // try to connect to the server
-		    socketStream->connectSocket(serverName, serverPortNo);
-		    
-		    // create an heartbeat thread
-		    createHBThread();
+		    pSocket->connectSocket(serverName, portNo);
 		}
 		catch (ConnectionError& )
 		{
 			// do nothing, if less than 5s ...
 			if (++elapsedTime > MAX_ELAPSED_TIME)
 			{
-				// free up socketStream
-				delete socketStream;
-
 				// rethrow the exception
 				throw;
 			}
@@ -193,12 +285,89 @@ void Client::connect()
 	}
 }
 
+/*******************************************************************
+* Function: Client::addConnection()
+* Purpose : add a connected socket to the connection pool
+* Initial : agent on October 18, 2026
+********************************************************************
+Revisions and bug fixes:
+*/
+void Client::addConnection(ClientSocket* pSocket, const int portNo)
+{
+	// create the connection record
+	Connection* pConnection = new Connection();
+	pConnection->pSocket = pSocket;
+	pConnection->portNo = portNo;
+	pthread_mutex_init(&pConnection->sendMutex, 0);
+	pthread_mutex_init(&pConnection->channelMutex, 0);
+
+	// add it to the pool
+	connections.push_back(pConnection);
+}
+
+/*******************************************************************
+* Function: Client::openConnectionPool()
+* Purpose : start and connect the additional frontends of the pool
+* Initial : agent on October 18, 2026
+********************************************************************
+Revisions and bug fixes:
+*/
+void Client::openConnectionPool()
+{
+	// number of additional frontends requested
+	int extraCount = s_connectionsVar.getIntValue() - 1;
+
+	// ports of the launched frontends
+	std::vector<int> ports;
+
+	// launch all the frontends first, so that they start up concurrently
+	int portNo = serverPortNo;
+	for (int i = 0; i < extraCount; ++i)
+	{
+		try
+		{
+			// pick a free port above the previous one
+			portNo = validatePortNo(portNo + 1);
+		}
+		catch (ConnectionError& e)
+		{
+			std::cerr << "Warning: " << e.what() << std::endl;
+			break;
+		}
+
+		launchFrontend(portNo);
+		ports.push_back(portNo);
+	}
+
+	// connect to each of them; a frontend that fails to start only shrinks the pool
+	for (size_t i = 0; i < ports.size(); ++i)
+	{
+		ClientSocket* pSocket = new ClientSocket();
+
+		try
+		{
+			connectSocket(pSocket, ports[i]);
+		}
+		catch (ConnectionError& e)
+		{
+			std::cerr << "Warning: frontend on port " << ports[i] << ": " << e.what() << std::endl;
+			delete pSocket;
+			continue;
+		}
+
+		addConnection(pSocket, ports[i]);
+	}
+}
+
 /*******************************************************************
 * Function: Client::openSocketStream()
 * Purpose : starts natlab and establish connection to natlab
 * Initial : Nurudeen A. Lameed on May 5, 2009
 ********************************************************************
 Revisions and bug fixes:
+
+agent on October 18, 2026
+Opens the additional connections of the pool.
 */
 void Client::openSocketStream(const char *svrName, const int svrPortNo)
 {
@@ -209,6 +378,12 @@ void Client::openSocketStream(const char *svrName, const int svrPortNo)
 		
 		// try to establish a connection
 		connect();
+
+		// start and connect the other frontends, if any
+		openConnectionPool();
+
+		// create an heartbeat thread
+		createHBThread();
 	}
 	catch(ConnectionError& e)
 	{
@@ -225,11 +400,35 @@ void Client::openSocketStream(const char *svrName, const int svrPortNo)
 * Initial : Nurudeen A. Lameed on May 5, 2009
 ********************************************************************
 Revisions and bug fixes:
+
+agent on October 18, 2026
+Uses the prefetched reply for the file, if there is one.
 */
 std::string Client::parseFile(const std::string& filePath)
 {
+	pthread_mutex_lock(&prefetchMutex);
+
+	// wait for the reply if the file is being prefetched
+	PrefetchMap::iterator itr = prefetched.find(filePath);
+	while (itr != prefetched.end() && !itr->second.ready)
+	{
+		pthread_cond_wait(&prefetchCond, &prefetchMutex);
+		itr = prefetched.find(filePath);
+	}
+
+	// a reply is consumed only once, later loads reparse the file
+	if (itr != prefetched.end())
+	{
+		std::string reply = itr->second.reply;
+		prefetched.erase(itr);
+		pthread_mutex_unlock(&prefetchMutex);
+		return reply;
+	}
+
+	pthread_mutex_unlock(&prefetchMutex);
+
 	// build a command string
-	std::string command = "<parsefile>" + XML::escapeString(filePath) + "</parsefile>";
+	std::string command = parseFileCommand(filePath);
 
 	std::string reply = "";
 	try
@@ -244,6 +443,240 @@ std::string Client::parseFile(const std::string& filePath)
 	return reply;
 }
 
+/*******************************************************************
+* Function: Client::parseFileCommand()
+* Purpose : Build the parsefile command for a file
+* Initial : agent on October 18, 2026
+********************************************************************
+Revisions and bug fixes:
+*/
+std::string Client::parseFileCommand(const std::string& filePath)
+{
+	return "<parsefile>" + XML::escapeString(filePath) + "</parsefile>";
+}
+
+/*******************************************************************
+* Function: Client::prefetchFiles()
+* Purpose : Parse files ahead of time, in the background
+* Initial : agent on October 18, 2026
+********************************************************************
+Revisions and bug fixes:
+*/
+void Client::prefetchFiles(const PathVector& filePaths)
+{
+	// nothing to do without a frontend
+	if (connections.empty())
+	{
+		return;
+	}
+
+	// one batch per connection
+	std::vector<PrefetchBatch*> batches;
+	for (size_t i = 0; i < connections.size(); ++i)
+	{
+		PrefetchBatch* pBatch = new PrefetchBatch();
+		pBatch->pConnection = connections[i];
+		batches.push_back(pBatch);
+	}
+
+	pthread_mutex_lock(&prefetchMutex);
+
+	// deal the files out to the connections, round-robin
+	size_t next = 0;
+	for (PathVector::const_iterator itr = filePaths.begin(); itr != filePaths.end(); ++itr)
+	{
+		// replies are keyed by absolute path, as in CodeParser::parseSrcFile
+		std::string absPath = getAbsPath(*itr);
+
+		// skip invalid files and those already queued
+		if (absPath.empty() || prefetched.find(absPath) != prefetched.end())
+		{
+			continue;
+		}
+
+		// mark the reply as pending
+		PrefetchEntry& entry = prefetched[absPath];
+		entry.ready = false;
+
+		batches[next++ % batches.size()]->filePaths.push_back(absPath);
+	}
+
+	pthread_mutex_unlock(&prefetchMutex);
+
+	// start a worker for each non-empty batch
+	for (size_t i = 0; i < batches.size(); ++i)
+	{
+		PrefetchBatch* pBatch = batches[i];
+
+		if (pBatch->filePaths.empty())
+		{
+			delete pBatch;
+			continue;
+		}
+
+		pthread_mutex_lock(&prefetchMutex);
+		++activeBatches;
+		pthread_mutex_unlock(&prefetchMutex);
+
+		pthread_t thread;
+		pthread_attr_t attr;
+		pthread_attr_init(&attr);
+		pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_DETACHED);
+		int success = pthread_create(&thread, &attr, &prefetchWorker, pBatch);
+		pthread_attr_destroy(&attr);
+
+		// if no thread could be created, the files are parsed on demand
+		if (success != 0)
+		{
+			for (size_t j = 0; j < pBatch->filePaths.size(); ++j)
+			{
+				storePrefetch(pBatch->filePaths[j], 0);
+			}
+
+			pthread_mutex_lock(&prefetchMutex);
+			--activeBatches;
+			pthread_cond_broadcast(&prefetchCond);
+			pthread_mutex_unlock(&prefetchMutex);
+
+			delete pBatch;
+		}
+	}
+}
+
+/*******************************************************************
+* Function: Client::prefetchDirectory()
+* Purpose : Prefetch every M-file found in a directory
+* Initial : agent on October 18, 2026
+********************************************************************
+Revisions and bug fixes:
+*/
+void Client::prefetchDirectory(const std::string& dirPath)
+{
+	DIR* pDir = opendir(dirPath.c_str());
+
+	// an unreadable directory has nothing to prefetch
+	if (!pDir)
+	{
+		return;
+	}
+
+	PathVector filePaths;
+
+	// collect the files with the .m extension
+	while (struct dirent* pEntry = readdir(pDir))
+	{
+		std::string name = pEntry->d_name;
+
+		if (name.length() > 2 && name.compare(name.length() - 2, 2, ".m") == 0)
+		{
+			filePaths.push_back(dirPath + "/" + name);
+		}
+	}
+
+	closedir(pDir);
+
+	prefetchFiles(filePaths);
+}
+
+/*******************************************************************
+* Function: Client::prefetchWorker()
+* Purpose : Parse a batch of files over one connection; up to
+*           PIPELINE_DEPTH requests are sent before reading replies
+* Initial : agent on October 18, 2026
+********************************************************************
+Revisions and bug fixes:
+*/
+void* Client::prefetchWorker(void* arg)
+{
+	PrefetchBatch* pBatch = (PrefetchBatch*)arg;
+	Connection* pConnection = pBatch->pConnection;
+	const PathVector& filePaths = pBatch->filePaths;
+
+	// index of the first file without a reply
+	size_t done = 0;
+
+	while (done < filePaths.size())
+	{
+		// the channel is released between windows so that on-demand
+		// commands do not wait for the whole batch
+		pthread_mutex_lock(&pConnection->channelMutex);
+
+		size_t windowEnd = std::min(done + PIPELINE_DEPTH, filePaths.size());
+
+		try
+		{
+			// send the whole window
+			for (size_t i = done; i < windowEnd; ++i)
+			{
+				sendMessage(pConnection, parseFileCommand(filePaths[i]).c_str());
+			}
+
+			// the frontend replies in request order
+			for (; done < windowEnd; ++done)
+			{
+				std::string reply = pConnection->pSocket->bufferedReceiveUntilNull();
+				storePrefetch(filePaths[done], &reply);
+			}
+		}
+		catch (std::exception& e)
+		{
+			pthread_mutex_unlock(&pConnection->channelMutex);
+
+			// give up on the rest; the files will be parsed on demand
+			for (; done < filePaths.size(); ++done)
+			{
+				storePrefetch(filePaths[done], 0);
+			}
+
+			break;
+		}
+
+		pthread_mutex_unlock(&pConnection->channelMutex);
+	}
+
+	// signal the end of this batch
+	pthread_mutex_lock(&prefetchMutex);
+	--activeBatches;
+	pthread_cond_broadcast(&prefetchCond);
+	pthread_mutex_unlock(&prefetchMutex);
+
+	delete pBatch;
+
+	return NULL;
+}
+
+/*******************************************************************
+* Function: Client::storePrefetch()
+* Purpose : Store a prefetched reply; a null reply discards the
+*           entry so that the file gets parsed on demand
+* Initial : agent on October 18, 2026
+********************************************************************
+Revisions and bug fixes:
+*/
+void Client::storePrefetch(const std::string& filePath, const std::string* reply)
+{
+	pthread_mutex_lock(&prefetchMutex);
+
+	PrefetchMap::iterator itr = prefetched.find(filePath);
+
+	if (itr != prefetched.end())
+	{
+		if (reply)
+		{
+			itr->second.reply = *reply;
+			itr->second.ready = true;
+		}
+		else
+		{
+			prefetched.erase(itr);
+		}
+	}
+
+	// wake up any thread waiting on this file
+	pthread_cond_broadcast(&prefetchCond);
+	pthread_mutex_unlock(&prefetchMutex);
+}
+
 /*******************************************************************
 * Function: Client::parseText
 * Purpose : Parses text
@@ -275,13 +708,47 @@ std::string Client::parseText(const std::string& txt)
 * Initial : Nurudeen A. Lameed on May 5, 2009
 ********************************************************************
 Revisions and bug fixes:
+
+agent on October 18, 2026
+Waits for pending prefetches and shuts down every frontend of the pool.
 */
 std::string Client::shutdown()
 {
+	// stop the heartbeats, which would fail once the frontends are down
+	stopHBThread();
+
+	// let the prefetch workers finish with the sockets
+	pthread_mutex_lock(&prefetchMutex);
+	while (activeBatches > 0)
+	{
+		pthread_cond_wait(&prefetchCond, &prefetchMutex);
+	}
+	pthread_mutex_unlock(&prefetchMutex);
+
+	// shut down the additional frontends; failures are not fatal here
+	for (size_t i = 1; i < connections.size(); ++i)
+	{
+		try
+		{
+			sendMessage(connections[i], "<shutdown/>");
+			connections[i]->pSocket->bufferedReceiveUntilNull();
+		}
+		catch(std::exception& e)
+		{
+		}
+	}
+
 	std::string reply = "";
 	try
 	{
-		reply = sendCommand("<shutdown/>");
+		if (connections.empty())
+		{
+			throw ConnectionError("Socket stream not available");
+		}
+
+		// the reply of the primary frontend is returned
+		sendMessage(connections[0], "<shutdown/>");
+		reply = connections[0]->pSocket->bufferedReceiveUntilNull();
 		closeSocketStream();
 	}
 	catch(std::exception& e)
@@ -298,28 +765,89 @@ std::string Client::shutdown()
 * Initial : Nurudeen A. Lameed on May 5, 2009
 ********************************************************************
 Revisions and bug fixes:
+
+agent on October 18, 2026
+Picks an idle connection of the pool and holds it until the reply is
+received, since prefetch requests may be pipelined on the same socket.
 */
 std::string Client::sendCommand(const char* command)
+{
+	// an error has occured
+	if (connections.empty())
+	{
+		throw ConnectionError("Socket stream not available");
+	}
+
+	// prefer an idle connection, otherwise wait for the primary one
+	Connection* pConnection = 0;
+	for (size_t i = 0; i < connections.size(); ++i)
+	{
+		if (pthread_mutex_trylock(&connections[i]->channelMutex) == 0)
+		{
+			pConnection = connections[i];
+			break;
+		}
+	}
+	if (!pConnection)
+	{
+		pConnection = connections[0];
+		pthread_mutex_lock(&pConnection->channelMutex);
+	}
+
+	std::string reply;
+	try
+	{
+		// send the command
+		sendMessage(pConnection, command);
+
+		// receive the output; replies to pipelined requests stay buffered
+		reply = pConnection->pSocket->bufferedReceiveUntilNull();
+	}
+	catch (std::exception& )
+	{
+		pthread_mutex_unlock(&pConnection->channelMutex);
+		throw;
+	}
+
+	pthread_mutex_unlock(&pConnection->channelMutex);
+
+	// return the output
+	return reply;
+}
+
+/*******************************************************************
+* Function: Client::sendMessage()
+* Purpose : send a message on a connection, without a reply
+* Initial : agent on October 18, 2026
+********************************************************************
+Revisions and bug fixes:
+*/
+void Client::sendMessage(Connection* pConnection, const char* command)
 {
 	// acquire the mutual exclusion lock
-	pthread_mutex_lock(&mutex);
+	pthread_mutex_lock(&pConnection->sendMutex);
 	
 	// send command, if connection is okay
-	if (socketStream && socketStream->isConnected())
+	if (pConnection->pSocket && pConnection->pSocket->isConnected())
 	{
-		// send the command
-		socketStream->sendAll(command, strlen(command) + 1);
-		
-		// release the mutual exclusion lock since only one thread is receiving
-		pthread_mutex_unlock(&mutex);
-		
-		// return the output
-		return socketStream->receiveUntilNull();
+		try
+		{
+			// send the command
+			pConnection->pSocket->sendAll(command, strlen(command) + 1);
+		}
+		catch (std::exception& )
+		{
+			pthread_mutex_unlock(&pConnection->sendMutex);
+			throw;
+		}
+
+		// release the mutual exclusion lock
+		pthread_mutex_unlock(&pConnection->sendMutex);
 	}
 	else
 	{
 		// must release the lock to progress
-		pthread_mutex_unlock(&mutex);
+		pthread_mutex_unlock(&pConnection->sendMutex);
 		
 		// an error has occured
 		throw ConnectionError("Socket stream not available");
@@ -342,6 +870,26 @@ inline void Client::waitHBThread()
   }
 }
 
+/*******************************************************************
+* Function: Client::stopHBThread()
+* Purpose : stop the heartbeat thread and wait for it to terminate
+* Initial : agent on October 18, 2026
+********************************************************************
+Revisions and bug fixes:
+*/
+void Client::stopHBThread()
+{
+	// ask the heartbeat thread to stop, waking it up if it waits
+	pthread_mutex_lock(&hbMutex);
+	hbStop = true;
+	pthread_cond_broadcast(&hbCond);
+	pthread_mutex_unlock(&hbMutex);
+
+	// wait for the heartbeat thread to terminate
+	waitHBThread();
+	hb = 0;
+}
+
 /*******************************************************************
 * Function: Client::createHBThread()
 * Purpose : create a thread for sending heartbeat messages
@@ -369,54 +917,64 @@ inline void Client::createHBThread()
 * Initial : Nurudeen A. Lameed on June 1, 2009
 ********************************************************************
 Revisions and bug fixes:
+
+agent on October 18, 2026
+Sends the heartbeat to every frontend of the pool, holding the channel
+of each connection, and stops when asked to by stopHBThread.
 */
 void* Client::heartbeat(void* arg)
 {
 	// declare and initialize a heartbeat message
 	const char* hb = "<heartbeat></heartbeat>";
 			
-	// send a heartbeat message to the server every MAX_INTERVAL secs
-	while (true)
-	{
-		// acquire the mutual exclusion lock
-		pthread_mutex_lock(&mutex);
-     	
-		// send command, if connection is okay
-		if (socketStream && socketStream->isConnected())
+	// send a heartbeat message to the servers every MAX_INTERVAL secs
+	pthread_mutex_lock(&hbMutex);
+	while (!hbStop)
+	{
+		pthread_mutex_unlock(&hbMutex);
+
+		for (size_t i = 0; i < connections.size(); ++i)
 		{
+			// hold the channel, so that the heartbeat is not sent in the
+			// middle of a request or of a pipelined window
+			pthread_mutex_lock(&connections[i]->channelMutex);
+
 			try
 			{
-				// send the message 
-				socketStream->sendAll(hb, strlen(hb) + 1);
-     		
-				// release the mutual exclusion lock since only one thread is receiving
-				pthread_mutex_unlock(&mutex);
+				// send the message; heartbeats get no reply
+				sendMessage(connections[i], hb);
+			}
+			catch(ConnectionError& e)
+			{
+				std::cout << " Disconnected from the server " << std::endl;
+															
+				// stop, for now
+				exit(1);
 			}
 			catch(std::exception& e)
 			{
-				// release the lock
-				pthread_mutex_unlock(&mutex);
-				
 				std::cout << e.what() << std::endl;
 												
 				// stop, for now
 				exit(1);
 			}
+
+			pthread_mutex_unlock(&connections[i]->channelMutex);
 		}
-		else
+		
+		// wait for some seconds (interval), unless asked to stop
+		timespec deadline;
+		clock_gettime(CLOCK_REALTIME, &deadline);
+		deadline.tv_sec += MAX_INTERVAL;
+
+		pthread_mutex_lock(&hbMutex);
+		while (!hbStop)
 		{
-			// release the lock
-			pthread_mutex_unlock(&mutex);
-							
-			std::cout << " Disconnected from the server " << std::endl;
-															
-			// stop, for now
-			exit(1);
+			if (pthread_cond_timedwait(&hbCond, &hbMutex, &deadline) == ETIMEDOUT)
+				break;
 		}
-		
-		// wait for some seconds (interval)
-		sleep(MAX_INTERVAL);
 	}
+	pthread_mutex_unlock(&hbMutex);
 
 	return NULL;
 }
@@ -427,16 +985,31 @@ void* Client::heartbeat(void* arg)
 * Initial : Nurudeen A. Lameed on May 5, 2009
 ********************************************************************
 Revisions and bug fixes:
+
+agent on October 18, 2026
+Stops the heartbeat thread, then closes every connection of the pool.
 */
 void Client::closeSocketStream()
 {
-	if (socketStream)
+	// the heartbeat thread must not use the connections being freed
+	stopHBThread();
+
+	for (size_t i = 0; i < connections.size(); ++i)
 	{
 		// close the socket
-		socketStream->closeSocket();
+		connections[i]->pSocket->closeSocket();
 		
-		// free up the memory socketStream 
-		delete socketStream;
+		// free up the memory of the socket and its record
+		delete connections[i]->pSocket;
+		delete connections[i];
+	}
+
+	connections.clear();
+
+	if (socketStream)
+	{
+		// the primary socket was part of the pool
+		socketStream = 0;
 		
 		// clean up the socket
 		ClientSocket::cleanUP();
@@ -21,8 +21,11 @@
 
 #include <string>
 #include <cstdio>
+#include <vector>
+#include <map>
 #include <pthread.h>
 #include "clientsocket.h"
+#include "configmanager.h"
 
 /*******************************************************************
 * Class   : Client
@@ -30,6 +33,9 @@
 * Initial : Nurudeen A. Lameed on May 5, 2009
 ********************************************************************
 Revisions and bug fixes:
+
+agent on October 18, 2026
+Added a pool of frontend connections and pipelined parse prefetching.
 */
 class Client
 {
@@ -42,12 +48,25 @@ public:
 
 	~Client();
 
+	// list of source file paths
+	typedef std::vector<std::string> PathVector;
+
+	// registers the client configuration variables
+	static void registerConfigVars();
+
 	// opens a stream to the frontend to mcvm
 	static void openSocketStream(const char *svrName, const int svrPortNo);
 
 	// send parsefile command to the frontend
 	static std::string parseFile(const std::string& filePath);
 
+	// queues parsefile commands for the given files in the background;
+	// parseFile picks up the replies as they become available
+	static void prefetchFiles(const PathVector& filePaths);
+
+	// prefetches every M-file found in a directory
+	static void prefetchDirectory(const std::string& dirPath);
+
 	// sends a parsetext command.
 	static std::string parseText(const std::string& txt);
 
@@ -62,16 +81,88 @@ public:
 
 	// connect to natlab
 	static void connect();
+
+	// number of frontend connections kept open
+	static ConfigVar s_connectionsVar;
+
+	// prefetch the M-files of the starting directory
+	static ConfigVar s_prefetchDirVar;
 	
 private:
 	// private constructor, must not be called.
 	Client();
 
+	// a connection to one frontend process
+	struct Connection
+	{
+		// socket connected to the frontend
+		ClientSocket* pSocket;
+
+		// the port number attached to the frontend
+		int portNo;
+
+		// serializes the messages written to the socket
+		pthread_mutex_t sendMutex;
+
+		// held by the thread owning the request/reply sequence
+		pthread_mutex_t channelMutex;
+	};
+
+	// a parse reply obtained ahead of time
+	struct PrefetchEntry
+	{
+		// set once the reply has been received
+		bool ready;
+
+		// the frontend reply
+		std::string reply;
+	};
+
+	// map of absolute file paths to prefetched replies
+	typedef std::map<std::string, PrefetchEntry> PrefetchMap;
+
+	// a batch of files parsed on one connection
+	struct PrefetchBatch
+	{
+		// the connection used for the batch
+		Connection* pConnection;
+
+		// the files to parse
+		PathVector filePaths;
+	};
+
 	// sends a  command to (natlab).
 	static std::string sendCommand(const char* command);
+
+	// sends a command on a given connection, without waiting for a reply
+	static void sendMessage(Connection* pConnection, const char* command);
+
+	// builds the parsefile command for a file
+	static std::string parseFileCommand(const std::string& filePath);
+
+	// launches a frontend process listening on a port
+	static void launchFrontend(const int portNo);
+
+	// connects a socket to a frontend, retrying until it is up
+	static void connectSocket(ClientSocket* pSocket, const int portNo);
+
+	// adds a connected socket to the connection pool
+	static void addConnection(ClientSocket* pSocket, const int portNo);
+
+	// starts and connects the additional frontends of the pool
+	static void openConnectionPool();
+
+	// parses a batch of prefetched files (thread entry point)
+	static void* prefetchWorker(void* arg);
+
+	// stores a prefetch reply, or discards the entry if reply is null
+	static void storePrefetch(const std::string& filePath, const std::string* reply);
 	
 	// wait for the heartbeat thread to terminate
 	inline static void waitHBThread();
+	
+	// stop the heartbeat thread and wait for it to terminate
+	static void stopHBThread();
 		
 	// create a thread for sending heartbeat messages
 	inline static void createHBThread();
@@ -80,7 +171,7 @@ private:
 	static void* heartbeat(void* arg);
 	
 	// test whether a port number is free, return a free port number
-	static void validatePortNo(const int svrPortNo);
+	static int validatePortNo(const int svrPortNo);
 	
 	// Compiler front-end smallest unregistered port number 
 	static const int PORT_NO_LOWER_BOUND = 49152;
@@ -109,12 +200,36 @@ private:
 	// heartbeat rate (inter-hearbeat message)
 	static const int MAX_INTERVAL = 2;
 	
-	// mutual exclusion object
-	static pthread_mutex_t mutex;
+	// pool of open frontend connections; the first one is socketStream
+	static std::vector<Connection*> connections;
+
+	// maximum number of parse requests in flight on a connection
+	static const size_t PIPELINE_DEPTH = 8;
+
+	// replies of prefetched files, not yet consumed
+	static PrefetchMap prefetched;
+
+	// number of prefetch batches being processed
+	static int activeBatches;
+
+	// guards the prefetched replies and the batch count
+	static pthread_mutex_t prefetchMutex;
+
+	// signaled when a prefetched reply arrives or a batch ends
+	static pthread_cond_t prefetchCond;
 	
 	// heartbeat thread id
 	static pthread_t hb;
 	
+	// guards the heartbeat stop flag
+	static pthread_mutex_t hbMutex;
+	
+	// signaled when the heartbeat thread must stop
+	static pthread_cond_t hbCond;
+	
+	// indicates that the heartbeat thread must stop
+	static bool hbStop;
+	
 	// the port number attached to the frontend	
 	static int serverPortNo;
 		
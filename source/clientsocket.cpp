@@ -127,6 +127,9 @@ bool ClientSocket::sendAll(const char* bytes, const int len)
 * Initial : Nurudeen A. Lameed on Jun 01, 2009
 **************************************************************
 Revisions and bug fixes:
+
+agent on October 18, 2026
+Appends runs of characters rather than one character at a time.
 */
 std::string  ClientSocket::bufferedReceiveUntilNull()
 {
@@ -140,12 +143,12 @@ std::string  ClientSocket::bufferedReceiveUntilNull()
 	{
 		if (pos < endPos && buf[pos]) // data available
 		{
-			// collect them until null
-			for(; pos < endPos && buf[pos]; ++pos)
-			{
-				// append the character
-				data += buf[pos];
-			}
+			// find the end of the run of characters before the null
+			int start = pos;
+			for(; pos < endPos && buf[pos]; ++pos);
+
+			// append the whole run at once
+			data.append(buf + start, pos - start);
 		}
 		else if (pos == endPos)	// empty buffer; refill the buffer
 		{
@@ -13,7 +13,7 @@ class DimVector
 {
 	public:
 	DimVector(unsigned int s=0,size_t val=0);
-	DimVector(size_t *,size_t *);	
+	DimVector(const size_t *,const size_t *);	
 	DimVector(const DimVector& dv);
 	~DimVector();	
 	unsigned int m_n;
@@ -44,6 +44,15 @@ class DimVector
 	size_t& operator[](int index);
 	bool operator!=(const DimVector& dv) const;
 
+	private:
+	// number of dimensions stored in the vector itself
+	static const unsigned int INLINE_DIMS = 4;
+
+	// number of dimensions m_ptr can hold
+	unsigned int m_capacity;
+
+	// inline storage, m_ptr points here for up to INLINE_DIMS dimensions
+	size_t m_inline[INLINE_DIMS];
 };
 
 #else
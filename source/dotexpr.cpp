@@ -18,6 +18,7 @@
 
 // Header files
 #include "dotexpr.h"
+#include "structobj.h"
 
 /***************************************************************
 * Function: DotExpr::copy()
@@ -32,6 +33,27 @@ DotExpr* DotExpr::copy() const
 	return new DotExpr(m_pExpr->copy(),m_Field);
 }	
 
+/***************************************************************
+* Function: DotExpr::getFieldSlot()
+* Purpose : Get the slot of the field in a struct shape
+* Initial : agent on October 18, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+size_t DotExpr::getFieldSlot(const StructShape* pShape) const
+{
+	// If the shape differs from the cached one, look the field up
+	// Note: most dot expressions only ever see structs of one shape
+	if (pShape != m_pCacheShape)
+	{
+		m_cacheSlot = pShape->findSlot(m_Field);
+		m_pCacheShape = pShape;
+	}
+
+	// Return the slot of the field
+	return m_cacheSlot;
+}
+
 /***************************************************************
 * Function: BinaryOpExpr::toString()
 * Purpose : Generate a text representation of this IIR node
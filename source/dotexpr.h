@@ -25,12 +25,18 @@
 #include "expressions.h"
 #include "symbolexpr.h"
 
+// Struct shape class, defined in structobj.h
+class StructShape;
+
 /***************************************************************
 * Class   : DotExpr
 * Purpose : Represent a dot expression (struct,oop)
 * Initial : Matthieu Dubet on March 12, 2012
 ****************************************************************
 Revisions and bug fixes:
+
+agent on October 18, 2026
+Added an inline cache of the field slot for the last struct shape seen.
 */
 class DotExpr : public Expression
 {
@@ -38,7 +44,7 @@ public:
 	
 	// Constructor
 	DotExpr(Expression* pExpr, std::string field)
-	: m_pExpr(pExpr), m_Field(field)
+	: m_pExpr(pExpr), m_Field(field), m_pCacheShape(NULL), m_cacheSlot(0)
 	{ m_exprType = Expression::ExprType::DOT ; }
 	
 	// Method to recursively copy this node
@@ -54,7 +60,10 @@ public:
 	// Method to obtain a string representation of this node
 	virtual std::string toString() const;
 	
-	std::string getField() const { return m_Field; }
+	const std::string& getField() const { return m_Field; }
+	
+	// Method to get the slot of the field in a struct shape
+	size_t getFieldSlot(const StructShape* pShape) const;
 	
 	// Accessor to get the arguments
 	Expression* getExpr() const { return m_pExpr; }
@@ -70,6 +79,12 @@ protected:
 	// Symbol expression
 	std::string m_Field;
 	
+	// Last struct shape the field was looked up in
+	mutable const StructShape* m_pCacheShape;
+	
+	// Slot of the field in the cached shape
+	mutable size_t m_cacheSlot;
+	
 };
 
 #endif // #ifndef DOTEXPR_H_
@@ -66,7 +66,30 @@ void Environment::bind(Environment* pEnv, const SymbolExpr* pSymbol, DataObject*
 	SymbolExpr* pSym = const_cast<SymbolExpr*>(pSymbol);
 	
 	// Store the binding
-	pEnv->m_bindings[pSym] = pObject;
+	Binding& binding = pEnv->m_bindings[pSym];
+	binding.pObject = pObject;
+	binding.scalar = ScalarValue();
+}
+
+/***************************************************************
+* Function: static Environment::bindScalar()
+* Purpose : Bind a symbol to an unboxed scalar value
+* Initial : agent on October 18, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+void Environment::bindScalar(Environment* pEnv, const SymbolExpr* pSymbol, const ScalarValue& value)
+{
+	// Ensure that the value is valid
+	assert (value.isValid());
+	
+	// Get a non-constant pointer for the symbol
+	SymbolExpr* pSym = const_cast<SymbolExpr*>(pSymbol);
+	
+	// Store the binding, the value is only boxed if looked up
+	Binding& binding = pEnv->m_bindings[pSym];
+	binding.pObject = NULL;
+	binding.scalar = value;
 }
 
 /***************************************************************
@@ -104,6 +127,10 @@ bool Environment::unbind(Environment* pEnv, const SymbolExpr* pSymbol)
 * Initial : Maxime Chevalier-Boisvert on November 12, 2008
 ****************************************************************
 Revisions and bug fixes:
+
+agent on October 18, 2026
+Unboxed scalar bindings are boxed and rebound to the box, so that
+objects modified in place stay in sync with the binding.
 */
 DataObject* Environment::lookup(const Environment* pEnv, const SymbolExpr* pSymbol)
 {
@@ -111,7 +138,7 @@ DataObject* Environment::lookup(const Environment* pEnv, const SymbolExpr* pSymb
 	SymbolExpr* pSym = const_cast<SymbolExpr*>(pSymbol);
 	
 	// Attempt to find the binding in this environment
-	SymbolMap::const_iterator bindItr = pEnv->m_bindings.find(pSym);
+	SymbolMap::iterator bindItr = pEnv->m_bindings.find(pSym);
 	
 	// If the binding was found
 	if (bindItr != pEnv->m_bindings.end())
@@ -119,8 +146,18 @@ DataObject* Environment::lookup(const Environment* pEnv, const SymbolExpr* pSymb
 		// Increment the environment lookup count
 		PROF_INCR_COUNTER(Profiler::ENV_LOOKUP_COUNT);
 		
+		// Get a reference to the binding
+		Binding& binding = bindItr->second;
+		
+		// If the value is unboxed, box it and bind the box instead
+		if (binding.pObject == NULL && binding.scalar.isValid())
+		{
+			binding.pObject = binding.scalar.box();
+			binding.scalar = ScalarValue();
+		}
+		
 		// Return the object bound to this symbol
-		return bindItr->second;
+		return binding.pObject;
 	}
 	
 	// If there is a parent environment
@@ -134,6 +171,52 @@ DataObject* Environment::lookup(const Environment* pEnv, const SymbolExpr* pSymb
 	return NULL;
 }
 
+/***************************************************************
+* Function: static Environment::lookupScalar()
+* Purpose : Lookup the value of a real or logical scalar symbol
+* Initial : agent on October 18, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+bool Environment::lookupScalar(const Environment* pEnv, const SymbolExpr* pSymbol, ScalarValue& value)
+{
+	// Get a non-constant pointer for the symbol
+	SymbolExpr* pSym = const_cast<SymbolExpr*>(pSymbol);
+	
+	// Attempt to find the binding in this environment
+	SymbolMap::const_iterator bindItr = pEnv->m_bindings.find(pSym);
+	
+	// If the binding was found
+	if (bindItr != pEnv->m_bindings.end())
+	{
+		// Increment the environment lookup count
+		PROF_INCR_COUNTER(Profiler::ENV_LOOKUP_COUNT);
+		
+		// Get a reference to the binding
+		const Binding& binding = bindItr->second;
+		
+		// If the value is unboxed, return it directly
+		if (binding.scalar.isValid())
+		{
+			value = binding.scalar;
+			return true;
+		}
+		
+		// Otherwise, try to unbox the bound object
+		return (binding.pObject != NULL && ScalarValue::unbox(binding.pObject, value));
+	}
+	
+	// If there is a parent environment
+	if (pEnv->m_pParent != NULL)
+	{
+		// lookup the binding in the parent environment
+		return lookupScalar(pEnv->m_pParent, pSymbol, value);
+	}
+		
+	// Symbol binding not found
+	return false;
+}
+
 /***************************************************************
 * Function: static Environment::extend()
 * Purpose : Extend an environment object
@@ -25,6 +25,7 @@
 #include <unordered_map>
 #include "symbolexpr.h"
 #include "objects.h"
+#include "scalarvalue.h"
 #include "utility.h"
 
 #include <gc_cpp.h>
@@ -34,6 +35,9 @@
 * Initial : Maxime Chevalier-Boisvert on November 12, 2008
 ****************************************************************
 Revisions and bug fixes:
+
+agent on October 18, 2026
+Bindings can hold unboxed scalar values, which are boxed on lookup.
 */
 class Environment
 : public gc
@@ -57,9 +61,15 @@ public:
 	// Method to remove a binding
 	static bool unbind(Environment* pEnv, const SymbolExpr* pSymbol);
 	
+	// Method to create a binding to an unboxed scalar value
+	static void bindScalar(Environment* pEnv, const SymbolExpr* pSymbol, const ScalarValue& value);
+	
 	// Method to lookup a symbol
 	static DataObject* lookup(const Environment* pEnv, const SymbolExpr* pSymbol);
 
+	// Method to lookup the value of a symbol bound to a real or logical scalar
+	static bool lookupScalar(const Environment* pEnv, const SymbolExpr* pSymbol, ScalarValue& value);
+
 	// Method to extend an environment object
 	static Environment* extend(Environment* pParent);
 	
@@ -71,13 +81,25 @@ private:
 	// Private constructor for extension
 	Environment(Environment* pParent);
 	
+	// Binding type definition
+	// Note: a binding holds either an object or an unboxed scalar
+	struct Binding
+	{
+		// Bound object, NULL if the value is unboxed
+		DataObject* pObject;
+		
+		// Unboxed scalar value
+		ScalarValue scalar;
+	};
+	
 	// Symbol map type definition
         // FIXME GC
 	//typedef std::unordered_map<SymbolExpr*, DataObject*, std::hash<SymbolExpr*>, std::equal_to<SymbolExpr*>, gc_allocator<DataObject*>> SymbolMap;
-	typedef std::unordered_map<SymbolExpr*, DataObject*> SymbolMap;
+	typedef std::unordered_map<SymbolExpr*, Binding> SymbolMap;
 	
 	// Bindings of the environment
-	SymbolMap m_bindings;
+	// Note: mutable because lookups box unboxed scalar bindings
+	mutable SymbolMap m_bindings;
 
 	// Pointer to parent environment
 	Environment* m_pParent;
@@ -86,7 +86,8 @@ public:
 	// Default constructor
 	LibFunction(const std::string& name, FnPointer function, TypeMapFunc typeMapping = nullTypeMapping)
 	: m_pHostFunc(function), 
-	  m_pTypeMapFunc(typeMapping) 
+	  m_pTypeMapFunc(typeMapping),
+	  m_acceptsRange(false)
 	{ m_isProgFunction = false; m_funcName = name; }
 	
 	// Method to recursively copy this node
@@ -101,6 +102,10 @@ public:
 	// Accessors to get a pointer to the type mapping function
 	TypeMapFunc getTypeMapping() const { return m_pTypeMapFunc; }
 	
+	// Accessors to test and set if a lone argument may be passed as a lazy range
+	bool acceptsRange() const { return m_acceptsRange; }
+	void setAcceptsRange(bool accepts) { m_acceptsRange = accepts; }
+	
 private:
 
 	// Pointer to host function
@@ -108,6 +113,9 @@ private:
 	
 	// Pointer to type mapping function
 	TypeMapFunc m_pTypeMapFunc;
+	
+	// Flag indicating that a lone argument may be passed as a lazy range
+	bool m_acceptsRange;
 };
 
 /***************************************************************
@@ -146,6 +154,9 @@ public:
 	// Method to create a temporary variable in this function
 	SymbolExpr* createTemp();
 	
+	// Method to avoid reusing the temp names of another function
+	void reserveTemps(const ProgFunction* pOther) { if (pOther->m_nextTempId > m_nextTempId) m_nextTempId = pOther->m_nextTempId; }
+	
 	// Method to get all symbols used/read in this function
 	Expression::SymbolSet getSymbolUses() const;
 	
@@ -0,0 +1,143 @@
+// =========================================================================== //
+//                                                                             //
+// Copyright 2026 agent.                                                       //
+//                                                                             //
+//   Licensed under the Apache License, Version 2.0 (the "License");           //
+//   you may not use this file except in compliance with the License.          //
+//   You may obtain a copy of the License at                                   //
+//                                                                             //
+//       http://www.apache.org/licenses/LICENSE-2.0                            //
+//                                                                             //
+//   Unless required by applicable law or agreed to in writing, software       //
+//   distributed under the License is distributed on an "AS IS" BASIS,         //
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  //
+//   See the License for the specific language governing permissions and       //
+//  limitations under the License.                                             //
+//                                                                             //
+// =========================================================================== //
+
+
+// Header files
+#include "gcmanager.h"
+#include "profiling.h"
+
+// Initial heap size config variable (in megabytes, 0 for the collector default)
+ConfigVar GCManager::s_initHeapVar("gc_initial_heap", ConfigVar::INT, "0", 0, 65536);
+
+// Free space divisor config variable, larger values collect more often in a smaller heap
+ConfigVar GCManager::s_freeDivisorVar("gc_free_space_divisor", ConfigVar::INT, "3", 1, 100);
+
+// Incremental collection config variable
+ConfigVar GCManager::s_incrementalVar("gc_incremental", ConfigVar::BOOL, "false");
+
+// Parallel marker thread count config variable (0 for the collector default)
+ConfigVar GCManager::s_markersVar("gc_markers", ConfigVar::INT, "0", 0, 64);
+
+// Start time of the current collection
+double GCManager::s_pauseStart = 0;
+
+/***************************************************************
+* Function: GCManager::registerConfigVars()
+* Purpose : Register the collector config variables
+* Initial : agent on October 18, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+void GCManager::registerConfigVars()
+{
+	// Register the heap sizing variables
+	ConfigManager::registerVar(&s_initHeapVar);
+	ConfigManager::registerVar(&s_freeDivisorVar);
+
+	// Register the collection mode variables
+	ConfigManager::registerVar(&s_incrementalVar);
+	ConfigManager::registerVar(&s_markersVar);
+}
+
+/***************************************************************
+* Function: GCManager::initialize()
+* Purpose : Apply the collector settings
+* Initial : agent on October 18, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+void GCManager::initialize()
+{
+	// Set the number of marker threads
+	// Note: this only has an effect if the collector has not
+	// yet started, otherwise, the GC_MARKERS environment
+	// variable must be used instead
+	if (s_markersVar.getIntValue() > 0)
+		GC_set_markers_count((unsigned)s_markersVar.getIntValue());
+
+	// Ensure the collector is initialized
+	GC_INIT();
+
+	// Set the free space divisor
+	GC_set_free_space_divisor((unsigned long)s_freeDivisorVar.getIntValue());
+
+	// If an initial heap size was given, grow the heap to it
+	size_t initHeap = size_t(s_initHeapVar.getIntValue()) << 20;
+	if (initHeap > GC_get_heap_size())
+		GC_expand_hp(initHeap - GC_get_heap_size());
+
+	// If requested, switch to incremental collection
+	if (s_incrementalVar.getBoolValue() == true)
+		GC_enable_incremental();
+
+	// Record the statistics of each collection
+	GC_set_on_collection_event(collectionEvent);
+}
+
+/***************************************************************
+* Function: GCManager::collectionEvent()
+* Purpose : Collection event callback
+* Initial : agent on October 18, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+void GCManager::collectionEvent(GC_EventType eventType)
+{
+	// Note: this is called with the allocation lock held,
+	// so it must neither allocate nor call locking functions
+
+	// If a collection is starting
+	if (eventType == GC_EVENT_START)
+	{
+		// Get the heap statistics as of this collection
+		GC_prof_stats_s stats;
+		GC_get_prof_stats_unsafe(&stats, sizeof(stats));
+
+		// Accumulate the bytes allocated since the last collection
+		uint64 allocBytes = PROF_GET_COUNTER(Profiler::GC_ALLOC_BYTES);
+		PROF_SET_COUNTER(Profiler::GC_ALLOC_BYTES, allocBytes + stats.bytes_allocd_since_gc);
+
+		// Store the current heap size
+		PROF_SET_COUNTER(Profiler::GC_HEAP_BYTES, stats.heapsize_full);
+
+		// Increment the collection count
+		PROF_INCR_COUNTER(Profiler::GC_COLLECT_COUNT);
+
+		// Start timing the pause
+		PROF_START_TIMER(Profiler::GC_TIME_TOTAL);
+		s_pauseStart = Profiler::getTimeSeconds();
+	}
+
+	// If a collection has completed
+	else if (eventType == GC_EVENT_END)
+	{
+		// Stop timing the pause
+		PROF_STOP_TIMER(Profiler::GC_TIME_TOTAL);
+		double pauseTime = Profiler::getTimeSeconds() - s_pauseStart;
+
+		// Add the pause to the pause time histogram
+		if (pauseTime < 0.001)
+			PROF_INCR_COUNTER(Profiler::GC_PAUSE_1MS_COUNT);
+		else if (pauseTime < 0.01)
+			PROF_INCR_COUNTER(Profiler::GC_PAUSE_10MS_COUNT);
+		else if (pauseTime < 0.1)
+			PROF_INCR_COUNTER(Profiler::GC_PAUSE_100MS_COUNT);
+		else
+			PROF_INCR_COUNTER(Profiler::GC_PAUSE_LONG_COUNT);
+	}
+}
@@ -0,0 +1,67 @@
+// =========================================================================== //
+//                                                                             //
+// Copyright 2026 agent.                                                       //
+//                                                                             //
+//   Licensed under the Apache License, Version 2.0 (the "License");           //
+//   you may not use this file except in compliance with the License.          //
+//   You may obtain a copy of the License at                                   //
+//                                                                             //
+//       http://www.apache.org/licenses/LICENSE-2.0                            //
+//                                                                             //
+//   Unless required by applicable law or agreed to in writing, software       //
+//   distributed under the License is distributed on an "AS IS" BASIS,         //
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  //
+//   See the License for the specific language governing permissions and       //
+//  limitations under the License.                                             //
+//                                                                             //
+// =========================================================================== //
+
+
+// Include guards
+#ifndef GCMANAGER_H_
+#define GCMANAGER_H_
+
+// Header files
+#include <gc/gc.h>
+#include "platform.h"
+#include "configmanager.h"
+
+/***************************************************************
+* Class   : GCManager
+* Purpose : Tune the garbage collector and gather its statistics
+* Initial : agent on October 18, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+class GCManager
+{
+public:
+
+	// Method to register the collector config variables
+	static void registerConfigVars();
+
+	// Method to apply the collector settings
+	static void initialize();
+
+	// Initial heap size config variable (in megabytes)
+	static ConfigVar s_initHeapVar;
+
+	// Free space divisor config variable
+	static ConfigVar s_freeDivisorVar;
+
+	// Incremental collection config variable
+	static ConfigVar s_incrementalVar;
+
+	// Parallel marker thread count config variable
+	static ConfigVar s_markersVar;
+
+private:
+
+	// Collection event callback, records the collection statistics
+	static void collectionEvent(GC_EventType eventType);
+
+	// Start time of the current collection
+	static double s_pauseStart;
+};
+
+#endif // #ifndef GCMANAGER_H_
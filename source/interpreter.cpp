@@ -31,6 +31,8 @@
 #include "rangeexpr.h"
 #include "constexprs.h"
 #include "cellindexexpr.h"
+#include "filesystem.h"
+#include "client.h"
 
 #ifdef MCVM_USE_JIT
 #include "jitcompiler.h"
@@ -42,6 +44,21 @@ ConfigVar Interpreter::s_validateTypes("validate_type_infer", ConfigVar::BOOL, "
 // Config variable to enable/disable type inference profiling
 ConfigVar Interpreter::s_profTypeInfer("profile_type_infer", ConfigVar::BOOL, "false");
 
+// Config variable to enable/disable background parsing of called m-files
+ConfigVar Interpreter::s_prefetchDeps("prefetch_deps", ConfigVar::BOOL, "true");
+
+// Config variable to enable/disable unboxed scalar evaluation
+ConfigVar Interpreter::s_unboxScalars("unbox_scalars", ConfigVar::BOOL, "true");
+
+// Config variable to enable/disable column storage of struct arrays
+ConfigVar Interpreter::s_structColumns("struct_columns", ConfigVar::BOOL, "true");
+
+// Config variable to enable/disable lazy evaluation of ranges
+ConfigVar Interpreter::s_lazyRanges("lazy_ranges", ConfigVar::BOOL, "true");
+
+// Config variable to enable/disable packed storage of cell arrays
+ConfigVar Interpreter::s_cellPacking("cell_packing", ConfigVar::BOOL, "true");
+
 // Static global environment variable
 Environment Interpreter::s_globalEnv;
 
@@ -67,6 +84,11 @@ void Interpreter::initialize()
 	// Register the local config variables
 	ConfigManager::registerVar(&s_validateTypes);
 	ConfigManager::registerVar(&s_profTypeInfer);
+	ConfigManager::registerVar(&s_prefetchDeps);
+	ConfigManager::registerVar(&s_unboxScalars);
+	ConfigManager::registerVar(&s_structColumns);
+	ConfigManager::registerVar(&s_lazyRanges);
+	ConfigManager::registerVar(&s_cellPacking);
 
 	// Get the static "nargin" and "nargout" symbol object
 	s_pNarginSym = SymbolExpr::getSymbol("nargin");
@@ -135,6 +157,9 @@ ArrayObj* Interpreter::callByName(const std::string& funcName, ArrayObj* pArgume
 * Initial : Maxime Chevalier-Boisvert on November 13, 2008
 ****************************************************************
 Revisions and bug fixes:
+
+agent on October 18, 2026
+Arguments are bound as lazy copies sharing the caller's elements.
 */
 ArrayObj* Interpreter::callFunction(Function* pFunction, ArrayObj* pArguments, size_t nargout)
 {
@@ -219,7 +244,8 @@ ArrayObj* Interpreter::callFunction(Function* pFunction, ArrayObj* pArguments, s
 					SymbolExpr* pSymbol = inParams[i];
 
 					// Create a binding in the calling environment
-					Environment::bind(pCallEnv, pSymbol, pValue->copy());
+					// Note: the elements are only copied if the callee writes to them
+					Environment::bind(pCallEnv, pSymbol, pValue->lazyCopy());
 				}
 
 				// Bind the "nargin" symbol in the calling environment
@@ -771,6 +797,11 @@ void Interpreter::execSeqStmt(const StmtSequence* pSeqStmt, Environment* pEnv)
 * Initial : Maxime Chevalier-Boisvert on November 13, 2008
 ****************************************************************
 Revisions and bug fixes:
+
+agent on October 18, 2026
+Matrices assigned from a variable are lazily copied so that writes
+to one variable are not seen through the other.
+Scalar results assigned to a variable are bound unboxed.
 */
 void Interpreter::evalAssignStmt(const AssignStmt* pStmt, Environment* pEnv)
 {
@@ -780,6 +811,36 @@ void Interpreter::evalAssignStmt(const AssignStmt* pStmt, Environment* pEnv)
 	// Get pointers to the right expression
 	Expression* pRightExpr = pStmt->getRightExpr();
 
+	// If this is a single assignment to a variable and the right
+	// expression is not a call or an indexing operation
+	if (s_unboxScalars.getBoolValue() &&
+		leftExprs.size() == 1 &&
+		leftExprs.front()->getExprType() == Expression::ExprType::SYMBOL &&
+		pRightExpr->getExprType() != Expression::ExprType::PARAM)
+	{
+		// Attempt to evaluate the right expression as a scalar
+		ScalarValue scalarVal;
+		if (evalScalarExpr(pRightExpr, pEnv, scalarVal))
+		{
+			// Get a typed pointer to the symbol
+			SymbolExpr* pSymExpr = (SymbolExpr*)leftExprs.front();
+
+			// Bind the unboxed value
+			Environment::bindScalar(pEnv, pSymExpr, scalarVal);
+
+			// If output should be presented
+			if (!pStmt->getSuppressFlag())
+			{
+				// Display the symbol name and the value
+				std::cout << pSymExpr->toString() << " = "  << std::endl;
+				std::cout << Environment::lookup(pEnv, pSymExpr)->toString() << std::endl;
+			}
+
+			// Assignment complete
+			return;
+		}
+	}
+
 	// Declare a variable to store the evaluation result
 	DataObject* pResult;
 
@@ -796,6 +857,13 @@ void Interpreter::evalAssignStmt(const AssignStmt* pStmt, Environment* pEnv)
 		// Evaluate the symbol expression directly to preserve possible multiple outputs
 		// NOTE: this is because the symbol expression may be a function call
 		pResult = evalSymbolExpr((SymbolExpr*)pRightExpr, pEnv, leftExprs.size());		
+		
+		// If the result is a matrix (structs are copied below)
+		if (pResult->isMatrixObj() && pResult->getType() != DataObject::Type::STRUCTARRAY)
+		{
+			// Share its elements until either variable is written
+			pResult = pResult->lazyCopy();
+		}
 	}
 	
 	// Otherwise, for any other type of right expression
@@ -978,6 +1046,9 @@ void Interpreter::assignObject(const Expression* pLeftExpr, DataObject* pRightOb
 * Initial : Maxime Chevalier-Boisvert on February 17, 2009
 ****************************************************************
 Revisions and bug fixes:
+
+agent on October 18, 2026
+Arithmetic on ranges is kept lazy, for strided slicing.
 */
 ArrayObj* Interpreter::evalIndexArgs(const Expression::ExprVector& argVector, Environment* pEnv)
 {
@@ -1001,8 +1072,8 @@ ArrayObj* Interpreter::evalIndexArgs(const Expression::ExprVector& argVector, En
 		}
 		else
 		{
-			// Evaluate the expression normally
-			pValue = evalExpression(pExpr, pEnv);
+			// Evaluate the expression, arithmetic on ranges stays lazy
+			pValue = evalOperand(pExpr, pEnv);
 		}
 
 		// Add the value to the argument array
@@ -1080,17 +1151,33 @@ void Interpreter::evalExprStmt(const ExprStmt* pStmt, Environment* pEnv)
 * Initial : Maxime Chevalier-Boisvert on November 13, 2008
 ****************************************************************
 Revisions and bug fixes:
+
+agent on October 18, 2026
+Scalar conditions are evaluated without boxing.
 */
 void Interpreter::evalIfStmt(const IfElseStmt* pStmt, Environment* pEnv)
 {
 	// Get a reference to the condition expression
 	Expression* pCondExpr = pStmt->getCondition();
 
-	// Evaluate the condition expression
-	DataObject* pCondVal = evalExpression(pCondExpr, pEnv);
+	// Declare a variable for the boolean condition value
+	bool boolCondVal;
 
-	// Evaluate the condition value as a boolean
-	bool boolCondVal = getBoolValue(pCondVal);
+	// Attempt to evaluate the condition as a scalar
+	ScalarValue scalarVal;
+	if (s_unboxScalars.getBoolValue() && evalScalarExpr(pCondExpr, pEnv, scalarVal))
+	{
+		// Get the truth value of the scalar
+		boolCondVal = scalarVal.toBool();
+	}
+	else
+	{
+		// Evaluate the condition expression
+		DataObject* pCondVal = evalExpression(pCondExpr, pEnv);
+
+		// Evaluate the condition value as a boolean
+		boolCondVal = getBoolValue(pCondVal);
+	}
 
 	// If the condition evaluated to a true value
 	if (boolCondVal == true)
@@ -1113,26 +1200,56 @@ void Interpreter::evalIfStmt(const IfElseStmt* pStmt, Environment* pEnv)
 * Initial : Maxime Chevalier-Boisvert on January 23, 2009
 ****************************************************************
 Revisions and bug fixes:
+
+agent on October 18, 2026
+Scalar test variables are read without boxing.
 */
 void Interpreter::evalLoopStmt(const LoopStmt* pLoopStmt, Environment* pEnv)
 {
 	// Execute the loop initialization code
 	execSeqStmt(pLoopStmt->getInitSeq(), pEnv);
 
+	// Execute the loop iterations
+	evalLoopIterations(pLoopStmt, pEnv, true);
+}
+
+/***************************************************************
+* Function: Interpreter::evalLoopIterations()
+* Purpose : Evaluate the iterations of a loop statement
+* Initial : agent on October 18, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+void Interpreter::evalLoopIterations(const LoopStmt* pLoopStmt, Environment* pEnv, bool execTestSeq)
+{
 	// Loop until the test condition is not met
-	for (;;)
+	for (;; execTestSeq = true)
 	{
 		// Execute the loop test condition code
-		execSeqStmt(pLoopStmt->getTestSeq(), pEnv);
+		if (execTestSeq)
+			execSeqStmt(pLoopStmt->getTestSeq(), pEnv);
+
+		// Declare a variable for the boolean test result
+		bool boolResult;
 
-		// Lookup the test variable
-		DataObject* pTestResult = Environment::lookup(pEnv, pLoopStmt->getTestVar());
+		// If the test variable holds a scalar, read it unboxed
+		ScalarValue scalarVal;
+		if (Environment::lookupScalar(pEnv, pLoopStmt->getTestVar(), scalarVal))
+		{
+			// Get the truth value of the scalar
+			boolResult = scalarVal.toBool();
+		}
+		else
+		{
+			// Lookup the test variable
+			DataObject* pTestResult = Environment::lookup(pEnv, pLoopStmt->getTestVar());
 
-		// Ensure the lookup was successful
-		assert (pTestResult != NULL);
+			// Ensure the lookup was successful
+			assert (pTestResult != NULL);
 
-		// Evaluate the boolean value of the test result
-		bool boolResult = getBoolValue(pTestResult);
+			// Evaluate the boolean value of the test result
+			boolResult = getBoolValue(pTestResult);
+		}
 
 		// If the result is false, prevent the body from executing
 		if (boolResult == false)
@@ -1163,6 +1280,114 @@ void Interpreter::evalLoopStmt(const LoopStmt* pLoopStmt, Environment* pEnv)
 	}
 }
 
+/***************************************************************
+* Function: Interpreter::resumeSeqStmt()
+* Purpose : Execute the code following a statement nested in
+*           a sequence, as if execution had just reached it
+* Initial : agent on October 18, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+bool Interpreter::resumeSeqStmt(const StmtSequence* pSeqStmt, const Statement* pStmt, Environment* pEnv)
+{
+	// Get the statements of the sequence
+	const StmtSequence::StmtVector& stmts = pSeqStmt->getStatements();
+
+	// For each statement
+	for (size_t i = 0; i < stmts.size(); ++i)
+	{
+		// Get a pointer to the current statement
+		const Statement* pCurStmt = stmts[i];
+
+		// Declare a flag to indicate that execution resumed in this statement
+		bool resumed = false;
+
+		// If this is the statement to resume after
+		if (pCurStmt == pStmt)
+		{
+			resumed = true;
+		}
+
+		// If this is an if-else statement, resume in its branches
+		else if (pCurStmt->getStmtType() == Statement::IF_ELSE)
+		{
+			const IfElseStmt* pIfStmt = (const IfElseStmt*)pCurStmt;
+			resumed = resumeSeqStmt(pIfStmt->getIfBlock(), pStmt, pEnv) || resumeSeqStmt(pIfStmt->getElseBlock(), pStmt, pEnv);
+		}
+
+		// If this is a loop statement, resume in its sequences
+		else if (pCurStmt->getStmtType() == Statement::LOOP)
+		{
+			// Get a typed pointer to the loop statement
+			const LoopStmt* pLoopStmt = (const LoopStmt*)pCurStmt;
+
+			// If the statement is in the initialization code, execute the iterations
+			if (resumeSeqStmt(pLoopStmt->getInitSeq(), pStmt, pEnv))
+			{
+				evalLoopIterations(pLoopStmt, pEnv, true);
+				resumed = true;
+			}
+
+			// If the statement is in the test code, test the condition and iterate
+			else if (resumeSeqStmt(pLoopStmt->getTestSeq(), pStmt, pEnv))
+			{
+				evalLoopIterations(pLoopStmt, pEnv, false);
+				resumed = true;
+			}
+
+			// Otherwise, look for the statement in the loop body
+			// Note: the body code is only executed once the statement is found,
+			// so a break or continue exception implies that it was found
+			else
+			{
+				try
+				{
+					resumed = resumeSeqStmt(pLoopStmt->getBodySeq(), pStmt, pEnv);
+				}
+				catch (BreakExcept e)
+				{
+					// The loop is exited, continue after it
+					resumed = true;
+					pLoopStmt = NULL;
+				}
+				catch (ContinueExcept e)
+				{
+					// Increment the loop normally
+					resumed = true;
+				}
+
+				// If the body was resumed, increment the index and iterate
+				if (resumed && pLoopStmt != NULL)
+				{
+					execSeqStmt(pLoopStmt->getIncrSeq(), pEnv);
+					evalLoopIterations(pLoopStmt, pEnv, true);
+				}
+
+				// If the statement is in the incrementation code, iterate
+				else if (resumed == false && resumeSeqStmt(pLoopStmt->getIncrSeq(), pStmt, pEnv))
+				{
+					evalLoopIterations(pLoopStmt, pEnv, true);
+					resumed = true;
+				}
+			}
+		}
+
+		// If execution resumed in this statement
+		if (resumed)
+		{
+			// Execute the following statements
+			for (size_t j = i + 1; j < stmts.size(); ++j)
+				execStatement(stmts[j], pEnv);
+
+			// The statement was found
+			return true;
+		}
+	}
+
+	// The statement is not in this sequence
+	return false;
+}
+
 /***************************************************************
 * Function: Interpreter::evalExpression()
 * Purpose : Evaluate an expression
@@ -1347,6 +1572,332 @@ DataObject* Interpreter::evalExpression(const Expression* pExpr, Environment* pE
 	}
 }
 
+/***************************************************************
+* Function: Interpreter::evalScalarExpr()
+* Purpose : Evaluate a scalar expression without boxing
+* Initial : agent on October 18, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+bool Interpreter::evalScalarExpr(const Expression* pExpr, Environment* pEnv, ScalarValue& value)
+{
+	// Note: only expressions without side effects are handled here, so
+	// that if this fails, the expression can be evaluated again normally
+
+	// Switch on the expression type
+	switch (pExpr->getExprType())
+	{
+		// Numerical constants
+		case Expression::ExprType::INT_CONST:
+		value = ScalarValue::makeF64(((IntConstExpr*)pExpr)->getValue());
+		break;
+		case Expression::ExprType::FP_CONST:
+		value = ScalarValue::makeF64(((FPConstExpr*)pExpr)->getValue());
+		break;
+
+		// Symbol expression
+		case Expression::ExprType::SYMBOL:
+		{
+			// Read the variable, if it holds a real or logical scalar
+			// Note: functions and undefined symbols are not handled here
+			if (Environment::lookupScalar(pEnv, (SymbolExpr*)pExpr, value) == false)
+				return false;
+		}
+		break;
+
+		// Unary operator expression
+		case Expression::ExprType::UNARY_OP:
+		{
+			// Get a typed pointer to the expression
+			UnaryOpExpr* pUnaryExpr = (UnaryOpExpr*)pExpr;
+
+			// Evaluate the operand
+			ScalarValue operand;
+			if (evalScalarExpr(pUnaryExpr->getOperand(), pEnv, operand) == false)
+				return false;
+
+			// Switch on the operator type
+			switch (pUnaryExpr->getOperator())
+			{
+				// Unary plus and transposition do not change scalars
+				case UnaryOpExpr::PLUS:
+				case UnaryOpExpr::TRANSP:
+				case UnaryOpExpr::ARRAY_TRANSP:
+				value = operand;
+				break;
+
+				// Arithmetic negation produces a real value
+				case UnaryOpExpr::MINUS:
+				value = ScalarValue::makeF64(-operand.toF64());
+				break;
+
+				// Logical negation, which is an error for NaN values
+				case UnaryOpExpr::NOT:
+				{
+					if (!operand.isBool() && operand.toF64() != operand.toF64())
+						return false;
+					value = ScalarValue::makeBool(!operand.toBool());
+				}
+				break;
+
+				// Other operators are not handled
+				default:
+				return false;
+			}
+		}
+		break;
+
+		// Binary operator expression
+		case Expression::ExprType::BINARY_OP:
+		{
+			// Get a typed pointer to the expression
+			BinaryOpExpr* pBinaryExpr = (BinaryOpExpr*)pExpr;
+
+			// Get the operator type
+			BinaryOpExpr::Operator op = pBinaryExpr->getOperator();
+
+			// Evaluate the left operand
+			ScalarValue left;
+			if (evalScalarExpr(pBinaryExpr->getLeftExpr(), pEnv, left) == false)
+				return false;
+
+			// Short-circuit the logical operators if possible
+			if (op == BinaryOpExpr::OR && left.toBool() == true)
+			{
+				value = ScalarValue::makeBool(true);
+				break;
+			}
+			if (op == BinaryOpExpr::AND && left.toBool() == false)
+			{
+				value = ScalarValue::makeBool(false);
+				break;
+			}
+
+			// Evaluate the right operand
+			ScalarValue right;
+			if (evalScalarExpr(pBinaryExpr->getRightExpr(), pEnv, right) == false)
+				return false;
+
+			// Get the operand values
+			float64 a = left.toF64();
+			float64 b = right.toF64();
+
+			// Switch on the operator type
+			switch (op)
+			{
+				// Arithmetic operators
+				case BinaryOpExpr::PLUS: value = ScalarValue::makeF64(a + b); break;
+				case BinaryOpExpr::MINUS: value = ScalarValue::makeF64(a - b); break;
+				case BinaryOpExpr::MULT: case BinaryOpExpr::ARRAY_MULT: value = ScalarValue::makeF64(a * b); break;
+				case BinaryOpExpr::DIV: case BinaryOpExpr::ARRAY_DIV: value = ScalarValue::makeF64(a / b); break;
+				case BinaryOpExpr::LEFT_DIV: case BinaryOpExpr::ARRAY_LEFT_DIV: value = ScalarValue::makeF64(b / a); break;
+
+				// Exponentiation, complex results are left to the generic path
+				case BinaryOpExpr::POWER:
+				case BinaryOpExpr::ARRAY_POWER:
+				{
+					if (a < 0 && b != floor(b))
+						return false;
+					value = ScalarValue::makeF64(pow(a, b));
+				}
+				break;
+
+				// Comparison operators
+				case BinaryOpExpr::EQUAL: value = ScalarValue::makeBool(a == b); break;
+				case BinaryOpExpr::NOT_EQUAL: value = ScalarValue::makeBool(a != b); break;
+				case BinaryOpExpr::LESS_THAN: value = ScalarValue::makeBool(a < b); break;
+				case BinaryOpExpr::LESS_THAN_EQ: value = ScalarValue::makeBool(a <= b); break;
+				case BinaryOpExpr::GREATER_THAN: value = ScalarValue::makeBool(a > b); break;
+				case BinaryOpExpr::GREATER_THAN_EQ: value = ScalarValue::makeBool(a >= b); break;
+
+				// Logical operators
+				case BinaryOpExpr::OR: case BinaryOpExpr::ARRAY_OR: value = ScalarValue::makeBool(left.toBool() || right.toBool()); break;
+				case BinaryOpExpr::AND: case BinaryOpExpr::ARRAY_AND: value = ScalarValue::makeBool(left.toBool() && right.toBool()); break;
+
+				// Other operators are not handled
+				default:
+				return false;
+			}
+		}
+		break;
+
+		// Other expression types are not handled
+		default:
+		return false;
+	}
+
+	// Increment the unboxed evaluation count
+	PROF_INCR_COUNTER(Profiler::SCALAR_UNBOXED_COUNT);
+
+	// Evaluation successful
+	return true;
+}
+
+/***************************************************************
+* Function: Interpreter::isLazyRangeExpr()
+* Purpose : Test if an expression may evaluate to a lazy range
+* Initial : agent on October 18, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+bool Interpreter::isLazyRangeExpr(const Expression* pExpr)
+{
+	// Range expressions other than the full range are lazy
+	if (pExpr->getExprType() == Expression::ExprType::RANGE)
+		return !((RangeExpr*)pExpr)->isFullRange();
+
+	// Other expressions must be binary operations
+	if (pExpr->getExprType() != Expression::ExprType::BINARY_OP)
+		return false;
+
+	// Get a typed pointer to the binary expression
+	const BinaryOpExpr* pBinExpr = (BinaryOpExpr*)pExpr;
+
+	// Switch on the operator type
+	switch (pBinExpr->getOperator())
+	{
+		// Operators that map ranges to ranges when applied with a scalar
+		case BinaryOpExpr::PLUS:
+		case BinaryOpExpr::MINUS:
+		case BinaryOpExpr::MULT:
+		case BinaryOpExpr::ARRAY_MULT:
+		case BinaryOpExpr::DIV:
+		case BinaryOpExpr::ARRAY_DIV:
+		return isLazyRangeExpr(pBinExpr->getLeftExpr()) || isLazyRangeExpr(pBinExpr->getRightExpr());
+
+		// Other operators do not produce ranges
+		default:
+		return false;
+	}
+}
+
+/***************************************************************
+* Function: Interpreter::evalOperand()
+* Purpose : Evaluate an operand, keeping ranges unexpanded
+* Initial : agent on October 18, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+DataObject* Interpreter::evalOperand(const Expression* pExpr, Environment* pEnv)
+{
+	// If the expression cannot produce a lazy range, evaluate it normally
+	if (!s_lazyRanges.getBoolValue() || !isLazyRangeExpr(pExpr))
+		return evalExpression(pExpr, pEnv);
+
+	// If this is a range expression, evaluate it without expanding it
+	if (pExpr->getExprType() == Expression::ExprType::RANGE)
+		return evalRangeExpr((RangeExpr*)pExpr, pEnv, false);
+
+	// Evaluate the arithmetic on the range
+	return evalRangeArithExpr((BinaryOpExpr*)pExpr, pEnv);
+}
+
+/***************************************************************
+* Function: Interpreter::evalRangeArithExpr()
+* Purpose : Evaluate arithmetic over ranges, keeping the
+*           result lazy when it is also a range
+* Initial : agent on October 18, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+DataObject* Interpreter::evalRangeArithExpr(const BinaryOpExpr* pExpr, Environment* pEnv)
+{
+	// Get the operator type
+	BinaryOpExpr::Operator op = pExpr->getOperator();
+
+	// Evaluate the operands, keeping ranges unexpanded
+	DataObject* pLeftVal = evalOperand(pExpr->getLeftExpr(), pEnv);
+	DataObject* pRightVal = evalOperand(pExpr->getRightExpr(), pEnv);
+
+	// Determine which operands are ranges
+	bool leftRange = (pLeftVal->getType() == DataObject::Type::RANGE);
+	bool rightRange = (pRightVal->getType() == DataObject::Type::RANGE);
+
+	// Get the other operand of a range, if it is a real scalar
+	DataObject* pOther = leftRange? pRightVal:pLeftVal;
+	bool otherScalar = (pOther->getType() == DataObject::Type::MATRIX_F64 && ((MatrixF64Obj*)pOther)->isScalar());
+
+	// If one operand is a range and the other is a real scalar
+	if (leftRange != rightRange && otherScalar)
+	{
+		// Get the range and the scalar value
+		const RangeObj* pRange = (RangeObj*)(leftRange? pLeftVal:pRightVal);
+		float64 value = ((MatrixF64Obj*)pOther)->getScalar();
+
+		// Declare a pointer for the transformed range
+		RangeObj* pResult = NULL;
+
+		// Switch on the operator type
+		switch (op)
+		{
+			case BinaryOpExpr::PLUS: pResult = pRange->affine(1, value); break;
+			case BinaryOpExpr::MINUS: pResult = leftRange? pRange->affine(1, -value):pRange->affine(-1, value); break;
+			case BinaryOpExpr::MULT:
+			case BinaryOpExpr::ARRAY_MULT: pResult = pRange->affine(value, 0); break;
+			case BinaryOpExpr::DIV:
+			case BinaryOpExpr::ARRAY_DIV: pResult = leftRange? pRange->affine(1 / value, 0):NULL; break;
+			default: break;
+		}
+
+		// If the result is still a range, return it
+		if (pResult != NULL)
+			return pResult;
+	}
+
+	// Otherwise, expand the ranges and apply the operator normally
+	if (leftRange) pLeftVal = ((RangeObj*)pLeftVal)->expand();
+	if (rightRange) pRightVal = ((RangeObj*)pRightVal)->expand();
+	return evalArithOp(op, pLeftVal, pRightVal);
+}
+
+/***************************************************************
+* Function: Interpreter::evalArithOp()
+* Purpose : Apply an arithmetic operator to evaluated operands
+* Initial : agent on October 18, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+DataObject* Interpreter::evalArithOp(BinaryOpExpr::Operator op, DataObject* pLeftVal, DataObject* pRightVal)
+{
+	// Switch on the operator type
+	switch (op)
+	{
+		case BinaryOpExpr::PLUS: return arrayArithOp<AddOp>(pLeftVal, pRightVal);
+		case BinaryOpExpr::MINUS: return arrayArithOp<SubOp>(pLeftVal, pRightVal);
+		case BinaryOpExpr::MULT: return matrixMultOp(pLeftVal, pRightVal);
+		case BinaryOpExpr::ARRAY_MULT: return arrayArithOp<MultOp>(pLeftVal, pRightVal);
+		case BinaryOpExpr::DIV: return matrixRightDivOp(pLeftVal, pRightVal);
+		case BinaryOpExpr::ARRAY_DIV: return arrayArithOp<DivOp>(pLeftVal, pRightVal);
+
+		// Other operators are not handled here
+		default:
+		assert (false);
+		return NULL;
+	}
+}
+
+/***************************************************************
+* Function: Interpreter::isScalarLeaf()
+* Purpose : Test if an expression is a constant or a variable
+* Initial : agent on October 18, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+bool Interpreter::isScalarLeaf(const Expression* pExpr)
+{
+	// Switch on the expression type
+	switch (pExpr->getExprType())
+	{
+		case Expression::ExprType::SYMBOL:
+		case Expression::ExprType::INT_CONST:
+		case Expression::ExprType::FP_CONST:
+		return true;
+
+		default:
+		return false;
+	}
+}
+
 /***************************************************************
 * Function: Interpreter::evalUnaryExpr()
 * Purpose : Evaluate an expression
@@ -1519,6 +2070,12 @@ DataObject* Interpreter::evalUnaryExpr(const UnaryOpExpr* pExpr, Environment* pE
 * Initial : Maxime Chevalier-Boisvert on November 13, 2008
 ****************************************************************
 Revisions and bug fixes:
+
+agent on October 18, 2026
+Operations on scalar variables and constants are evaluated unboxed,
+only the result is boxed.
+Arithmetic on ranges is evaluated lazily, the result range is
+expanded only once.
 */
 DataObject* Interpreter::evalBinaryExpr(const BinaryOpExpr* pExpr, Environment* pEnv)
 {
@@ -1526,6 +2083,21 @@ DataObject* Interpreter::evalBinaryExpr(const BinaryOpExpr* pExpr, Environment*
 	Expression* pLeftExpr = pExpr->getLeftExpr();
 	Expression* pRightExpr = pExpr->getRightExpr();
 
+	// If both operands are constants or variables, try to evaluate
+	// the operation without boxing the operands
+	ScalarValue scalarVal;
+	if (s_unboxScalars.getBoolValue() && isScalarLeaf(pLeftExpr) && isScalarLeaf(pRightExpr) &&
+		evalScalarExpr(pExpr, pEnv, scalarVal))
+		return scalarVal.box();
+
+	// If this is arithmetic on a range, evaluate it lazily
+	// and only expand the resulting range
+	if (s_lazyRanges.getBoolValue() && isLazyRangeExpr(pExpr))
+	{
+		DataObject* pValue = evalRangeArithExpr(pExpr, pEnv);
+		return (pValue->getType() == DataObject::Type::RANGE)? ((RangeObj*)pValue)->expand():pValue;
+	}
+
 	// Switch on the operator type
 	switch (pExpr->getOperator())
 	{
@@ -1968,6 +2540,12 @@ DataObject* Interpreter::evalEndExpr(const EndExpr* pExpr, Environment* pEnv)
 * Initial : Maxime Chevalier-Boisvert on January 24, 2009
 ****************************************************************
 Revisions and bug fixes:
+
+agent on October 18, 2026
+Field sweeps are read from struct columns when possible and
+the values of other field sweeps are concatenated.
+The values of a field sweep are concatenated at once.
+Struct arrays created by concatenation are packed in columns.
 */
 DataObject* Interpreter::evalMatrixExpr(const MatrixExpr* pExpr, Environment* pEnv)
 {
@@ -1977,6 +2555,9 @@ DataObject* Interpreter::evalMatrixExpr(const MatrixExpr* pExpr, Environment* pE
 	// Declare a pointer for the result (vertical) matrix
 	BaseMatrixObj* pVertMatrix = NULL;
 
+	// Indicates that the result was created by a concatenation
+	bool concatenated = false;
+
 	// For each row of the matrix expression
 	for (MatrixExpr::RowVector::const_iterator rowItr = rows.begin(); rowItr != rows.end(); ++rowItr)
 	{
@@ -1992,8 +2573,16 @@ DataObject* Interpreter::evalMatrixExpr(const MatrixExpr* pExpr, Environment* pE
 			// Get a reference to this expression
 			const Expression* pExpr = *colItr;
 
-			// Evaluate this expression
-			DataObject* pObject = evalExpression(pExpr, pEnv);
+			// Declare a pointer for the expression value
+			DataObject* pObject = NULL;
+
+			// If this is a field sweep, try reading it from struct columns
+			if (pExpr->getExprType() == Expression::ExprType::DOT && s_structColumns.getBoolValue())
+				pObject = evalFieldSweep((DotExpr*)pExpr, pEnv);
+
+			// If the sweep was not handled, evaluate this expression
+			if (pObject == NULL)
+				pObject = evalExpression(pExpr, pEnv);
 
 			// Declare a matrix to store this object
 			BaseMatrixObj* pObjMatrix;
@@ -2005,6 +2594,13 @@ DataObject* Interpreter::evalMatrixExpr(const MatrixExpr* pExpr, Environment* pE
 				pObjMatrix = (BaseMatrixObj*)pObject;
 			}
 
+			// If this is a list of values from a field sweep
+			else if (pObject->getType() == DataObject::Type::ARRAY && ((ArrayObj*)pObject)->getSize() > 0)
+			{
+				// Concatenate the list values horizontally
+				pObjMatrix = concatSweepValues((ArrayObj*)pObject);
+			}
+
 			// Otherwise
 			else
 			{
@@ -2022,6 +2618,7 @@ DataObject* Interpreter::evalMatrixExpr(const MatrixExpr* pExpr, Environment* pE
 			{
 				// Concatenate the object matrix into the horizontal matrix
 				pHorzMatrix = pHorzMatrix->concat(pObjMatrix, 1);
+				concatenated = true;
 			}
 		}
 
@@ -2035,6 +2632,7 @@ DataObject* Interpreter::evalMatrixExpr(const MatrixExpr* pExpr, Environment* pE
 		{
 			// Concatenate the row matrix into the vertical matrix
 			pVertMatrix = pVertMatrix->concat(pHorzMatrix, 0);
+			concatenated = true;
 		}
 	}
 
@@ -2045,6 +2643,11 @@ DataObject* Interpreter::evalMatrixExpr(const MatrixExpr* pExpr, Environment* pE
 		return new MatrixF64Obj();
 	}
 
+	// Pack struct arrays created by concatenation into columns, if possible
+	// Note: a single operand is not packed, since its elements may be shared
+	if (concatenated && pVertMatrix->getType() == DataObject::Type::STRUCTARRAY && s_structColumns.getBoolValue())
+		StructColumns::pack((StructArrayObj*)pVertMatrix);
+
 	// Return the result matrix
 	return pVertMatrix;
 }
@@ -2127,6 +2730,13 @@ DataObject* Interpreter::evalCellArrayExpr(const CellArrayExpr* pExpr, Environme
  * Purpose : Evaluate a dot expression (struct,oop)
  * Initial : Matthieu Dubet on March 12, 2012
  ****************************************************************
+ Revisions and bug fixes:
+
+agent on October 18, 2026
+Fields are read through the slot cached in the dot expression.
+Field sweeps pack struct arrays into columns, struct elements
+are materialized before their fields are modified in place.
+Field sweeps no longer pack the struct array they read.
 */
 DataObject* Interpreter::evalDotExpr(const DotExpr* pDotExpr, Environment* pEnv, Expected expected)
 {
@@ -2163,7 +2773,10 @@ DataObject* Interpreter::evalDotExpr(const DotExpr* pDotExpr, Environment* pEnv,
         ScalarStruct* ss = pSAO->getElem1D(i) ;
         DataObject* d = NULL ;
         if ( ss != NULL) {
-          d =  ( *ss) [ pDotExpr->getField() ] ;
+          // Homogeneous arrays share one shape, so the slot is cached
+          size_t slot = pDotExpr->getFieldSlot(ss->getShape()) ;
+          if ( slot != StructShape::NO_SLOT )
+            d = ss->getSlot(slot) ;
         }
         if ( d != NULL) {
           ArrayObj::addObject(ao, d ) ;
@@ -2192,11 +2805,23 @@ DataObject* Interpreter::evalDotExpr(const DotExpr* pDotExpr, Environment* pEnv,
        } else {
          pSAO->m_Fields.insert( pSAO->m_Fields.begin() ,   pDotExpr->getField() ) ;
        }
-      (*pScalarStruct) [pDotExpr->getField()]  =  expected.second ;
+      size_t slot = pDotExpr->getFieldSlot(pScalarStruct->getShape()) ;
+      if ( slot != StructShape::NO_SLOT )
+        pScalarStruct->setSlot(slot, expected.second) ;
+      else
+        pScalarStruct->setField(pDotExpr->getField(), expected.second) ;
       return expected.second ;
     }
 
-    DataObject* pFieldObject = (*pScalarStruct) [pDotExpr->getField()] ;
+    // The field object may be modified in place, so it cannot be a column value
+    if (expected.second != NULL)
+      pScalarStruct->materialize() ;
+
+    // Read the field through the slot cached for this shape
+    DataObject* pFieldObject = NULL ;
+    size_t fieldSlot = pDotExpr->getFieldSlot(pScalarStruct->getShape()) ;
+    if ( fieldSlot != StructShape::NO_SLOT )
+      pFieldObject = pScalarStruct->getSlot(fieldSlot) ;
 
     // Exist without overwrite, just return it
     if ( pFieldObject != NULL ) {
@@ -2214,7 +2839,11 @@ DataObject* Interpreter::evalDotExpr(const DotExpr* pDotExpr, Environment* pEnv,
        } else {
          pSAO->m_Fields.insert( pSAO->m_Fields.begin() ,   pDotExpr->getField() ) ;
        }
-      (*pScalarStruct) [pDotExpr->getField()]  =  expected.second ;
+      size_t slot = pDotExpr->getFieldSlot(pScalarStruct->getShape()) ;
+      if ( slot != StructShape::NO_SLOT )
+        pScalarStruct->setSlot(slot, expected.second) ;
+      else
+        pScalarStruct->setField(pDotExpr->getField(), expected.second) ;
       return expected.second ;
     }
 
@@ -2236,12 +2865,138 @@ DataObject* Interpreter::evalDotExpr(const DotExpr* pDotExpr, Environment* pEnv,
     throw RunError( "left expression ( here '" + pLeftExpr->toString() + "') in a dot expression should be a structarray (here '" +  pObject->getTypeName() + "')");
   }
 }
+/***************************************************************
+* Function: Interpreter::evalFieldSweep()
+* Purpose : Evaluate a field sweep over a packed struct array
+* Initial : agent on October 18, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+DataObject* Interpreter::evalFieldSweep(const DotExpr* pDotExpr, Environment* pEnv)
+{
+	// Only sweeps over variables are handled
+	Expression* pLeftExpr = pDotExpr->getExpr();
+	if (pLeftExpr->getExprType() != Expression::ExprType::SYMBOL)
+		return NULL;
+
+	// Lookup the symbol in the environment
+	DataObject* pObject = Environment::lookup(pEnv, (SymbolExpr*)pLeftExpr);
+
+	// If this is not a struct array with multiple elements, stop
+	if (pObject == NULL || pObject->getType() != DataObject::Type::STRUCTARRAY || ((StructArrayObj*)pObject)->getNumElems() < 2)
+		return NULL;
+
+	// Get the columns the struct array is packed in, if any
+	StructColumns* pColumns = StructColumns::getPacked((StructArrayObj*)pObject);
+	if (pColumns == NULL)
+		return NULL;
+
+	// If the field is not in the columns, let the generic path report it
+	size_t slot = pDotExpr->getFieldSlot(pColumns->getShape());
+	if (slot == StructShape::NO_SLOT)
+		return NULL;
+
+	// Read the field values as a row vector
+	return pColumns->readColumn(slot);
+}
+
+/***************************************************************
+* Function: appendSweepValues()
+* Purpose : Copy 2D matrices of one type side by side
+* Initial : agent on October 18, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+template <class ScalarType> static BaseMatrixObj* appendSweepValues(const ArrayObj* pList, size_t numRows, size_t numCols)
+{
+	// Create the result matrix
+	MatrixObj<ScalarType>* pResult = new MatrixObj<ScalarType>(numRows, numCols);
+
+	// Column-major 2D matrices with the same row count are
+	// concatenated horizontally by appending their elements
+	ScalarType* pDst = pResult->getElements();
+	for (size_t i = 0; i < pList->getSize(); ++i)
+	{
+		const MatrixObj<ScalarType>* pValue = (const MatrixObj<ScalarType>*)pList->getObject(i);
+		memcpy(pDst, pValue->getElements(), pValue->getNumElems() * sizeof(*pDst));
+		pDst += pValue->getNumElems();
+	}
+
+	// Return the result matrix
+	return pResult;
+}
+
+/***************************************************************
+* Function: Interpreter::concatSweepValues()
+* Purpose : Concatenate the values of a field sweep horizontally
+* Initial : agent on October 18, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+BaseMatrixObj* Interpreter::concatSweepValues(const ArrayObj* pList)
+{
+	// Get the type and row count of the first nonempty value
+	DataObject::Type type = DataObject::Type::UNKNOWN;
+	size_t numRows = 0;
+	size_t numCols = 0;
+	bool sameShape = true;
+
+	// For each value
+	for (size_t i = 0; i < pList->getSize(); ++i)
+	{
+		// Ensure that this value is a matrix
+		if (!pList->getObject(i)->isMatrixObj())
+			throw RunError("unsupported data type in matrix expression");
+
+		// Empty values do not take part in the concatenation
+		const BaseMatrixObj* pValue = (const BaseMatrixObj*)pList->getObject(i);
+		if (pValue->isEmpty())
+			continue;
+
+		// Test that the values are 2D, share a type and a row count
+		if (type == DataObject::Type::UNKNOWN)
+		{
+			type = pValue->getType();
+			numRows = pValue->getSize()[0];
+		}
+		if (pValue->getType() != type || !pValue->is2D() || pValue->getSize()[0] != numRows)
+			sameShape = false;
+
+		// Count the result columns
+		numCols += pValue->getNumElems() / numRows;
+	}
+
+	// If the values are real, logical or character matrices sharing a row
+	// count, copy them into the result in one pass
+	if (sameShape && type == DataObject::Type::MATRIX_F64)
+		return appendSweepValues<float64>(pList, numRows, numCols);
+	if (sameShape && type == DataObject::Type::LOGICALARRAY)
+		return appendSweepValues<bool>(pList, numRows, numCols);
+	if (sameShape && type == DataObject::Type::CHARARRAY)
+		return appendSweepValues<char>(pList, numRows, numCols);
+
+	// Otherwise, concatenate the values pairwise
+	BaseMatrixObj* pResult = NULL;
+	for (size_t i = 0; i < pList->getSize(); ++i)
+	{
+		BaseMatrixObj* pValue = (BaseMatrixObj*)pList->getObject(i);
+		pResult = (pResult == NULL)? pValue:pResult->concat(pValue, 1);
+	}
+
+	// Return the concatenated values
+	return pResult;
+}
+
 /***************************************************************
 * Function: Interpreter::evalParamExpr()
 * Purpose : Evaluate a parameterized expression
 * Initial : Maxime Chevalier-Boisvert on November 13, 2008
 ****************************************************************
 Revisions and bug fixes:
+
+agent on October 18, 2026
+Library functions accepting ranges receive lone range arguments
+unexpanded.
 */
 DataObject* Interpreter::evalParamExpr(const ParamExpr* pExpr, Environment* pEnv, size_t nargout, Expected expected)
 {
@@ -2284,6 +3039,26 @@ DataObject* Interpreter::evalParamExpr(const ParamExpr* pExpr, Environment* pEnv
 		// Create an array object for the arguments
 		ArrayObj* pArguments = new ArrayObj(argVector.size());
 
+		// Get a typed pointer to the function object
+		Function* pCallee = (Function*)pObject;
+
+		// If this library function can take a lone range argument,
+		// pass the range to it unexpanded
+		if (argVector.size() == 1 && !pCallee->isProgFunction() && ((LibFunction*)pCallee)->acceptsRange() &&
+			s_lazyRanges.getBoolValue() && isLazyRangeExpr(argVector[0]))
+		{
+			// Evaluate the argument, keeping ranges lazy
+			DataObject* pValue = evalOperand(argVector[0], pEnv);
+
+			// Empty ranges are expanded, their special cases are left to the function
+			if (pValue->getType() == DataObject::Type::RANGE && ((RangeObj*)pValue)->getElemCount() == 0)
+				pValue = ((RangeObj*)pValue)->expand();
+
+			// Call the function with the argument
+			ArrayObj::addObject(pArguments, pValue);
+			return callFunction(pCallee, pArguments, nargout);
+		}
+
 		// For each argument
 		for (ParamExpr::ExprVector::const_iterator itr = argVector.begin(); itr != argVector.end(); ++itr)
 		{
@@ -2405,6 +3180,10 @@ DataObject* Interpreter::evalParamExpr(const ParamExpr* pExpr, Environment* pEnv
 * Initial : Maxime Chevalier-Boisvert on February 18, 2009
 ****************************************************************
 Revisions and bug fixes:
+
+agent on October 18, 2026
+Single scalar indices read the element directly, without
+creating a sub-array, so packed elements are boxed only once.
 */
 DataObject* Interpreter::evalCellIndexExpr(const CellIndexExpr* pExpr, Environment* pEnv)
 {
@@ -2430,6 +3209,22 @@ DataObject* Interpreter::evalCellIndexExpr(const CellIndexExpr* pExpr, Environme
 	// Evaluate the indexing arguments
 	ArrayObj* pArguments = evalIndexArgs(argVector, pEnv);
 
+	// If there is a single scalar index
+	if (pArguments->getSize() == 1 && pArguments->getObject(0)->getType() == DataObject::Type::MATRIX_F64 &&
+		((MatrixF64Obj*)pArguments->getObject(0))->isScalar())
+	{
+		// Get the index value
+		float64 index = ((MatrixF64Obj*)pArguments->getObject(0))->getScalar();
+
+		// If the index is a valid element index, return a copy of the element
+		if (index >= 1 && index <= pCellArray->getNumElems() && index == size_t(index))
+		{
+			ArrayObj* pValues = new ArrayObj(1);
+			ArrayObj::addObject(pValues, PackedCells::copyElem(pCellArray, toZeroIndex(size_t(index))));
+			return pValues;
+		}
+	}
+
 	// Get the maximum indices
 	DimVector maxInds = pCellArray->getMaxIndices(pArguments);
 
@@ -2447,8 +3242,8 @@ DataObject* Interpreter::evalCellIndexExpr(const CellIndexExpr* pExpr, Environme
 	ArrayObj* pValues = new ArrayObj(pSubArray->getNumElems());
 
 	// Add copies of each object in the sub-array to the array object
-	for (size_t i = 1; i <= pSubArray->getNumElems(); ++i)
-		ArrayObj::addObject(pValues, pSubArray->getElem1D(i)->copy());
+	for (size_t i = 0; i < pSubArray->getNumElems(); ++i)
+		ArrayObj::addObject(pValues, PackedCells::copyElem(pSubArray, i));
 
 	// Return the array of values
 	return pValues;
@@ -2790,10 +3585,78 @@ CompUnits Interpreter::loadCompUnits(CompUnits& nodes, const std::string& nameTo
 		}
 	}
 
+	// Start parsing the m-files these functions may call
+	prefetchDependencies(funcVec);
+
 	// Return the list of compilation units
 	return nodes;
 }
 
+/***************************************************************
+* Function: Interpreter::prefetchDependencies()
+* Purpose : Start parsing the m-files called by new functions
+* Initial : agent on October 18, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+void Interpreter::prefetchDependencies(const std::vector<ProgFunction*>& funcVec)
+{
+	// If dependency prefetching is disabled, do nothing
+	if (s_prefetchDeps.getBoolValue() == false)
+		return;
+
+	// Declare a set for the m-files to be parsed
+	std::set<std::string> fileSet;
+
+	// For each loaded function
+	for (std::vector<ProgFunction*>::const_iterator funcItr = funcVec.begin(); funcItr != funcVec.end(); ++funcItr)
+	{
+		// Get a pointer to this function
+		ProgFunction* pFunction = *funcItr;
+
+		// Get the local environment of the function
+		Environment* pEnv = ProgFunction::getLocalEnv(pFunction);
+
+		// Get the symbols used and defined in the function
+		Expression::SymbolSet uses = pFunction->getSymbolUses();
+		Expression::SymbolSet defs = pFunction->getSymbolDefs();
+
+		// For each symbol used
+		for (Expression::SymbolSet::const_iterator symItr = uses.begin(); symItr != uses.end(); ++symItr)
+		{
+			// Get a pointer to the symbol
+			SymbolExpr* pSymbol = *symItr;
+
+			// Local variables are not calls
+			if (defs.find(pSymbol) != defs.end())
+				continue;
+
+			// Symbols already bound do not need to be loaded
+			if (pEnv != NULL && Environment::lookup(pEnv, pSymbol) != NULL)
+				continue;
+
+			// If there is an m-file with this name in the working directory, parse it
+			std::string fileName = pSymbol->getSymName() + ".m";
+			if (getAbsPath(fileName).empty() == false)
+				fileSet.insert(fileName);
+		}
+	}
+
+	// If there is nothing to parse, stop
+	if (fileSet.empty())
+		return;
+
+	// If verbose mode is enabled
+	if (ConfigManager::s_verboseVar.getBoolValue())
+	{
+		// Log the number of m-files being prefetched
+		std::cout << "Prefetching " << fileSet.size() << " m-file(s)" << std::endl;
+	}
+
+	// Have the front-end parse the files in the background
+	Client::prefetchFiles(Client::PathVector(fileSet.begin(), fileSet.end()));
+}
+
 /***************************************************************
 * Function: Interpreter::buildLocalEnv()
 * Purpose : Build the local environment for a function
@@ -32,6 +32,7 @@
 #include "parser.h"
 #include "functions.h"
 #include "environment.h"
+#include "scalarvalue.h"
 #include "arrayobj.h"
 #include "statements.h"
 #include "stmtsequence.h"
@@ -55,6 +56,9 @@
 
 typedef std::pair<bool,DataObject*> Expected ;
 
+// Forward declarations
+class BaseMatrixObj;
+
 /***************************************************************
 * Class   : Interpreter
 * Purpose : Interpret the intermediate representation (IIR)
@@ -102,9 +106,18 @@ public:
 	// Method to evaluate a loop statement
 	static void evalLoopStmt(const LoopStmt* pLoopStmt, Environment* pEnv);
 
+	// Method to evaluate the iterations of a loop statement
+	static void evalLoopIterations(const LoopStmt* pLoopStmt, Environment* pEnv, bool execTestSeq);
+
+	// Method to execute the code following a statement of a sequence
+	static bool resumeSeqStmt(const StmtSequence* pSeqStmt, const Statement* pStmt, Environment* pEnv);
+
 	// Method to evaluate an expression
 	static DataObject* evalExpression(const Expression* pExpr, Environment* pEnv, Expected e = Expected(false,NULL) );
 
+	// Method to evaluate a real or logical scalar expression without boxing
+	static bool evalScalarExpr(const Expression* pExpr, Environment* pEnv, ScalarValue& value);
+
 	// Method to evaluate a unary operator expression
 	static DataObject* evalUnaryExpr(const UnaryOpExpr* pExpr, Environment* pEnv);
 
@@ -128,6 +141,12 @@ public:
 
 	static DataObject* evalDotExpr(const DotExpr* pExpr, Environment* pEnv, Expected  e = Expected(false,NULL) );
 
+	// Method to evaluate a field sweep over a packed struct array
+	static DataObject* evalFieldSweep(const DotExpr* pExpr, Environment* pEnv);
+
+	// Method to concatenate the values of a field sweep horizontally
+	static BaseMatrixObj* concatSweepValues(const ArrayObj* pList);
+
 	// Method to evaluate a cell indexing expression
 	static DataObject* evalCellIndexExpr(const CellIndexExpr* pExpr, Environment* pEnv);
 
@@ -154,6 +173,9 @@ public:
 	
 	// Method to build the local environment for a function
 	static void buildLocalEnv(ProgFunction* pFunction, Environment* pLocalEnv);
+
+	// Method to start parsing the m-files called by newly loaded functions
+	static void prefetchDependencies(const std::vector<ProgFunction*>& funcVec);
 	
 	// Method to set a binding in the global environment
 	static void setBinding(const std::string& name, DataObject* pObject);
@@ -176,6 +198,21 @@ public:
 
 	// Config variable to enable/disable type inference profiling
 	static ConfigVar s_profTypeInfer;
+
+	// Config variable to enable/disable background parsing of called m-files
+	static ConfigVar s_prefetchDeps;
+
+	// Config variable to enable/disable unboxed scalar evaluation
+	static ConfigVar s_unboxScalars;
+
+	// Config variable to enable/disable column storage of struct arrays
+	static ConfigVar s_structColumns;
+
+	// Config variable to enable/disable lazy evaluation of ranges
+	static ConfigVar s_lazyRanges;
+
+	// Config variable to enable/disable packed storage of cell arrays
+	static ConfigVar s_cellPacking;
 	
 private:
 
@@ -186,6 +223,21 @@ private:
 	static SymbolExpr* s_pNarginSym;
 	static SymbolExpr* s_pNargoutSym;
 
+	// Method to test if an expression is a constant or a variable
+	static bool isScalarLeaf(const Expression* pExpr);
+
+	// Method to test if an expression may evaluate to a lazy range
+	static bool isLazyRangeExpr(const Expression* pExpr);
+
+	// Method to evaluate an operand, keeping ranges unexpanded
+	static DataObject* evalOperand(const Expression* pExpr, Environment* pEnv);
+
+	// Method to evaluate an arithmetic expression over ranges, keeping the result lazy
+	static DataObject* evalRangeArithExpr(const BinaryOpExpr* pExpr, Environment* pEnv);
+
+	// Method to apply an arithmetic operator to evaluated operands
+	static DataObject* evalArithOp(BinaryOpExpr::Operator op, DataObject* pLeftVal, DataObject* pRightVal);
+
 	// Function type info structure definition
 	struct FuncTypeInfo
 	{
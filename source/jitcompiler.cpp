@@ -22,7 +22,10 @@
 #include <cassert>
 #include <iostream>
 #include <sstream>
+#include <limits>
+#include <pthread.h>
 #include <llvm/Module.h>
+#include <llvm/Intrinsics.h>
 #include <llvm/PassManager.h>
 #include <llvm/CallingConv.h>
 #include <llvm/Constants.h>
@@ -49,7 +52,13 @@
 #include "matrixops.h"
 #include "transform_logic.h"
 #include "transform_split.h"
+#include "transform_inline.h"
+#include "transform_idioms.h"
+#include "transform_parallel.h"
+#include "workerpool.h"
+#include "typefeedback.h"
 #include "configmanager.h"
+#include "utility.h"
 #include "hotspot/profiler.h"
 #include "utils/llvmutils.h"
 
@@ -60,6 +69,7 @@ Statement *global_stmt;
 
 ConfigVar JITCompiler::s_jitEnableVar("jit_enable", ConfigVar::BOOL, "true");
 ConfigVar JITCompiler::s_jitCopyEnableVar("jit_copy_enable", ConfigVar::BOOL, "true");
+ConfigVar JITCompiler::s_jitFreeTempsVar("jit_free_temps", ConfigVar::BOOL, "true");
 
 // Config variable to enable/disable on-stack replacement capability
 ConfigVar JITCompiler::s_jitOsrEnableVar("jit_osr_enable", ConfigVar::BOOL, "false");
@@ -75,6 +85,39 @@ ConfigVar JITCompiler::s_jitUseDirectCalls("jit_use_direct_calls", ConfigVar::BO
 ConfigVar JITCompiler::s_jitNoReadBoundChecks("jit_no_read_bound_checks", ConfigVar::BOOL, "false");
 ConfigVar JITCompiler::s_jitNoWriteBoundChecks("jit_no_write_bound_checks", ConfigVar::BOOL, "false");
 
+// Config variable to enable/disable loop versioning on hoisted bounds checks
+ConfigVar JITCompiler::s_jitLoopVersioning("jit_loop_versioning", ConfigVar::BOOL, "true");
+
+// Config variables to control the inlining of small functions into their callers
+ConfigVar JITCompiler::s_jitInlineCalls("jit_inline_calls", ConfigVar::BOOL, "true");
+ConfigVar JITCompiler::s_jitInlineMaxStmts("jit_inline_max_stmts", ConfigVar::INT, "16", 0, 1000);
+
+// Config variable to enable/disable speculation on recorded value types
+ConfigVar JITCompiler::s_jitTypeSpeculation("jit_type_speculation", ConfigVar::BOOL, "true");
+
+// Config variable to enable/disable keeping small fixed-size matrices in registers
+ConfigVar JITCompiler::s_jitSmallMatrices("jit_small_matrices", ConfigVar::BOOL, "false");
+
+// Config variable to enable/disable replacing element-wise loops by array operations
+ConfigVar JITCompiler::s_jitLoopIdioms("jit_loop_idioms", ConfigVar::BOOL, "false");
+
+// Config variables to enable/disable running independent loops on the worker threads
+ConfigVar JITCompiler::s_jitParallelLoops("jit_parallel_loops", ConfigVar::BOOL, "true");
+ConfigVar JITCompiler::s_jitAutoParallel("jit_auto_parallel", ConfigVar::BOOL, "false");
+
+// Mutex protecting the compiler state, since compiled code may
+// call back into the compiler from parallel loop threads
+// Note: this mutex is recursive, compilation may trigger compilation
+static pthread_mutex_t jitMutex;
+
+// Scoped lock on the compiler state mutex
+class JITLock
+{
+public:
+    JITLock() { pthread_mutex_lock(&jitMutex); }
+    ~JITLock() { pthread_mutex_unlock(&jitMutex); }
+};
+
 llvm::LLVMContext* JITCompiler::s_Context;
 
 // LLVM module to store functions
@@ -100,6 +143,9 @@ JITCompiler::NativeMap JITCompiler::s_nativeMap;
 // Map of signatures to optimized library functions
 JITCompiler::LibFuncMap JITCompiler::s_libFuncMap;
 
+// Map of library functions compiled inline on real scalars
+JITCompiler::LibIntrinsicMap JITCompiler::s_libIntrinsicMap;
+
 // Map of program functions to function objects
 JITCompiler::FunctionMap JITCompiler::s_functionMap;
 
@@ -150,9 +196,19 @@ std::string CompError::toString() const
 * Initial : Maxime Chevalier-Boisvert on March 9, 2009
 ****************************************************************
 Revisions and bug fixes:
+
+agent on October 18, 2026
+Initialize the compiler state mutex.
 */
 void JITCompiler::initialize()
 {
+    // Initialize the compiler state mutex as a recursive mutex
+    pthread_mutexattr_t mutexAttr;
+    pthread_mutexattr_init(&mutexAttr);
+    pthread_mutexattr_settype(&mutexAttr, PTHREAD_MUTEX_RECURSIVE);
+    pthread_mutex_init(&jitMutex, &mutexAttr);
+    pthread_mutexattr_destroy(&mutexAttr);
+
     llvm::InitializeNativeTarget();
 
     s_Context = new llvm::LLVMContext();
@@ -276,8 +332,17 @@ void JITCompiler::initialize()
     i8Write2DArgs.push_back(llvm::Type::getInt64Ty(*s_Context));
     i8Write2DArgs.push_back(llvm::Type::getInt8Ty(*s_Context));
 
+    // Create a type vector for the small matrix unboxing function
+    LLVMTypeVector smallMatDataArgs;
+    smallMatDataArgs.push_back(VOID_PTR_TYPE);
+    smallMatDataArgs.push_back(llvm::Type::getInt64Ty(*s_Context));
+    smallMatDataArgs.push_back(llvm::Type::getInt64Ty(*s_Context));
+
     // Register JIT compiler support functions
-    regNativeFunc("JITCompiler::callExceptHandler", (void*)JITCompiler::callExceptHandler, llvm::Type::getVoidTy(*s_Context), LLVMTypeVector(4, VOID_PTR_TYPE));
+    regNativeFunc("JITCompiler::recordTypeFeedback", (void*)JITCompiler::recordTypeFeedback, llvm::Type::getVoidTy(*s_Context), LLVMTypeVector(3, VOID_PTR_TYPE));
+    regNativeFunc("JITCompiler::deoptimize", (void*)JITCompiler::deoptimize, llvm::Type::getVoidTy(*s_Context), LLVMTypeVector(5, VOID_PTR_TYPE));
+    regNativeFunc("JITCompiler::makeSmallMatrix", (void*)JITCompiler::makeSmallMatrix, VOID_PTR_TYPE, LLVMTypeVector(2, llvm::Type::getInt64Ty(*s_Context)), false, false, true);
+    regNativeFunc("JITCompiler::getSmallMatData", (void*)JITCompiler::getSmallMatData, llvm::PointerType::getUnqual(llvm::Type::getDoubleTy(*s_Context)), smallMatDataArgs, false, false, false);
 
     // Register basic interpreter functions
     regNativeFunc("getBoolValue", (void*)getBoolValue, llvm::Type::getInt8Ty(*s_Context), LLVMTypeVector(1, VOID_PTR_TYPE), true, false, true);
@@ -311,6 +376,9 @@ void JITCompiler::initialize()
 
     // Register matrix utility functions
     regNativeFunc("DataObject::copyObject", (void*)DataObject::copyObject, VOID_PTR_TYPE, LLVMTypeVector(1, VOID_PTR_TYPE ), true, false, true);
+    regNativeFunc("DataObject::lazyCopyObject", (void*)DataObject::lazyCopyObject, VOID_PTR_TYPE, LLVMTypeVector(1, VOID_PTR_TYPE ), false, false, true);
+    regNativeFunc("BaseMatrixObj::unshareMatrix", (void*)BaseMatrixObj::unshareMatrix, llvm::Type::getVoidTy(*s_Context), LLVMTypeVector(1, VOID_PTR_TYPE));
+    regNativeFunc("BaseMatrixObj::freeTemp", (void*)BaseMatrixObj::freeTemp, llvm::Type::getVoidTy(*s_Context), LLVMTypeVector(1, VOID_PTR_TYPE), false, false, true);
     regNativeFunc("BaseMatrixObj::getDimCount", (void*)BaseMatrixObj::getDimCount, getIntType(sizeof(size_t)), LLVMTypeVector(1, VOID_PTR_TYPE), true, true, true);
     regNativeFunc("BaseMatrixObj::getSizeArray", (void*)BaseMatrixObj::getSizeArray, llvm::PointerType::getUnqual(getIntType(sizeof(size_t))), LLVMTypeVector(1, VOID_PTR_TYPE), true, true, true);
     regNativeFunc("BaseMatrixObj::expandMatrix", (void*)BaseMatrixObj::expandMatrix, llvm::Type::getVoidTy(*s_Context), expandArgs);
@@ -319,6 +387,19 @@ void JITCompiler::initialize()
     regNativeFunc("StructArrayObj::makeScalar", (void*)StructArrayObj::makeScalar, VOID_PTR_TYPE, LLVMTypeVector(1, VOID_PTR_TYPE));
     regNativeFunc("makeScalarStructPtr", (void*)makeScalarStructPtr, VOID_PTR_TYPE, LLVMTypeVector());
     regNativeFunc("insertInScalarStruct", (void*)insertInScalarStruct, llvm::Type::getVoidTy(*s_Context), LLVMTypeVector(3,VOID_PTR_TYPE));
+    regNativeFunc("makeShapedScalarStruct", (void*)makeShapedScalarStruct, VOID_PTR_TYPE, LLVMTypeVector(1, VOID_PTR_TYPE), false, false, true);
+    LLVMTypeVector setSlotArgs;
+    setSlotArgs.push_back(VOID_PTR_TYPE);
+    setSlotArgs.push_back(llvm::Type::getInt64Ty(*s_Context));
+    setSlotArgs.push_back(VOID_PTR_TYPE);
+    regNativeFunc("setScalarStructSlot", (void*)setScalarStructSlot, llvm::Type::getVoidTy(*s_Context), setSlotArgs, false, false, true);
+    LLVMTypeVector readFieldArgs;
+    readFieldArgs.push_back(VOID_PTR_TYPE);
+    readFieldArgs.push_back(VOID_PTR_TYPE);
+    readFieldArgs.push_back(llvm::Type::getInt64Ty(*s_Context));
+    readFieldArgs.push_back(VOID_PTR_TYPE);
+    regNativeFunc("readStructField", (void*)readStructField, VOID_PTR_TYPE, readFieldArgs, true, false, false);
+    regNativeFunc("readStructFieldF64", (void*)readStructFieldF64, llvm::Type::getDoubleTy(*s_Context), readFieldArgs, true, false, false);
     regNativeFunc("LogicalArrayObj::makeScalar", (void*)LogicalArrayObj::makeScalar, VOID_PTR_TYPE, LLVMTypeVector(1, llvm::Type::getInt8Ty(*s_Context)));
     regNativeFunc("MatrixF64Obj::getScalarVal", (void*)MatrixF64Obj::getScalarVal, llvm::Type::getDoubleTy(*s_Context), LLVMTypeVector(1, VOID_PTR_TYPE), true, false, true);
     regNativeFunc("CharArrayObj::getScalarVal", (void*)CharArrayObj::getScalarVal, llvm::Type::getInt8Ty(*s_Context), LLVMTypeVector(1, VOID_PTR_TYPE), true, false, true);
@@ -464,7 +545,16 @@ void JITCompiler::initialize()
     ConfigManager::registerVar(&s_jitUseDirectCalls);
     ConfigManager::registerVar(&s_jitNoReadBoundChecks);
     ConfigManager::registerVar(&s_jitNoWriteBoundChecks);
+    ConfigManager::registerVar(&s_jitLoopVersioning);
+    ConfigManager::registerVar(&s_jitInlineCalls);
+    ConfigManager::registerVar(&s_jitInlineMaxStmts);
+    ConfigManager::registerVar(&s_jitTypeSpeculation);
+    ConfigManager::registerVar(&s_jitSmallMatrices);
+    ConfigManager::registerVar(&s_jitLoopIdioms);
+    ConfigManager::registerVar(&s_jitParallelLoops);
+    ConfigManager::registerVar(&s_jitAutoParallel);
     ConfigManager::registerVar(&s_jitCopyEnableVar);
+    ConfigManager::registerVar(&s_jitFreeTempsVar);
     ConfigManager::registerVar(&s_jitOsrEnableVar);
     ConfigManager::registerVar(&s_jitOsrStrategyVar);
 
@@ -631,6 +721,30 @@ void JITCompiler::regLibraryFunc(
     s_libFuncMap[key] = pFuncPtr;
 }
 
+/***************************************************************
+* Function: JITCompiler::regLibraryIntrinsic()
+* Purpose : Register a library function compiled inline
+*           when its arguments are real scalars
+* Initial : agent on October 18, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+void JITCompiler::regLibraryIntrinsic(
+    const LibFunction* pLibFunc,
+    size_t numArgs,
+    LibIntrinsic intrinsic
+)
+{
+    // Create a key object for this function and argument count
+    std::pair<const LibFunction*, size_t> key(pLibFunc, numArgs);
+
+    // Ensure that the function is not already registered
+    assert (s_libIntrinsicMap.find(key) == s_libIntrinsicMap.end());
+
+    // Store the intrinsic in the library intrinsic map
+    s_libIntrinsicMap[key] = intrinsic;
+}
+
 /***************************************************************
 * Function: JITCompiler::regLibraryFunc()
 * Purpose : Set up parameters used by compileFunction
@@ -657,15 +771,14 @@ void JITCompiler::setUpParameters(ProgFunction* pFunction, CompFunction& compFun
     compVersion.inArgStoreModes.push_back(llvm::Type::getInt64Ty(*s_Context));
     compVersion.inArgObjTypes.push_back(DataObject::Type::MATRIX_F64);
 
-    // Create a struct type for the input parameters
-    compVersion.pInStructType = llvm::StructType::get(*s_Context, compVersion.inArgStoreModes, false);
-
 //	const ProgFunction::ParamVector& inParams = pFunction->getInParams();
     const ProgFunction::ParamVector& outParams = pFunction->getOutParams();
 
     // Find the variable type map for after the function body
-    TypeInfoMap::const_iterator typeInfoItr = compVersion.pTypeInferInfo->postTypeMap.find(compFunction.pFuncBody);
-    assert (typeInfoItr != compVersion.pTypeInferInfo->postTypeMap.end());
+    // NOTE: speculated types are not used for the call interface, as
+    //       outputs may be produced by a failed type guard
+    TypeInfoMap::const_iterator typeInfoItr = compVersion.pStaticTypeInfo->postTypeMap.find(compFunction.pFuncBody);
+    assert (typeInfoItr != compVersion.pStaticTypeInfo->postTypeMap.end());
     const VarTypeMap& varTypes = typeInfoItr->second;
 
     // For each output parameter
@@ -691,7 +804,7 @@ void JITCompiler::setUpParameters(ProgFunction* pFunction, CompFunction& compFun
     compVersion.outArgStoreModes.push_back(llvm::Type::getInt64Ty(*s_Context));
     compVersion.outArgObjTypes.push_back(DataObject::Type::MATRIX_F64);
 
-    // Create a struct type for the output parameters
+    // Create a struct type for the values returned
     compVersion.pOutStructType = llvm::StructType::get(*s_Context, compVersion.outArgStoreModes, false);
 }
 
@@ -699,8 +812,9 @@ void JITCompiler::compFuncReturn(llvm::IRBuilder<>& exitBuilder, CompFunction& c
         CompVersion& compVersion, VariableMap& exitVarMap, const ProgFunction::ParamVector& outParams)
 {
     llvm::Function* pFuncObj = compVersion.pLLVMFunc;
-    // Get a pointer to the return data structure
-    llvm::Value* pRetStruct = ++(pFuncObj->arg_begin());
+
+    // Start from an undefined return value, filled in field by field
+    llvm::Value* pRetVal = llvm::UndefValue::get(compVersion.pOutStructType);
 
     // Create an initial basic block
     llvm::BasicBlock* pCurrentBlock = llvm::BasicBlock::Create(*s_Context, "", pFuncObj);
@@ -709,13 +823,6 @@ void JITCompiler::compFuncReturn(llvm::IRBuilder<>& exitBuilder, CompFunction& c
     // Jump from the exit block to the current basic block
     exitBuilder.CreateBr(pCurrentBlock);
 
-    // Create a basic block for the function return
-    llvm::BasicBlock* pRetBlock = llvm::BasicBlock::Create(*s_Context, "ret", pFuncObj);
-    llvm::IRBuilder<> retBuilder(pRetBlock);
-
-    // Create a return void instruction
-    retBuilder.CreateRetVoid();
-
     // For each output parameter
     for (size_t i = 0; i < outParams.size(); ++i)
     {
@@ -767,19 +874,9 @@ void JITCompiler::compFuncReturn(llvm::IRBuilder<>& exitBuilder, CompFunction& c
             llvm::BasicBlock* pSetNumBlock = llvm::BasicBlock::Create(*s_Context, "", pFuncObj);
             llvm::IRBuilder<> setBuilder(pSetNumBlock);
 
-            // Get the address of the number struct field
-            llvm::Value* gepValuesNum[2];
-            gepValuesNum[0] = llvm::ConstantInt::get(llvm::Type::getInt32Ty(*s_Context), 0);
-            gepValuesNum[1] = llvm::ConstantInt::get(llvm::Type::getInt32Ty(*s_Context), outParams.size());
-            llvm::ArrayRef<llvm::Value*> gepValuesRef(gepValuesNum, gepValuesNum+2);
-            llvm::Value* pNumFieldAddr = setBuilder.CreateGEP(pRetStruct, gepValuesRef);
-
-            // Store the number of values written into the output structure
+            // Set the number of values written and return the values written so far
             llvm::Value* pNumWritten = llvm::ConstantInt::get(llvm::Type::getInt64Ty(*s_Context), i);
-            setBuilder.CreateStore(pNumWritten, pNumFieldAddr);
-
-            // Jump to the return block
-            setBuilder.CreateBr(pRetBlock);
+            setBuilder.CreateRet(setBuilder.CreateInsertValue(pRetVal, pNumWritten, outParams.size()));
 
             // Create a basic block to convert the value type
             llvm::BasicBlock* pConvBlock = llvm::BasicBlock::Create(*s_Context, "", pFuncObj);
@@ -800,32 +897,15 @@ void JITCompiler::compFuncReturn(llvm::IRBuilder<>& exitBuilder, CompFunction& c
             currentBuilder.CreateCondBr(pCompVal, pSetNumBlock, pConvBlock);
         }
 
-        // Get the address of the struct field
-        llvm::Value* gepValuesVal[2];
-        gepValuesVal[0] = llvm::ConstantInt::get(llvm::Type::getInt32Ty(*s_Context), 0);
-        gepValuesVal[1] = llvm::ConstantInt::get(llvm::Type::getInt32Ty(*s_Context), i);
-        llvm::ArrayRef<llvm::Value*> gepValRef(gepValuesVal, gepValuesVal+2);
-        llvm::Value* pValFieldAddr = writeBuilder.CreateGEP(pRetStruct, gepValRef);
-
-        // Store the value in the output structure
-        writeBuilder.CreateStore(pValue, pValFieldAddr);
+        // Insert the value in the return structure
+        pRetVal = writeBuilder.CreateInsertValue(pRetVal, pValue, i);
 
         // If this is the last output parameter
         if (i == outParams.size() - 1)
         {
-            // Get the address of the number struct field
-            llvm::Value* gepValuesNum[2];
-            gepValuesNum[0] = llvm::ConstantInt::get(llvm::Type::getInt32Ty(*s_Context), 0);
-            gepValuesNum[1] = llvm::ConstantInt::get(llvm::Type::getInt32Ty(*s_Context), outParams.size());
-            llvm::ArrayRef<llvm::Value*> gepValuesRef(gepValuesNum, gepValuesNum+2);
-            llvm::Value* pNumFieldAddr = writeBuilder.CreateGEP(pRetStruct, gepValuesRef);
-
-            // Store the number of values written into the output structure
+            // Set the number of values written and return the structure
             llvm::Value* pNumWritten = llvm::ConstantInt::get(llvm::Type::getInt64Ty(*s_Context), outParams.size());
-            writeBuilder.CreateStore(pNumWritten, pNumFieldAddr);
-
-            // Jump to the return block
-            writeBuilder.CreateBr(pRetBlock);
+            writeBuilder.CreateRet(writeBuilder.CreateInsertValue(pRetVal, pNumWritten, outParams.size()));
         }
         else
         {
@@ -845,6 +925,12 @@ void JITCompiler::compFuncReturn(llvm::IRBuilder<>& exitBuilder, CompFunction& c
 * Initial : Maxime Chevalier-Boisvert on April 28, 2009
 ****************************************************************
 Revisions and bug fixes:
+
+agent on October 18, 2026
+Versions are recompiled in place when type feedback changes.
+Arguments are passed directly and output values are returned in a
+first-class structure rather than through memory.
+Independent loops are outlined to run on the worker threads.
 */
 void JITCompiler::compileFunction(ProgFunction* pFunction, const TypeSetString& argTypeStr)
 {
@@ -856,6 +942,9 @@ void JITCompiler::compileFunction(ProgFunction* pFunction, const TypeSetString&
 
     PROF_START_TIMER(Profiler::COMP_TIME_TOTAL);
 
+    // Save the statement being compiled in the caller, if any
+    Statement* pCallerStmt = global_stmt;
+
     // Log that we are compiling this function
     if (ConfigManager::s_verboseVar)
       std::cout << "Compiling function: \"" << pFunction->getFuncName() << "\"" << std::endl;
@@ -872,10 +961,29 @@ void JITCompiler::compileFunction(ProgFunction* pFunction, const TypeSetString&
         // Get the current function body
         StmtSequence* pFuncBody = pFunction->getCurrentBody();
 
+        // Replace the element-wise loops by array operations
+        if (s_jitLoopIdioms.getBoolValue() == true)
+            pFuncBody = transformLoopIdioms(pFuncBody, pFunction);
+
+        // Outline the parallel loops into chunk functions
+        if (s_jitParallelLoops.getBoolValue() == true || s_jitAutoParallel.getBoolValue() == true)
+        {
+            pFuncBody = transformParallelLoops(
+                pFuncBody,
+                pFunction,
+                s_jitParallelLoops.getBoolValue(),
+                s_jitAutoParallel.getBoolValue()
+            );
+        }
+
         // Transform the function body to split form
         pFuncBody = transformLogic(pFuncBody, pFunction);
         pFuncBody = splitSequence(pFuncBody, pFunction);
 
+        // Inline the calls to small functions, before any analysis runs
+        if (s_jitInlineCalls.getBoolValue() == true)
+            pFuncBody = inlineCalls(pFuncBody, pFunction, s_jitInlineMaxStmts.getIntValue());
+
         // Store a pointer to the function object
         compFunction.pProgFunc = pFunction;
 
@@ -896,16 +1004,41 @@ void JITCompiler::compileFunction(ProgFunction* pFunction, const TypeSetString&
     // Get a reference to the compiled function object
     CompFunction& compFunction = funcItr->second;
 
+    // Attempt to find an entry for this function version
+    VersionMap::iterator versionItr = compFunction.versions.find(argTypeStr);
+
+    // Number of times this version was previously compiled
+    size_t numCompiles = 0;
+
     // If there is already an entry for this function version
-    if (compFunction.versions.find(argTypeStr) != compFunction.versions.end())
+    if (versionItr != compFunction.versions.end())
     {
-        // Throw a compilation error exception
-        throw CompError("Function version is already compiled");
+        // If the version is not awaiting recompilation
+        if (versionItr->second.needsRecompile == false)
+        {
+            // Throw a compilation error exception
+            throw CompError("Function version is already compiled");
+        }
+
+        // Log that we are recompiling this version
+        if (ConfigManager::s_verboseVar)
+            std::cout << "Recompiling with new type feedback" << std::endl;
+
+        numCompiles = versionItr->second.numCompiles;
+
+        // Reset the version in place, since compiled code refers to its address
+        versionItr->second = CompVersion();
+
+        // Discard the previous speculative type information
+        AnalysisManager::clearInfo(&computeSpecTypeInfo, pFunction, compFunction.pFuncBody, argTypeStr);
     }
 
     // Create an entry for this function version
     CompVersion& compVersion = compFunction.versions[argTypeStr];
 
+    // Update the compilation count
+    compVersion.numCompiles = numCompiles + 1;
+
     // Store the input argument types
     compVersion.inArgTypes = argTypeStr;
 
@@ -918,9 +1051,20 @@ void JITCompiler::compileFunction(ProgFunction* pFunction, const TypeSetString&
     compVersion.pLiveVarInfo = (const LiveVarInfo*)AnalysisManager::requestInfo(&computeLiveVars,
         pFunction, compFunction.pFuncBody, compVersion.inArgTypes);
 
-    compVersion.pTypeInferInfo = (const TypeInferInfo*)AnalysisManager::requestInfo(&computeTypeInfo,
+    compVersion.pStaticTypeInfo = (const TypeInferInfo*)AnalysisManager::requestInfo(&computeTypeInfo,
         pFunction, compFunction.pFuncBody, compVersion.inArgTypes);
 
+    // Speculate on recorded types, unless the types are being validated
+    if (s_jitTypeSpeculation.getBoolValue() == true && Interpreter::s_validateTypes.getBoolValue() == false)
+    {
+        compVersion.pTypeInferInfo = (const TypeInferInfo*)AnalysisManager::requestInfo(&computeSpecTypeInfo,
+            pFunction, compFunction.pFuncBody, compVersion.inArgTypes);
+    }
+    else
+    {
+        compVersion.pTypeInferInfo = compVersion.pStaticTypeInfo;
+    }
+
     compVersion.pMetricsInfo = (const MetricsInfo*)AnalysisManager::requestInfo(&computeMetrics,
         pFunction, compFunction.pFuncBody, compVersion.inArgTypes);
 
@@ -933,6 +1077,12 @@ void JITCompiler::compileFunction(ProgFunction* pFunction, const TypeSetString&
         &ArrayCopyElim::computeArrayCopyElim, pFunction, compFunction.pFuncBody, compVersion.inArgTypes);
     }
 
+    compVersion.pEscapeInfo = (const EscapeInfo*)AnalysisManager::requestInfo(&computeEscapeInfo,
+        pFunction, compFunction.pFuncBody, compVersion.inArgTypes);
+
+    compVersion.pValueRangeInfo = (const ValueRangeInfo*)AnalysisManager::requestInfo(&computeValueRanges,
+        pFunction, compFunction.pFuncBody, compVersion.inArgTypes);
+
     //    std::cout << "IIR: \n" << pFunction->toString() << "\n";
 
     PROF_STOP_TIMER(Profiler::ANA_TIME_TOTAL);
@@ -944,6 +1094,10 @@ void JITCompiler::compileFunction(ProgFunction* pFunction, const TypeSetString&
     // Create a name string for the function
     std::string funcName = pFunction->getFuncName() + "_" + ::toString((void*)compVersion.pTypeInferInfo);
 
+    // Distinguish recompiled versions from the previous ones
+    if (compVersion.numCompiles > 1)
+        funcName += "_" + ::toString(compVersion.numCompiles);
+
     // Get the input and output parameters for the function
     const ProgFunction::ParamVector& inParams = pFunction->getInParams();
     const ProgFunction::ParamVector& outParams = pFunction->getOutParams();
@@ -951,19 +1105,11 @@ void JITCompiler::compileFunction(ProgFunction* pFunction, const TypeSetString&
 
     setUpParameters(pFunction, compFunction, compVersion, argTypeStr);
 
-    // Create a type vector for the function input argument types
-    LLVMTypeVector inArgTypes;
+    // Get a function type object taking the arguments directly, in their storage
+    // modes, and returning the output values and their number in a structure
+    llvm::FunctionType* pFuncType = llvm::FunctionType::get(compVersion.pOutStructType, compVersion.inArgStoreModes, false);
 
-    // Add a pointer to the input data structure to the input types
-    inArgTypes.push_back(llvm::PointerType::getUnqual(compVersion.pInStructType));
-
-    // Add a pointer to the output data structure to the input types
-    inArgTypes.push_back(llvm::PointerType::getUnqual(compVersion.pOutStructType));
-
-    // Get a function type object with the appropriate signature
-    llvm::FunctionType* pFuncType = llvm::FunctionType::get(llvm::Type::getVoidTy(*s_Context), inArgTypes, false);
-
-    // Create a function object with a void pointer input type and a void return type
+    // Create a function object with this signature
     llvm::Constant* pFuncConst = s_pModule->getOrInsertFunction(funcName, pFuncType);
     llvm::Function* pFuncObj = llvm::cast<llvm::Function>(pFuncConst);
 
@@ -983,25 +1129,17 @@ void JITCompiler::compileFunction(ProgFunction* pFunction, const TypeSetString&
     // Ensure that there are no more arguments than the number of formal parameters
     assert (argTypeStr.size() <= inParams.size());
 
-    // Get a pointer to the input struct value
-    llvm::Value* pInStructVal = pFuncObj->arg_begin();
+    // Get an iterator to the function arguments
+    llvm::Function::arg_iterator argItr = pFuncObj->arg_begin();
 
     // For each input argument
-    for (size_t i = 0; i < argTypeStr.size(); ++i)
+    for (size_t i = 0; i < argTypeStr.size(); ++i, ++argItr)
     {
         // Get the symbol for this argument
         SymbolExpr* pSymbol = inParams[i];
 
-        // Read the argument from the input struct
-        llvm::Value* gepValsArg[2];
-        gepValsArg[0] = llvm::ConstantInt::get(llvm::Type::getInt32Ty(*s_Context), 0);
-        gepValsArg[1] = llvm::ConstantInt::get(llvm::Type::getInt32Ty(*s_Context), i);
-        llvm::ArrayRef<llvm::Value*> gepValsArgRef(gepValsArg, gepValsArg+2);
-        llvm::Value* pArgAddrVal = entryBuilder.CreateGEP(pInStructVal, gepValsArgRef);
-        llvm::Value* pArgVal = entryBuilder.CreateLoad(pArgAddrVal);
-
         // Create a value object for this argument
-        Value argValue(pArgVal, compVersion.inArgObjTypes[i]);
+        Value argValue(argItr, compVersion.inArgObjTypes[i]);
 
         // Add the argument value to the variable map
         variableMap[pSymbol] = argValue;
@@ -1011,13 +1149,8 @@ void JITCompiler::compileFunction(ProgFunction* pFunction, const TypeSetString&
     SymbolExpr* pNarginSym = Interpreter::getNarginSym();
     SymbolExpr* pNargoutSym = Interpreter::getNargoutSym();
 
-    // Read the "nargout" argument from the input struct
-    llvm::Value* gepValsNargout[2];
-    gepValsNargout[0] = llvm::ConstantInt::get(llvm::Type::getInt32Ty(*s_Context), 0);
-    gepValsNargout[1] = llvm::ConstantInt::get(llvm::Type::getInt32Ty(*s_Context), argTypeStr.size());
-    llvm::ArrayRef<llvm::Value*> gepValsNargoutRef(gepValsNargout, gepValsNargout+2);
-    llvm::Value* pNargoutAddrVal = entryBuilder.CreateGEP(pInStructVal, gepValsNargoutRef);
-    llvm::Value* pNargoutVal = entryBuilder.CreateLoad(pNargoutAddrVal);
+    // The "nargout" value is the last argument
+    llvm::Value* pNargoutVal = argItr;
 
     // Add the "nargout" argument to the variable map
     variableMap[pNargoutSym] = Value(pNargoutVal, DataObject::Type::MATRIX_F64);
@@ -1063,6 +1196,9 @@ void JITCompiler::compileFunction(ProgFunction* pFunction, const TypeSetString&
     if (exitPoint.first != NULL)
         returnPoints.push_back(exitPoint);
 
+    // Add the failed type guard exits to the return point list
+    returnPoints.insert(returnPoints.end(), compVersion.deoptPoints.begin(), compVersion.deoptPoints.end());
+
     // Ensure that there is at least one return point
     assert (returnPoints.empty() == false);
 
@@ -1082,8 +1218,12 @@ void JITCompiler::compileFunction(ProgFunction* pFunction, const TypeSetString&
     // If the function has no return parameters
     if (outParams.size() == 0)
     {
-        // Return immediately
-        exitBuilder.CreateRetVoid();
+        // Return immediately, with no values written
+        exitBuilder.CreateRet(llvm::ConstantStruct::get(
+            compVersion.pOutStructType,
+            llvm::ConstantInt::get(llvm::Type::getInt64Ty(*s_Context), 0),
+            NULL
+        ));
     }
     else
     {
@@ -1099,7 +1239,7 @@ void JITCompiler::compileFunction(ProgFunction* pFunction, const TypeSetString&
     s_pFunctionPasses->run(*pFuncObj);
 
     // Get a function pointer to the compiled function
-    COMP_FUNC_PTR pFuncPtr = (COMP_FUNC_PTR)s_pExecEngine->getPointerToFunction(pFuncObj);
+    void* pFuncPtr = s_pExecEngine->getPointerToFunction(pFuncObj);
 
     // Store a pointer to the compiled function code
     compVersion.pFuncPtr = pFuncPtr;
@@ -1116,6 +1256,8 @@ void JITCompiler::compileFunction(ProgFunction* pFunction, const TypeSetString&
 
     PROF_STOP_TIMER(Profiler::COMP_TIME_TOTAL);
 
+    // Restore the statement being compiled in the caller
+    global_stmt = pCallerStmt;
 
     hotspot::Profiler::get()->cPopContext();
 }
@@ -1126,9 +1268,17 @@ void JITCompiler::compileFunction(ProgFunction* pFunction, const TypeSetString&
 * Initial : Maxime Chevalier-Boisvert on April 29, 2009
 ****************************************************************
 Revisions and bug fixes:
+
+agent on October 18, 2026
+The sizes of small matrix arguments are part of the version key.
+Lookups are serialized, and versions are not recompiled in place
+while parallel loop threads may be running them.
 */
 JITCompiler::CompVersion* JITCompiler::findFunction(ProgFunction* pFunction, ArrayObj* pArguments, size_t outArgCount)
 {
+    // Lock the compiler state
+    JITLock lock;
+
     // Get a reference to the input parameter vector
     const ProgFunction::ParamVector& inParams = pFunction->getInParams();
 
@@ -1146,6 +1296,23 @@ JITCompiler::CompVersion* JITCompiler::findFunction(ProgFunction* pFunction, Arr
     // Build a type set string from the arguments
     TypeSetString argTypeStr = typeSetStrMake(pArguments);
 
+    // If small matrices are kept in registers
+    if (s_jitSmallMatrices.getBoolValue() == true)
+    {
+        // For each argument
+        for (size_t i = 0; i < pArguments->getSize(); ++i)
+        {
+            // Get the type of this argument, with its dimensions
+            TypeInfo argType(pArguments->getObject(i), true, true);
+
+            // If the argument is a small matrix, record its size so
+            // that the function version can keep it in registers
+            size_t numRows, numCols;
+            if (getSmallMatSize(argType, numRows, numCols))
+                argTypeStr[i] = typeSetMake(argType);
+        }
+    }
+
     // Attempt to find the function in the function map
     FunctionMap::iterator funcItr = s_functionMap.find(pFunction);
 
@@ -1157,6 +1324,15 @@ JITCompiler::CompVersion* JITCompiler::findFunction(ProgFunction* pFunction, Arr
         hotspot::Profiler::get()->cAssert();
     }
 
+    // If the version is awaiting recompilation with new type feedback
+    // Note: this is deferred until the worker threads are done
+    else if (funcItr->second.versions.find(argTypeStr)->second.needsRecompile &&
+             WorkerPool::isBusy() == false)
+    {
+        compileFunction(pFunction, argTypeStr);
+        hotspot::Profiler::get()->cAssert();
+    }
+
     // Find the compiled function object
     funcItr = s_functionMap.find(pFunction);
     assert (funcItr != s_functionMap.end());
@@ -1193,38 +1369,6 @@ ArrayObj* JITCompiler::callFunction(ProgFunction* pFunction,
   return pOutput;
 }
 
-/***************************************************************
-* Function: JITCompiler::getCallEnv()
-* Purpose : Handle exceptions during function calls
-* Initial : Maxime Chevalier-Boisvert on June 9, 2009
-****************************************************************
-Revisions and bug fixes:
-*/
-void JITCompiler::callExceptHandler(
-    ProgFunction* pFunction,
-    COMP_FUNC_PTR pFuncPtr,
-    byte* pInStruct,
-    byte* pOutStruct
-)
-{
-    // Setup a try block to catch any errors
-    try
-    {
-        // Perform the function call
-        pFuncPtr(pInStruct, pOutStruct);
-    }
-
-    // If runtime errors are caught
-    catch (RunError error)
-    {
-        // Add additional error text
-        error.addInfo("error during call to \"" + pFunction->getFuncName() + "\"");
-
-        // Retrow the error
-        throw error;
-    }
-}
-
 /***************************************************************
 * Function: JITCompiler::getCallEnv()
 * Purpose : Create/get the calling environment for a function
@@ -1271,67 +1415,6 @@ llvm::Value* JITCompiler::getCallEnv(
     return version.pEnvObject;
 }
 
-/***************************************************************
-* Function: JITCompiler::getCallStructs()
-* Purpose : Create/get the call data struct for a function
-* Initial : Maxime Chevalier-Boisvert on June 18, 2009
-****************************************************************
-Revisions and bug fixes:
-*/
-JITCompiler::LLVMValuePair JITCompiler::getCallStructs(
-    CompFunction& callerFunction,
-    CompVersion& callerVersion,
-    CompFunction& calleeFunction,
-    CompVersion& calleeVersion
-)
-{
-    // Get the size of the in/out structures for the callee
-    size_t inStructSize = s_data_layout->getTypeStoreSize(calleeVersion.pInStructType);
-    size_t outStructSize = s_data_layout->getTypeStoreSize(calleeVersion.pOutStructType);
-
-    // Update the caller's in/out struct sizes
-    callerVersion.inStructSize = std::max(callerVersion.inStructSize, inStructSize);
-    callerVersion.outStructSize = std::max(callerVersion.outStructSize, outStructSize);
-
-    // Create an IR builder for the function's entry block
-    llvm::IRBuilder<> irBuilder(callerVersion.pEntryBlock);
-
-    // Allocate memory on the stack for the input call data structure
-    llvm::Value* pNewInStruct = irBuilder.CreateAlloca(
-        llvm::Type::getInt8Ty(*s_Context),
-        llvm::ConstantInt::get(
-            llvm::Type::getInt32Ty(*s_Context),
-            callerVersion.inStructSize
-        )
-    );
-
-    // Allocate memory on the stack for the output call data structure
-    llvm::Value* pNewOutStruct = irBuilder.CreateAlloca(
-        llvm::Type::getInt8Ty(*s_Context),
-        llvm::ConstantInt::get(
-            llvm::Type::getInt32Ty(*s_Context),
-            callerVersion.outStructSize
-        )
-    );
-
-    // If are already call data structs at this point
-    if (callerVersion.pInStruct != NULL)
-    {
-        // Note: here, we redo the struct allocations in case the max
-        // in/out struct sizes have changed as a result of a callee
-        // function being compiled.
-        callerVersion.pInStruct->replaceAllUsesWith(pNewInStruct);
-        callerVersion.pOutStruct->replaceAllUsesWith(pNewOutStruct);
-    }
-
-    // Store the in/out struct pointers
-    callerVersion.pInStruct = pNewInStruct;
-    callerVersion.pOutStruct = pNewOutStruct;
-
-    // Return call data structure pointers
-    return LLVMValuePair(callerVersion.pInStruct, callerVersion.pOutStruct);
-}
-
 /***************************************************************
 * Function: JITCompiler::matchBranchPoints()
 * Purpose : Match branching point variable mappings
@@ -1569,8 +1652,11 @@ JITCompiler::VariableMap JITCompiler::matchBranchPoints(
 * Initial : Maxime Chevalier-Boisvert on March 18, 2009
 ****************************************************************
 Revisions and bug fixes:
+
+agent on October 18, 2026
+Returns the number of variables written.
 */
-void JITCompiler::writeVariables(
+size_t JITCompiler::writeVariables(
     llvm::IRBuilder<>& irBuilder,
     CompFunction& function,
     CompVersion& version,
@@ -1578,6 +1664,9 @@ void JITCompiler::writeVariables(
     const Expression::SymbolSet& variables
 )
 {
+    // Number of variables written
+    size_t numWritten = 0;
+
     // For each variable
     for (Expression::SymbolSet::const_iterator itr = variables.begin(); itr != variables.end(); ++itr)
     {
@@ -1599,6 +1688,7 @@ void JITCompiler::writeVariables(
 
             // Set the variable map binding to NULL
             varMap[pSymbol].pValue = NULL;
+            ++numWritten;
 
             // If we are in verbose mode, log that the variable was written
             if (ConfigManager::s_verboseVar)
@@ -1617,6 +1707,9 @@ void JITCompiler::writeVariables(
             }
         }
     }
+
+    // Return the number of variables written
+    return numWritten;
 }
 
 /***************************************************************
@@ -1883,6 +1976,9 @@ void JITCompiler::printVarMap(
 * Initial : Maxime Chevalier-Boisvert on May 22, 2009
 ****************************************************************
 Revisions and bug fixes:
+
+agent on October 18, 2026
+Small fixed-size matrices can be stored in registers.
 */
 llvm::Type* JITCompiler::getStorageMode(
     const TypeSet& typeSet,
@@ -1930,10 +2026,132 @@ llvm::Type* JITCompiler::getStorageMode(
         }
     }
 
+    // If the value is a small fixed-size matrix, store its elements directly
+    size_t numRows, numCols;
+    if (getSmallMatSize(typeInfo, numRows, numCols))
+        return getSmallMatMode(numRows, numCols);
+
     // Store the value as an object pointer
     return VOID_PTR_TYPE;
 }
 
+/***************************************************************
+* Function: JITCompiler::getSmallMatSize()
+* Purpose : Get the size of a small fixed-size matrix type
+* Initial : agent on October 18, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+bool JITCompiler::getSmallMatSize(
+    const TypeInfo& typeInfo,
+    size_t& numRows,
+    size_t& numCols
+)
+{
+    // If small matrices are not kept in registers, stop
+    if (s_jitSmallMatrices.getBoolValue() == false)
+        return false;
+
+    // Only non-scalar f64 matrices of known 2D size qualify
+    if (typeInfo.getObjType() != DataObject::Type::MATRIX_F64 || typeInfo.isScalar() ||
+        typeInfo.getSizeKnown() == false || typeInfo.getMatSize().size() != 2)
+        return false;
+
+    // Get the matrix dimensions
+    numRows = typeInfo.getMatSize()[0];
+    numCols = typeInfo.getMatSize()[1];
+
+    // The matrix must be non-empty, not 1x1, and small enough
+    return
+        numRows >= 1 && numRows <= SMALL_MAT_MAX_DIM &&
+        numCols >= 1 && numCols <= SMALL_MAT_MAX_DIM &&
+        numRows * numCols > 1;
+}
+
+/***************************************************************
+* Function: JITCompiler::getSmallMatMode()
+* Purpose : Get the storage mode for a small fixed-size matrix
+* Initial : agent on October 18, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+llvm::Type* JITCompiler::getSmallMatMode(
+    size_t numRows,
+    size_t numCols
+)
+{
+    // Store the matrix as an array of column vectors, so that
+    // the storage mode encodes the matrix dimensions
+    return llvm::ArrayType::get(
+        llvm::VectorType::get(llvm::Type::getDoubleTy(*s_Context), numRows),
+        numCols
+    );
+}
+
+/***************************************************************
+* Function: JITCompiler::isSmallMatMode()
+* Purpose : Test if a storage mode is that of a small matrix
+* Initial : agent on October 18, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+bool JITCompiler::isSmallMatMode(
+    const llvm::Type* mode,
+    size_t* pNumRows,
+    size_t* pNumCols
+)
+{
+    // The mode must be an array of f64 column vectors
+    const llvm::ArrayType* pArrayType = llvm::dyn_cast<llvm::ArrayType>(mode);
+    if (pArrayType == NULL)
+        return false;
+    const llvm::VectorType* pColType = llvm::dyn_cast<llvm::VectorType>(pArrayType->getElementType());
+    if (pColType == NULL || pColType->getElementType() != llvm::Type::getDoubleTy(*s_Context))
+        return false;
+
+    // Extract the matrix dimensions, if requested
+    if (pNumRows) *pNumRows = pColType->getNumElements();
+    if (pNumCols) *pNumCols = pArrayType->getNumElements();
+
+    return true;
+}
+
+/***************************************************************
+* Function: JITCompiler::getExprStorageMode()
+* Purpose : Get the storage mode for the value of an expression
+* Initial : agent on October 18, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+llvm::Type* JITCompiler::getExprStorageMode(
+    Expression* pExpr,
+    const CompVersion& version,
+    const VarTypeMap& varTypes,
+    DataObject::Type& objType
+)
+{
+    // Declare a type set for the possible expression types
+    TypeSet exprTypes;
+
+    // If the expression is a symbol
+    if (pExpr->getExprType() == Expression::ExprType::SYMBOL)
+    {
+        // Get the type set associated with the symbol
+        VarTypeMap::const_iterator typeItr = varTypes.find((SymbolExpr*)pExpr);
+        exprTypes = (typeItr != varTypes.end())? typeItr->second:TypeSet();
+    }
+    else
+    {
+        // Get the type set associated with the expression, if it was analyzed
+        ExprTypeMap::const_iterator typeItr = version.pTypeInferInfo->exprTypeMap.find(pExpr);
+        if (typeItr != version.pTypeInferInfo->exprTypeMap.end() && typeItr->second.size() == 1)
+            exprTypes = typeItr->second[0];
+    }
+
+    // Get the storage mode for these types
+    return getStorageMode(exprTypes, objType);
+}
+
 /***************************************************************
 * Function: JITCompiler::widestStorageMode()
 * Purpose : Get the widest storage mode among two options
@@ -1953,6 +2171,10 @@ llvm::Type* JITCompiler::widestStorageMode(
     if (modeA == VOID_PTR_TYPE || modeB == VOID_PTR_TYPE )
         return VOID_PTR_TYPE;
 
+    // Small matrices only share a mode with matrices of the same size
+    else if (isSmallMatMode(modeA) || isSmallMatMode(modeB))
+        return (modeA == modeB)? modeA:VOID_PTR_TYPE;
+
     // If either option is the f64 mode, return that option
     else if (modeA == llvm::Type::getDoubleTy(*s_Context) || modeB == llvm::Type::getDoubleTy(*s_Context))
         return llvm::Type::getDoubleTy(*s_Context);
@@ -1978,6 +2200,9 @@ llvm::Type* JITCompiler::widestStorageMode(
 * Initial : Maxime Chevalier-Boisvert on May 21, 2009
 ****************************************************************
 Revisions and bug fixes:
+
+agent on October 18, 2026
+Added the boxing and unboxing of small fixed-size matrices.
 */
 llvm::Value* JITCompiler::changeStorageMode(
     llvm::IRBuilder<>& irBuilder,
@@ -2462,6 +2687,24 @@ llvm::Value* JITCompiler::changeStorageMode(
                 return pScalarVal;
             }
         }
+
+        // If we must convert to a small fixed-size matrix
+        else if (isSmallMatMode(newMode))
+        {
+            // Load the matrix elements into registers
+            return unboxSmallMatrix(irBuilder, pCurVal, newMode);
+        }
+    }
+
+    // If the variable is stored as a small fixed-size matrix
+    else if (isSmallMatMode(current_type))
+    {
+        // If we must convert to an object pointer type
+        if (newMode == VOID_PTR_TYPE)
+        {
+            // Store the matrix elements into a new matrix object
+            return boxSmallMatrix(irBuilder, pCurVal);
+        }
     }
 
     // Test is the current llvm type is a structure
@@ -2496,36 +2739,237 @@ llvm::Value* JITCompiler::changeStorageMode(
     throw std::runtime_error("Invalid type conversion requested");
 }
 
+// Function to get an element of a small matrix held in registers
+static llvm::Value* smallMatGet(
+    llvm::IRBuilder<>& builder,
+    llvm::Value* pMatValue,
+    size_t row,
+    size_t col
+)
+{
+    llvm::Value* pColVal = builder.CreateExtractValue(pMatValue, col);
+    return builder.CreateExtractElement(
+        pColVal,
+        llvm::ConstantInt::get(llvm::Type::getInt32Ty(builder.getContext()), row)
+    );
+}
+
+// Function to set an element of a small matrix held in registers
+static llvm::Value* smallMatSet(
+    llvm::IRBuilder<>& builder,
+    llvm::Value* pMatValue,
+    llvm::Value* pElemValue,
+    size_t row,
+    size_t col
+)
+{
+    llvm::Value* pColVal = builder.CreateExtractValue(pMatValue, col);
+    pColVal = builder.CreateInsertElement(
+        pColVal,
+        pElemValue,
+        llvm::ConstantInt::get(llvm::Type::getInt32Ty(builder.getContext()), row)
+    );
+    return builder.CreateInsertValue(pMatValue, pColVal, col);
+}
+
+// Function to broadcast a scalar value into a column vector
+static llvm::Value* smallMatSplat(
+    llvm::IRBuilder<>& builder,
+    llvm::Value* pScalarValue,
+    size_t numRows
+)
+{
+    llvm::Type* pColType = llvm::VectorType::get(pScalarValue->getType(), numRows);
+    llvm::Value* pColVal = llvm::UndefValue::get(pColType);
+    for (size_t i = 0; i < numRows; ++i)
+    {
+        pColVal = builder.CreateInsertElement(
+            pColVal,
+            pScalarValue,
+            llvm::ConstantInt::get(llvm::Type::getInt32Ty(builder.getContext()), i)
+        );
+    }
+    return pColVal;
+}
+
 /***************************************************************
-* Function: JITCompiler::compWrapperFunc()
-* Purpose : Compile a call wrapper function
-* Initial : Maxime Chevalier-Boisvert on June 11, 2009
+* Function: JITCompiler::boxSmallMatrix()
+* Purpose : Box a small fixed-size matrix into a matrix object
+* Initial : agent on October 18, 2026
 ****************************************************************
 Revisions and bug fixes:
 */
-void JITCompiler::compWrapperFunc(
-    CompFunction& function,
-    CompVersion& version
+llvm::Value* JITCompiler::boxSmallMatrix(
+    llvm::IRBuilder<>& irBuilder,
+    llvm::Value* pMatValue
 )
 {
-    // Ensure that the JIT compiler was initialized
-    assert (s_pModule != NULL && s_pExecEngine != NULL);
+    // Get the matrix dimensions from the storage mode
+    size_t numRows, numCols;
+    bool isSmallMat = isSmallMatMode(pMatValue->getType(), &numRows, &numCols);
+    assert (isSmallMat);
+
+    // Create a new matrix object of the right size
+    LLVMValueVector sizeArgs;
+    sizeArgs.push_back(llvm::ConstantInt::get(llvm::Type::getInt64Ty(*s_Context), numRows));
+    sizeArgs.push_back(llvm::ConstantInt::get(llvm::Type::getInt64Ty(*s_Context), numCols));
+    llvm::Value* pMatObject = createNativeCall(
+        irBuilder,
+        (void*)makeSmallMatrix,
+        sizeArgs
+    );
 
-    // Ensure that a wrapper function is not already compiled
-    assert (version.pWrapperPtr == NULL);
+    // Load the pointer to the matrix elements
+    llvm::Value* pDataPtr = loadMemberValue(
+        irBuilder,
+        pMatObject,
+        MEMBER_OFFSET(MatrixF64Obj, m_pElements),
+        llvm::PointerType::getUnqual(llvm::Type::getDoubleTy(*s_Context))
+    );
 
-    // Ensure that the function object was compiled
-    assert (version.pLLVMFunc != NULL);
+    // Store each matrix element, in column-major order
+    for (size_t col = 0; col < numCols; ++col)
+    {
+        for (size_t row = 0; row < numRows; ++row)
+        {
+            llvm::Value* pElemPtr = irBuilder.CreateGEP(
+                pDataPtr,
+                llvm::ConstantInt::get(llvm::Type::getInt64Ty(*s_Context), col * numRows + row)
+            );
+            irBuilder.CreateStore(smallMatGet(irBuilder, pMatValue, row, col), pElemPtr);
+        }
+    }
 
-    // Get a pointer to the function object
-    ProgFunction* pFunction = function.pProgFunc;
+    // Return the matrix object
+    return pMatObject;
+}
 
-    // If we are in verbose mode, log the wrapper function compilation
-    if (ConfigManager::s_verboseVar)
-        std::cout << "Compiling wrapper for function: \"" << pFunction->getFuncName() << "\"" << std::endl;
+/***************************************************************
+* Function: JITCompiler::unboxSmallMatrix()
+* Purpose : Unbox a matrix object into a small fixed-size matrix
+* Initial : agent on October 18, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+llvm::Value* JITCompiler::unboxSmallMatrix(
+    llvm::IRBuilder<>& irBuilder,
+    llvm::Value* pMatObject,
+    const llvm::Type* matMode
+)
+{
+    // Get the matrix dimensions from the storage mode
+    size_t numRows, numCols;
+    bool isSmallMat = isSmallMatMode(matMode, &numRows, &numCols);
+    assert (isSmallMat);
+
+    // Get the matrix elements, checking the matrix size at run time
+    LLVMValueVector dataArgs;
+    dataArgs.push_back(pMatObject);
+    dataArgs.push_back(llvm::ConstantInt::get(llvm::Type::getInt64Ty(*s_Context), numRows));
+    dataArgs.push_back(llvm::ConstantInt::get(llvm::Type::getInt64Ty(*s_Context), numCols));
+    llvm::Value* pDataPtr = createNativeCall(
+        irBuilder,
+        (void*)getSmallMatData,
+        dataArgs
+    );
 
-    // Create a name string for the function
-    std::string funcName = pFunction->getFuncName() + "_wrapper_" + ::toString((void*)version.pTypeInferInfo);
+    // Load each matrix element into registers
+    llvm::Value* pMatValue = llvm::UndefValue::get(const_cast<llvm::Type*>(matMode));
+    for (size_t col = 0; col < numCols; ++col)
+    {
+        for (size_t row = 0; row < numRows; ++row)
+        {
+            llvm::Value* pElemPtr = irBuilder.CreateGEP(
+                pDataPtr,
+                llvm::ConstantInt::get(llvm::Type::getInt64Ty(*s_Context), col * numRows + row)
+            );
+            pMatValue = smallMatSet(irBuilder, pMatValue, irBuilder.CreateLoad(pElemPtr), row, col);
+        }
+    }
+
+    // Return the matrix value
+    return pMatValue;
+}
+
+/***************************************************************
+* Function: JITCompiler::makeSmallMatrix()
+* Purpose : Create a matrix object to box a small matrix into
+* Initial : agent on October 18, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+DataObject* JITCompiler::makeSmallMatrix(
+    int64 numRows,
+    int64 numCols
+)
+{
+    // Create a new uninitialized matrix of the requested size
+    return new MatrixF64Obj(numRows, numCols);
+}
+
+/***************************************************************
+* Function: JITCompiler::getSmallMatData()
+* Purpose : Get the elements of a matrix unboxed as a small matrix
+* Initial : agent on October 18, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+float64* JITCompiler::getSmallMatData(
+    DataObject* pObject,
+    int64 numRows,
+    int64 numCols
+)
+{
+    // Ensure that the object is a matrix of the expected size
+    if (pObject->getType() != DataObject::Type::MATRIX_F64)
+        throw RunError("small matrix size mismatch");
+    MatrixF64Obj* pMatrix = (MatrixF64Obj*)pObject;
+    const DimVector& matSize = pMatrix->getSize();
+    if (matSize.size() != 2 || matSize[0] != size_t(numRows) || matSize[1] != size_t(numCols))
+        throw RunError("small matrix size mismatch");
+
+    // Return a pointer to the matrix elements
+    return pMatrix->getElements();
+}
+
+/***************************************************************
+* Function: JITCompiler::compWrapperFunc()
+* Purpose : Compile a call wrapper function
+* Initial : Maxime Chevalier-Boisvert on June 11, 2009
+****************************************************************
+Revisions and bug fixes:
+
+agent on October 18, 2026
+The wrapper now marshals the arguments and return values to and from the
+direct calling convention of compiled functions.
+*/
+void JITCompiler::compWrapperFunc(
+    CompFunction& function,
+    CompVersion& version
+)
+{
+    // Ensure that the JIT compiler was initialized
+    assert (s_pModule != NULL && s_pExecEngine != NULL);
+
+    // Ensure that a wrapper function is not already compiled
+    assert (version.pWrapperPtr == NULL);
+
+    // Ensure that the function object was compiled
+    assert (version.pLLVMFunc != NULL);
+
+    // Get a pointer to the function object
+    ProgFunction* pFunction = function.pProgFunc;
+
+    // If we are in verbose mode, log the wrapper function compilation
+    if (ConfigManager::s_verboseVar)
+        std::cout << "Compiling wrapper for function: \"" << pFunction->getFuncName() << "\"" << std::endl;
+
+    // Create a name string for the function
+    std::string funcName = pFunction->getFuncName() + "_wrapper_" + ::toString((void*)version.pTypeInferInfo);
+
+    // Distinguish recompiled versions from the previous ones
+    if (version.numCompiles > 1)
+        funcName += "_" + ::toString(version.numCompiles);
 
     // Get a function type object with the appropriate signature
     LLVMTypeVector argTypes;
@@ -2553,8 +2997,8 @@ void JITCompiler::compWrapperFunc(
     // Get a pointer to the function's input argument
     llvm::Value* pInArrayArg = pFuncObj->arg_begin();
 
-    // Allocate memory for the input structure
-    llvm::Value* pInStruct = entryBuilder.CreateAlloca(version.pInStructType);
+    // Create a vector for the function call arguments
+    LLVMValueVector fnCallArgs;
 
     // For each input argument
     for (size_t i = 0; i < version.inArgTypes.size(); ++i)
@@ -2577,57 +3021,23 @@ void JITCompiler::compWrapperFunc(
             version.inArgStoreModes[i]
         );
 
-        // Store the value in the input data struct
-        llvm::Value* gepValues[2];
-        gepValues[0] = llvm::ConstantInt::get(llvm::Type::getInt32Ty(*s_Context), 0);
-        gepValues[1] = llvm::ConstantInt::get(llvm::Type::getInt32Ty(*s_Context), i);
-        llvm::ArrayRef<llvm::Value*> gepValuesRef(gepValues, gepValues+2);
-        llvm::Value* pArgAddr = entryBuilder.CreateGEP(pInStruct, gepValuesRef);
-        entryBuilder.CreateStore(pArgVal, pArgAddr);
+        // Pass the value directly to the compiled function
+        fnCallArgs.push_back(pArgVal);
     }
 
     // Get a pointer to the function's output argument count argument
     llvm::Value* pOutArgCount = ++pFuncObj->arg_begin();
 
-    // Store the "nargout" value in the input data struct
-    llvm::Value* gepValsNargout[2];
-    gepValsNargout[0] = llvm::ConstantInt::get(llvm::Type::getInt32Ty(*s_Context), 0);
-    gepValsNargout[1] = llvm::ConstantInt::get(llvm::Type::getInt32Ty(*s_Context), version.inArgTypes.size());
-    llvm::ArrayRef<llvm::Value*> gepValsNargoutRef(gepValsNargout, gepValsNargout+2);
-    llvm::Value* pNargoutAddr = entryBuilder.CreateGEP(pInStruct, gepValsNargoutRef);
-    entryBuilder.CreateStore(pOutArgCount, pNargoutAddr);
-
-    // Declare a value for the return data structure
-    llvm::Value* pRetStruct = NULL;
+    // Pass the "nargout" value as the last argument
+    fnCallArgs.push_back(pOutArgCount);
 
     // Get the output parameters for the function
     const ProgFunction::ParamVector& outParams = pFunction->getOutParams();
 
-    // If the function has output parameters
-    if (outParams.size() != 0)
-    {
-        // Allocate memory for the output structure
-        pRetStruct = entryBuilder.CreateAlloca(version.pOutStructType);
-    }
-    else
-    {
-        // Set the return struct pointer to NULL
-        pRetStruct = createPtrConst(NULL, version.pOutStructType);
-    }
-
-    // Create a vector for the function call arguments
-    LLVMValueVector fnCallArgs;
-
-    // Add the input data structure pointer to the call arguments
-    fnCallArgs.push_back(pInStruct);
-
-    // Add the return data structure pointer to the call arguments
-    fnCallArgs.push_back(pRetStruct);
-
     //std::cout << "Creating call to function" << std::endl;
 
-    // Call the compiled function
-    entryBuilder.CreateCall(version.pLLVMFunc, fnCallArgs);
+    // Call the compiled function, which returns its output values in a structure
+    llvm::Value* pRetVal = entryBuilder.CreateCall(version.pLLVMFunc, fnCallArgs);
 
     //std::cout << "Created call to function" << std::endl;
 
@@ -2652,15 +3062,8 @@ void JITCompiler::compWrapperFunc(
     }
     else
     {
-        // Get the address of the number struct field
-        llvm::Value* gepValuesNum[2];
-        gepValuesNum[0] = llvm::ConstantInt::get(llvm::Type::getInt32Ty(*s_Context), 0);
-        gepValuesNum[1] = llvm::ConstantInt::get(llvm::Type::getInt32Ty(*s_Context), outParams.size());
-        llvm::ArrayRef<llvm::Value*> gepValuesRef(gepValuesNum, gepValuesNum+2);
-        llvm::Value* pNumFieldAddr = entryBuilder.CreateGEP(pRetStruct, gepValuesRef);
-
-        // Load the number of values written into the output structure
-        llvm::Value* pNumOutVals = entryBuilder.CreateLoad(pNumFieldAddr);
+        // Extract the number of values written from the returned structure
+        llvm::Value* pNumOutVals = entryBuilder.CreateExtractValue(pRetVal, outParams.size());
 
         // Create an initial basic block
         llvm::BasicBlock* pCurrentBlock = llvm::BasicBlock::Create(*s_Context, "", pFuncObj);
@@ -2683,15 +3086,8 @@ void JITCompiler::compWrapperFunc(
             llvm::BasicBlock* pWriteBlock = llvm::BasicBlock::Create(*s_Context, "", pFuncObj);
             llvm::IRBuilder<> writeBuilder(pWriteBlock);
 
-            // Get the address of the struct field
-            llvm::Value* gepValuesVal[2];
-            gepValuesVal[0] = llvm::ConstantInt::get(llvm::Type::getInt32Ty(*s_Context), 0);
-            gepValuesVal[1] = llvm::ConstantInt::get(llvm::Type::getInt32Ty(*s_Context), i);
-            llvm::ArrayRef<llvm::Value*> gepValRef(gepValuesVal, gepValuesVal+2);
-            llvm::Value* pValFieldAddr = writeBuilder.CreateGEP(pRetStruct, gepValRef);
-
-            // Store the value in the output structure
-            llvm::Value* pValue = writeBuilder.CreateLoad(pValFieldAddr);
+            // Extract the value from the returned structure
+            llvm::Value* pValue = writeBuilder.CreateExtractValue(pRetVal, i);
 
             // Change the storage mode of the value to the object pointer type
             llvm::Value* pValObj = changeStorageMode(
@@ -2874,6 +3270,9 @@ void JITCompiler::genCopyCode(
 * Initial : Nurudeen Lameed on December 29, 2009
 ****************************************************************
 Revisions and bug fixes:
+
+agent on October 18, 2026
+Copies are now lazy, the elements are copied on the first write.
 */
 void JITCompiler::genCopyCode(
         llvm::IRBuilder<>& irBuilder,
@@ -2911,12 +3310,13 @@ void JITCompiler::genCopyCode(
 
           //else	always generate copies for now
             {
+                // The copy shares the elements until one of the arrays is written
                 LLVMValueVector callArgs;
                 callArgs.push_back(lVal.pValue);
                 Value newVal(0, lVal.objType);
                 newVal.pValue = createNativeCall(
                     irBuilder,
-                    (void*)DataObject::copyObject,
+                    (void*)DataObject::lazyCopyObject,
                     callArgs
                 );
 
@@ -2926,6 +3326,61 @@ void JITCompiler::genCopyCode(
     }
 }
 
+/***************************************************************
+* Function: JITCompiler::genTempFrees()
+* Purpose : Free the temporaries that die at a statement
+* Initial : agent on October 18, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+void JITCompiler::genTempFrees(
+    llvm::IRBuilder<>& irBuilder,
+    CompVersion& version,
+    VariableMap& varMap,
+    const Statement* pStmt
+)
+{
+    // If freeing temporaries is disabled, do nothing
+    if (s_jitFreeTempsVar.getBoolValue() == false)
+        return;
+
+    // Find the temporaries that die at this statement
+    TempFreeMap::const_iterator freeItr = version.pEscapeInfo->freeVarMap.find(pStmt);
+    if (freeItr == version.pEscapeInfo->freeVarMap.end())
+        return;
+
+    // For each temporary
+    for (Expression::SymbolSet::const_iterator symItr = freeItr->second.begin(); symItr != freeItr->second.end(); ++symItr)
+    {
+        // Get a pointer to the symbol
+        SymbolExpr* pSymbol = *symItr;
+
+        // Find the variable and the object its definition produced
+        VariableMap::iterator varItr = varMap.find(pSymbol);
+        std::map<const SymbolExpr*, llvm::Value*>::const_iterator tempItr = version.tempValueMap.find(pSymbol);
+
+        // Only free the object if the variable still holds it locally,
+        // otherwise it may have been written to the environment or merged
+        // with values from other paths
+        if (varItr == varMap.end() || tempItr == version.tempValueMap.end() || varItr->second.pValue != tempItr->second)
+            continue;
+
+        // If we are in verbose mode, log that the temporary is freed
+        if (ConfigManager::s_verboseVar)
+            std::cout << "Freeing dead temporary: " << pSymbol->toString() << std::endl;
+
+        // Free the object
+        createNativeCall(
+            irBuilder,
+            (void*)BaseMatrixObj::freeTemp,
+            LLVMValueVector(1, varItr->second.pValue)
+        );
+
+        // The variable is dead, remove it from the variable map
+        varMap.erase(varItr);
+    }
+}
+
 /***************************************************************
 * Function: JITCompiler::genLoopHeaderCopy()
 * Purpose : copy code at a loop's header
@@ -3074,6 +3529,9 @@ llvm::BasicBlock* JITCompiler::genLoopHeaderCopy(
 * Initial : Maxime Chevalier-Boisvert on March 10, 2009
 ****************************************************************
 Revisions and bug fixes:
+
+agent on October 18, 2026
+The interpreter fallback executions are counted.
 */
 llvm::BasicBlock* JITCompiler::compStatement(
     Statement* pStatement,
@@ -3231,7 +3689,10 @@ llvm::BasicBlock* JITCompiler::compStatement(
             llvm::IRBuilder<> builder(pStmtBlock);
 
             // Write the symbols used by the statement to the environment
-            writeVariables(builder,	function, version, varMap, pStatement->getSymbolUses());
+            size_t numWritten = writeVariables(builder,	function, version, varMap, pStatement->getSymbolUses());
+
+            // Count the executions of this fallback
+            genFallbackCount(builder, function, version, pStatement, Profiler::FALLBACK_UNSUPPORTED_STMT, numWritten);
 
             hotspot::Profiler::get()->cInstrumentInterpreter(pStmtBlock);
             const NativeFunc& execStmtFunc = s_nativeMap[(void*)Interpreter::execStatement];
@@ -3256,6 +3717,9 @@ llvm::BasicBlock* JITCompiler::compStatement(
 * Initial : Maxime Chevalier-Boisvert on March 22, 2009
 ****************************************************************
 Revisions and bug fixes:
+
+agent on October 18, 2026
+The interpreter fallback executions are counted.
 */
 llvm::BasicBlock* JITCompiler::compExprStmt(
     ExprStmt* pExprStmt,
@@ -3340,6 +3804,10 @@ llvm::BasicBlock* JITCompiler::compExprStmt(
             );
         }
 
+        // Free the temporaries that die at this statement
+        llvm::IRBuilder<> exitBuilder(pExitBlock);
+        genTempFrees(exitBuilder, version, varMap, pExprStmt);
+
         // Set-up the exit point parameters
         exitPoint.first = pExitBlock;
         exitPoint.second = varMap;
@@ -3359,7 +3827,10 @@ llvm::BasicBlock* JITCompiler::compExprStmt(
     llvm::IRBuilder<> builder(pStmtBlock);
 
     // Write the symbols used by the statement to the environment
-    writeVariables(builder,	function, version, varMap, pExprStmt->getSymbolUses());
+    size_t numWritten = writeVariables(builder,	function, version, varMap, pExprStmt->getSymbolUses());
+
+    // Count the executions of this fallback
+    genFallbackCount(builder, function, version, pExprStmt, Profiler::FALLBACK_OUTPUT_DISPLAY, numWritten);
 
     // Get the function object for the "evalAssignStmt" function
     hotspot::Profiler::get()->cInstrumentInterpreter(pStmtBlock);
@@ -3380,6 +3851,11 @@ llvm::BasicBlock* JITCompiler::compExprStmt(
 * Initial : Maxime Chevalier-Boisvert on March 22, 2009
 ****************************************************************
 Revisions and bug fixes:
+
+agent on October 18, 2026
+Added type feedback recording and speculated type guards.
+The interpreter fallback executions are counted.
+Small matrices are assigned and written to in registers.
 */
 llvm::BasicBlock* JITCompiler::compAssignStmt(
     AssignStmt* pAssignStmt,
@@ -3398,13 +3874,16 @@ llvm::BasicBlock* JITCompiler::compAssignStmt(
         llvm::IRBuilder<> builder(pStmtBlock);
 
         // Write the symbols used by the statement to the environment
-        writeVariables(
+        size_t numWritten = writeVariables(
                 builder, 
                 function, 
                 version, 
                 varMap, 
                 pAssignStmt->getSymbolUses());
 
+        // Count the executions of this fallback
+        genFallbackCount(builder, function, version, pAssignStmt, Profiler::FALLBACK_OUTPUT_DISPLAY, numWritten);
+
         // Create a call to execute this statement
         hotspot::Profiler::get()->cInstrumentInterpreter(pStmtBlock);
 
@@ -3503,7 +3982,7 @@ llvm::BasicBlock* JITCompiler::compAssignStmt(
                  pAssignStmt);
         }
 
-        // Evaluate the expression
+        // Evaluate the expression, keeping small matrices in registers
         Value value = compExpression(
             pRightExpr,
             function,
@@ -3513,7 +3992,8 @@ llvm::BasicBlock* JITCompiler::compAssignStmt(
             typeItr->second,
             varMap,
             pEntryBlock,
-            pAfterBlock
+            pAfterBlock,
+            true
         );
 
         // Add the single value to the vector
@@ -3523,6 +4003,45 @@ llvm::BasicBlock* JITCompiler::compAssignStmt(
     // Setup an IR builder for the current basic block
     llvm::IRBuilder<> currentBuilder(pAfterBlock);
 
+    // If the right expression produces a single value
+    if (rightValues.size() == 1)
+    {
+        // Look for a type speculated for this value
+        SpecTypeMap::const_iterator specItr = version.pTypeInferInfo->specTypes.find(pRightExpr);
+
+        // If a type is speculated, guard the value against it
+        if (specItr != version.pTypeInferInfo->specTypes.end())
+        {
+            rightValues[0] = compTypeGuard(
+                pAssignStmt,
+                specItr->second,
+                rightValues[0],
+                function,
+                version,
+                liveItr->second,
+                varMap,
+                currentBuilder
+            );
+        }
+
+        // Otherwise, if the value type is unknown and still being recorded
+        else if (version.pTypeInferInfo->feedbackSites.find(pRightExpr) != version.pTypeInferInfo->feedbackSites.end() &&
+            TypeFeedback::isRecording(pRightExpr) && rightValues[0].pValue != NULL &&
+            rightValues[0].pValue->getType() == VOID_PTR_TYPE)
+        {
+            // Create a call to record the type of the value
+            LLVMValueVector recordArgs;
+            recordArgs.push_back(createPtrConst(&version));
+            recordArgs.push_back(createPtrConst(pRightExpr));
+            recordArgs.push_back(rightValues[0].pValue);
+            createNativeCall(
+                currentBuilder,
+                (void*)JITCompiler::recordTypeFeedback,
+                recordArgs
+            );
+        }
+    }
+
     StmtCopyVec copies;
     if (s_jitCopyEnableVar)
     {
@@ -3558,6 +4077,13 @@ llvm::BasicBlock* JITCompiler::compAssignStmt(
             {
                 genCopyCode(currentBuilder, function, version,  typeItr->second, varMap, copies[i]);
             }
+
+            // If this defines a temporary that never escapes, remember
+            // the object it holds so that it can be freed once dead
+            EscapeInfo::TempDefMap::const_iterator tempItr = version.pEscapeInfo->tempDefMap.find(pSymbol);
+            if (tempItr != version.pEscapeInfo->tempDefMap.end() && tempItr->second == pAssignStmt &&
+                varMap[pSymbol].pValue != NULL && varMap[pSymbol].pValue->getType() == VOID_PTR_TYPE)
+                version.tempValueMap[pSymbol] = varMap[pSymbol].pValue;
         }
 
         // If the left-expression is a parameterized expression
@@ -3644,8 +4170,8 @@ llvm::BasicBlock* JITCompiler::compAssignStmt(
             // and array access optimizations are enabled
             if (symObjType >= DataObject::Type::MATRIX_I32 && symObjType <= DataObject::Type::CHARARRAY &&
                 symObjType != DataObject::Type::MATRIX_C128 && argsScalar &&
-                rightVal.pValue->getType() != VOID_PTR_TYPE && rightVal.objType != DataObject::Type::MATRIX_C128 &&
-                s_jitUseArrayOpts.getBoolValue() == true)
+                rightVal.pValue->getType() != VOID_PTR_TYPE && !isSmallMatMode(rightVal.pValue->getType()) &&
+                rightVal.objType != DataObject::Type::MATRIX_C128 && s_jitUseArrayOpts.getBoolValue() == true)
             {
                 // Create a basic block for the symbol evaluation exit
                 llvm::BasicBlock* pSymExitBlock = llvm::BasicBlock::Create(*s_Context, "", version.pLLVMFunc);
@@ -3666,14 +4192,6 @@ llvm::BasicBlock* JITCompiler::compAssignStmt(
                 // Make the symbol eval exit block the current basic block
                 currentBuilder.SetInsertPoint(pSymExitBlock);
 
-                // Set the storage mode of the variable to the object pointer type
-                llvm::Value* pSymObject = changeStorageMode(
-                    currentBuilder,
-                    symValue.pValue,
-                    symValue.objType,
-                    VOID_PTR_TYPE
-                );
-
                 // Create a vector to store the argument values
                 std::vector<llvm::Value*> argValues;
 
@@ -3714,6 +4232,39 @@ llvm::BasicBlock* JITCompiler::compAssignStmt(
                     argValues.push_back(pIntArgVal);
                 }
 
+                // If the matrix is held in registers and the write can stay there
+                if (isSmallMatMode(symValue.pValue->getType()) &&
+                    isSmallMatWritable(symValue.pValue, argValues, pParamExpr, version))
+                {
+                    // Convert the right value to a float64
+                    llvm::Value* pElemVal = changeStorageMode(
+                        currentBuilder,
+                        rightVal.pValue,
+                        rightVal.objType,
+                        llvm::Type::getDoubleTy(*s_Context)
+                    );
+
+                    // Update the matrix value in registers
+                    varMap[pSymbol] = Value(
+                        compSmallMatWrite(currentBuilder, symValue.pValue, pElemVal, argValues, pParamExpr, version),
+                        DataObject::Type::MATRIX_F64
+                    );
+
+                    continue;
+                }
+
+                // Set the storage mode of the variable to the object pointer type
+                llvm::Value* pSymObject = changeStorageMode(
+                    currentBuilder,
+                    symValue.pValue,
+                    symValue.objType,
+                    VOID_PTR_TYPE
+                );
+
+                // If the matrix was boxed, the variable now refers to the boxed object
+                if (isSmallMatMode(symValue.pValue->getType()))
+                    varMap[pSymbol] = Value(pSymObject, symValue.objType);
+
                 // Create a basic block for the array write exit
                 llvm::BasicBlock* pWriteExitBlock = llvm::BasicBlock::Create(*s_Context, "", version.pLLVMFunc);
 
@@ -3806,6 +4357,9 @@ llvm::BasicBlock* JITCompiler::compAssignStmt(
         }
     }
 
+    // Free the temporaries that die at this statement
+    genTempFrees(currentBuilder, version, varMap, pAssignStmt);
+
     // Set-up the exit point parameters
     exitPoint.first = currentBuilder.GetInsertBlock();
     exitPoint.second = varMap;
@@ -3838,7 +4392,18 @@ void JITCompiler::compAssignStmtFallback(
             );
 
             // Write the symbols used by the left expression to the environment
-            writeVariables(builder, function, version, varMap, pExpr->getSymbolUses());
+            size_t numWritten = writeVariables(builder, function, version, varMap, pExpr->getSymbolUses());
+
+            // Count the executions of this fallback
+            genFallbackCount(
+                builder,
+                function,
+                version,
+                pExpr,
+                (pExpr->getExprType() == Expression::ExprType::CELL_INDEX)?
+                    Profiler::FALLBACK_CELL_INDEX:Profiler::FALLBACK_UNSUPPORTED_EXPR,
+                numWritten
+            );
 
             // Create a call to perform the object assignment
             LLVMValueVector assignArgs;
@@ -3855,6 +4420,160 @@ void JITCompiler::compAssignStmtFallback(
       pRightObject->dump() ;
 }
 
+/***************************************************************
+* Function: JITCompiler::compTypeGuard()
+* Purpose : Compile a guard on a speculated type
+* Initial : agent on October 18, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+JITCompiler::Value JITCompiler::compTypeGuard(
+    AssignStmt* pAssignStmt,
+    const TypeInfo& specType,
+    const Value& value,
+    CompFunction& function,
+    CompVersion& version,
+    const Expression::SymbolSet& liveVars,
+    VariableMap& varMap,
+    llvm::IRBuilder<>& builder
+)
+{
+    // Get the value as an object pointer
+    llvm::Value* pObject = changeStorageMode(
+        builder,
+        value.pValue,
+        value.objType,
+        VOID_PTR_TYPE
+    );
+
+    // Create blocks for the guard failure and success
+    llvm::BasicBlock* pFailBlock = llvm::BasicBlock::Create(*s_Context, "", version.pLLVMFunc);
+    llvm::BasicBlock* pPassBlock = llvm::BasicBlock::Create(*s_Context, "", version.pLLVMFunc);
+
+    // Test that the object has the speculated type
+    llvm::Value* pObjType = loadObjectType(builder, pObject);
+    llvm::Value* pTypeTest = builder.CreateICmpEQ(pObjType, getObjType(specType.getObjType()));
+
+    // If a scalar is speculated
+    if (specType.isScalar())
+    {
+        // Test the number of elements only once the type is known
+        llvm::BasicBlock* pSizeBlock = llvm::BasicBlock::Create(*s_Context, "", version.pLLVMFunc);
+        builder.CreateCondBr(pTypeTest, pSizeBlock, pFailBlock);
+        builder.SetInsertPoint(pSizeBlock);
+
+        llvm::Value* pNumElems = loadMemberValue(
+            builder,
+            pObject,
+            MEMBER_OFFSET(BaseMatrixObj, m_numElements),
+            getIntType(sizeof(size_t))
+        );
+        llvm::Value* pSizeTest = builder.CreateICmpEQ(
+            pNumElems,
+            llvm::ConstantInt::get(getIntType(sizeof(size_t)), 1)
+        );
+        builder.CreateCondBr(pSizeTest, pPassBlock, pFailBlock);
+    }
+    else
+    {
+        builder.CreateCondBr(pTypeTest, pPassBlock, pFailBlock);
+    }
+
+    // If the guard fails, write the live variables to the environment
+    llvm::IRBuilder<> failBuilder(pFailBlock);
+    VariableMap failVarMap = varMap;
+    writeVariables(failBuilder, function, version, failVarMap, liveVars);
+
+    // Resume the execution of the function in the interpreter
+    LLVMValueVector deoptArgs;
+    deoptArgs.push_back(createPtrConst(&version));
+    deoptArgs.push_back(createPtrConst(function.pFuncBody));
+    deoptArgs.push_back(createPtrConst(pAssignStmt));
+    deoptArgs.push_back(pObject);
+    deoptArgs.push_back(getCallEnv(function, version));
+    createNativeCall(
+        failBuilder,
+        (void*)JITCompiler::deoptimize,
+        deoptArgs
+    );
+
+    // The function then returns with all its outputs in the environment
+    version.deoptPoints.push_back(BranchPoint(pFailBlock, VariableMap()));
+
+    // Continue compilation in the success block
+    builder.SetInsertPoint(pPassBlock);
+
+    // Convert the value to the storage mode of the speculated type
+    DataObject::Type objType;
+    llvm::Type* storageMode = getStorageMode(typeSetMake(specType), objType);
+    llvm::Value* pSpecValue = changeStorageMode(builder, pObject, objType, storageMode);
+
+    // Return the guarded value
+    return Value(pSpecValue, objType);
+}
+
+/***************************************************************
+* Function: JITCompiler::recordTypeFeedback()
+* Purpose : Record the type of a value for type feedback
+* Initial : agent on October 18, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+void JITCompiler::recordTypeFeedback(
+    CompVersion* pVersion,
+    const Expression* pExpr,
+    const DataObject* pObject
+)
+{
+    // Lock the compiler state
+    JITLock lock;
+
+    // If enough observations were made, recompile on the next call
+    if (TypeFeedback::recordType(pExpr, pObject))
+        pVersion->needsRecompile = true;
+}
+
+/***************************************************************
+* Function: JITCompiler::deoptimize()
+* Purpose : Resume execution in the interpreter after a failed guard
+* Initial : agent on October 18, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+void JITCompiler::deoptimize(
+    CompVersion* pVersion,
+    const StmtSequence* pFuncBody,
+    const AssignStmt* pAssignStmt,
+    DataObject* pValue,
+    Environment* pEnv
+)
+{
+    // If we are in verbose mode, log the failed guard
+    if (ConfigManager::s_verboseVar)
+        std::cout << "Type guard failed at: \"" << pAssignStmt->toString() << "\"" << std::endl;
+
+    // Stop speculating on this value and recompile on the next call
+    {
+        JITLock lock;
+        TypeFeedback::markFailed(pAssignStmt->getRightExpr());
+        pVersion->needsRecompile = true;
+    }
+
+    // Perform the assignment guarded against
+    Interpreter::assignObject(pAssignStmt->getLeftExprs()[0], pValue, pEnv, false);
+
+    // Execute the rest of the function body in the interpreter
+    try
+    {
+        Interpreter::resumeSeqStmt(pFuncBody, pAssignStmt, pEnv);
+    }
+
+    // The return statement only ends the function
+    catch (ReturnExcept e)
+    {
+    }
+}
+
 /***************************************************************
 * Function: JITCompiler::compIfElseStmt()
 * Purpose : Compile an if-else statement
@@ -4018,6 +4737,10 @@ llvm::BasicBlock* JITCompiler::compIfElseStmt(
 * Initial : Maxime Chevalier-Boisvert on March 10, 2009
 ****************************************************************
 Revisions and bug fixes:
+
+agent on October 18, 2026
+Versions loops whose array bounds checks can be hoisted into a
+single guard evaluated before the loop.
 */
 llvm::BasicBlock* JITCompiler::compLoopStmt(
     LoopStmt* pLoopStmt,
@@ -4043,27 +4766,15 @@ llvm::BasicBlock* JITCompiler::compLoopStmt(
         genCopyCode(copyBuilder, function, version, preLoopTypeItr->second, varMap, pLoopStmt);
     }
 
-    // Get the statement sequences associated with the loop
+    // Get the initialization sequence of the loop
     StmtSequence* pInitSeq = pLoopStmt->getInitSeq();
-    StmtSequence* pTestSeq = pLoopStmt->getTestSeq();
-    StmtSequence* pBodySeq = pLoopStmt->getBodySeq();
-    StmtSequence* pIncrSeq = pLoopStmt->getIncrSeq();
-
-    // Get the test variable of the loop
-    SymbolExpr* pTestVar = pLoopStmt->getTestVar();
-
-    /***********************************/
-    /***********************************/
 
     // Declare branch point lists for the continue and break points
     BranchList contPoints;
     BranchList breakPoints;
 
-    // Declare branch points for the statement sequence exits
+    // Declare a branch point for the initialization sequence exit
     BranchPoint initExit;
-    BranchPoint testExit;
-    BranchPoint bodyExit;
-    BranchPoint incrExit;
 
     /************************************
     * Initialization sequence compilation
@@ -4085,12 +4796,130 @@ llvm::BasicBlock* JITCompiler::compLoopStmt(
     assert (initExit.first != NULL && contPoints.empty() && breakPoints.empty());
     copyBuilder.CreateBr(pInitBlock);
 
+    /*****************
+    * Loop versioning
+    *****************/
+
+    // Get the type information before the test sequence
+    TypeInfoMap::const_iterator preTestTypeItr = version.pTypeInferInfo->preTypeMap.find(pLoopStmt->getTestSeq());
+    assert (preTestTypeItr != version.pTypeInferInfo->preTypeMap.end());
+
+    // Declare a loop guard for the bounds checks that can be hoisted
+    LoopGuard loopGuard;
+
+    // If loop versioning is enabled and some bounds checks can be hoisted out of the loop
+    if (s_jitLoopVersioning.getBoolValue() == true &&
+        findLoopGuard(pLoopStmt, version.pTypeInferInfo, preTestTypeItr->second, initExit.second, loopGuard) == true)
+    {
+        // Create an IR builder for the loop init exit point
+        llvm::IRBuilder<> initExitBuilder(initExit.first);
+
+        // Compile the guard, loading the hoisted values before the loop
+        HoistedLoadMap hoistedLoads;
+        llvm::Value* pGuardVal = compLoopGuard(
+            initExitBuilder,
+            loopGuard,
+            initExit.second,
+            hoistedLoads
+        );
+
+        // Create entry points for the unchecked and checked versions of the loop
+        BranchPoint fastEntry(llvm::BasicBlock::Create(*s_Context, "", version.pLLVMFunc), initExit.second);
+        BranchPoint slowEntry(llvm::BasicBlock::Create(*s_Context, "", version.pLLVMFunc), initExit.second);
+
+        // Select the loop version based on the guard value
+        initExitBuilder.CreateCondBr(pGuardVal, fastEntry.first, slowEntry.first);
+
+        // Compile the unchecked version, skipping the checks covered by the guard
+        for (size_t i = 0; i < loopGuard.accesses.size(); ++i)
+            version.hoistedChecks.insert(loopGuard.accesses[i].pExpr);
+        version.hoistedLoads = hoistedLoads;
+        compLoopIterations(pLoopStmt, function, version, fastEntry, breakPoints, returnPoints);
+        version.hoistedChecks.clear();
+        version.hoistedLoads.clear();
+
+        // Compile the checked version
+        compLoopIterations(pLoopStmt, function, version, slowEntry, breakPoints, returnPoints);
+    }
+    else
+    {
+        // Compile a single version of the loop
+        compLoopIterations(pLoopStmt, function, version, initExit, breakPoints, returnPoints);
+    }
+
+    /*************************
+    * Final loop break linkage
+    *************************/
+
+    // Create a basic block for the loop break point
+    llvm::BasicBlock* pBreakBlock = llvm::BasicBlock::Create(*s_Context, "", version.pLLVMFunc);
+
+    // Find the live variable set after the loop statement
+    LiveVarMap::const_iterator afterLoopLiveSet = version.pLiveVarInfo->liveVarMap.find(pLoopStmt);
+    assert (afterLoopLiveSet != version.pLiveVarInfo->liveVarMap.end());
+
+    // Find the variable type map after the loop statement
+    TypeInfoMap::const_iterator afterLoopTypeMap = version.pTypeInferInfo->postTypeMap.find(pLoopStmt);
+    assert (afterLoopTypeMap != version.pTypeInferInfo->postTypeMap.end());
+
+    // Match the variable mappings at the break point
+    VariableMap breakVarMap = matchBranchPoints(
+        function,
+        version,
+        afterLoopLiveSet->second,
+        afterLoopTypeMap->second,
+        breakPoints,
+        pBreakBlock
+    );
+
+    // Set the exit point parameters
+    exitPoint.first = pBreakBlock;
+    exitPoint.second = breakVarMap;
+
+    // Return a pointer to the loop initialization block
+    // return pInitBlock;
+    return pCopyBlock;
+}
+
+/***************************************************************
+* Function: JITCompiler::compLoopIterations()
+* Purpose : Compile the test, body and incrementation of a loop
+* Initial : agent on October 18, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+void JITCompiler::compLoopIterations(
+    LoopStmt* pLoopStmt,
+    CompFunction& function,
+    CompVersion& version,
+    BranchPoint& entryPoint,
+    BranchList& breakPoints,
+    BranchList& returnPoints
+)
+{
+    // Get the statement sequences associated with the loop
+    StmtSequence* pInitSeq = pLoopStmt->getInitSeq();
+    StmtSequence* pTestSeq = pLoopStmt->getTestSeq();
+    StmtSequence* pBodySeq = pLoopStmt->getBodySeq();
+    StmtSequence* pIncrSeq = pLoopStmt->getIncrSeq();
+
+    // Get the test variable of the loop
+    SymbolExpr* pTestVar = pLoopStmt->getTestVar();
+
+    // Declare a branch point list for the continue points
+    BranchList contPoints;
+
+    // Declare branch points for the statement sequence exits
+    BranchPoint testExit;
+    BranchPoint bodyExit;
+    BranchPoint incrExit;
+
     /***********************
     * Loop entry point setup
     ***********************/
 
-    // Create an IR builder for the loop init exit point
-    llvm::IRBuilder<> initExitBuilder(initExit.first);
+    // Create an IR builder for the loop entry point
+    llvm::IRBuilder<> entryBuilder(entryPoint.first);
 
     // Create a basic block for the loop entry point
     llvm::BasicBlock* pLoopEntryBlock =
@@ -4111,7 +4940,7 @@ llvm::BasicBlock* JITCompiler::compLoopStmt(
     const VarTypeMap& preTestVarTypes = preTestTypeItr->second;
 
     // For each variable in the post-initialization variable map
-    for (VariableMap::iterator mapItr = initExit.second.begin(); mapItr != initExit.second.end(); ++mapItr)
+    for (VariableMap::iterator mapItr = entryPoint.second.begin(); mapItr != entryPoint.second.end(); ++mapItr)
     {
         // Get a pointer to the symbol
         SymbolExpr* pSymbol = mapItr->first;
@@ -4149,7 +4978,7 @@ llvm::BasicBlock* JITCompiler::compLoopStmt(
 
                 // Change the storage mode of the variable
                 pValue = changeStorageMode(
-                    initExitBuilder,
+                    entryBuilder,
                     pValue,
                     mapItr->second.objType,
                     storageMode
@@ -4160,7 +4989,7 @@ llvm::BasicBlock* JITCompiler::compLoopStmt(
             llvm::PHINode* pPhiNode = loopEntryBuilder.CreatePHI(storageMode, 2);
 
             // Add an entry point for the loop initialization block
-            pPhiNode->addIncoming(pValue, initExit.first);
+            pPhiNode->addIncoming(pValue, entryPoint.first);
 
             // Add the phi node to the loop entry variable map
             loopEntryVarMap[pSymbol] = Value(pPhiNode, objectType);
@@ -4170,7 +4999,7 @@ llvm::BasicBlock* JITCompiler::compLoopStmt(
     }
 
     // Link the init exit block to the loop entry block
-    initExitBuilder.CreateBr(pLoopEntryBlock);
+    entryBuilder.CreateBr(pLoopEntryBlock);
 
     /**************************
     * Test sequence compilation
@@ -4229,8 +5058,11 @@ llvm::BasicBlock* JITCompiler::compLoopStmt(
         llvm::Type::getInt1Ty(*s_Context)
     );
 
-    // Add the decision point block to the break points
-    breakPoints.push_back(BranchPoint(pDecBlock, decVarMap));
+    // Create a basic block for the loop exit at the decision point
+    llvm::BasicBlock* pDecExitBlock = llvm::BasicBlock::Create(*s_Context, "", version.pLLVMFunc);
+
+    // Add the decision point exit block to the break points
+    breakPoints.push_back(BranchPoint(pDecExitBlock, decVarMap));
 
 
     /*******************************
@@ -4323,10 +5155,10 @@ llvm::BasicBlock* JITCompiler::compLoopStmt(
         SymbolExpr* pSymbol = mapItr->first;
 
         // Lookup the variable in the post-init variable map
-        VariableMap::iterator postInitItr = initExit.second.find(pSymbol);
+        VariableMap::iterator postInitItr = entryPoint.second.find(pSymbol);
 
         // Determine if the variable is local in the post-init variable map
-        bool postInitLocal = postInitItr != initExit.second.end() && postInitItr->second.pValue != NULL;
+        bool postInitLocal = postInitItr != entryPoint.second.end() && postInitItr->second.pValue != NULL;
 
         // Determine if the variable is local in the post-incr variable map
         bool postIncrLocal = mapItr->second.pValue != NULL;
@@ -4385,46 +5217,569 @@ llvm::BasicBlock* JITCompiler::compLoopStmt(
     // Link the loop entry block to the loop test block
     loopEntryBuilder.CreateBr(pTestBlock);
 
+    // Create a conditional branch to select which block to execute based on the loop test value
+    decBuilder.CreateCondBr(pBoolVal, pBodyBlock, pDecExitBlock);
+}
 
-    /*************************
-    * Final loop break linkage
-    *************************/
+/***************************************************************
+* Function: JITCompiler::findLoopGuard()
+* Purpose : Find the array accesses of a loop whose bounds
+*           checks can be hoisted into a single guard
+* Initial : agent on October 18, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+bool JITCompiler::findLoopGuard(
+    LoopStmt* pLoopStmt,
+    const TypeInferInfo* pTypeInferInfo,
+    const VarTypeMap& loopVarTypes,
+    const VariableMap& entryVarMap,
+    LoopGuard& guard
+)
+{
+    // Only version innermost loops, to bound the code growth
+    if (pLoopStmt->isInnermost() == false || pLoopStmt->getIndexVar() == NULL)
+        return false;
+
+    // Get the test and incrementation statements
+    const StmtSequence::StmtVector& testStmts = pLoopStmt->getTestSeq()->getStatements();
+    const StmtSequence::StmtVector& incrStmts = pLoopStmt->getIncrSeq()->getStatements();
+
+    // The test and incrementation must each be a single assignment
+    if (testStmts.size() != 1 || testStmts[0]->getStmtType() != Statement::ASSIGN ||
+        incrStmts.size() != 1 || incrStmts[0]->getStmtType() != Statement::ASSIGN)
+        return false;
+
+    // Get the right expressions of the test and incrementation statements
+    Expression* pTestExpr = ((AssignStmt*)testStmts[0])->getRightExpr();
+    Expression* pIncrExpr = ((AssignStmt*)incrStmts[0])->getRightExpr();
+
+    // The test must be of the form i <= end and the incrementation of the form i + step
+    if (pTestExpr->getExprType() != Expression::ExprType::BINARY_OP ||
+        pIncrExpr->getExprType() != Expression::ExprType::BINARY_OP)
+        return false;
+    BinaryOpExpr* pTestOp = (BinaryOpExpr*)pTestExpr;
+    BinaryOpExpr* pIncrOp = (BinaryOpExpr*)pIncrExpr;
+    if (pTestOp->getOperator() != BinaryOpExpr::LESS_THAN_EQ ||
+        pTestOp->getLeftExpr() != pLoopStmt->getIndexVar() ||
+        pTestOp->getRightExpr()->getExprType() != Expression::ExprType::SYMBOL ||
+        pIncrOp->getOperator() != BinaryOpExpr::PLUS ||
+        pIncrOp->getLeftExpr() != pLoopStmt->getIndexVar())
+        return false;
+
+    // Store the index and end value variables
+    guard.pIndexVar = pLoopStmt->getIndexVar();
+    guard.pEndVar = (SymbolExpr*)pTestOp->getRightExpr();
+    guard.pStepVar = NULL;
+    guard.pLoopVar = NULL;
+
+    // Get the stepping expression
+    Expression* pStepExpr = pIncrOp->getRightExpr();
+
+    // If the step is a variable, its sign will be tested by the guard
+    if (pStepExpr->getExprType() == Expression::ExprType::SYMBOL)
+        guard.pStepVar = (SymbolExpr*)pStepExpr;
+
+    // Otherwise, the step must be a positive constant
+    else if (!(pStepExpr->getExprType() == Expression::ExprType::INT_CONST && ((IntConstExpr*)pStepExpr)->getValue() > 0) &&
+             !(pStepExpr->getExprType() == Expression::ExprType::FP_CONST && ((FPConstExpr*)pStepExpr)->getValue() > 0))
+        return false;
+
+    // The index, end and step values must be locally stored scalars at the loop entry
+    SymbolExpr* rangeVars[3] = { guard.pIndexVar, guard.pEndVar, guard.pStepVar };
+    for (size_t i = 0; i < 3; ++i)
+    {
+        // If there is no step variable, skip it
+        if (rangeVars[i] == NULL)
+            continue;
 
-    // Create a basic block for the loop break point
-    llvm::BasicBlock* pBreakBlock = llvm::BasicBlock::Create(*s_Context, "", version.pLLVMFunc);
-    llvm::IRBuilder<> breakBuilder(pBreakBlock);
+        // Ensure the variable is stored as a scalar
+        VariableMap::const_iterator varItr = entryVarMap.find(rangeVars[i]);
+        if (varItr == entryVarMap.end() || varItr->second.pValue == NULL || varItr->second.pValue->getType() == VOID_PTR_TYPE ||
+            isSmallMatMode(varItr->second.pValue->getType()))
+            return false;
+    }
 
-    // Find the live variable set after the loop statement
-    LiveVarMap::const_iterator afterLoopLiveSet = version.pLiveVarInfo->liveVarMap.find(pLoopStmt);
-    assert (afterLoopLiveSet != version.pLiveVarInfo->liveVarMap.end());
+    // Declare a vector for the body statements, including those of nested if-else statements
+    StmtSequence::StmtVector bodyStmts;
 
-    // Find the variable type map after the loop statement
-    TypeInfoMap::const_iterator afterLoopTypeMap = version.pTypeInferInfo->postTypeMap.find(pLoopStmt);
-    assert (afterLoopTypeMap != version.pTypeInferInfo->postTypeMap.end());
+    // Declare a stack of statement sequences to flatten
+    std::vector<StmtSequence*> seqStack(1, pLoopStmt->getBodySeq());
 
-    // Match the variable mappings at the break point
-    VariableMap breakVarMap = matchBranchPoints(
-        function,
-        version,
-        afterLoopLiveSet->second,
-        afterLoopTypeMap->second,
-        breakPoints,
-        pBreakBlock
+    // Until all nested sequences have been flattened
+    while (seqStack.empty() == false)
+    {
+        // Pop a sequence from the stack
+        StmtSequence* pSeq = seqStack.back();
+        seqStack.pop_back();
+
+        // For each statement in the sequence
+        for (StmtSequence::StmtVector::const_iterator stmtItr = pSeq->getStatements().begin(); stmtItr != pSeq->getStatements().end(); ++stmtItr)
+        {
+            // Get a pointer to the statement
+            Statement* pStmt = *stmtItr;
+
+            // Switch on the statement type
+            switch (pStmt->getStmtType())
+            {
+                // Nested if-else statements are flattened
+                case Statement::IF_ELSE:
+                seqStack.push_back(((IfElseStmt*)pStmt)->getIfBlock());
+                seqStack.push_back(((IfElseStmt*)pStmt)->getElseBlock());
+                break;
+
+                // Simple statements are kept as-is
+                case Statement::ASSIGN:
+                case Statement::EXPR:
+                case Statement::BREAK:
+                case Statement::CONTINUE:
+                case Statement::RETURN:
+                break;
+
+                // Nested loops are not supported
+                default:
+                return false;
+            }
+
+            // Add the statement to the flattened body
+            bodyStmts.push_back(pStmt);
+        }
+    }
+
+    // Get the first statement of the body
+    const StmtSequence::StmtVector& firstStmts = pLoopStmt->getBodySeq()->getStatements();
+    Statement* pFirstStmt = firstStmts.empty()? NULL:firstStmts[0];
+
+    // If the body starts by copying the index to the loop variable
+    if (pFirstStmt != NULL && pFirstStmt->getStmtType() == Statement::ASSIGN &&
+        ((AssignStmt*)pFirstStmt)->getLeftExprs().size() == 1 &&
+        ((AssignStmt*)pFirstStmt)->getLeftExprs()[0]->getExprType() == Expression::ExprType::SYMBOL &&
+        ((AssignStmt*)pFirstStmt)->getRightExpr() == guard.pIndexVar)
+    {
+        // The loop variable takes the same values as the index
+        guard.pLoopVar = (SymbolExpr*)((AssignStmt*)pFirstStmt)->getLeftExprs()[0];
+    }
+
+    // Declare sets for all symbols defined in the body and for those
+    // defined other than by a single indexed assignment
+    Expression::SymbolSet bodyDefs;
+    Expression::SymbolSet plainDefs;
+
+    // Declare vectors for the array accesses and the expressions to scan for them
+    std::vector<ParamExpr*> accessExprs;
+    std::set<ParamExpr*> writeExprs;
+    Expression::ExprVector scanExprs;
+
+    // For each statement in the flattened body
+    for (StmtSequence::StmtVector::iterator stmtItr = bodyStmts.begin(); stmtItr != bodyStmts.end(); ++stmtItr)
+    {
+        // Get a pointer to the statement
+        Statement* pStmt = *stmtItr;
+
+        // The loop variable copy is not a definition of interest
+        if (pStmt == pFirstStmt && guard.pLoopVar != NULL)
+            continue;
+
+        // Add the symbols defined by this statement to the body definitions
+        Expression::SymbolSet stmtDefs = pStmt->getSymbolDefs();
+        bodyDefs.insert(stmtDefs.begin(), stmtDefs.end());
+
+        // If this is an if-else statement, scan its condition
+        if (pStmt->getStmtType() == Statement::IF_ELSE)
+            scanExprs.push_back(((IfElseStmt*)pStmt)->getCondition());
+
+        // If this is an expression statement, scan its expression
+        else if (pStmt->getStmtType() == Statement::EXPR)
+            scanExprs.push_back(((ExprStmt*)pStmt)->getExpression());
+
+        // If this is an assignment statement
+        else if (pStmt->getStmtType() == Statement::ASSIGN)
+        {
+            // Get a typed pointer to the statement
+            AssignStmt* pAssignStmt = (AssignStmt*)pStmt;
+            Expression::ExprVector leftExprs = pAssignStmt->getLeftExprs();
+
+            // Get the type of the assigned value
+            Expression* pRightExpr = pAssignStmt->getRightExpr();
+            TypeSet rightTypes;
+            if (pRightExpr->getExprType() == Expression::ExprType::SYMBOL)
+            {
+                TypeInfoMap::const_iterator stmtTypeItr = pTypeInferInfo->preTypeMap.find(pStmt);
+                assert (stmtTypeItr != pTypeInferInfo->preTypeMap.end());
+                VarTypeMap::const_iterator typeItr = stmtTypeItr->second.find((SymbolExpr*)pRightExpr);
+                if (typeItr != stmtTypeItr->second.end())
+                    rightTypes = typeItr->second;
+            }
+            else
+            {
+                ExprTypeMap::const_iterator typeItr = pTypeInferInfo->exprTypeMap.find(pRightExpr);
+                if (typeItr != pTypeInferInfo->exprTypeMap.end() && typeItr->second.size() == 1)
+                    rightTypes = typeItr->second[0];
+            }
+
+            // Only scalar values are written in place, others may resize the array (e.g.: a(i) = [])
+            bool scalarWrite = rightTypes.size() == 1 && rightTypes.begin()->isScalar();
+
+            // If this is a single scalar indexed assignment to an array variable
+            if (scalarWrite && leftExprs.size() == 1 && leftExprs[0]->getExprType() == Expression::ExprType::PARAM &&
+                ((ParamExpr*)leftExprs[0])->getExpr()->getExprType() == Expression::ExprType::SYMBOL)
+            {
+                // Add the write to the array accesses
+                ParamExpr* pParamExpr = (ParamExpr*)leftExprs[0];
+                accessExprs.push_back(pParamExpr);
+                writeExprs.insert(pParamExpr);
+
+                // Scan the indices of the write
+                scanExprs.insert(scanExprs.end(), pParamExpr->getArguments().begin(), pParamExpr->getArguments().end());
+            }
+            else
+            {
+                // The definitions of this statement may resize arrays
+                plainDefs.insert(stmtDefs.begin(), stmtDefs.end());
+
+                // Scan the left expressions
+                scanExprs.insert(scanExprs.end(), leftExprs.begin(), leftExprs.end());
+            }
+
+            // Scan the right expression
+            scanExprs.push_back(pAssignStmt->getRightExpr());
+        }
+    }
+
+    // The loop variable must not be redefined in the body
+    if (guard.pLoopVar != NULL && bodyDefs.find(guard.pLoopVar) != bodyDefs.end())
+        guard.pLoopVar = NULL;
+
+    // The index, end and step values must not be redefined in the body
+    if (bodyDefs.find(guard.pIndexVar) != bodyDefs.end() || bodyDefs.find(guard.pEndVar) != bodyDefs.end() ||
+        (guard.pStepVar != NULL && bodyDefs.find(guard.pStepVar) != bodyDefs.end()))
+        return false;
+
+    // Until all expressions have been scanned
+    while (scanExprs.empty() == false)
+    {
+        // Pop an expression from the stack
+        Expression* pExpr = scanExprs.back();
+        scanExprs.pop_back();
+
+        // If this is a parameterized expression on a symbol, add it to the array accesses
+        if (pExpr->getExprType() == Expression::ExprType::PARAM &&
+            ((ParamExpr*)pExpr)->getExpr()->getExprType() == Expression::ExprType::SYMBOL)
+            accessExprs.push_back((ParamExpr*)pExpr);
+
+        // Scan the sub-expressions of this expression
+        Expression::ExprVector subExprs = pExpr->getSubExprs();
+        for (size_t i = 0; i < subExprs.size(); ++i)
+            if (subExprs[i] != NULL)
+                scanExprs.push_back(subExprs[i]);
+    }
+
+    // Declare a vector for the candidate accesses and a set for the arrays they may not cover
+    std::vector<GuardAccess> candidates;
+    Expression::SymbolSet rejectedArrays(plainDefs);
+
+    // For each array access
+    for (std::vector<ParamExpr*>::iterator accessItr = accessExprs.begin(); accessItr != accessExprs.end(); ++accessItr)
+    {
+        // Describe the access
+        GuardAccess access;
+        access.pExpr = *accessItr;
+        access.pArray = (SymbolExpr*)access.pExpr->getExpr();
+        access.isWrite = writeExprs.find(access.pExpr) != writeExprs.end();
+
+        // Get the object type of the array at the loop entry
+        VarTypeMap::const_iterator typeItr = loopVarTypes.find(access.pArray);
+        TypeSet arrayTypes = (typeItr != loopVarTypes.end())? typeItr->second:TypeSet();
+        getStorageMode(arrayTypes, access.arrayType);
+
+        // Find the array object at the loop entry
+        VariableMap::const_iterator varItr = entryVarMap.find(access.pArray);
+
+        // Only accesses compiled as scalar array reads and writes on local arrays,
+        // with one or two indices, can be covered
+        bool covered =
+            access.arrayType >= DataObject::Type::MATRIX_I32 && access.arrayType <= DataObject::Type::CHARARRAY &&
+            access.arrayType != DataObject::Type::MATRIX_C128 &&
+            varItr != entryVarMap.end() && varItr->second.pValue != NULL && varItr->second.pValue->getType() == VOID_PTR_TYPE &&
+            access.pExpr->getArguments().size() >= 1 && access.pExpr->getArguments().size() <= 2;
+
+        // Each index must be affine in the loop index or loop-invariant
+        for (size_t i = 0; covered && i < access.pExpr->getArguments().size(); ++i)
+        {
+            GuardIndex index;
+            covered = getGuardIndex(access.pExpr->getArguments()[i], guard, bodyDefs, entryVarMap, index);
+            access.indices.push_back(index);
+        }
+
+        // If the access is covered, add it to the candidates
+        if (covered)
+            candidates.push_back(access);
+
+        // Otherwise, an uncovered write may resize the array
+        else if (access.isWrite)
+            rejectedArrays.insert(access.pArray);
+    }
+
+    // For each candidate access
+    for (std::vector<GuardAccess>::iterator accessItr = candidates.begin(); accessItr != candidates.end(); ++accessItr)
+    {
+        // If the array may be resized in the loop, skip this access
+        if (rejectedArrays.find(accessItr->pArray) != rejectedArrays.end())
+            continue;
+
+        // Add the access to the guard
+        guard.accesses.push_back(*accessItr);
+
+        // If this is a write, mark the array as written
+        if (accessItr->isWrite)
+            guard.writtenArrays.insert(accessItr->pArray);
+    }
+
+    // Version the loop only if some checks can be hoisted
+    return guard.accesses.empty() == false;
+}
+
+/***************************************************************
+* Function: JITCompiler::getGuardIndex()
+* Purpose : Express an array index as a guard index
+* Initial : agent on October 18, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+bool JITCompiler::getGuardIndex(
+    Expression* pIndexExpr,
+    const LoopGuard& guard,
+    const Expression::SymbolSet& bodyDefs,
+    const VariableMap& entryVarMap,
+    GuardIndex& index
+)
+{
+    // Initialize the index to a zero offset
+    index.pSymbol = NULL;
+    index.offset = 0;
+
+    // If the index is a binary operation, separate its constant offset
+    if (pIndexExpr->getExprType() == Expression::ExprType::BINARY_OP)
+    {
+        // Get a typed pointer to the expression
+        BinaryOpExpr* pBinOpExpr = (BinaryOpExpr*)pIndexExpr;
+        Expression* pLeftExpr = pBinOpExpr->getLeftExpr();
+        Expression* pRightExpr = pBinOpExpr->getRightExpr();
+
+        // Handle the i + c, c + i and i - c forms
+        if (pBinOpExpr->getOperator() == BinaryOpExpr::PLUS && pRightExpr->getExprType() == Expression::ExprType::INT_CONST)
+        {
+            index.offset = ((IntConstExpr*)pRightExpr)->getValue();
+            pIndexExpr = pLeftExpr;
+        }
+        else if (pBinOpExpr->getOperator() == BinaryOpExpr::PLUS && pLeftExpr->getExprType() == Expression::ExprType::INT_CONST)
+        {
+            index.offset = ((IntConstExpr*)pLeftExpr)->getValue();
+            pIndexExpr = pRightExpr;
+        }
+        else if (pBinOpExpr->getOperator() == BinaryOpExpr::MINUS && pRightExpr->getExprType() == Expression::ExprType::INT_CONST)
+        {
+            index.offset = -((IntConstExpr*)pRightExpr)->getValue();
+            pIndexExpr = pLeftExpr;
+        }
+        else
+        {
+            return false;
+        }
+
+        // The offset must apply to a symbol
+        if (pIndexExpr->getExprType() != Expression::ExprType::SYMBOL)
+            return false;
+    }
+
+    // If the index is an integer constant
+    if (pIndexExpr->getExprType() == Expression::ExprType::INT_CONST)
+    {
+        // The index is its own offset
+        index.offset = ((IntConstExpr*)pIndexExpr)->getValue();
+        return true;
+    }
+
+    // Otherwise, the index must be a symbol
+    if (pIndexExpr->getExprType() != Expression::ExprType::SYMBOL)
+        return false;
+    SymbolExpr* pSymbol = (SymbolExpr*)pIndexExpr;
+
+    // If the symbol is the loop index or the loop variable, the index is affine
+    if (pSymbol == guard.pIndexVar || pSymbol == guard.pLoopVar)
+    {
+        index.pSymbol = guard.pIndexVar;
+        return true;
+    }
+
+    // Otherwise, the symbol must be a loop-invariant scalar stored locally
+    VariableMap::const_iterator varItr = entryVarMap.find(pSymbol);
+    if (bodyDefs.find(pSymbol) != bodyDefs.end() || varItr == entryVarMap.end() ||
+        varItr->second.pValue == NULL || varItr->second.pValue->getType() == VOID_PTR_TYPE ||
+        isSmallMatMode(varItr->second.pValue->getType()))
+        return false;
+
+    // The index is the invariant symbol value
+    index.pSymbol = pSymbol;
+    return true;
+}
+
+/***************************************************************
+* Function: JITCompiler::compLoopGuard()
+* Purpose : Compile the guard selecting the unchecked version
+*           of a loop, and the loads hoisted out of it
+* Initial : agent on October 18, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+llvm::Value* JITCompiler::compLoopGuard(
+    llvm::IRBuilder<>& builder,
+    const LoopGuard& guard,
+    const VariableMap& entryVarMap,
+    HoistedLoadMap& hoistedLoads
+)
+{
+    // The range tests are done in floating-point, so that out of range
+    // and NaN values fail them instead of being truncated. The values
+    // indices are computed from must also equal their floor, so that
+    // non-integer values fail the guard as well
+    llvm::Type* pDoubleType = llvm::Type::getDoubleTy(*s_Context);
+    llvm::Value* pOneVal = llvm::ConstantFP::get(pDoubleType, 1.0);
+    llvm::Function* pFloorFunc = llvm::Intrinsic::getDeclaration(s_pModule, llvm::Intrinsic::floor, pDoubleType);
+
+    // Get the start and end values of the loop index
+    const Value& startVal = entryVarMap.find(guard.pIndexVar)->second;
+    const Value& endVal = entryVarMap.find(guard.pEndVar)->second;
+    llvm::Value* pStartVal = changeStorageMode(builder, startVal.pValue, startVal.objType, pDoubleType);
+    llvm::Value* pEndVal = changeStorageMode(builder, endVal.pValue, endVal.objType, pDoubleType);
+
+    // Ensure the start and end values are integers
+    llvm::Value* pGuardVal = builder.CreateAnd(
+        builder.CreateFCmpOEQ(builder.CreateCall(pFloorFunc, pStartVal), pStartVal),
+        builder.CreateFCmpOEQ(builder.CreateCall(pFloorFunc, pEndVal), pEndVal)
     );
 
-    // Erase the final break instruction from the decision block
-    pDecBlock->getInstList().erase(--pDecBlock->end());
+    // If the step is a variable, ensure it is a positive integer
+    if (guard.pStepVar != NULL)
+    {
+        const Value& stepVal = entryVarMap.find(guard.pStepVar)->second;
+        llvm::Value* pStepVal = changeStorageMode(builder, stepVal.pValue, stepVal.objType, pDoubleType);
+        pGuardVal = builder.CreateAnd(pGuardVal, builder.CreateFCmpOGT(pStepVal, llvm::ConstantFP::get(pDoubleType, 0.0)));
+        pGuardVal = builder.CreateAnd(pGuardVal, builder.CreateFCmpOEQ(builder.CreateCall(pFloorFunc, pStepVal), pStepVal));
+    }
 
-    // Create a conditional branch to select which block to execute based on the loop test value
-    decBuilder.CreateCondBr(pBoolVal, pBodyBlock, pBreakBlock);
+    // Declare maps for the values loaded from each array
+    std::map<SymbolExpr*, llvm::Value*> numElemsMap;
+    std::map<SymbolExpr*, llvm::Value*> rowCountMap;
+    std::map<SymbolExpr*, llvm::Value*> dataPtrMap;
+
+    // For each guarded access
+    for (std::vector<GuardAccess>::const_iterator accessItr = guard.accesses.begin(); accessItr != guard.accesses.end(); ++accessItr)
+    {
+        // Get the array object at the loop entry
+        SymbolExpr* pArray = accessItr->pArray;
+        llvm::Value* pArrayObj = entryVarMap.find(pArray)->second.pValue;
+
+        // Load the number of array elements, if not yet loaded
+        if (numElemsMap.find(pArray) == numElemsMap.end())
+        {
+            llvm::Value* pNumElems = loadMemberValue(
+                builder,
+                pArrayObj,
+                MEMBER_OFFSET(BaseMatrixObj, m_numElements),
+                getIntType(sizeof(size_t))
+            );
+            numElemsMap[pArray] = builder.CreateUIToFP(pNumElems, pDoubleType);
+        }
+
+        // Load the size of the first dimension, if needed and not yet loaded
+        if (accessItr->indices.size() == 2 && rowCountMap.find(pArray) == rowCountMap.end())
+        {
+            llvm::Value* pSizeArrayPtr = createNativeCall(
+                builder,
+                (void*)BaseMatrixObj::getSizeArray,
+                LLVMValueVector(1, pArrayObj)
+            );
+            llvm::Value* pRowCount = builder.CreateLoad(pSizeArrayPtr);
+            rowCountMap[pArray] = builder.CreateIntCast(pRowCount, llvm::Type::getInt64Ty(*s_Context), false);
+        }
+
+        // Declare a vector for the highest value of each index
+        LLVMValueVector highVals;
+
+        // For each index
+        for (size_t i = 0; i < accessItr->indices.size(); ++i)
+        {
+            // Get the index description
+            const GuardIndex& index = accessItr->indices[i];
+            llvm::Value* pOffsetVal = llvm::ConstantFP::get(pDoubleType, (float64)index.offset);
+
+            // Compute the lowest and highest index values over the loop
+            llvm::Value* pLowVal = pOffsetVal;
+            llvm::Value* pHighVal = pOffsetVal;
+            if (index.pSymbol == guard.pIndexVar)
+            {
+                pLowVal = builder.CreateFAdd(pStartVal, pOffsetVal);
+                pHighVal = builder.CreateFAdd(pEndVal, pOffsetVal);
+            }
+            else if (index.pSymbol != NULL)
+            {
+                const Value& symVal = entryVarMap.find(index.pSymbol)->second;
+                llvm::Value* pSymVal = changeStorageMode(builder, symVal.pValue, symVal.objType, pDoubleType);
+                pLowVal = builder.CreateFAdd(pSymVal, pOffsetVal);
+                pHighVal = pLowVal;
+
+                // Ensure the invariant index value is an integer
+                pGuardVal = builder.CreateAnd(pGuardVal, builder.CreateFCmpOEQ(builder.CreateCall(pFloorFunc, pSymVal), pSymVal));
+            }
+
+            // Ensure the lowest index value is at least 1
+            pGuardVal = builder.CreateAnd(pGuardVal, builder.CreateFCmpOGE(pLowVal, pOneVal));
+
+            // Add the highest value to the list
+            highVals.push_back(pHighVal);
+        }
+
+        // Compute the highest zero-based linear index of the access
+        llvm::Value* pLinearVal = builder.CreateFSub(highVals[0], pOneVal);
+        if (highVals.size() == 2)
+        {
+            // Ensure the row index does not exceed the row count
+            llvm::Value* pRowCount = builder.CreateUIToFP(rowCountMap[pArray], pDoubleType);
+            pGuardVal = builder.CreateAnd(pGuardVal, builder.CreateFCmpOLE(highVals[0], pRowCount));
+
+            // Add the column offset to the linear index
+            pLinearVal = builder.CreateFAdd(pLinearVal, builder.CreateFMul(builder.CreateFSub(highVals[1], pOneVal), pRowCount));
+        }
+
+        // Ensure the linear index is below the number of array elements
+        pGuardVal = builder.CreateAnd(pGuardVal, builder.CreateFCmpOLT(pLinearVal, numElemsMap[pArray]));
+
+        // Only the loads of floating-point arrays which are not written in the loop are hoisted
+        if (accessItr->isWrite || accessItr->arrayType != DataObject::Type::MATRIX_F64 ||
+            guard.writtenArrays.find(pArray) != guard.writtenArrays.end())
+            continue;
+
+        // Load the element array pointer, if not yet loaded
+        if (dataPtrMap.find(pArray) == dataPtrMap.end())
+        {
+            dataPtrMap[pArray] = loadMemberValue(
+                builder,
+                pArrayObj,
+                MEMBER_OFFSET(MatrixF64Obj, m_pElements),
+                llvm::PointerType::getUnqual(pDoubleType)
+            );
+        }
 
-    // Set the exit point parameters
-    exitPoint.first = pBreakBlock;
-    exitPoint.second = breakVarMap;
+        // Store the hoisted loads for this access
+        HoistedLoads loads;
+        loads.pDataPtr = dataPtrMap[pArray];
+        loads.pRowCount = (accessItr->indices.size() == 2)? rowCountMap[pArray]:NULL;
+        hoistedLoads[accessItr->pExpr] = loads;
+    }
 
-    // Return a pointer to the loop initialization block
-    // return pInitBlock;
-    return pCopyBlock;
+    // Return the guard value
+    return pGuardVal;
 }
 
 /***************************************************************
@@ -4433,6 +5788,9 @@ llvm::BasicBlock* JITCompiler::compLoopStmt(
 * Initial : Maxime Chevalier-Boisvert on March 22, 2009
 ****************************************************************
 Revisions and bug fixes:
+
+agent on October 18, 2026
+Small matrix values are boxed unless the caller accepts them.
 */
 JITCompiler::Value JITCompiler::compExpression(
     Expression* pExpression,
@@ -4443,9 +5801,40 @@ JITCompiler::Value JITCompiler::compExpression(
     const VarTypeMap& varTypes,
     VariableMap& varMap,
     llvm::BasicBlock* pEntryBlock,
-    llvm::BasicBlock* pExitBlock
+    llvm::BasicBlock* pExitBlock,
+    bool allowSmallMat
 )
 {
+    // If small matrices are kept in registers but the caller does not accept them
+    if (s_jitSmallMatrices.getBoolValue() == true && allowSmallMat == false)
+    {
+        // Create a basic block to box the value in
+        llvm::BasicBlock* pBoxBlock = llvm::BasicBlock::Create(*s_Context, "", version.pLLVMFunc);
+
+        // Compile the expression, allowing small matrix values
+        Value value = compExpression(
+            pExpression,
+            function,
+            version,
+            liveVars,
+            reachDefs,
+            varTypes,
+            varMap,
+            pEntryBlock,
+            pBoxBlock,
+            true
+        );
+
+        // If the value is a small matrix, box it into a matrix object
+        llvm::IRBuilder<> boxBuilder(pBoxBlock);
+        if (value.pValue != NULL && isSmallMatMode(value.pValue->getType()))
+            value.pValue = changeStorageMode(boxBuilder, value.pValue, value.objType, VOID_PTR_TYPE);
+        boxBuilder.CreateBr(pExitBlock);
+
+        // Return the boxed value
+        return value;
+    }
+
     // Switch on the expression type
     switch (pExpression->getExprType())
     {
@@ -4603,7 +5992,9 @@ JITCompiler::Value JITCompiler::compExpression(
                 varTypes,
                 varMap,
                 pEntryBlock,
-                pExitBlock
+                pExitBlock,
+                (pExpression->getExprType() == Expression::ExprType::CELL_INDEX)?
+                    Profiler::FALLBACK_CELL_INDEX:Profiler::FALLBACK_UNSUPPORTED_EXPR
             );
         }
     }
@@ -4615,6 +6006,9 @@ JITCompiler::Value JITCompiler::compExpression(
 * Initial : Maxime Chevalier-Boisvert on June 12, 2009
 ****************************************************************
 Revisions and bug fixes:
+
+agent on October 18, 2026
+Operations on small matrices are unrolled in registers.
 */
 JITCompiler::Value JITCompiler::compUnaryExpr(
     UnaryOpExpr* pUnaryExpr,
@@ -4628,6 +6022,27 @@ JITCompiler::Value JITCompiler::compUnaryExpr(
     llvm::BasicBlock* pExitBlock
 )
 {
+    // If small matrices are kept in registers
+    if (s_jitSmallMatrices.getBoolValue() == true)
+    {
+        // Attempt to unroll the operation on small matrices
+        Value smallMatValue = compSmallMatOp(
+            pUnaryExpr,
+            function,
+            version,
+            liveVars,
+            reachDefs,
+            varTypes,
+            varMap,
+            pEntryBlock,
+            pExitBlock
+        );
+
+        // If the operation was unrolled, return its value
+        if (smallMatValue.pValue != NULL)
+            return smallMatValue;
+    }
+
     // Switch on the binary operator type
     switch (pUnaryExpr->getOperator())
     {
@@ -4675,7 +6090,8 @@ JITCompiler::Value JITCompiler::compUnaryExpr(
                 varTypes,
                 varMap,
                 pEntryBlock,
-                pExitBlock
+                pExitBlock,
+                Profiler::FALLBACK_UNSUPPORTED_OP
             );
         }
     }
@@ -4687,6 +6103,9 @@ JITCompiler::Value JITCompiler::compUnaryExpr(
 * Initial : Maxime Chevalier-Boisvert on March 24, 2009
 ****************************************************************
 Revisions and bug fixes:
+
+agent on October 18, 2026
+Operations on small matrices are unrolled in registers.
 */
 JITCompiler::Value JITCompiler::compBinaryExpr(
     BinaryOpExpr* pBinaryExpr,
@@ -4715,8 +6134,30 @@ JITCompiler::Value JITCompiler::compBinaryExpr(
             varTypes,
             varMap,
             pEntryBlock,
+            pExitBlock,
+            Profiler::FALLBACK_OPTS_DISABLED
+        );
+    }
+
+    // If small matrices are kept in registers
+    if (s_jitSmallMatrices.getBoolValue() == true)
+    {
+        // Attempt to unroll the operation on small matrices
+        Value smallMatValue = compSmallMatOp(
+            pBinaryExpr,
+            function,
+            version,
+            liveVars,
+            reachDefs,
+            varTypes,
+            varMap,
+            pEntryBlock,
             pExitBlock
         );
+
+        // If the operation was unrolled, return its value
+        if (smallMatValue.pValue != NULL)
+            return smallMatValue;
     }
 
     // Switch on the binary operator type
@@ -5270,12 +6711,271 @@ JITCompiler::Value JITCompiler::compBinaryExpr(
                 varTypes,
                 varMap,
                 pEntryBlock,
-                pExitBlock
+                pExitBlock,
+                Profiler::FALLBACK_UNSUPPORTED_OP
             );
         }
     }
 }
 
+/***************************************************************
+* Function: JITCompiler::compSmallMatOp()
+* Purpose : Compile an operation on small fixed-size matrices
+* Initial : agent on October 18, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+JITCompiler::Value JITCompiler::compSmallMatOp(
+    Expression* pExpression,
+    CompFunction& function,
+    CompVersion& version,
+    const Expression::SymbolSet& liveVars,
+    const VarDefMap& reachDefs,
+    const VarTypeMap& varTypes,
+    VariableMap& varMap,
+    llvm::BasicBlock* pEntryBlock,
+    llvm::BasicBlock* pExitBlock
+)
+{
+    // Operations which can be unrolled on small matrices
+    enum SmallMatOp
+    {
+        NONE,
+        ADD,
+        SUB,
+        ELEM_MULT,
+        ELEM_DIV,
+        MAT_MULT,
+        NEGATE,
+        TRANSPOSE
+    };
+
+    // Declare a vector for the operand expressions
+    Expression::ExprVector operands;
+
+    // Determine the operation to perform
+    SmallMatOp op = NONE;
+    if (pExpression->getExprType() == Expression::ExprType::BINARY_OP)
+    {
+        BinaryOpExpr* pBinaryExpr = (BinaryOpExpr*)pExpression;
+        operands.push_back(pBinaryExpr->getLeftExpr());
+        operands.push_back(pBinaryExpr->getRightExpr());
+
+        switch (pBinaryExpr->getOperator())
+        {
+            case BinaryOpExpr::PLUS:        op = ADD;       break;
+            case BinaryOpExpr::MINUS:       op = SUB;       break;
+            case BinaryOpExpr::ARRAY_MULT:  op = ELEM_MULT; break;
+            case BinaryOpExpr::ARRAY_DIV:   op = ELEM_DIV;  break;
+            case BinaryOpExpr::DIV:         op = ELEM_DIV;  break;
+            case BinaryOpExpr::MULT:        op = MAT_MULT;  break;
+            default: break;
+        }
+    }
+    else if (pExpression->getExprType() == Expression::ExprType::UNARY_OP)
+    {
+        UnaryOpExpr* pUnaryExpr = (UnaryOpExpr*)pExpression;
+        operands.push_back(pUnaryExpr->getOperand());
+
+        switch (pUnaryExpr->getOperator())
+        {
+            case UnaryOpExpr::MINUS:        op = NEGATE;    break;
+            case UnaryOpExpr::TRANSP:       op = TRANSPOSE; break;
+            case UnaryOpExpr::ARRAY_TRANSP: op = TRANSPOSE; break;
+            default: break;
+        }
+    }
+
+    // If this operation cannot be unrolled, stop
+    if (op == NONE)
+        return Value();
+
+    // Get the storage mode and dimensions of each operand
+    std::vector<llvm::Type*> modes;
+    std::vector<size_t> numRows(operands.size(), 1);
+    std::vector<size_t> numCols(operands.size(), 1);
+    bool anySmallMat = false;
+    for (size_t i = 0; i < operands.size(); ++i)
+    {
+        DataObject::Type objType;
+        llvm::Type* mode = getExprStorageMode(operands[i], version, varTypes, objType);
+        modes.push_back(mode);
+
+        // Each operand must be a small matrix or a real scalar
+        if (isSmallMatMode(mode, &numRows[i], &numCols[i]))
+            anySmallMat = true;
+        else if (mode != llvm::Type::getDoubleTy(*s_Context) &&
+            mode != llvm::Type::getInt64Ty(*s_Context) && mode != llvm::Type::getInt1Ty(*s_Context))
+            return Value();
+    }
+
+    // At least one operand must be a small matrix
+    if (anySmallMat == false)
+        return Value();
+
+    // A matrix product with a scalar operand is an element-wise product
+    bool leftScalar = isSmallMatMode(modes.front()) == false;
+    bool rightScalar = isSmallMatMode(modes.back()) == false;
+    if (op == MAT_MULT && (leftScalar || rightScalar))
+        op = ELEM_MULT;
+
+    // Matrix division is only element-wise when dividing by a scalar
+    if (pExpression->getExprType() == Expression::ExprType::BINARY_OP &&
+        ((BinaryOpExpr*)pExpression)->getOperator() == BinaryOpExpr::DIV && rightScalar == false)
+        return Value();
+
+    // Determine the dimensions of the result
+    size_t outRows, outCols;
+    switch (op)
+    {
+        case MAT_MULT:
+        {
+            // The inner dimensions must agree
+            if (numCols[0] != numRows[1])
+                return Value();
+            outRows = numRows[0];
+            outCols = numCols[1];
+        }
+        break;
+
+        case NEGATE:
+        {
+            outRows = numRows[0];
+            outCols = numCols[0];
+        }
+        break;
+
+        case TRANSPOSE:
+        {
+            outRows = numCols[0];
+            outCols = numRows[0];
+        }
+        break;
+
+        default:
+        {
+            // Element-wise operands must have the same size, unless one is a scalar
+            if (leftScalar == false && rightScalar == false &&
+                (numRows[0] != numRows[1] || numCols[0] != numCols[1]))
+                return Value();
+            outRows = leftScalar? numRows[1]:numRows[0];
+            outCols = leftScalar? numCols[1]:numCols[0];
+        }
+    }
+
+    // If we are in verbose mode, log the small matrix op code generation
+    if (ConfigManager::s_verboseVar)
+        std::cout << "Generating small matrix code for \"" << pExpression->toString() << "\"" << std::endl;
+
+    // Compile the operand expressions, keeping small matrices in registers
+    llvm::BasicBlock* pCurBlock = pEntryBlock;
+    LLVMValueVector values;
+    for (size_t i = 0; i < operands.size(); ++i)
+    {
+        llvm::BasicBlock* pOpExitBlock = llvm::BasicBlock::Create(*s_Context, "", version.pLLVMFunc);
+
+        Value opValue = compExpression(
+            operands[i],
+            function,
+            version,
+            liveVars,
+            reachDefs,
+            varTypes,
+            varMap,
+            pCurBlock,
+            pOpExitBlock,
+            true
+        );
+
+        // Convert the operand to its small matrix or float64 storage mode
+        llvm::IRBuilder<> opBuilder(pOpExitBlock);
+        values.push_back(changeStorageMode(
+            opBuilder,
+            opValue.pValue,
+            opValue.objType,
+            isSmallMatMode(modes[i])? modes[i]:llvm::Type::getDoubleTy(*s_Context)
+        ));
+
+        pCurBlock = pOpExitBlock;
+    }
+
+    // Create an IR builder for the operation
+    llvm::IRBuilder<> builder(pCurBlock);
+
+    // Declare a value for the result
+    llvm::Value* pResult = llvm::UndefValue::get(getSmallMatMode(outRows, outCols));
+
+    // Generate the unrolled operation
+    switch (op)
+    {
+        case NEGATE:
+        {
+            for (size_t j = 0; j < outCols; ++j)
+                pResult = builder.CreateInsertValue(pResult, builder.CreateFNeg(builder.CreateExtractValue(values[0], j)), j);
+        }
+        break;
+
+        case TRANSPOSE:
+        {
+            for (size_t j = 0; j < outCols; ++j)
+                for (size_t i = 0; i < outRows; ++i)
+                    pResult = smallMatSet(builder, pResult, smallMatGet(builder, values[0], j, i), i, j);
+        }
+        break;
+
+        case MAT_MULT:
+        {
+            // Accumulate each result column as a combination of the left columns
+            for (size_t j = 0; j < outCols; ++j)
+            {
+                llvm::Value* pColVal = NULL;
+                for (size_t k = 0; k < numCols[0]; ++k)
+                {
+                    llvm::Value* pProdVal = builder.CreateFMul(
+                        builder.CreateExtractValue(values[0], k),
+                        smallMatSplat(builder, smallMatGet(builder, values[1], k, j), outRows)
+                    );
+                    pColVal = (pColVal == NULL)? pProdVal:builder.CreateFAdd(pColVal, pProdVal);
+                }
+                pResult = builder.CreateInsertValue(pResult, pColVal, j);
+            }
+        }
+        break;
+
+        default:
+        {
+            for (size_t j = 0; j < outCols; ++j)
+            {
+                // Get the column operands, broadcasting scalars
+                llvm::Value* pLeftCol = leftScalar?
+                    smallMatSplat(builder, values[0], outRows):builder.CreateExtractValue(values[0], j);
+                llvm::Value* pRightCol = rightScalar?
+                    smallMatSplat(builder, values[1], outRows):builder.CreateExtractValue(values[1], j);
+
+                llvm::Value* pColVal;
+                switch (op)
+                {
+                    case ADD:       pColVal = builder.CreateFAdd(pLeftCol, pRightCol); break;
+                    case SUB:       pColVal = builder.CreateFSub(pLeftCol, pRightCol); break;
+                    case ELEM_MULT: pColVal = builder.CreateFMul(pLeftCol, pRightCol); break;
+                    default:        pColVal = builder.CreateFDiv(pLeftCol, pRightCol); break;
+                }
+                pResult = builder.CreateInsertValue(pResult, pColVal, j);
+            }
+        }
+    }
+
+    // A 1x1 product is produced as a scalar value
+    if (outRows == 1 && outCols == 1)
+        pResult = smallMatGet(builder, pResult, 0, 0);
+
+    // Branch to the exit block
+    builder.CreateBr(pExitBlock);
+
+    // Return the result value
+    return Value(pResult, DataObject::Type::MATRIX_F64);
+}
+
 /***************************************************************
 * Function: JITCompiler::compBinaryOp()
 * Purpose : Generate code for binary expression operations
@@ -6135,6 +7835,13 @@ JITCompiler::Value JITCompiler::compBinaryOp(
 * Purpose : Compile a dot  expression
 * Initial : Matthieu Dubet on July 2012
 ****************************************************************
+Revisions and bug fixes:
+
+agent on October 18, 2026
+Scalar struct fields are read by slot, guarded by the struct shape.
+Real scalar fields are read unboxed.
+Fields with a slot in the expected shape are loaded inline, behind a
+shape guard. The native read is only called when the guard fails.
 */
 JITCompiler::Value JITCompiler::compDotExpr(
     Statement* stmt,
@@ -6153,8 +7860,207 @@ JITCompiler::Value JITCompiler::compDotExpr(
     if (ConfigManager::s_verboseVar)
         std::cout << "Generating code for dot expr \"" << pDotExpr->toString() << "\" evaluation" << std::endl;
 
-    // TODO
-    throw std::runtime_error("unimplemented");
+    // Get the struct expression
+    Expression* pStructExpr = pDotExpr->getExpr();
+
+    // Find the type set for the struct expression
+    ExprTypeMap::const_iterator structTypeItr = version.pTypeInferInfo->exprTypeMap.find(pStructExpr);
+    TypeSet structTypes = (structTypeItr != version.pTypeInferInfo->exprTypeMap.end() && !structTypeItr->second.empty())? structTypeItr->second[0]:TypeSet();
+
+    // Determine whether the struct is known to be a scalar struct
+    bool scalarStruct = (structTypes.size() == 1 && structTypes.begin()->getObjType() == DataObject::Type::STRUCTARRAY);
+    if (scalarStruct && !structTypes.begin()->isScalar())
+    {
+        const TypeInfo::DimVector& structSize = structTypes.begin()->getMatSize();
+        scalarStruct = structTypes.begin()->getSizeKnown() && std::count(structSize.begin(), structSize.end(), 1) == (int)structSize.size();
+    }
+
+    // If the struct may not be scalar, the field access
+    // may produce multiple values, use the interpreter
+    if (scalarStruct == false)
+    {
+        hotspot::Profiler::get()->cInstrumentInterpreter(pEntryBlock);
+        return exprFallback(
+            pDotExpr,
+            (void*)Interpreter::evalExpression,
+            function,
+            version,
+            liveVars,
+            reachDefs,
+            varTypes,
+            varMap,
+            pEntryBlock,
+            pExitBlock,
+            Profiler::FALLBACK_STRUCT_FIELD
+        );
+    }
+
+    // Get the shape the struct is expected to have, and the
+    // slot of the field in that shape, if the field is known
+    const StructShape* pShape = structTypes.begin()->getShape();
+    size_t slot = pShape->findSlot(pDotExpr->getField());
+    if (slot == StructShape::NO_SLOT)
+    {
+        pShape = NULL;
+        slot = 0;
+    }
+
+    // Create a basic block for the struct expression exit point
+    llvm::BasicBlock* pStructExitBlock = llvm::BasicBlock::Create(*s_Context, "", version.pLLVMFunc);
+
+    // Compile the struct expression to get its value
+    Value structVal = compExpression(
+        pStructExpr,
+        function,
+        version,
+        liveVars,
+        reachDefs,
+        varTypes,
+        varMap,
+        pEntryBlock,
+        pStructExitBlock
+    );
+
+    // Create an IR builder for the struct exit block
+    llvm::IRBuilder<> exitBuilder(pStructExitBlock);
+
+    // Get the struct as an object pointer
+    llvm::Value* pStructObj = changeStorageMode(
+        exitBuilder,
+        structVal.pValue,
+        structVal.objType,
+        VOID_PTR_TYPE
+    );
+
+    // Find the type set for the field value
+    ExprTypeMap::const_iterator typeItr = version.pTypeInferInfo->exprTypeMap.find(pDotExpr);
+    TypeSet exprTypes = (typeItr != version.pTypeInferInfo->exprTypeMap.end() && !typeItr->second.empty())? typeItr->second[0]:TypeSet();
+
+    // Get the optimal storage mode for the value
+    DataObject::Type objectType;
+    llvm::Type* storageMode = getStorageMode(
+        exprTypes,
+        objectType
+    );
+
+    // Determine whether the field is read as an unboxed real scalar
+    // Note: this avoids boxing the values of structs stored in columns
+    bool readF64 = (storageMode == llvm::Type::getDoubleTy(*s_Context) && objectType == DataObject::Type::MATRIX_F64);
+
+    // Create blocks for the native field read and the read result
+    llvm::BasicBlock* pSlowBlock = llvm::BasicBlock::Create(*s_Context, "", version.pLLVMFunc);
+    llvm::BasicBlock* pJoinBlock = llvm::BasicBlock::Create(*s_Context, "", version.pLLVMFunc);
+
+    // Declare a vector for the values read inline and their blocks
+    LLVMValueVector fastValues;
+    std::vector<llvm::BasicBlock*> fastBlocks;
+
+    // If the field has a slot in the expected shape, read it inline,
+    // guarded by the shape of the struct and the slot contents
+    if (pShape != NULL)
+    {
+        llvm::Type* pSizeType = getIntType(sizeof(size_t));
+        llvm::Value* pOneVal = llvm::ConstantInt::get(pSizeType, 1);
+
+        // Test that the object is a struct array with one element
+        llvm::BasicBlock* pStructBlock = llvm::BasicBlock::Create(*s_Context, "", version.pLLVMFunc);
+        llvm::Value* pStructTest = exitBuilder.CreateICmpEQ(loadObjectType(exitBuilder, pStructObj), getObjType(DataObject::Type::STRUCTARRAY));
+        llvm::Value* pNumElems = loadMemberValue(exitBuilder, pStructObj, MEMBER_OFFSET(BaseMatrixObj, m_numElements), pSizeType);
+        exitBuilder.CreateCondBr(exitBuilder.CreateAnd(pStructTest, exitBuilder.CreateICmpEQ(pNumElems, pOneVal)), pStructBlock, pSlowBlock);
+        exitBuilder.SetInsertPoint(pStructBlock);
+
+        // Load the scalar struct, then test its shape and that it holds its own slots
+        llvm::Value* pElements = loadMemberValue(exitBuilder, pStructObj, MEMBER_OFFSET(StructArrayObj, m_pElements), llvm::PointerType::getUnqual(VOID_PTR_TYPE));
+        llvm::Value* pScalar = exitBuilder.CreateLoad(pElements);
+        llvm::Value* pShapeVal = loadMemberValue(exitBuilder, pScalar, MEMBER_OFFSET(ScalarStruct, m_pShape), VOID_PTR_TYPE);
+        llvm::Value* pSlots = loadMemberValue(exitBuilder, pScalar, MEMBER_OFFSET(ScalarStruct, m_pSlots), llvm::PointerType::getUnqual(VOID_PTR_TYPE));
+        llvm::Value* pShapeTest = exitBuilder.CreateAnd(
+            exitBuilder.CreateICmpEQ(pShapeVal, createPtrConst(pShape)),
+            exitBuilder.CreateICmpNE(pSlots, llvm::ConstantPointerNull::get((llvm::PointerType*)pSlots->getType()))
+        );
+        llvm::BasicBlock* pSlotBlock = llvm::BasicBlock::Create(*s_Context, "", version.pLLVMFunc);
+        exitBuilder.CreateCondBr(pShapeTest, pSlotBlock, pSlowBlock);
+        exitBuilder.SetInsertPoint(pSlotBlock);
+
+        // Load the field value from its slot, empty fields take the native path
+        llvm::Value* pFieldVal = exitBuilder.CreateLoad(
+            exitBuilder.CreateGEP(pSlots, llvm::ConstantInt::get(llvm::Type::getInt64Ty(*s_Context), slot))
+        );
+        llvm::Value* pFieldTest = exitBuilder.CreateICmpNE(pFieldVal, llvm::ConstantPointerNull::get((llvm::PointerType*)VOID_PTR_TYPE));
+
+        // If the field is read as an object, the slot value is the result
+        if (readF64 == false)
+        {
+            fastValues.push_back(pFieldVal);
+            fastBlocks.push_back(exitBuilder.GetInsertBlock());
+            exitBuilder.CreateCondBr(pFieldTest, pJoinBlock, pSlowBlock);
+        }
+
+        // Otherwise, test that the value is a real scalar and load it
+        else
+        {
+            llvm::BasicBlock* pValueBlock = llvm::BasicBlock::Create(*s_Context, "", version.pLLVMFunc);
+            exitBuilder.CreateCondBr(pFieldTest, pValueBlock, pSlowBlock);
+            exitBuilder.SetInsertPoint(pValueBlock);
+
+            llvm::Value* pScalarTest = exitBuilder.CreateAnd(
+                exitBuilder.CreateICmpEQ(loadObjectType(exitBuilder, pFieldVal), getObjType(DataObject::Type::MATRIX_F64)),
+                exitBuilder.CreateICmpEQ(loadMemberValue(exitBuilder, pFieldVal, MEMBER_OFFSET(BaseMatrixObj, m_numElements), pSizeType), pOneVal)
+            );
+            llvm::BasicBlock* pLoadBlock = llvm::BasicBlock::Create(*s_Context, "", version.pLLVMFunc);
+            exitBuilder.CreateCondBr(pScalarTest, pLoadBlock, pSlowBlock);
+            exitBuilder.SetInsertPoint(pLoadBlock);
+
+            llvm::Value* pDataPtr = loadMemberValue(exitBuilder, pFieldVal, MEMBER_OFFSET(MatrixF64Obj, m_pElements), llvm::PointerType::getUnqual(storageMode));
+            fastValues.push_back(exitBuilder.CreateLoad(pDataPtr));
+            fastBlocks.push_back(pLoadBlock);
+            exitBuilder.CreateBr(pJoinBlock);
+        }
+    }
+    else
+    {
+        exitBuilder.CreateBr(pSlowBlock);
+    }
+
+    // Otherwise, read the field natively, by slot if the struct
+    // has the expected shape, by name otherwise
+    llvm::IRBuilder<> slowBuilder(pSlowBlock);
+    LLVMValueVector readArgs;
+    readArgs.push_back(pStructObj);
+    readArgs.push_back(createPtrConst(pShape));
+    readArgs.push_back(llvm::ConstantInt::get(llvm::Type::getInt64Ty(*s_Context), slot));
+    readArgs.push_back(createPtrConst(&pDotExpr->getField()));
+    llvm::Value* pSlowValue = createNativeCall(
+        slowBuilder,
+        readF64? (void*)readStructFieldF64:(void*)readStructField,
+        readArgs
+    );
+    slowBuilder.CreateBr(pJoinBlock);
+
+    // Merge the field values read inline and natively
+    llvm::IRBuilder<> joinBuilder(pJoinBlock);
+    llvm::PHINode* pPhiNode = joinBuilder.CreatePHI(pSlowValue->getType(), fastValues.size() + 1);
+    for (size_t i = 0; i < fastValues.size(); ++i)
+        pPhiNode->addIncoming(fastValues[i], fastBlocks[i]);
+    pPhiNode->addIncoming(pSlowValue, pSlowBlock);
+    llvm::Value* pValue = pPhiNode;
+
+    // If the storage mode of the value does not match, change it
+    if (pValue->getType() != storageMode)
+    {
+        pValue = changeStorageMode(
+            joinBuilder,
+            pValue,
+            objectType,
+            storageMode
+        );
+    }
+
+    // Link the join block to the exit block
+    joinBuilder.CreateBr(pExitBlock);
+
+    // Return the field value
+    return Value(pValue, objectType);
 }
 
 /***************************************************************
@@ -6163,6 +8069,10 @@ JITCompiler::Value JITCompiler::compDotExpr(
 * Initial : Maxime Chevalier-Boisvert on March 24, 2009
 ****************************************************************
 Revisions and bug fixes:
+
+agent on October 18, 2026
+Elements of small matrices are read directly from registers. Fixed the
+argument values being converted in the wrong basic block.
 */
 JITCompiler::ValueVector JITCompiler::compParamExpr(
     ParamExpr* pParamExpr,
@@ -6323,14 +8233,6 @@ JITCompiler::ValueVector JITCompiler::compParamExpr(
         // Create an IR builder for the symbol evaluation exit block
         llvm::IRBuilder<> symExitBuilder(pSymExitBlock);
 
-        // Set the storage mode of the variable to the object pointer type
-        llvm::Value* pSymObject = changeStorageMode(
-            symExitBuilder,
-            symValue.pValue,
-            symValue.objType,
-            VOID_PTR_TYPE
-        );
-
         // Set the current IR builder to the symbol exit builder
         llvm::IRBuilder<> currentBuilder = symExitBuilder;
 
@@ -6360,7 +8262,7 @@ JITCompiler::ValueVector JITCompiler::compParamExpr(
             );
 
             // Update the current IR builder
-            //currentBuilder.SetInsertPoint(pArgExitBlock);
+            currentBuilder.SetInsertPoint(pArgExitBlock);
 
             // Set the storage mode of the argument to int64
             llvm::Value* pIntArgVal = changeStorageMode(
@@ -6374,6 +8276,31 @@ JITCompiler::ValueVector JITCompiler::compParamExpr(
             argValues.push_back(pIntArgVal);
         }
 
+        // If the matrix is held in registers
+        if (isSmallMatMode(symValue.pValue->getType()))
+        {
+            // Read the element directly from the registers
+            llvm::Value* pElemVal = compSmallMatRead(
+                currentBuilder,
+                symValue.pValue,
+                argValues,
+                pParamExpr,
+                version
+            );
+            currentBuilder.CreateBr(pExitBlock);
+
+            // Return the element value
+            return ValueVector(1, Value(pElemVal, DataObject::Type::MATRIX_F64));
+        }
+
+        // Set the storage mode of the variable to the object pointer type
+        llvm::Value* pSymObject = changeStorageMode(
+            currentBuilder,
+            symValue.pValue,
+            symValue.objType,
+            VOID_PTR_TYPE
+        );
+
         // Generate code for the scalar array read operation
         Value readValue = compArrayRead(
             pSymObject,
@@ -6403,7 +8330,8 @@ JITCompiler::ValueVector JITCompiler::compParamExpr(
         varTypes,
         varMap,
         pEntryBlock,
-        pExitBlock
+        pExitBlock,
+        Profiler::FALLBACK_UNKNOWN_TYPE
     );
 }
 
@@ -6493,6 +8421,9 @@ void checkDeclaredAndSuppliedFuncCallArgs(
 * Initial : Maxime Chevalier-Boisvert on June 15, 2009
 ****************************************************************
 Revisions and bug fixes:
+
+agent on October 18, 2026
+Library intrinsics on real scalars are compiled inline.
 */
 JITCompiler::ValueVector JITCompiler::compFunctionCall(
         Function* pCalleeFunc,
@@ -6568,7 +8499,7 @@ JITCompiler::ValueVector JITCompiler::compFunctionCall(
     {
         // Generate interpreter fallback code
         return arrayExprFallback(pOrigExpr, pFallbackFunc, nargout, callerFunction, callerVersion,
-            liveVars, reachDefs, varTypes, varMap, pEntryBlock, pExitBlock);
+            liveVars, reachDefs, varTypes, varMap, pEntryBlock, pExitBlock, Profiler::FALLBACK_NESTED_FUNC);
     }
 
     // If the callee is a program function nested inside the caller function
@@ -6601,6 +8532,64 @@ JITCompiler::ValueVector JITCompiler::compFunctionCall(
         argCountFixed == true &&
         s_jitUseLibOpts == true)
     {
+        // Attempt to find an intrinsic for this function and argument count
+        LibIntrinsicMap::iterator intrItr = s_libIntrinsicMap.find(
+            std::make_pair((const LibFunction*)pCalleeFunc, arguments.size()));
+
+        // Get the possible return types
+        ExprTypeMap::const_iterator retTypeItr = callerVersion.pTypeInferInfo->exprTypeMap.find(pOrigExpr);
+        assert (retTypeItr != callerVersion.pTypeInferInfo->exprTypeMap.end());
+
+        // The intrinsic applies only if the arguments and the return value are known real scalars
+        bool realScalars = (intrItr != s_libIntrinsicMap.end() && retTypeItr->second.size() == 1);
+        for (size_t i = 0; realScalars && i <= inArgTypes.size(); ++i)
+        {
+            const TypeSet& typeSet = (i < inArgTypes.size())? inArgTypes[i]:retTypeItr->second[0];
+            realScalars = (typeSet.size() == 1 &&
+                typeSet.begin()->getObjType() == DataObject::Type::MATRIX_F64 &&
+                typeSet.begin()->isScalar());
+        }
+
+        // If the intrinsic applies
+        if (realScalars)
+        {
+            // Create an IR builder for the current basic block
+            llvm::IRBuilder<> currentBuilder(pEntryBlock);
+
+            // Create a vector for the argument values
+            LLVMValueVector argValues;
+
+            // For each input argument
+            for (size_t i = 0; i < arguments.size(); ++i)
+            {
+                // Create a basic block for the expression evaluation exit
+                llvm::BasicBlock* pAfterBlock = llvm::BasicBlock::Create(*s_Context, "", callerVersion.pLLVMFunc);
+
+                // Compile the expression to obtain its value
+                Value argValue = compExpression(arguments[i], callerFunction, callerVersion, liveVars,
+                        reachDefs, varTypes, varMap, currentBuilder.GetInsertBlock(), pAfterBlock);
+
+                // Update the current basic block
+                currentBuilder.SetInsertPoint(pAfterBlock);
+
+                // Compute the intrinsic on float64 values
+                argValues.push_back(changeStorageMode(currentBuilder, argValue.pValue, argValue.objType, llvm::Type::getDoubleTy(*s_Context)));
+            }
+
+            // Compile the intrinsic inline
+            llvm::Value* pRetVal = compLibIntrinsic(currentBuilder, intrItr->second, argValues, callerVersion.pLLVMFunc, pOrigExpr);
+
+            // Store the result in the storage mode of the return type
+            DataObject::Type retObjType;
+            llvm::Type* retType = getStorageMode(retTypeItr->second[0], retObjType);
+            pRetVal = changeStorageMode(currentBuilder, pRetVal, retObjType, retType);
+
+            // Branch to the exit block
+            currentBuilder.CreateBr(pExitBlock);
+
+            // Return the return value
+            return ValueVector(1, Value(pRetVal, retObjType));
+        }
 
         // Get the possible return types
         ExprTypeMap::const_iterator typeItr = callerVersion.pTypeInferInfo->exprTypeMap.find(pOrigExpr);
@@ -6701,7 +8690,10 @@ JITCompiler::ValueVector JITCompiler::compFunctionCall(
             if (pArgExpr->getExprType() == Expression::ExprType::CELL_INDEX)
             {
                 // Write the symbols used by the expression to the environment
-                writeVariables(currentBuilder, callerFunction, callerVersion, varMap, pArgExpr->getSymbolUses());
+                size_t numWritten = writeVariables(currentBuilder, callerFunction, callerVersion, varMap, pArgExpr->getSymbolUses());
+
+                // Count the executions of this fallback
+                genFallbackCount(currentBuilder, callerFunction, callerVersion, pArgExpr, Profiler::FALLBACK_CELL_INDEX, numWritten);
 
                 hotspot::Profiler::get()->cInstrumentInterpreter(
                     currentBuilder.GetInsertBlock());
@@ -6846,6 +8838,11 @@ JITCompiler::ValueVector JITCompiler::compFunctionCall(
 * Initial : Maxime Chevalier-Boisvert on June 15, 2009
 ****************************************************************
 Revisions and bug fixes:
+
+agent on October 18, 2026
+Arguments and return values are passed directly instead of through
+per-caller call structures.
+Small matrix arguments are passed in registers.
 */
 void JITCompiler::compFuncCallJIT(
     Function* pCalleeFunc,
@@ -6892,19 +8889,9 @@ void JITCompiler::compFuncCallJIT(
     // Get a reference to the compiled function version
     CompVersion& calleeVersion = versionItr->second;
 
-    // Get the call input/output structures
-    LLVMValuePair callStructs = getCallStructs(
-        callerFunction, callerVersion, calleeFunction, calleeVersion);
-
     // Create an IR builder for the current basic block
     llvm::IRBuilder<> currentBuilder(pEntryBlock);
 
-    // Cast the in/out struct pointers to the proper type
-    llvm::Value* pInStructPtr = currentBuilder.CreateBitCast(
-        callStructs.first, llvm::PointerType::getUnqual(calleeVersion.pInStructType));
-    llvm::Value* pOutStructPtr = currentBuilder.CreateBitCast(
-        callStructs.second, llvm::PointerType::getUnqual(calleeVersion.pOutStructType));
-
     // If there are too many input arguments
     if (arguments.size() > pProgFunc->getInParams().size())
     {
@@ -6912,6 +8899,16 @@ void JITCompiler::compFuncCallJIT(
         throw CompError("too many input arguments", pOrigExpr);
     }
 
+    // If there are more output values requested than the function can produce
+    if (nargout > pProgFunc->getOutParams().size())
+    {
+        // Throw a compilation error
+        throw CompError("too many output values requested", pOrigExpr);
+    }
+
+    // Create a vector for the call arguments
+    LLVMValueVector callArgs;
+
     // For each input argument
     for (size_t i = 0; i < arguments.size(); ++i)
     {
@@ -6931,7 +8928,8 @@ void JITCompiler::compFuncCallJIT(
             varTypes,
             varMap,
             currentBuilder.GetInsertBlock(),
-            pAfterBlock
+            pAfterBlock,
+            true
         );
 
         // Update the current basic block
@@ -6945,64 +8943,23 @@ void JITCompiler::compFuncCallJIT(
             calleeVersion.inArgStoreModes[i]
         );
 
-        // Write the value to the input data structure
-        llvm::Value* gepValues[2];
-        gepValues[0] = llvm::ConstantInt::get(llvm::Type::getInt32Ty(*s_Context), 0);
-        gepValues[1] = llvm::ConstantInt::get(llvm::Type::getInt32Ty(*s_Context), i);
-        llvm::ArrayRef<llvm::Value*> gepValuesRef(gepValues, gepValues+2);
-        llvm::Value* pFieldAddr = currentBuilder.CreateGEP(pInStructPtr, gepValuesRef);
-        currentBuilder.CreateStore(pArgValue, pFieldAddr);
+        // Pass the value directly to the callee
+        callArgs.push_back(pArgValue);
     }
 
-    //std::cout << "Storing nargout value" << std::endl;
-
-    // Store the number of values to output (nargout) in the input structure
-    llvm::Value* gepValuesNargout[2];
-    gepValuesNargout[0] = llvm::ConstantInt::get(llvm::Type::getInt32Ty(*s_Context), 0);
-    gepValuesNargout[1] = llvm::ConstantInt::get(llvm::Type::getInt32Ty(*s_Context), arguments.size());
-    llvm::ArrayRef<llvm::Value*> gepValNargoutRef(gepValuesNargout, gepValuesNargout+2);
-    llvm::Value* pNargoutFieldAddr = currentBuilder.CreateGEP(pInStructPtr, gepValNargoutRef);
-    llvm::Value* pNargoutVal = llvm::ConstantInt::get(llvm::Type::getInt64Ty(*s_Context), nargout);
-    currentBuilder.CreateStore(pNargoutVal, pNargoutFieldAddr);
+    // Pass the number of values to output (nargout) as the last argument
+    callArgs.push_back(llvm::ConstantInt::get(llvm::Type::getInt64Ty(*s_Context), nargout));
 
-    //std::cout << "Stored nargout value" << std::endl;
-
-    // If this is a recursive call, and thus the function is not yet compiled
-    if (calleeFunction.pProgFunc == pProgFunc)
-    {
-        // Create a direct call to the function
-        LLVMValueVector callArgs;
-        callArgs.push_back(pInStructPtr);
-        callArgs.push_back(pOutStructPtr);
-        currentBuilder.CreateCall(calleeVersion.pLLVMFunc, callArgs);
-    }
-    else
-    {
-        // Create a native call through the exception handler
-        LLVMValueVector callArgs;
-        callArgs.push_back(createPtrConst(pProgFunc));
-        callArgs.push_back(createPtrConst((void*)calleeVersion.pFuncPtr));
-        callArgs.push_back(callerVersion.pInStruct);
-        callArgs.push_back(callerVersion.pOutStruct);
-        createNativeCall(
-            currentBuilder,
-            (void*)JITCompiler::callExceptHandler,
-            callArgs
-        );
-    }
+    // Create a direct call to the function, which returns its output values in a structure
+    llvm::Value* pRetVal = currentBuilder.CreateCall(calleeVersion.pLLVMFunc, callArgs);
 
     // If the number of output values should be tested
     if (nargout > 0)
     {
         //std::cout << "****** nargout for call: " << nargout << std::endl;
 
-        // Load the number of values written from the output structure
-        llvm::Value* gepValuesNum[2];
-        gepValuesNum[0] = llvm::ConstantInt::get(llvm::Type::getInt32Ty(*s_Context), 0);
-        gepValuesNum[1] = llvm::ConstantInt::get(llvm::Type::getInt32Ty(*s_Context), pProgFunc->getOutParams().size());
-        llvm::ArrayRef<llvm::Value*> gepValuesRef(gepValuesNum, gepValuesNum+2);
-        llvm::Value* pNumFieldAddr = currentBuilder.CreateGEP(pOutStructPtr, gepValuesRef);
-        llvm::Value* pNumOutVals = currentBuilder.CreateLoad(pNumFieldAddr);
+        // Extract the number of values written from the returned structure
+        llvm::Value* pNumOutVals = currentBuilder.CreateExtractValue(pRetVal, pProgFunc->getOutParams().size());
 
         // Create a basic block to replace the current entry block
         llvm::BasicBlock* pNewCurrentBlock = llvm::BasicBlock::Create(*s_Context, "", callerVersion.pLLVMFunc);
@@ -7031,7 +8988,7 @@ void JITCompiler::compFuncCallJIT(
         );
 
         // Terminate the basic block to keep the CFG proper
-        failBuilder.CreateRetVoid();
+        failBuilder.CreateUnreachable();
 
         // Update the current basic block
         currentBuilder.SetInsertPoint(pNewCurrentBlock);
@@ -7040,13 +8997,8 @@ void JITCompiler::compFuncCallJIT(
     // For each output value
     for (size_t i = 0; i < nargout; ++i)
     {
-        // Load this value from the output structure
-        llvm::Value* gepValues[2];
-        gepValues[0] = llvm::ConstantInt::get(llvm::Type::getInt32Ty(*s_Context), 0);
-        gepValues[1] = llvm::ConstantInt::get(llvm::Type::getInt32Ty(*s_Context), i);
-        llvm::ArrayRef<llvm::Value*> gepValuesRef(gepValues, gepValues+2);
-        llvm::Value* pFieldAddr = currentBuilder.CreateGEP(pOutStructPtr, gepValuesRef);
-        llvm::Value* pFieldValue = currentBuilder.CreateLoad(pFieldAddr);
+        // Extract this value from the returned structure
+        llvm::Value* pFieldValue = currentBuilder.CreateExtractValue(pRetVal, i);
 
         // Add the value to the vector
         valueVector.push_back(Value(pFieldValue, calleeVersion.outArgObjTypes[i]));
@@ -7189,7 +9141,8 @@ JITCompiler::ValueVector JITCompiler::compSymbolExpr(
                     varTypes,
                     varMap,
                     pEntryBlock,
-                    pExitBlock
+                    pExitBlock,
+                    Profiler::FALLBACK_UNKNOWN_SYMBOL
                 );
             }
         }
@@ -7295,6 +9248,12 @@ JITCompiler::Value JITCompiler::compSymbolEval(
 * Initial : Maxime Chevalier-Boisvert on July 15, 2009
 ****************************************************************
 Revisions and bug fixes:
+
+agent on October 18, 2026
+Skips the bounds checks hoisted into the guard of a versioned
+loop, and uses the loads hoisted out of it.
+Also skips the checks on indices whose value range is proved to
+lie within the array.
 */
 JITCompiler::Value JITCompiler::compArrayRead(
     llvm::Value* pMatrixObj,
@@ -7310,11 +9269,18 @@ JITCompiler::Value JITCompiler::compArrayRead(
     // Create an IR builder for the entry block
     llvm::IRBuilder<> currentBuilder(pEntryBlock);
 
+    // Determine if bounds checking is required, unless a loop guard covers this access
+    bool checkBounds = s_jitNoReadBoundChecks == false && version.hoistedChecks.find(pOrigExpr) == version.hoistedChecks.end();
+
+    // Find the values loaded before the enclosing loop for this access, if any
+    HoistedLoadMap::const_iterator hoistItr = version.hoistedLoads.find(pOrigExpr);
+    bool hoisted = hoistItr != version.hoistedLoads.end();
+
     // Declare a value for the size array pointer
     llvm::Value* pSizeArrayPtr = NULL;
 
-    // If there is more than one index
-    if (indices.size() > 1)
+    // If there is more than one index and the dimensions were not loaded before the loop
+    if (indices.size() > 1 && hoisted == false)
     {
         // Get a pointer to the dimension size array
         pSizeArrayPtr = createNativeCall(
@@ -7355,7 +9321,7 @@ JITCompiler::Value JITCompiler::compArrayRead(
     llvm::Value* pNumDims = NULL;
 
     // If we are indexing in more than 2 dimensions and bounds checking is required
-    if (indices.size() > 2 && s_jitNoReadBoundChecks == false)
+    if (indices.size() > 2 && checkBounds)
     {
         // Get the number of matrix dimensions
         pNumDims = createNativeCall(
@@ -7385,6 +9351,13 @@ JITCompiler::Value JITCompiler::compArrayRead(
     // In the NMI case, for each index (except the last)
     for (size_t i = 0; i < indices.size() - 1; ++i)
     {
+        // If the row count was loaded before the loop, use it
+        if (hoisted)
+        {
+            nmiSizes.push_back(hoistItr->second.pRowCount);
+            continue;
+        }
+
         // Extract the size of the current dimension
         llvm::Value* pDimElemPtr = nmiBuilder.CreateGEP(pSizeArrayPtr, llvm::ConstantInt::get(llvm::Type::getInt64Ty(*s_Context), i));
         llvm::Value* pDimSize = nmiBuilder.CreateLoad(pDimElemPtr);
@@ -7397,6 +9370,13 @@ JITCompiler::Value JITCompiler::compArrayRead(
     // In the TMI case, for the first two indices
     for (size_t i = 0; i < 2 && i < indices.size() - 1; ++i)
     {
+        // If the row count was loaded before the loop, use it
+        if (hoisted)
+        {
+            tmiSizes.push_back(hoistItr->second.pRowCount);
+            continue;
+        }
+
         // Extract the size of the current dimension
         llvm::Value* pDimElemPtr = tmiBuilder.CreateGEP(pSizeArrayPtr, llvm::ConstantInt::get(llvm::Type::getInt64Ty(*s_Context), i));
         llvm::Value* pDimSize = tmiBuilder.CreateLoad(pDimElemPtr);
@@ -7516,7 +9496,7 @@ JITCompiler::Value JITCompiler::compArrayRead(
     }
 
     // If bounds checking is required
-    if (s_jitNoReadBoundChecks == false)
+    if (checkBounds)
     {
         // Create a basic block for the out of bounds size case
         llvm::BasicBlock* pFailBlock = llvm::BasicBlock::Create(*s_Context, "", version.pLLVMFunc);
@@ -7530,11 +9510,10 @@ JITCompiler::Value JITCompiler::compArrayRead(
         );
 
         // Terminate the fail block
-        failBuilder.CreateRetVoid();
+        failBuilder.CreateUnreachable();
 
         // If bounds checking is required for the last index
-        if (version.pBoundsCheckInfo->isBoundsCheckRequired(pOrigExpr, indices.size() - 1, 0) == true ||
-            version.pBoundsCheckInfo->isBoundsCheckRequired(pOrigExpr, indices.size() - 1, 1) == true)
+        if (isBoundsCheckRequired(version, pOrigExpr, indices.size() - 1))
         {
             // Load the number of matrix elements
             llvm::Value* pNumElems = loadMemberValue(
@@ -7562,8 +9541,7 @@ JITCompiler::Value JITCompiler::compArrayRead(
         for (size_t i = 0; i < zeroIndices.size() - 1; ++i)
         {
             // If no bounds checking is required for this index, skip it
-            if (version.pBoundsCheckInfo->isBoundsCheckRequired(pOrigExpr, i, 0) == false &&
-                version.pBoundsCheckInfo->isBoundsCheckRequired(pOrigExpr, i, 1) == false)
+            if (isBoundsCheckRequired(version, pOrigExpr, i) == false)
                 continue;
 
             // Get the index along the current dimension
@@ -7597,8 +9575,8 @@ JITCompiler::Value JITCompiler::compArrayRead(
         // Floating-point matrix
         case DataObject::Type::MATRIX_F64:
         {
-            // Load the element array pointer
-            llvm::Value* pDataPtr = loadMemberValue(
+            // Load the element array pointer, unless it was loaded before the loop
+            llvm::Value* pDataPtr = hoisted? hoistItr->second.pDataPtr:loadMemberValue(
                 currentBuilder,
                 pMatrixObj,
                 MEMBER_OFFSET(MatrixF64Obj, m_pElements),
@@ -7678,6 +9656,12 @@ JITCompiler::Value JITCompiler::compArrayRead(
 * Initial : Maxime Chevalier-Boisvert on July 15, 2009
 ****************************************************************
 Revisions and bug fixes:
+
+agent on October 18, 2026
+Unshares copy-on-write element buffers before the store.
+Skips the bounds checks hoisted into the guard of a versioned loop.
+Also skips the checks on indices whose value range is proved to
+lie within the array.
 */
 void JITCompiler::compArrayWrite(
     llvm::Value* pMatrixObj,
@@ -7697,6 +9681,9 @@ void JITCompiler::compArrayWrite(
     // Create an IR builder for the entry block
     llvm::IRBuilder<> currentBuilder(pEntryBlock);
 
+    // Determine if bounds checking is required, unless a loop guard covers this access
+    bool checkBounds = s_jitNoWriteBoundChecks == false && version.hoistedChecks.find(pOrigExpr) == version.hoistedChecks.end();
+
     // Declare a value for the size array pointer
     llvm::Value* pSizeArrayPtr = NULL;
 
@@ -7738,7 +9725,7 @@ void JITCompiler::compArrayWrite(
     llvm::IRBuilder<> outBuilder(pOutBlock);
 
     // If we are indexing in more than 2 dimensions and bounds checking is required
-    if (indices.size() > 2 && s_jitNoWriteBoundChecks == false)
+    if (indices.size() > 2 && checkBounds)
     {
         // Get the number of matrix dimensions
         llvm::Value* pNumDims = createNativeCall(
@@ -7941,11 +9928,10 @@ void JITCompiler::compArrayWrite(
     }
 
     // If bounds checking is required
-    if (s_jitNoWriteBoundChecks == false)
+    if (checkBounds)
     {
         // If bounds checking is required for the last index
-        if (version.pBoundsCheckInfo->isBoundsCheckRequired(pOrigExpr, indices.size() - 1, 0) == true ||
-            version.pBoundsCheckInfo->isBoundsCheckRequired(pOrigExpr, indices.size() - 1, 1) == true)
+        if (isBoundsCheckRequired(version, pOrigExpr, indices.size() - 1))
         {
             // Load the number of matrix elements
             llvm::Value* pNumElems = loadMemberValue(
@@ -7973,8 +9959,7 @@ void JITCompiler::compArrayWrite(
         for (size_t i = 0; i < zeroIndices.size() - 1; ++i)
         {
             // If no bounds checking is required for this index, skip it
-            if (version.pBoundsCheckInfo->isBoundsCheckRequired(pOrigExpr, i, 0) == false &&
-                version.pBoundsCheckInfo->isBoundsCheckRequired(pOrigExpr, i, 1) == false)
+            if (isBoundsCheckRequired(version, pOrigExpr, i) == false)
                 continue;
 
             // Get the index along the current dimension
@@ -8008,7 +9993,7 @@ void JITCompiler::compArrayWrite(
         );
 
         // Terminate the fail block
-        failBuilder.CreateRetVoid();
+        failBuilder.CreateUnreachable();
 
         // For each index
         for (size_t i = 0; i < indices.size(); ++i)
@@ -8127,11 +10112,44 @@ void JITCompiler::compArrayWrite(
     else
     {
         // Terminate the out of bounds block
-        outBuilder.CreateRetVoid();
+        outBuilder.CreateUnreachable();
     }
 
     //std::cout << "Bounds checking complete" << std::endl;
 
+    // Load the reference count pointer of the element buffer
+    llvm::Value* pRefCountPtr = loadMemberValue(
+        currentBuilder,
+        pMatrixObj,
+        MEMBER_OFFSET(BaseMatrixObj, m_pRefCount),
+        VOID_PTR_TYPE
+    );
+
+    // Test if the element buffer may be shared with another matrix
+    llvm::Value* pSharedVal = currentBuilder.CreateICmpNE(
+        pRefCountPtr,
+        llvm::Constant::getNullValue(VOID_PTR_TYPE)
+    );
+
+    // Create basic blocks for the unsharing and the element write
+    llvm::BasicBlock* pUnshareBlock = llvm::BasicBlock::Create(*s_Context, "", version.pLLVMFunc);
+    llvm::BasicBlock* pWriteBlock = llvm::BasicBlock::Create(*s_Context, "", version.pLLVMFunc);
+    llvm::IRBuilder<> unshareBuilder(pUnshareBlock);
+
+    // Branch based on the test condition
+    currentBuilder.CreateCondBr(pSharedVal, pUnshareBlock, pWriteBlock);
+
+    // If the buffer is shared, give the matrix its own copy before writing
+    createNativeCall(
+        unshareBuilder,
+        (void*)BaseMatrixObj::unshareMatrix,
+        LLVMValueVector(1, pMatrixObj)
+    );
+    unshareBuilder.CreateBr(pWriteBlock);
+
+    // Make the write block the new current basic block
+    currentBuilder.SetInsertPoint(pWriteBlock);
+
     // Switch based on the matrix type
     switch (matrixType)
     {
@@ -8234,12 +10252,261 @@ void JITCompiler::compArrayWrite(
     currentBuilder.CreateBr(pExitBlock);
 }
 
+// Function to get the dimension sizes of a small matrix as seen by an indexing
+static std::vector<size_t> smallMatDimSizes(
+    size_t numIndices,
+    size_t numRows,
+    size_t numCols
+)
+{
+    // With a single index, the matrix is indexed linearly
+    if (numIndices == 1)
+        return std::vector<size_t>(1, numRows * numCols);
+
+    // Otherwise, any dimension past the second has size 1
+    std::vector<size_t> dimSizes(numIndices, 1);
+    dimSizes[0] = numRows;
+    dimSizes[1] = numCols;
+    return dimSizes;
+}
+
+// Function to get the constant linear index of a small matrix access, if any
+static bool smallMatConstIndex(
+    const LLVMValueVector& indices,
+    size_t numRows,
+    size_t numCols,
+    size_t& linearIndex
+)
+{
+    // Get the dimension sizes for this indexing
+    std::vector<size_t> dimSizes = smallMatDimSizes(indices.size(), numRows, numCols);
+
+    linearIndex = 0;
+    size_t stride = 1;
+
+    // For each index
+    for (size_t i = 0; i < indices.size(); ++i)
+    {
+        // The index must be a constant within its dimension
+        llvm::ConstantInt* pConstIndex = llvm::dyn_cast<llvm::ConstantInt>(indices[i]);
+        if (pConstIndex == NULL || pConstIndex->getSExtValue() < 1 || uint64_t(pConstIndex->getSExtValue()) > dimSizes[i])
+            return false;
+
+        linearIndex += (pConstIndex->getZExtValue() - 1) * stride;
+        stride *= dimSizes[i];
+    }
+
+    return true;
+}
+
+/***************************************************************
+* Function: JITCompiler::compSmallMatRead()
+* Purpose : Generate code for an element read from a small matrix
+* Initial : agent on October 18, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+llvm::Value* JITCompiler::compSmallMatRead(
+    llvm::IRBuilder<>& builder,
+    llvm::Value* pMatValue,
+    const LLVMValueVector& indices,
+    ParamExpr* pOrigExpr,
+    CompVersion& version
+)
+{
+    // Get the matrix dimensions from the storage mode
+    size_t numRows, numCols;
+    bool isSmallMat = isSmallMatMode(pMatValue->getType(), &numRows, &numCols);
+    assert (isSmallMat);
+
+    // If the indices are constants within the matrix, extract the element directly
+    size_t linearIndex;
+    if (smallMatConstIndex(indices, numRows, numCols, linearIndex))
+        return smallMatGet(builder, pMatValue, linearIndex % numRows, linearIndex / numRows);
+
+    // Get the dimension sizes for this indexing
+    std::vector<size_t> dimSizes = smallMatDimSizes(indices.size(), numRows, numCols);
+
+    // Create a basic block for the out of bounds case
+    llvm::BasicBlock* pFailBlock = llvm::BasicBlock::Create(*s_Context, "", version.pLLVMFunc);
+    llvm::IRBuilder<> failBuilder(pFailBlock);
+
+    // In the fail case, throw an exception
+    createThrowError(
+        failBuilder,
+        "index out of bounds in matrix read",
+        pOrigExpr
+    );
+
+    // Terminate the fail block
+    failBuilder.CreateUnreachable();
+
+    // Compute the zero-based linear index
+    llvm::Value* pIndex = llvm::ConstantInt::get(llvm::Type::getInt64Ty(*s_Context), 0);
+    size_t stride = 1;
+    for (size_t i = 0; i < indices.size(); ++i)
+    {
+        // Subtract one from the index
+        llvm::Value* pZeroIndex = builder.CreateSub(indices[i], llvm::ConstantInt::get(llvm::Type::getInt64Ty(*s_Context), 1));
+
+        // If bounds checking is required for this index
+        if (s_jitNoReadBoundChecks == false && isBoundsCheckRequired(version, pOrigExpr, i))
+        {
+            // Test if the index is out of bounds
+            llvm::Value* pCompVal = builder.CreateICmpUGE(
+                pZeroIndex,
+                llvm::ConstantInt::get(llvm::Type::getInt64Ty(*s_Context), dimSizes[i])
+            );
+
+            // Create a basic block for the within bounds case
+            llvm::BasicBlock* pPassBlock = llvm::BasicBlock::Create(*s_Context, "", version.pLLVMFunc);
+
+            // Branch based on the test condition
+            builder.CreateCondBr(pCompVal, pFailBlock, pPassBlock);
+
+            // Update the current basic block
+            builder.SetInsertPoint(pPassBlock);
+        }
+
+        // Add the offset along this dimension
+        llvm::Value* pDimOffset = builder.CreateMul(pZeroIndex, llvm::ConstantInt::get(llvm::Type::getInt64Ty(*s_Context), stride));
+        pIndex = builder.CreateAdd(pIndex, pDimOffset);
+        stride *= dimSizes[i];
+    }
+
+    // Select the element matching the linear index
+    llvm::Value* pReadValue = smallMatGet(builder, pMatValue, 0, 0);
+    for (size_t i = 1; i < numRows * numCols; ++i)
+    {
+        llvm::Value* pCompVal = builder.CreateICmpEQ(pIndex, llvm::ConstantInt::get(llvm::Type::getInt64Ty(*s_Context), i));
+        pReadValue = builder.CreateSelect(pCompVal, smallMatGet(builder, pMatValue, i % numRows, i / numRows), pReadValue);
+    }
+
+    // Return the read value
+    return pReadValue;
+}
+
+/***************************************************************
+* Function: JITCompiler::compSmallMatWrite()
+* Purpose : Generate code for an element write into a small matrix
+* Initial : agent on October 18, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+llvm::Value* JITCompiler::compSmallMatWrite(
+    llvm::IRBuilder<>& builder,
+    llvm::Value* pMatValue,
+    llvm::Value* pElemValue,
+    const LLVMValueVector& indices,
+    ParamExpr* pOrigExpr,
+    CompVersion& version
+)
+{
+    // Ensure that the write can be done in registers
+    assert (isSmallMatWritable(pMatValue, indices, pOrigExpr, version));
+
+    // Get the matrix dimensions from the storage mode
+    size_t numRows, numCols;
+    isSmallMatMode(pMatValue->getType(), &numRows, &numCols);
+
+    // If the indices are constants within the matrix, insert the element directly
+    size_t linearIndex;
+    if (smallMatConstIndex(indices, numRows, numCols, linearIndex))
+        return smallMatSet(builder, pMatValue, pElemValue, linearIndex % numRows, linearIndex / numRows);
+
+    // Get the dimension sizes for this indexing
+    std::vector<size_t> dimSizes = smallMatDimSizes(indices.size(), numRows, numCols);
+
+    // Compute the zero-based linear index, which is known to be within bounds
+    llvm::Value* pIndex = llvm::ConstantInt::get(llvm::Type::getInt64Ty(*s_Context), 0);
+    size_t stride = 1;
+    for (size_t i = 0; i < indices.size(); ++i)
+    {
+        llvm::Value* pZeroIndex = builder.CreateSub(indices[i], llvm::ConstantInt::get(llvm::Type::getInt64Ty(*s_Context), 1));
+        llvm::Value* pDimOffset = builder.CreateMul(pZeroIndex, llvm::ConstantInt::get(llvm::Type::getInt64Ty(*s_Context), stride));
+        pIndex = builder.CreateAdd(pIndex, pDimOffset);
+        stride *= dimSizes[i];
+    }
+
+    // Replace the element matching the linear index
+    for (size_t i = 0; i < numRows * numCols; ++i)
+    {
+        llvm::Value* pCompVal = builder.CreateICmpEQ(pIndex, llvm::ConstantInt::get(llvm::Type::getInt64Ty(*s_Context), i));
+        llvm::Value* pNewElem = builder.CreateSelect(pCompVal, pElemValue, smallMatGet(builder, pMatValue, i % numRows, i / numRows));
+        pMatValue = smallMatSet(builder, pMatValue, pNewElem, i % numRows, i / numRows);
+    }
+
+    // Return the updated matrix value
+    return pMatValue;
+}
+
+/***************************************************************
+* Function: JITCompiler::isSmallMatWritable()
+* Purpose : Test if a small matrix element write can stay in registers
+* Initial : agent on October 18, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+bool JITCompiler::isSmallMatWritable(
+    llvm::Value* pMatValue,
+    const LLVMValueVector& indices,
+    ParamExpr* pOrigExpr,
+    CompVersion& version
+)
+{
+    // Get the matrix dimensions from the storage mode
+    size_t numRows, numCols;
+    if (isSmallMatMode(pMatValue->getType(), &numRows, &numCols) == false)
+        return false;
+
+    // If the indices are constants within the matrix, the write cannot grow it
+    size_t linearIndex;
+    if (smallMatConstIndex(indices, numRows, numCols, linearIndex))
+        return true;
+
+    // If write bounds checks are disabled, the indices are assumed valid
+    if (s_jitNoWriteBoundChecks == true)
+        return true;
+
+    // Otherwise, every index must be proved to lie within the matrix
+    for (size_t i = 0; i < indices.size(); ++i)
+        if (isBoundsCheckRequired(version, pOrigExpr, i))
+            return false;
+
+    return true;
+}
+
+/***************************************************************
+* Function: JITCompiler::isBoundsCheckRequired()
+* Purpose : Test if an array access index must be bounds checked
+* Initial : agent on October 18, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+bool JITCompiler::isBoundsCheckRequired(
+    const CompVersion& version,
+    const ParamExpr* pOrigExpr,
+    size_t dim
+)
+{
+    // If the bounds check analysis proved the index safe, no check is required
+    if (version.pBoundsCheckInfo->isBoundsCheckRequired(pOrigExpr, dim, 0) == false &&
+        version.pBoundsCheckInfo->isBoundsCheckRequired(pOrigExpr, dim, 1) == false)
+        return false;
+
+    // Otherwise, a check is required unless the range of the index lies within the array
+    return version.pValueRangeInfo->isIndexInBounds(pOrigExpr, dim) == false;
+}
+
 /***************************************************************
 * Function: JITCompiler::arrayExprFallback()
 * Purpose : Compile an array-returning evaluation fallback
 * Initial : Maxime Chevalier-Boisvert on June 16, 2009
 ****************************************************************
 Revisions and bug fixes:
+
+agent on October 18, 2026
+The fallback executions are counted, with their reason.
 */
 JITCompiler::ValueVector JITCompiler::arrayExprFallback(
     Expression* pExpression,
@@ -8252,7 +10519,8 @@ JITCompiler::ValueVector JITCompiler::arrayExprFallback(
     const VarTypeMap& varTypes,
     VariableMap& varMap,
     llvm::BasicBlock* pEntryBlock,
-    llvm::BasicBlock* pExitBlock
+    llvm::BasicBlock* pExitBlock,
+    Profiler::FallbackReason reason
 )
 {
     // If we are in verbose mode, log the array expression fallback
@@ -8263,7 +10531,10 @@ JITCompiler::ValueVector JITCompiler::arrayExprFallback(
     llvm::IRBuilder<> entryBuilder(pEntryBlock);
 
     // Write the symbols used by the expression to the environment
-    writeVariables(entryBuilder, function, version, varMap, pExpression->getSymbolUses());
+    size_t numWritten = writeVariables(entryBuilder, function, version, varMap, pExpression->getSymbolUses());
+
+    // Count the executions of this fallback
+    genFallbackCount(entryBuilder, function, version, pExpression, reason, numWritten);
 
     // Create a native call to evaluate the expresssion
     LLVMValueVector evalArgs;
@@ -8355,7 +10626,7 @@ JITCompiler::ValueVector JITCompiler::arrayExprFallback(
         );
 
         // Terminate this basic block
-        singleBuilder.CreateRetVoid();
+        singleBuilder.CreateUnreachable();
     }
     else
     {
@@ -8400,6 +10671,9 @@ JITCompiler::ValueVector JITCompiler::arrayExprFallback(
 * Initial : Maxime Chevalier-Boisvert on March 25, 2009
 ****************************************************************
 Revisions and bug fixes:
+
+agent on October 18, 2026
+The fallback executions are counted, with their reason.
 */
 JITCompiler::Value JITCompiler::exprFallback(
     Expression* pExpression,
@@ -8411,7 +10685,8 @@ JITCompiler::Value JITCompiler::exprFallback(
     const VarTypeMap& varTypes,
     VariableMap& varMap,
     llvm::BasicBlock* pEntryBlock,
-    llvm::BasicBlock* pExitBlock
+    llvm::BasicBlock* pExitBlock,
+    Profiler::FallbackReason reason
 )
 {
     // If we are in verbose mode, log the expression fallback
@@ -8422,7 +10697,10 @@ JITCompiler::Value JITCompiler::exprFallback(
     llvm::IRBuilder<> entryBuilder(pEntryBlock);
 
     // Write the symbols used by the expression to the environment
-    writeVariables(entryBuilder, function, version, varMap, pExpression->getSymbolUses());
+    size_t numWritten = writeVariables(entryBuilder, function, version, varMap, pExpression->getSymbolUses());
+
+    // Count the executions of this fallback
+    genFallbackCount(entryBuilder, function, version, pExpression, reason, numWritten);
 
     // Generate the arguments for the native call
     LLVMValueVector evalArgs;
@@ -8466,6 +10744,52 @@ JITCompiler::Value JITCompiler::exprFallback(
     return Value(pValue, objectType);
 }
 
+/***************************************************************
+* Function: JITCompiler::genFallbackCount()
+* Purpose : Generate code counting the executions of a fallback site
+* Initial : agent on October 18, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+void JITCompiler::genFallbackCount(
+    llvm::IRBuilder<>& irBuilder,
+    CompFunction& function,
+    CompVersion& version,
+    const IIRNode* pNode,
+    Profiler::FallbackReason reason,
+    size_t numSyncVars
+)
+{
+    // If profiling is disabled, do nothing
+    #ifdef MCVM_DISABLE_PROFILING
+    return;
+    #endif
+
+    // Register the fallback site within the statement being compiled
+    Profiler::FallbackSite* pSite = Profiler::regFallbackSite(
+        pNode,
+        global_stmt,
+        &version,
+        function.pProgFunc->getFuncName(),
+        reason,
+        numSyncVars
+    );
+
+    // Increment the site counters in place
+    llvm::Type* pCountType = llvm::Type::getInt64Ty(*s_Context);
+    llvm::Value* pExecCountPtr = createPtrConst(&pSite->execCount, pCountType);
+    llvm::Value* pExecCount = irBuilder.CreateLoad(pExecCountPtr);
+    irBuilder.CreateStore(irBuilder.CreateAdd(pExecCount, llvm::ConstantInt::get(pCountType, 1)), pExecCountPtr);
+
+    // If variables are written to the environment, count them as well
+    if (numSyncVars != 0)
+    {
+        llvm::Value* pSyncCountPtr = createPtrConst(&pSite->syncCount, pCountType);
+        llvm::Value* pSyncCount = irBuilder.CreateLoad(pSyncCountPtr);
+        irBuilder.CreateStore(irBuilder.CreateAdd(pSyncCount, llvm::ConstantInt::get(pCountType, numSyncVars)), pSyncCountPtr);
+    }
+}
+
 /***************************************************************
 * Function: JITCompiler::getArrayValues()
 * Purpose : Read values from an array object
@@ -8526,7 +10850,7 @@ JITCompiler::ValueVector JITCompiler::getArrayValues(
         );
 
         // Terminate the basic block to keep the CFG proper
-        failBuilder.CreateRetVoid();
+        failBuilder.CreateUnreachable();
 
         // Update the entry block pointer
         pEntryBlock = pNewEntryBlock;
@@ -8572,6 +10896,129 @@ JITCompiler::ValueVector JITCompiler::getArrayValues(
     return valueVector;
 }
 
+/***************************************************************
+* Function: JITCompiler::compLibIntrinsic()
+* Purpose : Compile a library function intrinsic on real scalars
+* Initial : agent on October 18, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+llvm::Value* JITCompiler::compLibIntrinsic(
+    llvm::IRBuilder<>& irBuilder,
+    LibIntrinsic intrinsic,
+    const LLVMValueVector& arguments,
+    llvm::Function* pLLVMFunc,
+    const IIRNode* pErrorNode
+)
+{
+    // Get the float64 type and the constants used below
+    llvm::Type* pF64Type = llvm::Type::getDoubleTy(*s_Context);
+    llvm::Value* pZero = llvm::ConstantFP::get(pF64Type, 0.0);
+    llvm::Value* pOne = llvm::ConstantFP::get(pF64Type, 1.0);
+    llvm::Value* pHalf = llvm::ConstantFP::get(pF64Type, 0.5);
+    llvm::Value* pNaN = llvm::ConstantFP::get(pF64Type, std::numeric_limits<float64>::quiet_NaN());
+
+    // Get the argument values, if any
+    llvm::Value* pX = (arguments.size() > 0)? arguments[0]:NULL;
+    llvm::Value* pY = (arguments.size() > 1)? arguments[1]:NULL;
+
+    // Get the floor intrinsic, used by the rounding functions
+    llvm::Function* pFloorFunc = llvm::Intrinsic::getDeclaration(s_pModule, llvm::Intrinsic::floor, pF64Type);
+
+    // Note: the semantics below follow the library functions exactly,
+    // since the interpreter may run the same code
+    switch (intrinsic)
+    {
+        // Functions with an LLVM intrinsic
+        case INTR_ABS:
+        return irBuilder.CreateCall(llvm::Intrinsic::getDeclaration(s_pModule, llvm::Intrinsic::fabs, pF64Type), pX);
+        case INTR_EXP:
+        return irBuilder.CreateCall(llvm::Intrinsic::getDeclaration(s_pModule, llvm::Intrinsic::exp, pF64Type), pX);
+        case INTR_SIN:
+        return irBuilder.CreateCall(llvm::Intrinsic::getDeclaration(s_pModule, llvm::Intrinsic::sin, pF64Type), pX);
+        case INTR_COS:
+        return irBuilder.CreateCall(llvm::Intrinsic::getDeclaration(s_pModule, llvm::Intrinsic::cos, pF64Type), pX);
+        case INTR_FLOOR:
+        return irBuilder.CreateCall(pFloorFunc, pX);
+
+        // The sqrt intrinsic is undefined on negative values, which produce NaN
+        case INTR_SQRT:
+        {
+            llvm::Value* pSqrt = irBuilder.CreateCall(llvm::Intrinsic::getDeclaration(s_pModule, llvm::Intrinsic::sqrt, pF64Type), pX);
+            return irBuilder.CreateSelect(irBuilder.CreateFCmpOLT(pX, pZero), pNaN, pSqrt);
+        }
+
+        // The library log2 function rejects negative values
+        case INTR_LOG2:
+        {
+            // Create basic blocks for the negative and valid cases
+            llvm::BasicBlock* pFailBlock = llvm::BasicBlock::Create(*s_Context, "", pLLVMFunc);
+            llvm::BasicBlock* pPassBlock = llvm::BasicBlock::Create(*s_Context, "", pLLVMFunc);
+
+            // If the value is negative, throw an exception
+            llvm::IRBuilder<> failBuilder(pFailBlock);
+            createThrowError(failBuilder, "logarithms of negative numbers unsupported", pErrorNode);
+            failBuilder.CreateUnreachable();
+            irBuilder.CreateCondBr(irBuilder.CreateFCmpOLT(pX, pZero), pFailBlock, pPassBlock);
+
+            // Otherwise, compute the logarithm
+            irBuilder.SetInsertPoint(pPassBlock);
+            return irBuilder.CreateCall(llvm::Intrinsic::getDeclaration(s_pModule, llvm::Intrinsic::log2, pF64Type), pX);
+        }
+
+        // The ceiling is the negated floor of the negated value
+        case INTR_CEIL:
+        return irBuilder.CreateFNeg(irBuilder.CreateCall(pFloorFunc, irBuilder.CreateFNeg(pX)));
+
+        // Truncate towards zero
+        case INTR_FIX:
+        {
+            llvm::Value* pFloor = irBuilder.CreateCall(pFloorFunc, pX);
+            llvm::Value* pCeil = irBuilder.CreateFNeg(irBuilder.CreateCall(pFloorFunc, irBuilder.CreateFNeg(pX)));
+            return irBuilder.CreateSelect(irBuilder.CreateFCmpOLT(pX, pZero), pCeil, pFloor);
+        }
+
+        // Round halfway cases away from zero
+        // Note: the fraction is computed exactly, unlike floor(x + 0.5)
+        case INTR_ROUND:
+        {
+            llvm::Value* pNeg = irBuilder.CreateFCmpOLT(pX, pZero);
+            llvm::Value* pAbs = irBuilder.CreateSelect(pNeg, irBuilder.CreateFNeg(pX), pX);
+            llvm::Value* pTrunc = irBuilder.CreateCall(pFloorFunc, pAbs);
+            llvm::Value* pRoundUp = irBuilder.CreateFCmpOGE(irBuilder.CreateFSub(pAbs, pTrunc), pHalf);
+            llvm::Value* pRounded = irBuilder.CreateSelect(pRoundUp, irBuilder.CreateFAdd(pTrunc, pOne), pTrunc);
+            return irBuilder.CreateSelect(pNeg, irBuilder.CreateFNeg(pRounded), pRounded);
+        }
+
+        // Return 1 for positive values, 0 for zero, and -1 otherwise
+        case INTR_SIGN:
+        {
+            llvm::Value* pNonPos = irBuilder.CreateSelect(irBuilder.CreateFCmpOEQ(pX, pZero), pZero, llvm::ConstantFP::get(pF64Type, -1.0));
+            return irBuilder.CreateSelect(irBuilder.CreateFCmpOGT(pX, pZero), pOne, pNonPos);
+        }
+
+        // The library modulo is the floating-point remainder
+        case INTR_MOD:
+        return irBuilder.CreateFRem(pX, pY);
+
+        // Minimum and maximum, with the same NaN behavior as std::min and std::max
+        case INTR_MIN:
+        return irBuilder.CreateSelect(irBuilder.CreateFCmpOLT(pY, pX), pY, pX);
+        case INTR_MAX:
+        return irBuilder.CreateSelect(irBuilder.CreateFCmpOLT(pX, pY), pY, pX);
+
+        // Constants
+        case INTR_PI:
+        return llvm::ConstantFP::get(pF64Type, PI);
+        case INTR_EPS:
+        return llvm::ConstantFP::get(pF64Type, std::numeric_limits<float64>::epsilon());
+    }
+
+    // Unknown intrinsic
+    assert (false);
+    return NULL;
+}
+
 /***************************************************************
 * Function: JITCompiler::createThrowError()
 * Purpose : Create a call throwing a runtime error
@@ -8787,10 +11234,12 @@ llvm::Value* JITCompiler::comp_struct_obj_from_llvm_struct(
     assert (typeinfo.getObjType() == DataObject::Type::STRUCTARRAY &&
             " Generation of a struct obj need to have a struct typeinfo") ;
 
+    // The struct is created with the shape of its field set, so
+    // each field is stored at its slot, found at compile time
     auto scalar_struct = createNativeCall(
                             builder,
-                            (void*)makeScalarStructPtr,
-                            LLVMValueVector());
+                            (void*)makeShapedScalarStruct,
+                            LLVMValueVector(1, createPtrConst(typeinfo.getShape())));
 
     auto fields = typeinfo.getFields() ;
     for (auto it = std::begin(fields) ; it != std::end(fields) ; ++it) {
@@ -8802,7 +11251,6 @@ llvm::Value* JITCompiler::comp_struct_obj_from_llvm_struct(
 
         // Add the indice for the current field
         auto indice = std::distance (fields.begin(), it);
-        std::cout << "indice " << indice << std::endl ;
         gep_vec_current.push_back
             (llvm::ConstantInt::get
              (llvm::Type::getInt32Ty(*s_Context), indice)) ;
@@ -8847,21 +11295,16 @@ llvm::Value* JITCompiler::comp_struct_obj_from_llvm_struct(
                 break;
         }
 
-        // Convert the string field to a pointer to a C++ string
-        // Hint : ConstantDataArray may be useful here
-        //llvm::ConstantDataArray::getString(*s_Context,
-        //it->first.c_str()),
-        auto field_name_value = 
-            builder.CreateGlobalStringPtr(it->first) ;
-
+        // Store the field value in its slot, the slot of a field
+        // is its position in the type's field map
         LLVMValueVector make_args ;
         make_args.push_back(scalar_struct);
-        make_args.push_back(field_name_value);
+        make_args.push_back(llvm::ConstantInt::get(llvm::Type::getInt64Ty(*s_Context), indice));
         make_args.push_back(field_value);
 
         createNativeCall(
                 builder,
-                (void*)insertInScalarStruct,
+                (void*)setScalarStructSlot,
                 make_args
                 );
     }
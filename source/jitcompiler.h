@@ -32,6 +32,7 @@
 #include <llvm/IRBuilder.h>
 #include <llvm/Support/TargetSelect.h>
 #include "configmanager.h"
+#include "profiling.h"
 #include "functions.h"
 #include "exprstmt.h"
 #include "ifelsestmt.h"
@@ -45,6 +46,8 @@
 #include "analysis_metrics.h"
 #include "analysis_boundscheck.h"
 #include "analysis_copyplacement.h"
+#include "analysis_escape.h"
+#include "analysis_valuerange.h"
 #include "structobj.h"
 
 /***************************************************************
@@ -131,6 +134,34 @@ public:
 		bool noThrows = false		
 	);
 	
+	// Library function intrinsics, compiled inline on real scalars
+	enum LibIntrinsic
+	{
+		INTR_ABS,
+		INTR_SQRT,
+		INTR_EXP,
+		INTR_LOG2,
+		INTR_SIN,
+		INTR_COS,
+		INTR_FLOOR,
+		INTR_CEIL,
+		INTR_ROUND,
+		INTR_FIX,
+		INTR_SIGN,
+		INTR_MOD,
+		INTR_MIN,
+		INTR_MAX,
+		INTR_PI,
+		INTR_EPS
+	};
+	
+	// Method to register a library function compiled inline on real scalars
+	static void regLibraryIntrinsic(
+		const LibFunction* pLibFunc,
+		size_t numArgs,
+		LibIntrinsic intrinsic
+	);
+	
 	// Method to compile a program function given argument types
 	static void compileFunction(ProgFunction* pFunction, const TypeSetString& argTypeStr);
 	
@@ -147,9 +178,33 @@ public:
 	static ConfigVar s_jitNoReadBoundChecks;
 	static ConfigVar s_jitNoWriteBoundChecks;
 
+	// Config variable to enable/disable loop versioning on hoisted bounds checks
+	static ConfigVar s_jitLoopVersioning;
+
+	// Config variables to control the inlining of small functions into their callers
+	static ConfigVar s_jitInlineCalls;
+	static ConfigVar s_jitInlineMaxStmts;
+
+	// Config variable to enable/disable speculation on type feedback
+	static ConfigVar s_jitTypeSpeculation;
+
+	// Config variable to enable/disable keeping small fixed-size matrices in registers
+	static ConfigVar s_jitSmallMatrices;
+
+	// Config variable to enable/disable replacing element-wise loops by array operations
+	static ConfigVar s_jitLoopIdioms;
+
+	// Config variables to enable/disable running parfor loops, or all
+	// loops found to be independent, on the worker threads
+	static ConfigVar s_jitParallelLoops;
+	static ConfigVar s_jitAutoParallel;
+
 	// Config variable for enabling or disabling copy optimizations	
 	static ConfigVar s_jitCopyEnableVar;
 
+	// Config variable to enable/disable freeing of dead temporaries
+	static ConfigVar s_jitFreeTempsVar;
+
     // Config variables to enable/disable on-stack replacement
     static ConfigVar s_jitOsrEnableVar;
     static ConfigVar s_jitOsrStrategyVar;
@@ -190,6 +245,64 @@ private:
 	
 	// Function set type definition
 	typedef std::set<Function*, std::less<Function*>, gc_allocator<Function> > FunctionSet;
+	
+	// Index of a guarded array access, as a symbol plus a constant offset
+	struct GuardIndex
+	{
+		// Index symbol (the loop index for affine indices, NULL for constants)
+		SymbolExpr* pSymbol;
+		
+		// Constant offset added to the symbol value
+		int64 offset;
+	};
+	
+	// Array access whose bounds checks are hoisted into a loop guard
+	struct GuardAccess
+	{
+		// Parameterized expression performing the access
+		ParamExpr* pExpr;
+		
+		// Array symbol and its object type
+		SymbolExpr* pArray;
+		DataObject::Type arrayType;
+		
+		// Indices of the access
+		std::vector<GuardIndex> indices;
+		
+		// Indicates that the access is an indexed assignment
+		bool isWrite;
+	};
+	
+	// Loop guard structure, describing the checks hoisted out of a loop
+	struct LoopGuard
+	{
+		// Loop index, end value and step value variables (no step variable for constant steps)
+		SymbolExpr* pIndexVar;
+		SymbolExpr* pEndVar;
+		SymbolExpr* pStepVar;
+		
+		// Loop variable copied from the index at the start of the body (NULL if none)
+		SymbolExpr* pLoopVar;
+		
+		// Guarded array accesses
+		std::vector<GuardAccess> accesses;
+		
+		// Arrays written to by the guarded accesses
+		Expression::SymbolSet writtenArrays;
+	};
+	
+	// Values loaded before a versioned loop for one of its array reads
+	struct HoistedLoads
+	{
+		// Element array pointer
+		llvm::Value* pDataPtr;
+		
+		// Size of the first dimension (NULL for linear indexing)
+		llvm::Value* pRowCount;
+	};
+	
+	// Hoisted load map type definition
+	typedef std::map<const ParamExpr*, HoistedLoads> HoistedLoadMap;
 		
 	// Native function structure
 	struct NativeFunc
@@ -245,8 +358,8 @@ private:
 	//typedef std::map<LibFuncKey, void*, std::less<LibFuncKey>, gc_allocator<std::pair<LibFuncKey, void*> > > LibFuncMap;
 	typedef std::map<LibFuncKey, void*, std::less<LibFuncKey>> LibFuncMap;
 	
-	// Compiled program function pointer type definition
-	typedef void (*COMP_FUNC_PTR)(byte* pInStruct, byte* pOutStruct);
+	// Library function intrinsic map type definition, keyed by function and argument count
+	typedef std::map<std::pair<const LibFunction*, size_t>, LibIntrinsic> LibIntrinsicMap;
 	
 	// Compiled wrapper function pointer type definition
 	typedef ArrayObj* (*WRAPPER_FUNC_PTR)(ArrayObj* pArgs, int64 outArgCount);
@@ -257,12 +370,10 @@ private:
 		CompVersion():
 			pOutStructType(NULL),
 			pEnvObject(NULL),
-			pInStruct(NULL),
-			pOutStruct(NULL),
-			inStructSize(0),
-		       	outStructSize(0),
 			pFuncPtr(NULL),
-			pWrapperPtr(NULL)
+			pWrapperPtr(NULL),
+			needsRecompile(false),
+			numCompiles(0)
 	      	{}
 		
 		// Input argument types
@@ -277,6 +388,9 @@ private:
 		// Type inference information
 		const TypeInferInfo* pTypeInferInfo;
 		
+		// Type inference information without speculated types
+		const TypeInferInfo* pStaticTypeInfo;
+		
 		// Code metrics information
 		const MetricsInfo* pMetricsInfo;
 		
@@ -286,18 +400,31 @@ private:
 		// Array copy analysis Information 
 		const ArrayCopyAnalysisInfo* pArrayCopyInfo;
 		
+		// Temporary escape analysis information
+		const EscapeInfo* pEscapeInfo;
+		
+		// Value range analysis information
+		const ValueRangeInfo* pValueRangeInfo;
+		
+		// Values produced by the definitions of non-escaping temporaries
+		std::map<const SymbolExpr*, llvm::Value*> tempValueMap;
+		
+		// Array accesses whose bounds are checked by the guard of the versioned loop being compiled
+		std::set<const ParamExpr*> hoistedChecks;
+		
+		// Loads hoisted out of the versioned loop being compiled
+		HoistedLoadMap hoistedLoads;
+		
 		// Input argument storage modes and object types
+		// NOTE: the arguments are passed directly, in these storage modes
 		LLVMTypeVector inArgStoreModes;
 		std::vector<DataObject::Type> inArgObjTypes;
 
-		// Type of the input data structure
-		llvm::StructType* pInStructType;
-		
 		// Output argument storage modes and object types
 		LLVMTypeVector outArgStoreModes;
 		std::vector<DataObject::Type> outArgObjTypes;
 		
-		// Type of the return data structure
+		// Type of the return value structure
 		llvm::StructType* pOutStructType;
 		
 		// Entry basic block for the function
@@ -306,14 +433,6 @@ private:
 		// Environment object pointer (NULL if not used)
 		llvm::Value* pEnvObject;
 		
-		// Call in/out data structs (NULL if not used)
-		llvm::Value* pInStruct;
-		llvm::Value* pOutStruct;
-		
-		// Maximum call in/out data struct sizes encountered
-		size_t inStructSize;
-		size_t outStructSize;
-		
 		// LLVM function object
 		llvm::Function* pLLVMFunc;
 		
@@ -321,10 +440,19 @@ private:
 		llvm::Function* pLLVMWrapper;
 
 		// Pointer to the compiled program function code
-		COMP_FUNC_PTR pFuncPtr;
+		void* pFuncPtr;
 		
 		// Pointer to the compiled wrapper function code
 		WRAPPER_FUNC_PTR pWrapperPtr;
+		
+		// Points where failed type guards exit the function
+		BranchList deoptPoints;
+		
+		// Indicates that type feedback changed since compilation
+		bool needsRecompile;
+		
+		// Number of times this version was compiled
+		size_t numCompiles;
 	};
 	
 	// Method to call a JIT-compiled version of a function
@@ -385,28 +513,12 @@ private:
 	static llvm::Value* createICmpSLEInstr(llvm::IRBuilder<>& builder, llvm::Value* pLVal, llvm::Value* pRVal) { return builder.CreateICmpSLE(pLVal, pRVal); }
 	static llvm::Value* createFCmpOLEInstr(llvm::IRBuilder<>& builder, llvm::Value* pLVal, llvm::Value* pRVal) { return builder.CreateFCmpOLE(pLVal, pRVal); }
 	
-	// Method to handle exceptions during function calls
-	static void callExceptHandler(
-		ProgFunction* pFunction,
-		COMP_FUNC_PTR pFuncPtr,
-		byte* pInStruct,
-		byte* pOutStruct
-	);
-	
 	// Method to create/get the calling environment for a function
 	static llvm::Value* getCallEnv(
 		CompFunction& function,
 		CompVersion& version
 	);
 	
-	// Method to create/get the call data structures for a function
-	static LLVMValuePair getCallStructs(
-		CompFunction& callerFunction,
-		CompVersion& callerVersion,
-		CompFunction& calleeFunction,
-		CompVersion& calleeVersion
-	);
-	
 	// Method to match branching point variable mappings
 	static VariableMap matchBranchPoints(
 		CompFunction& function,
@@ -418,7 +530,7 @@ private:
 	);
 	
 	// Method to write variables to the environment
-	static void writeVariables(
+	static size_t writeVariables(
 		llvm::IRBuilder<>& irBuilder,
 		CompFunction& function,
 		CompVersion& version,
@@ -472,6 +584,37 @@ private:
 		DataObject::Type& objType
 	);
 	
+	// Maximum number of rows and columns of small fixed-size matrices
+	static const size_t SMALL_MAT_MAX_DIM = 4;
+	
+	// Method to get the size of a small fixed-size matrix type
+	static bool getSmallMatSize(
+		const TypeInfo& typeInfo,
+		size_t& numRows,
+		size_t& numCols
+	);
+	
+	// Method to get the storage mode for a small fixed-size matrix
+	static llvm::Type* getSmallMatMode(
+		size_t numRows,
+		size_t numCols
+	);
+	
+	// Method to test if a storage mode is that of a small fixed-size matrix
+	static bool isSmallMatMode(
+		const llvm::Type* mode,
+		size_t* pNumRows = NULL,
+		size_t* pNumCols = NULL
+	);
+	
+	// Method to get the storage mode for the value of an expression
+	static llvm::Type* getExprStorageMode(
+		Expression* pExpr,
+		const CompVersion& version,
+		const VarTypeMap& varTypes,
+		DataObject::Type& objType
+	);
+	
 	// Method to get the widest storage mode among two options
 	static llvm::Type* widestStorageMode(
 		llvm::Type* modeA,
@@ -488,6 +631,32 @@ private:
                 const TypeInfo* current_typeinfo = nullptr
 	);
 		
+	// Method to box a small fixed-size matrix into a matrix object
+	static llvm::Value* boxSmallMatrix(
+		llvm::IRBuilder<>& irBuilder,
+		llvm::Value* pMatValue
+	);
+	
+	// Method to unbox a matrix object into a small fixed-size matrix
+	static llvm::Value* unboxSmallMatrix(
+		llvm::IRBuilder<>& irBuilder,
+		llvm::Value* pMatObject,
+		const llvm::Type* matMode
+	);
+	
+	// Function to create a matrix object to box a small matrix into
+	static DataObject* makeSmallMatrix(
+		int64 numRows,
+		int64 numCols
+	);
+	
+	// Function to get the elements of a matrix object unboxed as a small matrix
+	static float64* getSmallMatData(
+		DataObject* pObject,
+		int64 numRows,
+		int64 numCols
+	);
+	
 	// Method to compile a call wrapper function
 	static void compWrapperFunc(
 		CompFunction& function,
@@ -545,6 +714,34 @@ private:
     Value rightVal
     );
 
+	// Method to compile a guard on a speculated type
+	static Value compTypeGuard(
+		AssignStmt* pAssignStmt,
+		const TypeInfo& specType,
+		const Value& value,
+		CompFunction& function,
+		CompVersion& version,
+		const Expression::SymbolSet& liveVars,
+		VariableMap& varMap,
+		llvm::IRBuilder<>& builder
+	);
+	
+	// Function to record the type of a value for type feedback
+	static void recordTypeFeedback(
+		CompVersion* pVersion,
+		const Expression* pExpr,
+		const DataObject* pObject
+	);
+	
+	// Function to resume execution in the interpreter after a failed guard
+	static void deoptimize(
+		CompVersion* pVersion,
+		const StmtSequence* pFuncBody,
+		const AssignStmt* pAssignStmt,
+		DataObject* pValue,
+		Environment* pEnv
+	);
+
 	// Method to compile an if-else statement
 	static llvm::BasicBlock* compIfElseStmt(
 		IfElseStmt* pIfStmt,
@@ -567,6 +764,42 @@ private:
 		BranchList& returnPoints
 	);
 	
+	// Method to compile the test, body and incrementation of a loop
+	static void compLoopIterations(
+		LoopStmt* pLoopStmt,
+		CompFunction& function,
+		CompVersion& version,
+		BranchPoint& entryPoint,
+		BranchList& breakPoints,
+		BranchList& returnPoints
+	);
+	
+	// Method to find the array accesses of a loop whose bounds checks can be hoisted
+	static bool findLoopGuard(
+		LoopStmt* pLoopStmt,
+		const TypeInferInfo* pTypeInferInfo,
+		const VarTypeMap& loopVarTypes,
+		const VariableMap& entryVarMap,
+		LoopGuard& guard
+	);
+	
+	// Method to express an array index as a guard index
+	static bool getGuardIndex(
+		Expression* pIndexExpr,
+		const LoopGuard& guard,
+		const Expression::SymbolSet& bodyDefs,
+		const VariableMap& entryVarMap,
+		GuardIndex& index
+	);
+	
+	// Method to compile the guard selecting the unchecked version of a loop
+	static llvm::Value* compLoopGuard(
+		llvm::IRBuilder<>& builder,
+		const LoopGuard& guard,
+		const VariableMap& entryVarMap,
+		HoistedLoadMap& hoistedLoads
+	);
+	
 	// Method to compile an expression
 	static Value compExpression(
 		Expression* pExpression,
@@ -577,7 +810,8 @@ private:
 		const VarTypeMap& varTypes,
 		VariableMap& varMap,
 		llvm::BasicBlock* pEntryBlock,
-		llvm::BasicBlock* pExitBlock
+		llvm::BasicBlock* pExitBlock,
+		bool allowSmallMat = false
 	);
 
 	// Method to compile a unary expression
@@ -606,6 +840,19 @@ private:
 		llvm::BasicBlock* pExitBlock
 	);
 	
+	// Method to compile an operation on small fixed-size matrices
+	static Value compSmallMatOp(
+		Expression* pExpression,
+		CompFunction& function,
+		CompVersion& version,
+		const Expression::SymbolSet& liveVars,
+		const VarDefMap& reachDefs,
+		const VarTypeMap& varTypes,
+		VariableMap& varMap,
+		llvm::BasicBlock* pEntryBlock,
+		llvm::BasicBlock* pExitBlock
+	);
+	
 	// Method to generate code for binary operations
 	static Value compBinaryOp(
 		Expression* pLeftExpr,
@@ -756,6 +1003,40 @@ private:
 		llvm::BasicBlock* pExitBlock
 	);
 	
+	// Method to generate code for an element read from a small matrix
+	static llvm::Value* compSmallMatRead(
+		llvm::IRBuilder<>& builder,
+		llvm::Value* pMatValue,
+		const LLVMValueVector& indices,
+		ParamExpr* pOrigExpr,
+		CompVersion& version
+	);
+	
+	// Method to generate code for an element write into a small matrix
+	static llvm::Value* compSmallMatWrite(
+		llvm::IRBuilder<>& builder,
+		llvm::Value* pMatValue,
+		llvm::Value* pElemValue,
+		const LLVMValueVector& indices,
+		ParamExpr* pOrigExpr,
+		CompVersion& version
+	);
+	
+	// Method to test if a small matrix element write can be done in registers
+	static bool isSmallMatWritable(
+		llvm::Value* pMatValue,
+		const LLVMValueVector& indices,
+		ParamExpr* pOrigExpr,
+		CompVersion& version
+	);
+	
+	// Method to test if an array access index must be bounds checked
+	static bool isBoundsCheckRequired(
+		const CompVersion& version,
+		const ParamExpr* pOrigExpr,
+		size_t dim
+	);
+	
 	// Method to generate fallback code for an array-returning expression evaluation
 	static ValueVector arrayExprFallback(
 		Expression* pExpression,
@@ -768,7 +1049,8 @@ private:
 		const VarTypeMap& varTypes,
 		VariableMap& varMap,
 		llvm::BasicBlock* pEntryBlock,
-		llvm::BasicBlock* pExitBlock
+		llvm::BasicBlock* pExitBlock,
+		Profiler::FallbackReason reason
 	);
 	
 	// Method to generate fallback code for an expression evaluation
@@ -782,7 +1064,18 @@ private:
 		const VarTypeMap& varTypes,
 		VariableMap& varMap,
 		llvm::BasicBlock* pEntryBlock,
-		llvm::BasicBlock* pExitBlock
+		llvm::BasicBlock* pExitBlock,
+		Profiler::FallbackReason reason
+	);
+	
+	// Method to generate code counting the executions of a fallback site
+	static void genFallbackCount(
+		llvm::IRBuilder<>& irBuilder,
+		CompFunction& function,
+		CompVersion& version,
+		const IIRNode* pNode,
+		Profiler::FallbackReason reason,
+		size_t numSyncVars
 	);
 	
 	// Method to read values from an array object
@@ -799,6 +1092,15 @@ private:
 		llvm::BasicBlock* pExitBlock
 	);
 	
+	// Method to compile a library function intrinsic on real scalars
+	static llvm::Value* compLibIntrinsic(
+		llvm::IRBuilder<>& irBuilder,
+		LibIntrinsic intrinsic,
+		const LLVMValueVector& arguments,
+		llvm::Function* pLLVMFunc,
+		const IIRNode* pErrorNode
+	);
+	
 	// Method to create a call throwing a runtime error
 	static void createThrowError(
 		llvm::IRBuilder<>& irBuilder,
@@ -853,6 +1155,14 @@ private:
 		const CopyInfo& cpInfo
 	);
 	
+	// Method to free the temporaries that die at a statement
+	static void genTempFrees(
+		llvm::IRBuilder<>& irBuilder,
+		CompVersion& version,
+		VariableMap& varMap,
+		const Statement* pStmt
+	);
+	
 	// Method to generate copy code at a loop's header
 	static llvm::BasicBlock* genLoopHeaderCopy(
 		llvm::BasicBlock* curBlock,
@@ -904,6 +1214,9 @@ private:
 	// Map of signatures to optimized library functions
 	static LibFuncMap s_libFuncMap;
 	
+	// Map of library functions compiled inline on real scalars
+	static LibIntrinsicMap s_libIntrinsicMap;
+	
 	// Map of program functions to function objects
 	static FunctionMap s_functionMap;
 
@@ -41,6 +41,9 @@ ForStmt* ForStmt::copy() const
 * Initial : Maxime Chevalier-Boisvert on November 8, 2008
 ****************************************************************
 Revisions and bug fixes:
+
+agent on October 18, 2026
+Print parfor loops with the "parfor" keyword.
 */
 std::string ForStmt::toString() const
 {
@@ -48,7 +51,7 @@ std::string ForStmt::toString() const
 	std::string output;
 	
 	// Add the "for" keyword and the assignment statement to the string
-	output += "for " + m_pAssignStmt->toString() + "\n";
+	output += (isParallel()? "parfor ":"for ") + m_pAssignStmt->toString() + "\n";
 	
 	// Indent and add the loop body text
 	output += indentText(m_pLoopBody->toString());
@@ -55,6 +55,7 @@ public:
 
     bool isOutermost() const  { return m_annotations & OUTERMOST; }
     bool isInnermost() const  { return m_annotations & INNERMOST; }
+    bool isParallel() const   { return m_annotations & PARALLEL; }
     
 private:
 
@@ -165,6 +166,7 @@ public:
 
     bool isOutermost() const  { return m_annotations & OUTERMOST; }
     bool isInnermost() const  { return m_annotations & INNERMOST; }
+    bool isParallel() const   { return m_annotations & PARALLEL; }
 
 	
 private:
@@ -29,6 +29,10 @@
 #include "parser.h"
 #include "utility.h"
 #include "client.h"
+#include "bufferpool.h"
+#include "typefeedback.h"
+#include "gcmanager.h"
+#include "workerpool.h"
 #include "hotspot/profiler.h"
 
 #ifdef MCVM_USE_JIT
@@ -58,9 +62,27 @@ int main(int argc, char** argv)
 	Profiler::initialize();
   hotspot::Profiler::registerConfigVars();
 
+	// Register the frontend client config variables
+	Client::registerConfigVars();
+
+	// Register the buffer pool config variables
+	BufferPool::registerConfigVars();
+
+	// Register the type feedback config variables
+	TypeFeedback::registerConfigVars();
+
+	// Register the garbage collector config variables
+	GCManager::registerConfigVars();
+
+	// Register the worker pool config variables
+	WorkerPool::registerConfigVars();
+
 	// Parse the command-line arguments
 	ConfigManager::parseCmdArgs(argc, argv);
 
+	// Apply the garbage collector settings
+	GCManager::initialize();
+
     // OSR depends on the osr-flag being enabled, try it 
     // after parsing the command line arguments
 #ifdef MCVM_USE_JIT
@@ -84,6 +106,10 @@ int main(int argc, char** argv)
 		std::cout << "WARNING: could not change to specified starting directory" << std::endl;
 	}
 
+	// If requested, have the frontend parse the local M-files in the background
+	if (Client::s_prefetchDirVar.getBoolValue() == true)
+		Client::prefetchDirectory(getWorkingDir());
+
 	// If the target file name was set
 	if (ConfigManager::getFileName() != "")
 	{
@@ -116,6 +142,9 @@ int main(int argc, char** argv)
     runREPLoop();
 	}
 	
+	// Shut down the profiler
+	Profiler::shutdown();
+	
 	// Shut down the JIT compiler
 #ifdef MCVM_USE_JIT
 	JITCompiler::shutdown();
@@ -0,0 +1,660 @@
+// =========================================================================== //
+//                                                                             //
+// Copyright 2026 agent.                                                       //
+//                                                                             //
+//   Licensed under the Apache License, Version 2.0 (the "License");           //
+//   you may not use this file except in compliance with the License.          //
+//   You may obtain a copy of the License at                                   //
+//                                                                             //
+//       http://www.apache.org/licenses/LICENSE-2.0                            //
+//                                                                             //
+//   Unless required by applicable law or agreed to in writing, software       //
+//   distributed under the License is distributed on an "AS IS" BASIS,         //
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  //
+//   See the License for the specific language governing permissions and       //
+//  limitations under the License.                                             //
+//                                                                             //
+// =========================================================================== //
+
+// Header files
+#include <cstring>
+#include <set>
+#include <sys/mman.h>
+#include <unistd.h>
+#include <gc/gc.h>
+#include "matfile.h"
+#include "runtimebase.h"
+#include "interpreter.h"
+#include "chararrayobj.h"
+#include "cellarrayobj.h"
+#include "structobj.h"
+#include "rangeobj.h"
+#include "utility.h"
+
+// File signature and format version
+const char MatFile::MAGIC[8] = "MCVMMAT";
+const uint32 MatFile::VERSION = 1;
+
+// Alignment of raw element data within the file
+const size_t MatFile::DATA_ALIGN = 16;
+
+// Minimum data size for memory-mapped loading (1 MB)
+const size_t MatFile::MAP_THRESHOLD = 1 << 20;
+
+/***************************************************************
+* Function: MatFile::isMatFile()
+* Purpose : Test if a file is a binary variable file
+* Initial : agent on October 18, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+bool MatFile::isMatFile(const std::string& fileName)
+{
+	// Attempt to open the file
+	FILE* pFile = fopen(fileName.c_str(), "rb");
+
+	// If the file could not be opened, it is not a variable file
+	if (pFile == NULL)
+		return false;
+
+	// Read the file signature
+	char magic[sizeof(MAGIC)];
+	size_t numRead = fread(magic, 1, sizeof(magic), pFile);
+
+	// Close the file
+	fclose(pFile);
+
+	// Test if the signature matches
+	return (numRead == sizeof(MAGIC) && memcmp(magic, MAGIC, sizeof(MAGIC)) == 0);
+}
+
+/***************************************************************
+* Function: MatFile::saveFile()
+* Purpose : Save variables to a binary file
+* Initial : agent on October 18, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+void MatFile::saveFile(const std::string& fileName, const VarVector& variables)
+{
+	// Attempt to open the output file
+	FILE* pFile = fopen(fileName.c_str(), "wb");
+
+	// Ensure the file was opened successfully
+	if (pFile == NULL)
+		throw RunError("could not open output file: \"" + fileName + "\"");
+
+	try
+	{
+		// Write the file signature and format version
+		writeBytes(pFile, MAGIC, sizeof(MAGIC));
+		writeBytes(pFile, &VERSION, sizeof(VERSION));
+
+		// Write the variable count
+		uint32 varCount = variables.size();
+		writeBytes(pFile, &varCount, sizeof(varCount));
+
+		// For each variable
+		for (VarVector::const_iterator itr = variables.begin(); itr != variables.end(); ++itr)
+		{
+			// Write the variable name
+			writeString(pFile, itr->first);
+
+			// Write the variable value
+			writeObject(pFile, itr->second);
+		}
+	}
+
+	// If an error occurs
+	catch (RunError error)
+	{
+		// Close the file and rethrow the error
+		fclose(pFile);
+		throw error;
+	}
+
+	// Close the output file
+	if (fclose(pFile) != 0)
+		throw RunError("could not write output file: \"" + fileName + "\"");
+}
+
+/***************************************************************
+* Function: MatFile::loadFile()
+* Purpose : Load variables from a binary file
+* Initial : agent on October 18, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+MatFile::VarVector MatFile::loadFile(const std::string& fileName)
+{
+	// Attempt to open the input file
+	FILE* pFile = fopen(fileName.c_str(), "rb");
+
+	// Ensure the file was opened successfully
+	if (pFile == NULL)
+		throw RunError("could not read input file: \"" + fileName + "\"");
+
+	// Declare a vector for the loaded variables
+	VarVector variables;
+
+	try
+	{
+		// Read and validate the file signature
+		char magic[sizeof(MAGIC)];
+		readBytes(pFile, magic, sizeof(magic));
+		if (memcmp(magic, MAGIC, sizeof(MAGIC)) != 0)
+			throw RunError("not a binary variable file");
+
+		// Read and validate the format version
+		uint32 version;
+		readBytes(pFile, &version, sizeof(version));
+		if (version != VERSION)
+			throw RunError("unsupported variable file version: " + ::toString(version));
+
+		// Read the variable count
+		uint32 varCount;
+		readBytes(pFile, &varCount, sizeof(varCount));
+
+		// For each variable
+		for (uint32 i = 0; i < varCount; ++i)
+		{
+			// Read the variable name
+			std::string name = readString(pFile);
+
+			// Read the variable value
+			DataObject* pObject = readObject(pFile);
+
+			// Add the variable to the list
+			variables.push_back(Variable(name, pObject));
+		}
+	}
+
+	// If an error occurs
+	catch (RunError error)
+	{
+		// Close the file and rethrow the error
+		fclose(pFile);
+		error.addInfo("error reading variable file \"" + fileName + "\"");
+		throw error;
+	}
+
+	// Close the input file
+	// Note that memory mappings remain valid after the file is closed
+	fclose(pFile);
+
+	// Return the loaded variables
+	return variables;
+}
+
+/***************************************************************
+* Function: MatFile::writeObject()
+* Purpose : Write an object record
+* Initial : agent on October 18, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+void MatFile::writeObject(FILE* pFile, const DataObject* pObject)
+{
+	// Get the object type (null objects are stored as unknown)
+	DataObject::Type objType = pObject? pObject->getType():DataObject::Type::UNKNOWN;
+
+	// Write the object type
+	uint32 typeId = (uint32)objType;
+	writeBytes(pFile, &typeId, sizeof(typeId));
+
+	// If this is a null object, stop here
+	if (pObject == NULL)
+		return;
+
+	// If this is a range object
+	if (objType == DataObject::Type::RANGE)
+	{
+		// Write the start, step and end values
+		const RangeObj* pRange = (const RangeObj*)pObject;
+		float64 values[3] = { pRange->getStartVal(), pRange->getStepVal(), pRange->getEndVal() };
+		writeBytes(pFile, values, sizeof(values));
+		return;
+	}
+
+	// Ensure the object is a matrix
+	if (!pObject->isMatrixObj())
+		throw RunError("cannot save objects of type \"" + pObject->getTypeName() + "\"");
+
+	// Get the matrix dimensions
+	const DimVector& dims = ((const BaseMatrixObj*)pObject)->getSize();
+
+	// Write the number of dimensions and the dimensions
+	uint32 numDims = dims.size();
+	writeBytes(pFile, &numDims, sizeof(numDims));
+	for (size_t i = 0; i < dims.size(); ++i)
+	{
+		uint64 dim = dims[i];
+		writeBytes(pFile, &dim, sizeof(dim));
+	}
+
+	// Switch on the object type
+	switch (objType)
+	{
+		// Numerical matrices are written as raw column-major data
+		case DataObject::Type::MATRIX_F32:
+		writeElements(pFile, (const MatrixF32Obj*)pObject);
+		break;
+
+		case DataObject::Type::MATRIX_F64:
+		writeElements(pFile, (const MatrixF64Obj*)pObject);
+		break;
+
+		case DataObject::Type::MATRIX_C128:
+		writeElements(pFile, (const MatrixC128Obj*)pObject);
+		break;
+
+		case DataObject::Type::LOGICALARRAY:
+		writeElements(pFile, (const LogicalArrayObj*)pObject);
+		break;
+
+		case DataObject::Type::CHARARRAY:
+		writeElements(pFile, (const CharArrayObj*)pObject);
+		break;
+
+		// Cell arrays
+		case DataObject::Type::CELLARRAY:
+		{
+			// Get a typed pointer to the cell array
+			const CellArrayObj* pCellArray = (const CellArrayObj*)pObject;
+
+			// Write each element, in column-major order
+			// Note: packed elements are boxed one at a time
+			for (size_t i = 1; i <= pCellArray->getNumElems(); ++i)
+				writeObject(pFile, pCellArray->getElem1D(i));
+		}
+		break;
+
+		// Struct arrays
+		case DataObject::Type::STRUCTARRAY:
+		{
+			// Get a typed pointer to the struct array
+			const StructArrayObj* pStructArray = (const StructArrayObj*)pObject;
+
+			// Collect the field names of the array and of each element
+			std::set<std::string> fields(pStructArray->m_Fields.begin(), pStructArray->m_Fields.end());
+			for (size_t i = 0; i < pStructArray->getNumElems(); ++i)
+			{
+				const ScalarStruct* pScalar = pStructArray->getElements()[i];
+				if (pScalar == NULL) continue;
+				for (ScalarStruct::const_iterator itr = pScalar->begin(); itr != pScalar->end(); ++itr)
+					fields.insert(itr->first);
+			}
+
+			// Write the field names
+			uint32 numFields = fields.size();
+			writeBytes(pFile, &numFields, sizeof(numFields));
+			for (std::set<std::string>::const_iterator itr = fields.begin(); itr != fields.end(); ++itr)
+				writeString(pFile, *itr);
+
+			// For each element of the struct array
+			for (size_t i = 0; i < pStructArray->getNumElems(); ++i)
+			{
+				// Write a flag indicating if the element is present
+				const ScalarStruct* pScalar = pStructArray->getElements()[i];
+				uint8 present = (pScalar != NULL);
+				writeBytes(pFile, &present, sizeof(present));
+
+				// If the element is missing, move to the next one
+				if (pScalar == NULL)
+					continue;
+
+				// Write the value of each field, in field order
+				for (std::set<std::string>::const_iterator itr = fields.begin(); itr != fields.end(); ++itr)
+				{
+					ScalarStruct::const_iterator fieldItr = pScalar->find(*itr);
+					writeObject(pFile, (fieldItr != pScalar->end())? fieldItr->second:NULL);
+				}
+			}
+		}
+		break;
+
+		// Other matrix types are not supported
+		default:
+		throw RunError("cannot save objects of type \"" + pObject->getTypeName() + "\"");
+	}
+}
+
+/***************************************************************
+* Function: MatFile::writeElements()
+* Purpose : Write the raw elements of a matrix
+* Initial : agent on October 18, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+template <class ScalarType> void MatFile::writeElements(FILE* pFile, const MatrixObj<ScalarType>* pMatrix)
+{
+	// Write the data size in bytes
+	uint64 dataSize = pMatrix->getNumElems() * sizeof(ScalarType);
+	writeBytes(pFile, &dataSize, sizeof(dataSize));
+
+	// Align the data so that it can be mapped directly
+	writePadding(pFile);
+
+	// Write the matrix elements
+	writeBytes(pFile, pMatrix->getElements(), dataSize);
+}
+
+/***************************************************************
+* Function: MatFile::readObject()
+* Purpose : Read an object record
+* Initial : agent on October 18, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+DataObject* MatFile::readObject(FILE* pFile)
+{
+	// Read the object type
+	uint32 typeId;
+	readBytes(pFile, &typeId, sizeof(typeId));
+	DataObject::Type objType = (DataObject::Type)typeId;
+
+	// If this is a null object, return early
+	if (objType == DataObject::Type::UNKNOWN)
+		return NULL;
+
+	// If this is a range object
+	if (objType == DataObject::Type::RANGE)
+	{
+		// Read the start, step and end values
+		float64 values[3];
+		readBytes(pFile, values, sizeof(values));
+		return new RangeObj(values[0], values[1], values[2]);
+	}
+
+	// Read the matrix dimensions
+	uint32 numDims;
+	readBytes(pFile, &numDims, sizeof(numDims));
+	if (numDims < 2)
+		throw RunError("invalid matrix dimension count");
+	DimVector dims(numDims);
+	for (size_t i = 0; i < numDims; ++i)
+	{
+		uint64 dim;
+		readBytes(pFile, &dim, sizeof(dim));
+		dims[i] = dim;
+	}
+
+	// Switch on the object type
+	switch (objType)
+	{
+		// Numerical matrices are read (or mapped) as raw column-major data
+		case DataObject::Type::MATRIX_F32:
+		return readElements(pFile, new MatrixF32Obj(), dims);
+
+		case DataObject::Type::MATRIX_F64:
+		return readElements(pFile, new MatrixF64Obj(), dims);
+
+		case DataObject::Type::MATRIX_C128:
+		return readElements(pFile, new MatrixC128Obj(), dims);
+
+		case DataObject::Type::LOGICALARRAY:
+		return readElements(pFile, new LogicalArrayObj(), dims);
+
+		case DataObject::Type::CHARARRAY:
+		return readElements<char>(pFile, new CharArrayObj(), dims);
+
+		// Cell arrays
+		case DataObject::Type::CELLARRAY:
+		{
+			// Create a cell array of the given size
+			CellArrayObj* pCellArray = new CellArrayObj();
+			pCellArray->m_size = dims;
+			pCellArray->allocMatrix();
+
+			// Read each element, in column-major order
+			for (size_t i = 0; i < pCellArray->m_numElements; ++i)
+				pCellArray->m_pElements[i] = readObject(pFile);
+
+			// Pack the elements, if possible
+			if (Interpreter::s_cellPacking.getBoolValue())
+				PackedCells::pack(pCellArray);
+
+			// Return the cell array
+			return pCellArray;
+		}
+
+		// Struct arrays
+		case DataObject::Type::STRUCTARRAY:
+		{
+			// Read the field names
+			uint32 numFields;
+			readBytes(pFile, &numFields, sizeof(numFields));
+			std::vector<std::string> fields(numFields);
+			for (size_t i = 0; i < numFields; ++i)
+				fields[i] = readString(pFile);
+
+			// Create a struct array of the given size
+			StructArrayObj* pStructArray = new StructArrayObj();
+			pStructArray->m_size = dims;
+			pStructArray->allocMatrix();
+			pStructArray->m_Fields.insert(fields.begin(), fields.end());
+
+			// For each element of the struct array
+			for (size_t i = 0; i < pStructArray->m_numElements; ++i)
+			{
+				// Read the element presence flag
+				uint8 present;
+				readBytes(pFile, &present, sizeof(present));
+
+				// If the element is missing, store a null element
+				if (!present)
+				{
+					pStructArray->m_pElements[i] = NULL;
+					continue;
+				}
+
+				// Read the value of each field
+				ScalarStruct* pScalar = makeScalarStructPtr();
+				for (size_t j = 0; j < fields.size(); ++j)
+				{
+					DataObject* pValue = readObject(pFile);
+					if (pValue != NULL)
+						(*pScalar)[fields[j]] = pValue;
+				}
+
+				// Store the element
+				pStructArray->m_pElements[i] = pScalar;
+			}
+
+			// Pack the elements into columns, if possible
+			if (Interpreter::s_structColumns.getBoolValue())
+				StructColumns::pack(pStructArray);
+
+			// Return the struct array
+			return pStructArray;
+		}
+
+		// Other types are not supported
+		default:
+		throw RunError("unsupported object type in variable file");
+	}
+}
+
+/***************************************************************
+* Function: MatFile::readElements()
+* Purpose : Read the raw elements of a matrix
+* Initial : agent on October 18, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+template <class ScalarType> MatrixObj<ScalarType>* MatFile::readElements(FILE* pFile, MatrixObj<ScalarType>* pMatrix, const DimVector& dims)
+{
+	// Set the matrix size
+	pMatrix->m_size = dims;
+
+	// Compute the number of matrix elements
+	size_t numElements = 1;
+	for (size_t i = 0; i < dims.size(); ++i)
+		numElements *= dims[i];
+
+	// Read the data size and ensure it matches the dimensions
+	uint64 dataSize;
+	readBytes(pFile, &dataSize, sizeof(dataSize));
+	if (dataSize != numElements * sizeof(ScalarType))
+		throw RunError("matrix data size does not match its dimensions");
+
+	// Skip the alignment padding
+	skipPadding(pFile);
+
+	// If the data is large enough to be mapped
+	if (dataSize >= MAP_THRESHOLD)
+	{
+		// Compute the page-aligned mapping offset
+		off_t dataOffset = ftello(pFile);
+		off_t mapOffset = dataOffset - (dataOffset % sysconf(_SC_PAGESIZE));
+		size_t mapLength = dataSize + (dataOffset - mapOffset);
+
+		// Map the data privately, pages are only read when first touched
+		// and writes to the matrix never reach the file
+		void* pBase = mmap(NULL, mapLength, PROT_READ | PROT_WRITE, MAP_PRIVATE, fileno(pFile), mapOffset);
+
+		// If the mapping succeeded
+		if (pBase != MAP_FAILED)
+		{
+			// Point the matrix elements into the mapping
+			pMatrix->m_numElements = numElements;
+			pMatrix->m_pElements = (ScalarType*)((byte*)pBase + (dataOffset - mapOffset));
+
+			// Unmap the data once the matrix is collected
+			MapRecord* pRecord = new MapRecord();
+			pRecord->pBase = pBase;
+			pRecord->length = mapLength;
+			GC_register_finalizer(pMatrix, unmapFinalizer, pRecord, NULL, NULL);
+
+			// Skip over the mapped data
+			if (fseeko(pFile, dataOffset + dataSize, SEEK_SET) != 0)
+				throw RunError("unexpected end of file");
+
+			// Return the matrix object
+			return pMatrix;
+		}
+	}
+
+	// Allocate and read the matrix elements
+	pMatrix->allocMatrix();
+	readBytes(pFile, pMatrix->m_pElements, dataSize);
+
+	// Return the matrix object
+	return pMatrix;
+}
+
+/***************************************************************
+* Function: MatFile::writeString()
+* Purpose : Write a length-prefixed string
+* Initial : agent on October 18, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+void MatFile::writeString(FILE* pFile, const std::string& string)
+{
+	// Write the string length followed by the characters
+	uint32 length = string.length();
+	writeBytes(pFile, &length, sizeof(length));
+	writeBytes(pFile, string.data(), length);
+}
+
+/***************************************************************
+* Function: MatFile::readString()
+* Purpose : Read a length-prefixed string
+* Initial : agent on October 18, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+std::string MatFile::readString(FILE* pFile)
+{
+	// Read the string length
+	uint32 length;
+	readBytes(pFile, &length, sizeof(length));
+
+	// Read the string characters
+	std::string string(length, '\0');
+	if (length > 0)
+		readBytes(pFile, &string[0], length);
+
+	// Return the string
+	return string;
+}
+
+/***************************************************************
+* Function: MatFile::writeBytes()
+* Purpose : Write raw data to a file
+* Initial : agent on October 18, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+void MatFile::writeBytes(FILE* pFile, const void* pData, size_t size)
+{
+	// Write the data and ensure it was fully written
+	if (size > 0 && fwrite(pData, 1, size, pFile) != size)
+		throw RunError("failed to write to variable file");
+}
+
+/***************************************************************
+* Function: MatFile::readBytes()
+* Purpose : Read raw data from a file
+* Initial : agent on October 18, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+void MatFile::readBytes(FILE* pFile, void* pData, size_t size)
+{
+	// Read the data and ensure it was fully read
+	if (size > 0 && fread(pData, 1, size, pFile) != size)
+		throw RunError("unexpected end of file");
+}
+
+/***************************************************************
+* Function: MatFile::writePadding()
+* Purpose : Pad the file up to the data alignment
+* Initial : agent on October 18, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+void MatFile::writePadding(FILE* pFile)
+{
+	// Compute the number of padding bytes needed
+	size_t padSize = (DATA_ALIGN - ftello(pFile) % DATA_ALIGN) % DATA_ALIGN;
+
+	// Write the padding bytes
+	static const byte padding[DATA_ALIGN] = { 0 };
+	writeBytes(pFile, padding, padSize);
+}
+
+/***************************************************************
+* Function: MatFile::skipPadding()
+* Purpose : Skip the padding inserted before element data
+* Initial : agent on October 18, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+void MatFile::skipPadding(FILE* pFile)
+{
+	// Compute the number of padding bytes to skip
+	size_t padSize = (DATA_ALIGN - ftello(pFile) % DATA_ALIGN) % DATA_ALIGN;
+
+	// Skip the padding bytes
+	if (padSize > 0 && fseeko(pFile, padSize, SEEK_CUR) != 0)
+		throw RunError("unexpected end of file");
+}
+
+/***************************************************************
+* Function: MatFile::unmapFinalizer()
+* Purpose : Unmap memory-mapped element data
+* Initial : agent on October 18, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+void MatFile::unmapFinalizer(void* pObject, void* pClientData)
+{
+	// Get the mapping record
+	MapRecord* pRecord = (MapRecord*)pClientData;
+
+	// Release the mapping and its record
+	munmap(pRecord->pBase, pRecord->length);
+	delete pRecord;
+}
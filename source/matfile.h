@@ -0,0 +1,109 @@
+// =========================================================================== //
+//                                                                             //
+// Copyright 2026 agent.                                                       //
+//                                                                             //
+//   Licensed under the Apache License, Version 2.0 (the "License");           //
+//   you may not use this file except in compliance with the License.          //
+//   You may obtain a copy of the License at                                   //
+//                                                                             //
+//       http://www.apache.org/licenses/LICENSE-2.0                            //
+//                                                                             //
+//   Unless required by applicable law or agreed to in writing, software       //
+//   distributed under the License is distributed on an "AS IS" BASIS,         //
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  //
+//   See the License for the specific language governing permissions and       //
+//  limitations under the License.                                             //
+//                                                                             //
+// =========================================================================== //
+
+// Include guards
+#ifndef MATFILE_H_
+#define MATFILE_H_
+
+// Header files
+#include <cstdio>
+#include <string>
+#include <vector>
+#include "platform.h"
+#include "objects.h"
+#include "matrixobjs.h"
+
+/***************************************************************
+* Class   : MatFile
+* Purpose : Binary workspace variable file reader/writer
+* Initial : agent on October 18, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+class MatFile
+{
+public:
+
+	// Named variable type definition
+	typedef std::pair<std::string, DataObject*> Variable;
+
+	// Variable vector type definition
+	typedef std::vector<Variable> VarVector;
+
+	// Method to test if a file is a binary variable file
+	static bool isMatFile(const std::string& fileName);
+
+	// Method to save variables to a binary file
+	static void saveFile(const std::string& fileName, const VarVector& variables);
+
+	// Method to load variables from a binary file
+	static VarVector loadFile(const std::string& fileName);
+
+	// File signature and format version
+	static const char MAGIC[8];
+	static const uint32 VERSION;
+
+	// Alignment of raw element data within the file
+	static const size_t DATA_ALIGN;
+
+	// Minimum data size for memory-mapped loading
+	static const size_t MAP_THRESHOLD;
+
+private:
+
+	// Memory mapping record, released when the owning matrix is collected
+	struct MapRecord
+	{
+		// Base address of the mapping
+		void* pBase;
+
+		// Length of the mapping in bytes
+		size_t length;
+	};
+
+	// Method to write an object record
+	static void writeObject(FILE* pFile, const DataObject* pObject);
+
+	// Method to write the raw elements of a matrix
+	template <class ScalarType> static void writeElements(FILE* pFile, const MatrixObj<ScalarType>* pMatrix);
+
+	// Method to read an object record
+	static DataObject* readObject(FILE* pFile);
+
+	// Method to read the raw elements of a matrix
+	template <class ScalarType> static MatrixObj<ScalarType>* readElements(FILE* pFile, MatrixObj<ScalarType>* pMatrix, const DimVector& dims);
+
+	// Methods to write and read strings
+	static void writeString(FILE* pFile, const std::string& string);
+	static std::string readString(FILE* pFile);
+
+	// Methods to write and read raw values
+	static void writeBytes(FILE* pFile, const void* pData, size_t size);
+	static void readBytes(FILE* pFile, void* pData, size_t size);
+
+	// Method to pad the file up to the data alignment
+	static void writePadding(FILE* pFile);
+
+	// Method to skip the padding inserted before element data
+	static void skipPadding(FILE* pFile);
+
+	// Finalizer to unmap memory-mapped element data
+	static void unmapFinalizer(void* pObject, void* pClientData);
+};
+
+#endif // #ifndef MATFILE_H_
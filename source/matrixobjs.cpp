@@ -383,6 +383,39 @@ void BaseMatrixObj::expandMatrix(BaseMatrixObj* pMatrix, size_t* pIndices, size_
 	pMatrix->expand(newSize);	
 }
 
+/***************************************************************
+* Function: BaseMatrixObj::freeTemp()
+* Purpose : Static method to free a temporary matrix
+* Initial : agent on October 18, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+void BaseMatrixObj::freeTemp(DataObject* pObject)
+{
+	// Get the object type
+	DataObject::Type type = pObject->getType();
+	
+	// Only free matrices of scalar elements, cell
+	// arrays may hold objects referenced elsewhere
+	if (type < DataObject::Type::MATRIX_I32 || type > DataObject::Type::CHARARRAY)
+		return;
+	
+	// Release the element buffer
+	((BaseMatrixObj*)pObject)->freeElements();
+	
+	// Unregister the object finalizer, if any (such as the unmapping
+	// of loaded matrices), and run it now, then free the object
+	GC_finalization_proc pFinalizer = NULL;
+	void* pClientData = NULL;
+	GC_register_finalizer(pObject, NULL, NULL, &pFinalizer, &pClientData);
+	if (pFinalizer != NULL)
+		pFinalizer(pObject, pClientData);
+	GC_FREE(pObject);
+	
+	// Increment the temporary free count
+	PROF_INCR_COUNTER(Profiler::TEMP_FREE_COUNT);
+}
+
 /***************************************************************
 * Function: BaseMatrixObj::multCompatible()
 * Purpose : Test if matrices are compatible for multiplication
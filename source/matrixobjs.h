@@ -36,10 +36,18 @@
 #include "utility.h"
 #include "profiling.h"
 #include "dimvector.h"
+#include "bufferpool.h"
 
 // Dimension vector type definition
 //typedef std::vector<size_t, gc_allocator<size_t> > DimVector;
 
+// Struct array element type, defined in structobj.h
+class ScalarStruct;
+ScalarStruct* makeScalarStructPtr();
+
+// Packed cell array element storage, defined in cellarrayobj.h
+class PackedCells;
+
 // Helper functions to highlight indexing conversions
 inline size_t toZeroIndex(size_t oneIndex) { return oneIndex - 1; }
 inline size_t toOneIndex(size_t zeroIndex) { return zeroIndex + 1; }
@@ -50,6 +58,12 @@ inline size_t toOneIndex(size_t zeroIndex) { return zeroIndex + 1; }
 * Initial : Maxime Chevalier-Boisvert on February 15, 2009
 ****************************************************************
 Revisions and bug fixes:
+
+agent on October 18, 2026
+Added reference counting for element buffers shared between copies.
+Added explicit freeing of dead temporaries.
+Buffer reference counts are updated atomically, since copies of
+a matrix may be written or collected on parallel loop threads.
 */
 class BaseMatrixObj : public DataObject
 {
@@ -59,6 +73,24 @@ class BaseMatrixObj : public DataObject
 	
 public:
 	
+	// Default constructor
+	BaseMatrixObj() : m_pRefCount(NULL) {}
+	
+	// Method to give this matrix its own copy of a shared element buffer
+	virtual void unshare() = 0;
+	
+	// Static version of the unshare method
+	static void unshareMatrix(BaseMatrixObj* pMatrix) { pMatrix->unshare(); }
+	
+	// Method to test if the element buffer may be shared with other matrices
+	bool isShared() const { return m_pRefCount != NULL; }
+	
+	// Method to release the element buffer of a matrix no longer in use
+	virtual void freeElements() = 0;
+	
+	// Static method to free a temporary matrix no longer in use
+	static void freeTemp(DataObject* pObject);
+	
 	// Method to test if slice indices are valid (positive integers)
 	bool validIndices(const ArrayObj* pSlice) const;
 	
@@ -133,6 +165,12 @@ protected:
 	
 	// Number of matrix elements
 	size_t m_numElements;
+	
+	// Number of matrices sharing the element buffer, NULL if not shared
+	// Note: the count is only decremented by explicit releases (unshare,
+	// expand and freeTemp), not when a sharing matrix is collected, so a
+	// count above one only means the buffer may be shared
+	mutable size_t* m_pRefCount;
 };
 
 /***************************************************************
@@ -141,6 +179,17 @@ protected:
 * Initial : Maxime Chevalier-Boisvert on January 15, 2009
 ****************************************************************
 Revisions and bug fixes:
+
+agent on October 18, 2026
+Added lazy (copy-on-write) copies. Writes to existing matrices must
+go through unshare, which the element write methods below do.
+Small matrices now store their elements inline in the object.
+Element reads go through loadElem, so cell arrays can keep their
+elements packed and box them on demand.
+Lazy copies of memory-mapped matrices are made eagerly, since the
+mapping is released when the original matrix is collected.
+Reading packed elements no longer boxes them in place. Concatenation
+and expansion keep cell arrays packed where the layout allows it.
 */
 template <class ScalarType> class MatrixObj : public BaseMatrixObj
 {
@@ -148,6 +197,14 @@ template <class ScalarType> class MatrixObj : public BaseMatrixObj
 	// This is so the JIT can access the internal data directly
 	friend class JITCompiler;
 	
+	// Declare the variable file reader as a friend class
+	// This is so loaded data can be mapped in place
+	friend class MatFile;
+	
+	// Declare the packed cell storage as a friend class
+	// This is so packed elements can be attached to cell arrays
+	friend class PackedCells;
+	
 public:
 
         virtual ~MatrixObj() { std::cout << "cleaning base mastrix" << std::endl ; } ;
@@ -276,10 +333,104 @@ public:
 		// Copy all the matrix elements into the new matrix
 		memcpy(pNewMatrix->m_pElements, m_pElements, sizeof(ScalarType) * m_numElements);
 		
+		// Let the new matrix share any packed elements
+		copyPacking(pNewMatrix);
+		
+		// Return the new matrix object
+		return pNewMatrix;
+	}
+	
+	// Method to copy this data object, sharing the element buffer until written
+	virtual MatrixObj* lazyCopy() const
+	{
+		// Empty and inline matrices are cheaper to copy than to share
+		if (m_numElements == 0 || isInline())
+			return copy();
+		
+		// Buffers not allocated in the collected heap (memory-mapped
+		// elements) only live as long as their owner, copy them now
+		if (GC_base((void*)m_pElements) == NULL)
+			return copy();
+		
+		// Create a new matrix object
+		MatrixObj* pNewMatrix = new MatrixObj();
+		
+		// Copy the matrix dimensions
+		pNewMatrix->m_size = m_size;
+		pNewMatrix->m_numElements = m_numElements;
+		
+		// If the buffer is not yet shared, start counting its users
+		if (m_pRefCount == NULL)
+		{
+			m_pRefCount = (size_t*)GC_MALLOC_ATOMIC(sizeof(size_t));
+			*m_pRefCount = 1;
+		}
+		
+		// Share the element buffer with the new matrix
+		__sync_add_and_fetch(m_pRefCount, 1);
+		pNewMatrix->m_pRefCount = m_pRefCount;
+		pNewMatrix->m_pElements = m_pElements;
+		
+		// Let the new matrix share any packed elements
+		copyPacking(pNewMatrix);
+		
 		// Return the new matrix object
 		return pNewMatrix;
 	}
 	
+	// Method to give this matrix its own copy of a shared element buffer
+	virtual void unshare()
+	{
+		// If the buffer is not shared, there is nothing to do
+		if (m_pRefCount == NULL)
+			return;
+		
+		// If other matrices may still use the buffer
+		if (*m_pRefCount > 1)
+		{
+			// Increment the deferred copy count
+			PROF_INCR_COUNTER(Profiler::ARRAY_UNSHARE_COUNT);
+			
+			// Copy the elements into a buffer of our own
+			ScalarType* pOldElements = m_pElements;
+			allocMatrix();
+			memcpy(m_pElements, pOldElements, sizeof(ScalarType) * m_numElements);
+			
+			// Release our reference to the shared buffer, only once
+			// copied, and recycle it if the other users released theirs
+			if (__sync_sub_and_fetch(m_pRefCount, 1) == 0)
+				releaseBuffer(pOldElements);
+		}
+		
+		// This matrix now owns its buffer
+		m_pRefCount = NULL;
+	}
+	
+	// Method to release the element buffer of a matrix no longer in use
+	virtual void freeElements()
+	{
+		// Inline elements are freed along with the object
+		if (isInline() || m_pElements == NULL)
+			return;
+		
+		// If the buffer is shared, only release our reference to it,
+		// otherwise, return the buffer to the pool
+		if (m_pRefCount != NULL)
+		{
+			if (__sync_sub_and_fetch(m_pRefCount, 1) == 0)
+				releaseBuffer(m_pElements);
+		}
+		else
+		{
+			releaseBuffer(m_pElements);
+		}
+		
+		// The matrix no longer has elements
+		m_pElements = NULL;
+		m_pRefCount = NULL;
+		m_numElements = 0;
+	}
+	
 	// Method to obtain a string representation of this object
 	virtual std::string toString() const
 	{
@@ -466,8 +617,26 @@ public:
 		// Store the current (old) matrix size
 		DimVector oldSize = m_size;
 		
+		// If the element positions change, box any packed elements
+		if (isPacked() && !keepsLayout(indices))
+			unpackElements();
+		
 		// Store a pointer to the current (old) matrix elements
 		ScalarType* pOldElements = m_pElements;
+		
+		// The elements are copied into a new buffer below, so
+		// a shared buffer only needs to be released once copied
+		size_t* pOldRefCount = m_pRefCount;
+		m_pRefCount = NULL;
+		
+		// If the elements are inline, save them, since the new
+		// elements may be stored in the same inline buffer
+		InlineStorage oldInline;
+		if (isInline())
+		{
+			memcpy(oldInline.bytes, m_inlineData.bytes, INLINE_BYTES);
+			pOldElements = (ScalarType*)oldInline.bytes;
+		}
 
 		// Create a vector for the new matrix size
 		DimVector newSize = indices;
@@ -540,8 +709,10 @@ public:
 		// Recursively perform the matrix expansion
 		expand(oldSize, newSize, srcStride, dstStride, pOldElements, m_pElements, newSize.size() - 1);
 		
-		// Delete the old matrix elements
-		delete [] pOldElements;
+		// Recycle the old elements if no other matrix uses them
+		// Note that buffers not allocated on the heap are ignored
+		if (pOldRefCount == NULL || __sync_sub_and_fetch(pOldRefCount, 1) == 0)
+			releaseBuffer(pOldElements);
 	}
 
 	// Method to recursively expand this matrix
@@ -553,8 +724,8 @@ public:
 			// Copy the elements of this column
 			memcpy(pDst, pSrc, sizeof(ScalarType) * srcSize[0]);
 			
-			// Fill the rest of the column with zeros
-			std::uninitialized_fill(pDst + srcSize[0], pDst + dstSize[0], (ScalarType)0);
+			// Initialize the rest of the column to a default value
+			initRange(pDst + srcSize[0], pDst + dstSize[0]);
 		}
 		else
 		{
@@ -887,13 +1058,12 @@ void getSliceND(const ArrayObj* pSlice, size_t curDim, size_t* pIndices, ScalarT
 					ScalarType* pSrcAddr = pBaseAddr + zeroIndex;
 				
           if (getType() == DataObject::Type::STRUCTARRAY) {
-            typedef std::map<std::string,DataObject*> ScalarStruct;
             ScalarStruct** pSrcAddrStruct = reinterpret_cast<ScalarStruct**> (pSrcAddr);
             if (*pSrcAddrStruct == NULL)
-              *pSrcAddrStruct = new ScalarStruct();
+              *pSrcAddrStruct = makeScalarStructPtr();
           }
 
-					*pDstElem = *pSrcAddr;
+					*pDstElem = loadElem(pSrcAddr);
 					
 					// Increment the destination element pointer
 					++pDstElem;
@@ -923,7 +1093,7 @@ void getSliceND(const ArrayObj* pSlice, size_t curDim, size_t* pIndices, ScalarT
 						ScalarType* pSrcAddr = pBaseAddr + index;
 						
 						// Copy the element
-						*pDstElem = *pSrcAddr;
+						*pDstElem = loadElem(pSrcAddr);
 						
 						// Increment the destination element pointer
 						++pDstElem;
@@ -961,12 +1131,25 @@ void getSliceND(const ArrayObj* pSlice, size_t curDim, size_t* pIndices, ScalarT
 						ScalarType* pSrcAddr = pBaseAddr + i;
 						
 						// Copy the element
-						*pDstElem = *pSrcAddr;
+						*pDstElem = loadElem(pSrcAddr);
 						
 						// Increment the destination element pointer
 						++pDstElem;						
 					}
 				}
+				// If the range is a contiguous run of indices, copy it as one block
+				// Note: packed elements must be boxed one at a time
+				else if (pRange->getStepVal() == 1 && !isPacked())
+				{
+					// Get the element count for the range
+					size_t elemCount = pRange->getElemCount();
+					
+					// Copy the elements
+					memcpy(pDstElem, pBaseAddr + toZeroIndex(size_t(pRange->getStartVal())), elemCount * sizeof(ScalarType));
+					
+					// Move the destination element pointer past the block
+					pDstElem += elemCount;
+				}
 				else
 				{
 					// Initialize the current value to the start value
@@ -985,7 +1168,7 @@ void getSliceND(const ArrayObj* pSlice, size_t curDim, size_t* pIndices, ScalarT
 						ScalarType* pSrcAddr = pBaseAddr + zeroIndex;
 						
 						// Copy the element
-						*pDstElem = *pSrcAddr;
+						*pDstElem = loadElem(pSrcAddr);
 						
 						// Increment the destination element pointer
 						++pDstElem;
@@ -1010,6 +1193,10 @@ void getSliceND(const ArrayObj* pSlice, size_t curDim, size_t* pIndices, ScalarT
 	{
 		// Ensure that the slice has at most as many dimensions as this matrix
 		assert (pSlice->getSize() <= m_size.size());
+		
+		// Make sure the elements written are not shared
+		if (m_pRefCount != NULL)
+			unshare();
 	
 		// Declare a pointer for the source matrix
 		MatrixObj* pSrcMatrix;
@@ -1108,7 +1295,8 @@ void getSliceND(const ArrayObj* pSlice, size_t curDim, size_t* pIndices, ScalarT
 			return;
 
 		// Get a pointer to the current element in the sub matrix
-		ScalarType* pSrcElem = pSrcMatrix->m_pElements;
+		// Note: packed source elements are boxed into a temporary buffer
+		const ScalarType* pSrcElem = pSrcMatrix->loadElements();
 		
 		// Allocate memory for the indices
 		size_t* pIndices = (size_t*)alloca(sizeof(size_t) * pSlice->getSize());
@@ -1118,7 +1306,7 @@ void getSliceND(const ArrayObj* pSlice, size_t curDim, size_t* pIndices, ScalarT
 	}
 	
 	// Helper method to recursively implement slice copying
-	void setSliceND(const ArrayObj* pSlice, size_t curDim, size_t* pIndices, ScalarType*& pSrcElem) const
+	void setSliceND(const ArrayObj* pSlice, size_t curDim, size_t* pIndices, const ScalarType*& pSrcElem) const
 	{
 		// Get a reference to the slice along the current dimension
 		const DataObject* pCurSlice = pSlice->getObject(curDim);
@@ -1371,7 +1559,7 @@ void getSliceND(const ArrayObj* pSlice, size_t curDim, size_t* pIndices, ScalarT
 		assert (index < m_numElements);
 		
 		// Return the desired element
-		return m_pElements[index];
+		return loadElem(m_pElements + index);
 	}
 	
 	// Method to set an element unidimensionally
@@ -1383,6 +1571,10 @@ void getSliceND(const ArrayObj* pSlice, size_t curDim, size_t* pIndices, ScalarT
 		// Ensure that the index is valid
 		assert (index < m_numElements);
 
+		// Make sure the element written is not shared
+		if (m_pRefCount != NULL)
+			unshare();
+
 		// Set the desired element
 		m_pElements[index] = value;
 	}
@@ -1404,7 +1596,7 @@ void getSliceND(const ArrayObj* pSlice, size_t curDim, size_t* pIndices, ScalarT
 		assert (index < m_numElements);
 		
 		// Return the desired element
-		return m_pElements[index];
+		return loadElem(m_pElements + index);
 	}
 
 	// Method to set an element bidimensionally
@@ -1423,6 +1615,10 @@ void getSliceND(const ArrayObj* pSlice, size_t curDim, size_t* pIndices, ScalarT
 		// Ensure the index is valid
 		assert (index < m_numElements);
 		
+		// Make sure the element written is not shared
+		if (m_pRefCount != NULL)
+			unshare();
+		
 		// Set the desired element
 		m_pElements[index] = value;
 	}
@@ -1470,6 +1666,10 @@ void getSliceND(const ArrayObj* pSlice, size_t curDim, size_t* pIndices, ScalarT
 		// Ensure that the global index is valid
 		assert (index < m_numElements);
 		
+		// Make sure the element written is not shared
+		if (m_pRefCount != NULL)
+			unshare();
+		
 		// Set the desired element
 		m_pElements[index] = value;
 	}
@@ -1518,7 +1718,7 @@ void getSliceND(const ArrayObj* pSlice, size_t curDim, size_t* pIndices, ScalarT
 		assert (index < m_numElements);
 		
 		// Return the desired element
-		return m_pElements[index];
+		return loadElem(m_pElements + index);
 	}
 	
 	// Static method to vectorize this matrix
@@ -1584,7 +1784,7 @@ void getSliceND(const ArrayObj* pSlice, size_t curDim, size_t* pIndices, ScalarT
 			for (size_t j = 0; j < numCols; ++j)		
 			{
 				// Transpose this element
-				pResult->m_pElements[i * numCols + j] = pMatrix->m_pElements[j * numRows + i];
+				pResult->m_pElements[i * numCols + j] = pMatrix->loadElem(pMatrix->m_pElements + j * numRows + i);
 			}
 		}
 		
@@ -1866,7 +2066,7 @@ void getSliceND(const ArrayObj* pSlice, size_t curDim, size_t* pIndices, ScalarT
 		// If B is empty, return a copy of A
 		if (pMatrixB->isEmpty())
 			return pMatrixA->copy();
-
+		
 		// Ensure that all dimensions have the same size, except the concat dimension
 		for (size_t i = 0; i < sizeA.size(); ++i)
 		{
@@ -1909,6 +2109,16 @@ void getSliceND(const ArrayObj* pSlice, size_t curDim, size_t* pIndices, ScalarT
 		for (size_t i = catDim + 1; i < sizeA.size(); ++i)
 			numSlices *= sizeA[i];
 		
+		// If the elements of B follow those of A, packed elements
+		// can be packed into the result without being boxed
+		if (numSlices == 1 && (pMatrixA->isPacked() || pMatrixB->isPacked()) && pResult->concatPacked(pMatrixA, pMatrixB))
+			return pResult;
+		
+		// Get pointers to the elements of both matrices
+		// Note: packed elements are boxed into temporary buffers
+		const ScalarType* pElemsA = pMatrixA->loadElements();
+		const ScalarType* pElemsB = pMatrixB->loadElements();
+		
 		// For each slice
 		for (size_t i = 0; i < numSlices; ++i)
 		{
@@ -1919,7 +2129,7 @@ void getSliceND(const ArrayObj* pSlice, size_t curDim, size_t* pIndices, ScalarT
 			if (sliceSizeA > 0)
 			{
 				// Compute the address of this slice in A
-				const ScalarType* pSliceA = pMatrixA->m_pElements + i * sliceSizeA;
+				const ScalarType* pSliceA = pElemsA + i * sliceSizeA;
 				
 				// Copy the data into the result matrix
 				memcpy(pSliceR, pSliceA, sizeof(ScalarType) * sliceSizeA);
@@ -1929,7 +2139,7 @@ void getSliceND(const ArrayObj* pSlice, size_t curDim, size_t* pIndices, ScalarT
 			if (sliceSizeB > 0)
 			{
 				// Compute the address of this slice in B
-				const ScalarType* pSliceB = pMatrixB->m_pElements + i * sliceSizeB;
+				const ScalarType* pSliceB = pElemsB + i * sliceSizeB;
 				
 				// Copy the data into the result matrix
 				memcpy(pSliceR + sliceSizeA, pSliceB, sizeof(ScalarType) * sliceSizeB);
@@ -1950,11 +2160,8 @@ void getSliceND(const ArrayObj* pSlice, size_t curDim, size_t* pIndices, ScalarT
 		if (zeroIndex >= pMatrix->m_numElements)
 			throw RunError("index out of range in 1D matrix read");
 		
-		// Get a pointer to the matrix data
-		const ScalarType* pData = pMatrix->getElements();
-		
 		// Read the element at the index
-		return pData[zeroIndex];
+		return pMatrix->loadElem(pMatrix->m_pElements + zeroIndex);
 	}
 	
 	// Method to read an element using 2D indexing
@@ -1971,11 +2178,8 @@ void getSliceND(const ArrayObj* pSlice, size_t curDim, size_t* pIndices, ScalarT
 		if (zeroIndex1 >= pMatrix->m_size[0] || offset >= pMatrix->m_numElements)
 			throw RunError("index out of range in 2D matrix read");
 		
-		// Get a pointer to the matrix data
-		const ScalarType* pData = pMatrix->getElements();
-		
 		// Read the element at the offset
-		return pData[offset];
+		return pMatrix->loadElem(pMatrix->m_pElements + offset);
 	}
 	
 	// Method to write an element using 1D indexing
@@ -1995,6 +2199,10 @@ void getSliceND(const ArrayObj* pSlice, size_t curDim, size_t* pIndices, ScalarT
 			pMatrix->expand(DimVector(1, index));
 		}
 		
+		// Make sure the element written is not shared
+		if (pMatrix->m_pRefCount != NULL)
+			pMatrix->unshare();
+		
 		// Get a pointer to the matrix data
 		ScalarType* pData = pMatrix->getElements();
 		
@@ -2029,6 +2237,10 @@ void getSliceND(const ArrayObj* pSlice, size_t curDim, size_t* pIndices, ScalarT
 			offset = zeroIndex2 * pMatrix->m_size[0] + zeroIndex1;
 		}
 		
+		// Make sure the element written is not shared
+		if (pMatrix->m_pRefCount != NULL)
+			pMatrix->unshare();
+		
 		// Get a pointer to the matrix data
 		ScalarType* pData = pMatrix->getElements();
 		
@@ -2067,10 +2279,13 @@ void getSliceND(const ArrayObj* pSlice, size_t curDim, size_t* pIndices, ScalarT
 	ScalarType getScalar() const { return *m_pElements; }
 	
 	// Accessor to access the matrix elements of a constant matrix
-	const ScalarType* getElements() const { return m_pElements; }
+	// Note: packed elements are boxed into a temporary buffer, the matrix is left unchanged
+	const ScalarType* getElements() const { return loadElements(); }
 	
 	// Accessors to access the matrix elements
-	ScalarType* getElements() { return m_pElements; }
+	// Note: call unshare before writing to a matrix that was not just created,
+	// packed elements are boxed in place, after unsharing the buffer
+	ScalarType* getElements() { unpackElements(); return m_pElements; }
 
 	// Static method to get the first element of a matrix
 	static ScalarType getScalarVal(const MatrixObj* pMatrix) { return pMatrix->getScalar(); }
@@ -2100,9 +2315,64 @@ protected:
 		for (size_t i = 1; i < m_size.size(); ++i)
 			m_numElements *= m_size[i];
 		
+		// If the elements fit in the inline buffer, store them there
+		if (m_numElements * sizeof(ScalarType) <= INLINE_BYTES)
+		{
+			m_pElements = (ScalarType*)m_inlineData.bytes;
+			return;
+		}
+		
 		// Allocate memory for the matrix elements
-		// Note that the memory is garbage-collected
-		m_pElements = (ScalarType*)GC_MALLOC_ATOMIC_IGNORE_OFF_PAGE(m_numElements * sizeof(ScalarType));
+		// Note that the memory is garbage-collected, large
+		// buffers are recycled through the buffer pool
+		m_pElements = (ScalarType*)BufferPool::acquire(m_numElements * sizeof(ScalarType));
+	}
+	
+	// Method to test if the elements are stored inline
+	bool isInline() const { return (const void*)m_pElements == (const void*)m_inlineData.bytes; }
+	
+	// Method to return an element buffer to the buffer pool
+	// Note: buffers are only recycled on explicit releases, never from
+	// finalizers, since compiled code may still hold a pointer into the
+	// elements of a matrix that is no longer referenced
+	static void releaseBuffer(ScalarType* pBuffer) { BufferPool::release(pBuffer); }
+	
+	// Method to test if some elements are held in packed form
+	// Note: only cell arrays pack their elements
+	bool isPacked() const { return false; }
+	
+	// Method to read an element, boxing it if it is packed
+	ScalarType loadElem(const ScalarType* pAddr) const { return *pAddr; }
+	
+	// Method to get the elements for reading, boxing packed ones into a temporary buffer
+	const ScalarType* loadElements() const { return m_pElements; }
+	
+	// Method to box all packed elements, making the storage generic
+	void unpackElements() {}
+	
+	// Method to let a copy of this matrix share the packed elements
+	void copyPacking(MatrixObj* pCopy) const {}
+	
+	// Method to fill this new matrix by packing the elements of two others, one after the other
+	bool concatPacked(const MatrixObj* pMatrixA, const MatrixObj* pMatrixB) { return false; }
+	
+	// Method to test if expanding to the given indices keeps the linear index of every element
+	bool keepsLayout(const DimVector& indices) const
+	{
+		// Each dimension the elements span must keep its stride
+		size_t oldStride = 1;
+		size_t newStride = 1;
+		for (size_t i = 0; i < m_size.size(); ++i)
+		{
+			if (m_size[i] > 1 && oldStride != newStride)
+				return false;
+			
+			oldStride *= m_size[i];
+			newStride *= (i < indices.size())? std::max(indices[i], m_size[i]):m_size[i];
+		}
+		
+		// The element positions are unchanged
+		return true;
 	}
 	
 	// Method to initialize the matrix
@@ -2122,6 +2392,23 @@ protected:
 	// Array of matrix element
 	// Note: the elements are stored in column-major order
 	ScalarType* m_pElements;
+	
+	// Size of the inline element buffer (a 4x4 float64 matrix)
+	static const size_t INLINE_BYTES = 16 * sizeof(float64);
+	
+	// Inline element buffer type, aligned for any element type
+	// Note: packed cell arrays are never inline, and reuse the
+	// storage to point to their packed elements
+	union InlineStorage
+	{
+		float64 align;
+		byte bytes[INLINE_BYTES];
+		PackedCells* pPacked;
+	};
+	
+	// Inline element buffer, used when the elements fit
+	// Note: never share a pointer into this buffer with other objects
+	InlineStorage m_inlineData;
 };
 
 // Template specialization of the class type method for common matrix object types
@@ -22,6 +22,10 @@
 #include <iostream>
 #include <vector>
 #include <string>
+#include <unordered_map>
+#include <cstdio>
+#include <cstdlib>
+#include <exception>
 #include <sys/time.h>
 #include "mcvmstdlib.h"
 #include "runtimebase.h"
@@ -29,13 +33,19 @@
 
 #ifdef MCVM_USE_JIT
 #include "jitcompiler.h"
+#include "transform_parallel.h"
 #endif
 
+#include "workerpool.h"
+#include "environment.h"
+#include "binaryopexpr.h"
+
 #include "matrixobjs.h"
 #include "matrixops.h"
 #include "chararrayobj.h"
 #include "cellarrayobj.h"
 #include "structobj.h"
+#include "rangeobj.h"
 #include "utility.h"
 #include "process.h"
 
@@ -44,16 +54,70 @@
 #endif 
 
 #include "filesystem.h"
+#include "matfile.h"
+#include "spreadsheet.h"
 
 // Standard library name space
 namespace mcvm_std_lib
 {
 	// Start time value for the tic-toc timer system
 	double ticTocStartTime = FLOAT_INFINITY;
+	
+	// Random number state of the parallel loop chunks
+	__thread unsigned int randThreadSeed = 0;
+	
+	// Flag indicating that a parallel loop chunk runs on this thread
+	__thread bool randInChunk = false;
 
+	// Open output file structure
+	struct OutFile
+	{
+		// Underlying file handle
+		FILE* pHandle;
+		
+		// Pending output, written out in large blocks
+		std::string buffer;
+	};
+	
 	// Map of file ids to open file handles
-	typedef std::map<size_t, FILE*> FileHandleMap; 
+	typedef std::map<size_t, OutFile> FileHandleMap; 
 	FileHandleMap openFileMap;
+	
+	// Output size at which file buffers are written out
+	const size_t FILE_BUFFER_SIZE = 1 << 16;
+	
+	// Terminate handler replaced by the one writing out buffered output
+	std::terminate_handler prevTerminateHandler = NULL;
+	
+	// Reusable output buffers for standard output and string formatting
+	std::string stdOutBuffer;
+	std::string stringBuffer;
+	
+	// Compiled format specifier structure
+	struct FormatSpec
+	{
+		// Conversion character (0 for literal text)
+		char conversion;
+		
+		// Flag indicating there are no flags, width or precision
+		bool plain;
+		
+		// Literal text, or printf-style conversion string
+		std::string text;
+		
+		// Alternate conversion string for non-integer %d values
+		std::string altText;
+	};
+	
+	// Compiled format type definition
+	typedef std::vector<FormatSpec> CompiledFormat;
+	
+	// Map of format strings to compiled formats
+	typedef std::unordered_map<std::string, CompiledFormat> FormatCache;
+	FormatCache formatCache;
+	
+	// Maximum number of compiled formats kept in the cache
+	const size_t FORMAT_CACHE_SIZE = 256;
 		
 	/***************************************************************
 	* Function: parseMatSize()
@@ -290,100 +354,92 @@ namespace mcvm_std_lib
 	}
 	
 	/***************************************************************
-	* Function: formatPrint()
-	* Purpose : Perform formatted printing
-	* Initial : Maxime Chevalier-Boisvert on February 3, 2009
+	* Function: compileFormat()
+	* Purpose : Parse a format string into a format specifier list
+	* Initial : agent on October 18, 2026
 	****************************************************************
 	Revisions and bug fixes:
 	*/	
-	std::string formatPrint(ArrayObj* pArguments)
+	const CompiledFormat& compileFormat(const std::string& formatStr)
 	{
-		// If there are no arguments, throw an exception
-		if (pArguments->getSize() == 0)
-			throw RunError("insufficient argument count");
-		
-		// Get the format argument
-		DataObject* pFormatArg = pArguments->getObject(0);
-		
-		// Ensure the format argument is a string
-		if (pFormatArg->getType() != DataObject::Type::CHARARRAY)
-			throw RunError("the format argument must be a string");
-		
-		// Extract the format string
-		std::string formatStr = ((CharArrayObj*)pFormatArg)->getString();
+		// If this format was already compiled, return the cached version
+		FormatCache::const_iterator cacheItr = formatCache.find(formatStr);
+		if (cacheItr != formatCache.end())
+			return cacheItr->second;
 		
-		// Declare an index for the next argument to use 
-		size_t nextArg = 1;
+		// Create a specifier list for this format
+		CompiledFormat format;
 		
-		// Create a string to store the output
-		std::string output;
+		// Declare a string to accumulate literal text
+		std::string literal;
 		
 		// For each character of the format string
 		for (size_t charIndex = 0; charIndex < formatStr.length(); ++charIndex)
 		{
-			// Extrac the current character from the format string
+			// Extract the current character from the format string
 			char thisChar = formatStr[charIndex];
 	
-			// If this is an escape sequence
+			// If this is a percent sign followed by another, output a percent sign
+			if (thisChar == '%' && charIndex + 1 < formatStr.length() && formatStr[charIndex + 1] == '%')
+			{
+				literal += '%';
+				++charIndex;
+				continue;
+			}
+			
+			// If this is a format specifier
 			if (thisChar == '%')
 			{
-				// TODO: expand support
+				// Find the end of the flags, width and precision
+				size_t convIndex = charIndex + 1;
+				while (convIndex < formatStr.length() && strchr("-+ 0#.0123456789", formatStr[convIndex]) != NULL)
+					++convIndex;
+				
+				// Ensure the specifier is complete
+				if (convIndex >= formatStr.length())
+					throw RunError("incomplete format specifier in format string");
 				
-				char formatChar = formatStr[++charIndex];
+				// Ensure the format character is supported
+				char formatChar = formatStr[convIndex];
+				if (strchr("dfiegs", formatChar) == NULL)
+					throw RunError("unsupported format character in format string");
 				
-				// Ensure that the argument count is sufficient
-				if (nextArg >= pArguments->getSize())
-					throw RunError("missing argument for output formatting");
+				// Flush the literal text accumulated so far
+				if (!literal.empty())
+				{
+					FormatSpec litSpec = { 0, true, literal, "" };
+					format.push_back(litSpec);
+					literal.clear();
+				}
 				
-				// Get the output argument
-				DataObject* pOutArg = pArguments->getObject(nextArg++);
+				// Extract the flags, width and precision
+				std::string modifiers = formatStr.substr(charIndex + 1, convIndex - charIndex - 1);
 				
-				// Switch on the format character
+				// Create the specifier for this conversion
+				FormatSpec spec;
+				spec.conversion = formatChar;
+				spec.plain = modifiers.empty();
+				
+				// Build the printf conversion strings
 				switch (formatChar)
 				{
-					// Fixed-point format
+					// Integer formats print as integers or exponentials
 					case 'd':
-					case 'f':
-					{
-						double floatVal = getFloat64Value(pOutArg);
-						
-						output += ::toString(floatVal);
-					}
-					break;
-					
-					// Integer format
 					case 'i':
-					{
-						long int intVal = getInt32Value(pOutArg);
-						
-						output += ::toString(intVal);
-					}
+					spec.text = "%" + modifiers + "lld";
+					spec.altText = "%" + modifiers + "e";
 					break;
 					
-					// String format
-					case 's':
-					{
-						// Ensure that the argument is a string
-						if (pOutArg->getType() != DataObject::Type::CHARARRAY)
-							throw RunError("invalid value for string format");
-						
-						// Get the string value
-						std::string string = ((CharArrayObj*)pOutArg)->getString();
-						
-						// Add the string to the output
-						output += string;
-					}
-					break;
-					
-					// Invalid format character
+					// Other formats map directly to printf
 					default:
-					{
-						// Throw an exception
-						throw RunError("unsupported format character in format string");
-					}
-				}				
+					spec.text = "%" + modifiers + formatChar;
+				}
 				
-				// Do not output this character
+				// Add the specifier to the list
+				format.push_back(spec);
+				
+				// Move past the specifier
+				charIndex = convIndex;
 				continue;
 			}			
 			
@@ -398,31 +454,253 @@ namespace mcvm_std_lib
 				{
 					// Newline
 					case 'n':
-					output += '\n';
+					literal += '\n';
 					break;
 
 					// Tab character
 					case 't':
-					output += '\t';
+					literal += '\t';
 					break;
 					
 					// Quotation mark
 					case '\'':
 					if (formatStr[++charIndex] == '\'')
-						output += '\'';
+						literal += '\'';
 					break;
 				}
 				
 				// Do not output this character
 				continue;
-			}			
+			}
 			
-			// Add the character to the output
-			output += thisChar;
+			// Add the character to the literal text
+			literal += thisChar;
 		}		
 		
-		// Return the output string
-		return output;
+		// Flush the remaining literal text
+		if (!literal.empty())
+		{
+			FormatSpec litSpec = { 0, true, literal, "" };
+			format.push_back(litSpec);
+		}
+		
+		// If the cache is full, empty it
+		if (formatCache.size() >= FORMAT_CACHE_SIZE)
+			formatCache.clear();
+		
+		// Cache and return the compiled format
+		CompiledFormat& cachedFormat = formatCache[formatStr];
+		cachedFormat.swap(format);
+		return cachedFormat;
+	}
+	
+	/***************************************************************
+	* Function: appendFormat()
+	* Purpose : Append a printf-formatted value to an output buffer
+	* Initial : agent on October 18, 2026
+	****************************************************************
+	Revisions and bug fixes:
+	*/	
+	template <class T> void appendFormat(std::string& output, const std::string& format, T value)
+	{
+		// Format into a stack buffer, which fits nearly all values
+		char buffer[128];
+		int length = snprintf(buffer, sizeof(buffer), format.c_str(), value);
+		
+		// If the value fit into the buffer, append it
+		if (length < (int)sizeof(buffer))
+		{
+			output.append(buffer, length);
+			return;
+		}
+		
+		// Otherwise, format directly at the end of the output
+		size_t oldSize = output.size();
+		output.resize(oldSize + length + 1);
+		snprintf(&output[oldSize], length + 1, format.c_str(), value);
+		output.resize(oldSize + length);
+	}
+	
+	/***************************************************************
+	* Function: formatPrint()
+	* Purpose : Perform formatted printing
+	* Initial : Maxime Chevalier-Boisvert on February 3, 2009
+	****************************************************************
+	Revisions and bug fixes:
+
+	agent on October 18, 2026
+	Format strings are now compiled once and cached, and the output
+	is appended to a caller-provided buffer.
+	*/	
+	void formatPrint(ArrayObj* pArguments, size_t formatArg, std::string& output)
+	{
+		// If there is no format argument, throw an exception
+		if (pArguments->getSize() <= formatArg)
+			throw RunError("insufficient argument count");
+		
+		// Get the format argument
+		DataObject* pFormatArg = pArguments->getObject(formatArg);
+		
+		// Ensure the format argument is a string
+		if (pFormatArg->getType() != DataObject::Type::CHARARRAY)
+			throw RunError("the format argument must be a string");
+		
+		// Get the compiled format for this format string
+		const CompiledFormat& format = compileFormat(((CharArrayObj*)pFormatArg)->getString());
+		
+		// Declare an index for the next argument to use 
+		size_t nextArg = formatArg + 1;
+		
+		// For each format specifier
+		for (CompiledFormat::const_iterator specItr = format.begin(); specItr != format.end(); ++specItr)
+		{
+			// Get a reference to the specifier
+			const FormatSpec& spec = *specItr;
+			
+			// If this is literal text, output it directly
+			if (spec.conversion == 0)
+			{
+				output += spec.text;
+				continue;
+			}
+			
+			// Ensure that the argument count is sufficient
+			if (nextArg >= pArguments->getSize())
+				throw RunError("missing argument for output formatting");
+			
+			// Get the output argument
+			DataObject* pOutArg = pArguments->getObject(nextArg++);
+			
+			// Switch on the format character
+			switch (spec.conversion)
+			{
+				// Fixed-point format
+				case 'd':
+				case 'f':
+				{
+					double floatVal = getFloat64Value(pOutArg);
+					
+					// Plain formats use the default number representation
+					if (spec.plain)
+						output += ::toString(floatVal);
+					else if (spec.conversion == 'f')
+						appendFormat(output, spec.text, floatVal);
+					else if (::isInteger(floatVal))
+						appendFormat(output, spec.text, (long long int)floatVal);
+					else
+						appendFormat(output, spec.altText, floatVal);
+				}
+				break;
+				
+				// Integer format
+				case 'i':
+				{
+					long int intVal = getInt32Value(pOutArg);
+					
+					// Plain formats use the default number representation
+					if (spec.plain)
+						output += ::toString(intVal);
+					else
+						appendFormat(output, spec.text, (long long int)intVal);
+				}
+				break;
+				
+				// Exponential and general formats
+				case 'e':
+				case 'g':
+				appendFormat(output, spec.text, getFloat64Value(pOutArg));
+				break;
+				
+				// String format
+				case 's':
+				{
+					// Ensure that the argument is a string
+					if (pOutArg->getType() != DataObject::Type::CHARARRAY)
+						throw RunError("invalid value for string format");
+					
+					// Get a typed pointer to the string
+					CharArrayObj* pString = (CharArrayObj*)pOutArg;
+					
+					// Add the string to the output
+					if (spec.plain)
+						output.append(pString->getElements(), pString->getNumElems());
+					else
+						appendFormat(output, spec.text, pString->getString().c_str());
+				}
+				break;
+			}				
+		}
+	}
+	
+	/***************************************************************
+	* Function: flushOutFile()
+	* Purpose : Write out the buffered output of a file
+	* Initial : agent on October 18, 2026
+	****************************************************************
+	Revisions and bug fixes:
+	*/	
+	bool flushOutFile(OutFile& file)
+	{
+		// If there is no pending output, do nothing
+		if (file.buffer.empty())
+			return true;
+		
+		// Write the pending output to the file
+		size_t numWritten = ::fwrite(file.buffer.data(), 1, file.buffer.size(), file.pHandle);
+		bool success = (numWritten == file.buffer.size());
+		
+		// Empty the buffer, keeping its storage
+		// Note: output which could not be written is dropped,
+		// the failure is reported to the caller instead
+		file.buffer.clear();
+		
+		// Indicate whether all the output was written
+		return success;
+	}
+	
+	/***************************************************************
+	* Function: flushOutput()
+	* Purpose : Write out all buffered library output
+	* Initial : agent on October 18, 2026
+	****************************************************************
+	Revisions and bug fixes:
+	*/	
+	void flushOutput()
+	{
+		// Write out the buffer of each open file
+		// Note: this runs as the program exits, so failures can only be reported
+		for (FileHandleMap::iterator itr = openFileMap.begin(); itr != openFileMap.end(); ++itr)
+		{
+			bool success = flushOutFile(itr->second);
+			if (::fflush(itr->second.pHandle) != 0)
+				success = false;
+			
+			if (success == false)
+				std::cerr << "error: could not write buffered output to file " << itr->first << std::endl;
+		}
+		
+		// Flush the standard output stream
+		std::cout.flush();
+	}
+	
+	/***************************************************************
+	* Function: flushOutputTerminate()
+	* Purpose : Write out buffered output before the program is
+	*           terminated by an uncaught exception
+	* Initial : agent on October 18, 2026
+	****************************************************************
+	Revisions and bug fixes:
+	*/	
+	void flushOutputTerminate()
+	{
+		// Write out the buffered output
+		flushOutput();
+		
+		// Let the previous handler report the exception and abort
+		if (prevTerminateHandler != NULL)
+			prevTerminateHandler();
+		
+		std::abort();
 	}
 	
 	/***************************************************************
@@ -1012,6 +1290,138 @@ namespace mcvm_std_lib
 		return new ArrayObj(pNewMatrix);
 	}
 	
+	/***************************************************************
+	* Function: cellfunFunc()
+	* Purpose : Apply a function to each element of a cell array
+	* Initial : agent on October 18, 2026
+	****************************************************************
+	Revisions and bug fixes:
+	*/
+	ArrayObj* cellfunFunc(ArrayObj* pArguments)
+	{
+		// Ensure there are exactly two arguments
+		if (pArguments->getSize() != 2)
+			throw RunError("invalid argument count");
+		
+		// Get the function and cell array arguments
+		DataObject* pFuncArg = pArguments->getObject(0);
+		DataObject* pCellArg = pArguments->getObject(1);
+		
+		// Ensure that the second argument is a cell array
+		if (pCellArg->getType() != DataObject::Type::CELLARRAY)
+			throw RunError("the second argument must be a cell array");
+		
+		// Get a typed pointer to the cell array
+		CellArrayObj* pCellArray = (CellArrayObj*)pCellArg;
+		
+		// Create a matrix to store the outputs
+		MatrixF64Obj* pOutMatrix = new MatrixF64Obj(pCellArray->getSize());
+		float64* pOutElems = pOutMatrix->getElements();
+		
+		// If the function is given by name
+		if (pFuncArg->getType() == DataObject::Type::CHARARRAY)
+		{
+			// Get the function name
+			std::string funcName = ((CharArrayObj*)pFuncArg)->getString();
+			
+			// Ensure that the function is supported by name
+			if (funcName != "isempty" && funcName != "length" && funcName != "ndims" && funcName != "prodofsize")
+				throw RunError("unsupported function name: \"" + funcName + "\"");
+			
+			// Get the packed elements, if any
+			const PackedCells* pPacked = PackedCells::get(pCellArray);
+			
+			// For each element of the cell array
+			for (size_t i = 0; i < pCellArray->getNumElems(); ++i)
+			{
+				// Declare variables for the element size
+				size_t numDims;
+				size_t numElems;
+				size_t maxDim;
+				
+				// If the element is a packed row, read its length without boxing it
+				const void* pRow;
+				size_t length;
+				if (pPacked != NULL && PackedCells::getRow(pCellArray, i, pPacked->getElemType(), pRow, length))
+				{
+					numDims = 2;
+					numElems = length;
+					maxDim = std::max(length, size_t(1));
+				}
+				
+				// Otherwise, get the size of the element
+				else
+				{
+					DataObject* pElem = pCellArray->getElem1D(i + 1);
+					
+					if (!pElem->isMatrixObj())
+						throw RunError("cell array elements must be arrays");
+					
+					const DimVector& size = ((BaseMatrixObj*)pElem)->getSize();
+					
+					numDims = size.size();
+					numElems = ((BaseMatrixObj*)pElem)->getNumElems();
+					maxDim = *std::max_element(size.begin(), size.end());
+				}
+				
+				// Compute the output for this element
+				if (funcName == "isempty")
+					pOutElems[i] = (numElems == 0);
+				else if (funcName == "length")
+					pOutElems[i] = (numElems == 0)? 0:maxDim;
+				else if (funcName == "ndims")
+					pOutElems[i] = numDims;
+				else
+					pOutElems[i] = numElems;
+			}
+			
+			// The isempty outputs are logical values
+			if (funcName == "isempty")
+				return new ArrayObj(pOutMatrix->convert(DataObject::Type::LOGICALARRAY));
+			
+			// Return the output matrix
+			return new ArrayObj(pOutMatrix);
+		}
+		
+		// Ensure that the first argument is a function handle
+		if (pFuncArg->getType() != DataObject::Type::FN_HANDLE)
+			throw RunError("the first argument must be a function handle or name");
+		
+		// Get a pointer to the function object
+		Function* pFunction = ((FnHandleObj*)pFuncArg)->getFunction();
+		
+		// Keep track of whether all the outputs are logical
+		bool allLogical = true;
+		
+		// For each element of the cell array
+		for (size_t i = 0; i < pCellArray->getNumElems(); ++i)
+		{
+			// Call the function on the element
+			// Note: packed elements are boxed one at a time
+			ArrayObj* pOutputs = Interpreter::callFunction(pFunction, new ArrayObj(pCellArray->getElem1D(i + 1)), 1);
+			
+			// Ensure that the function produced a scalar
+			if (pOutputs->getSize() == 0 || !pOutputs->getObject(0)->isMatrixObj() || !((BaseMatrixObj*)pOutputs->getObject(0))->isScalar())
+				throw RunError("the function outputs must be scalar values");
+			
+			// Get the output value as a floating-point scalar
+			DataObject* pOutput = pOutputs->getObject(0);
+			allLogical = allLogical && (pOutput->getType() == DataObject::Type::LOGICALARRAY);
+			if (pOutput->getType() != DataObject::Type::MATRIX_F64)
+				pOutput = pOutput->convert(DataObject::Type::MATRIX_F64);
+			
+			// Store the output value
+			pOutElems[i] = ((MatrixF64Obj*)pOutput)->getScalar();
+		}
+		
+		// If all outputs were logical, so is the result
+		if (allLogical && !pCellArray->isEmpty())
+			return new ArrayObj(pOutMatrix->convert(DataObject::Type::LOGICALARRAY));
+		
+		// Return the output matrix
+		return new ArrayObj(pOutMatrix);
+	}
+	
 	/***************************************************************
 	* Function: createCellArrTypeMapping()
 	* Purpose : Type mapping for cell array creation functions
@@ -1163,6 +1573,235 @@ namespace mcvm_std_lib
 		}
 	}
 	
+	// Output matrix state of csvread
+	struct CsvReadOutput
+	{
+		// Number of leading columns to skip
+		size_t colOffset;
+		
+		// Output matrix, created once the size is known
+		MatrixF64Obj* pMatrix;
+	};
+	
+	/***************************************************************
+	* Function: csvreadAllocColumn()
+	* Purpose : Get the storage of a csvread output column
+	* Initial : agent on October 18, 2026
+	****************************************************************
+	Revisions and bug fixes:
+	*/
+	float64* csvreadAllocColumn(uint32 x, size_t numRows, uint32 numCols, void* pUserData)
+	{
+		// Get the output state
+		CsvReadOutput* pOutput = (CsvReadOutput*)pUserData;
+		
+		// Skipped columns are not stored
+		if (x < pOutput->colOffset)
+			return NULL;
+		
+		// Create the output matrix on the first stored column
+		if (pOutput->pMatrix == NULL)
+			pOutput->pMatrix = new MatrixF64Obj(numRows, numCols - pOutput->colOffset);
+		
+		// Return the storage of this column in the output matrix
+		return pOutput->pMatrix->getElements() + (x - pOutput->colOffset) * numRows;
+	}
+	
+	/***************************************************************
+	* Function: csvreadFunc()
+	* Purpose : Read a numeric matrix from a CSV file
+	* Initial : agent on October 18, 2026
+	****************************************************************
+	Revisions and bug fixes:
+	*/
+	ArrayObj* csvreadFunc(ArrayObj* pArguments)
+	{
+		// Ensure there are one or three arguments
+		if (pArguments->getSize() != 1 && pArguments->getSize() != 3)
+			throw RunError("invalid argument count");
+		
+		// Ensure the file name argument is a string
+		if (pArguments->getObject(0)->getType() != DataObject::Type::CHARARRAY)
+			throw RunError("the file name argument must be a string");
+		
+		// Extract the filename string
+		std::string fileName = ((CharArrayObj*)pArguments->getObject(0))->getString();
+		
+		// Get the zero-based row and column offsets, if specified
+		size_t rowOffset = 0;
+		size_t colOffset = 0;
+		if (pArguments->getSize() == 3)
+		{
+			rowOffset = (size_t)getFloat64Value(pArguments->getObject(1));
+			colOffset = (size_t)getFloat64Value(pArguments->getObject(2));
+		}
+		
+		// Load the file into typed columns, empty cells are zeros,
+		// the numbers are parsed directly into the output matrix
+		SpreadSheet sheet;
+		CsvReadOutput output = { colOffset, NULL };
+		if (!sheet.loadColumns(fileName, rowOffset, false, 0, csvreadAllocColumn, &output))
+			throw RunError("could not read input file: \"" + fileName + "\"");
+		
+		// If there are no columns to output, create an empty matrix
+		if (output.pMatrix == NULL)
+			output.pMatrix = new MatrixF64Obj(sheet.getColumnLength(), 0);
+		
+		// Ensure the output columns are numeric
+		for (size_t c = colOffset; c < sheet.getNumColumns(); ++c)
+		{
+			if (sheet.getColumn(c).Type != SpreadSheet::NUMERIC)
+				throw RunError("non-numeric data in column " + ::toString(c + 1) + " of \"" + fileName + "\"");
+		}
+		
+		// Return the output matrix
+		return new ArrayObj(output.pMatrix);
+	}
+	
+	/***************************************************************
+	* Function: csvreadFuncTypeMapping()
+	* Purpose : Type mapping for the "csvread" library function
+	* Initial : agent on October 18, 2026
+	****************************************************************
+	Revisions and bug fixes:
+	*/
+	TypeSetString csvreadFuncTypeMapping(const TypeSetString& argTypes)
+	{
+		// Return the type info for a 2D floating-point matrix
+		return typeSetStrMake(TypeInfo(
+			DataObject::Type::MATRIX_F64,
+			true,
+			false,
+			false,
+			false,
+			TypeInfo::DimVector(),
+			NULL,
+			TypeSet()
+		));
+	}
+	
+	/***************************************************************
+	* Function: csvwriteFunc()
+	* Purpose : Write a matrix or cell array to a CSV file
+	* Initial : agent on October 18, 2026
+	****************************************************************
+	Revisions and bug fixes:
+	*/
+	ArrayObj* csvwriteFunc(ArrayObj* pArguments)
+	{
+		// Ensure there are two arguments
+		if (pArguments->getSize() != 2)
+			throw RunError("invalid argument count");
+		
+		// Ensure the file name argument is a string
+		if (pArguments->getObject(0)->getType() != DataObject::Type::CHARARRAY)
+			throw RunError("the file name argument must be a string");
+		
+		// Extract the filename string
+		std::string fileName = ((CharArrayObj*)pArguments->getObject(0))->getString();
+		
+		// Get the data argument
+		DataObject* pData = pArguments->getObject(1);
+		
+		// Ensure the data is a 2D matrix
+		if (!pData->isMatrixObj() || !((BaseMatrixObj*)pData)->is2D())
+			throw RunError("the data argument must be a 2D matrix or cell array");
+		
+		// Get the number of rows and columns
+		size_t numRows = ((BaseMatrixObj*)pData)->getSize()[0];
+		size_t numCols = ((BaseMatrixObj*)pData)->getSize()[1];
+		
+		// Struct arrays have no CSV representation
+		if (pData->getType() == DataObject::Type::STRUCTARRAY)
+			throw RunError("cannot write struct arrays to CSV files");
+		
+		// Get the data as a cell array or as a floating-point matrix
+		CellArrayObj* pCellArray = NULL;
+		MatrixF64Obj* pMatrix = NULL;
+		if (pData->getType() == DataObject::Type::CELLARRAY)
+			pCellArray = (CellArrayObj*)pData;
+		else if (pData->getType() == DataObject::Type::MATRIX_F64)
+			pMatrix = (MatrixF64Obj*)pData;
+		else
+			pMatrix = (MatrixF64Obj*)pData->convert(DataObject::Type::MATRIX_F64);
+		
+		// Attempt to open the output file
+		FILE* pFile = ::fopen(fileName.c_str(), "w");
+		if (pFile == NULL)
+			throw RunError("could not open output file: \"" + fileName + "\"");
+		
+		// Declare a buffer for the output text
+		std::string output;
+		
+		// For each row
+		for (size_t r = 0; r < numRows; ++r)
+		{
+			// For each column
+			for (size_t c = 0; c < numCols; ++c)
+			{
+				// Separate the cells with commas
+				if (c > 0)
+					output += ',';
+				
+				// If the data is a numeric matrix, write the value
+				if (pMatrix != NULL)
+				{
+					appendFormat(output, "%.15g", pMatrix->getElements()[c * numRows + r]);
+					continue;
+				}
+				
+				// Get the cell array element
+				// Note: packed elements are boxed one at a time
+				DataObject* pElem = pCellArray->getElem1D(c * numRows + r + 1);
+				
+				// Empty elements produce empty cells
+				if (pElem == NULL || (pElem->isMatrixObj() && ((BaseMatrixObj*)pElem)->isEmpty()))
+					continue;
+				
+				// If the element is a string, write it quoted
+				if (pElem->getType() == DataObject::Type::CHARARRAY)
+				{
+					std::string text = ((CharArrayObj*)pElem)->getString();
+					output += '"';
+					for (size_t i = 0; i < text.length(); ++i)
+					{
+						if (text[i] == '"') output += '"';
+						output += text[i];
+					}
+					output += '"';
+				}
+				
+				// Otherwise, the element must be a numeric scalar
+				else
+				{
+					appendFormat(output, "%.15g", getFloat64Value(pElem));
+				}
+			}
+			
+			// End the row
+			output += '\n';
+			
+			// If enough output is pending, write it out
+			if (output.size() >= FILE_BUFFER_SIZE)
+			{
+				if (::fwrite(output.data(), 1, output.size(), pFile) != output.size())
+				{
+					::fclose(pFile);
+					throw RunError("could not write to output file: \"" + fileName + "\"");
+				}
+				output.clear();
+			}
+		}
+		
+		// Write the remaining output and close the file
+		size_t numWritten = ::fwrite(output.data(), 1, output.size(), pFile);
+		if (::fclose(pFile) != 0 || numWritten != output.size())
+			throw RunError("could not write to output file: \"" + fileName + "\"");
+		
+		// Return nothing
+		return new ArrayObj();
+	}
+	
 	/***************************************************************
 	* Function: diagFunc()
 	* Purpose : Create diagonal matrices
@@ -1365,7 +2004,7 @@ namespace mcvm_std_lib
             auto obj = pArguments->getObject(0) ;
             assert (obj != NULL) ;
 
-            std::cout << obj->toString() << std::endl;		
+            std::cout << obj->toString() << '\n';
 
             // Return nothing
             return new ArrayObj();
@@ -1727,6 +2366,10 @@ namespace mcvm_std_lib
 	* Initial : Maxime Chevalier-Boisvert on July 11, 2009
 	****************************************************************
 	Revisions and bug fixes:
+	
+	agent on October 18, 2026
+	Buffered output is written out first. An error is raised if it
+	could not all be written.
 	*/
 	ArrayObj* fcloseFunc(ArrayObj* pArguments)
 	{
@@ -1748,12 +2391,18 @@ namespace mcvm_std_lib
 		if (fileItr == openFileMap.end())
 			return new ArrayObj(new MatrixF64Obj(-1));
 		
-		// Close the file
-		::fclose(fileItr->second);
+		// Write out any buffered output and close the file
+		bool success = flushOutFile(fileItr->second);
+		if (::fclose(fileItr->second.pHandle) != 0)
+			success = false;
 		
 		// Remove the entry from the open file map
 		openFileMap.erase(fileId);
 		
+		// If the output could not all be written, the operation fails
+		if (success == false)
+			throw RunError("could not write to file");
+		
 		// The operation was successful, return 0
 		return new ArrayObj(new MatrixF64Obj(0));
 	}
@@ -1913,6 +2562,9 @@ namespace mcvm_std_lib
 	* Initial : Maxime Chevalier-Boisvert on February 26, 2009
 	****************************************************************
 	Revisions and bug fixes:
+
+	agent on October 18, 2026
+	Negative values were rounded down instead of towards zero.
 	*/
 	ArrayObj* fixFunc(ArrayObj* pArguments)
 	{
@@ -1938,8 +2590,8 @@ namespace mcvm_std_lib
 			// For each element of the matrices
 			for (float64 *pIn = pInMatrix->getElements(), *pOut = pOutMatrix->getElements(); pIn < pLastElem; ++pIn, ++pOut)
 			{
-				// Apply the floor function to this element
-				*pOut = ::floor(*pIn);
+				// Round this element towards zero
+				*pOut = (*pIn < 0)? ::ceil(*pIn) : ::floor(*pIn);
 			}			
 			
 			// Return the output matrix
@@ -2047,12 +2699,15 @@ namespace mcvm_std_lib
 		if (pFileHandle == NULL)
 			return new ArrayObj(new MatrixF64Obj(-1));
 		
+		// Output is buffered in the file table, disable stdio buffering
+		::setvbuf(pFileHandle, NULL, _IONBF, 0);
+		
 		// Find the lowest available file id
 		size_t fileId = 3;
 		while (openFileMap.find(fileId) != openFileMap.end()) ++fileId;
 	
 		// Add an entry in the open file map for this file
-		openFileMap[fileId] = pFileHandle;
+		openFileMap[fileId].pHandle = pFileHandle;
 	
 		// Return the file id of the newly opened file
 		return new ArrayObj(new MatrixF64Obj(fileId));
@@ -2064,6 +2719,9 @@ namespace mcvm_std_lib
 	* Initial : Maxime Chevalier-Boisvert on January 30, 2009
 	****************************************************************
 	Revisions and bug fixes:
+	
+	agent on October 18, 2026
+	File output is buffered, and written out in large blocks.
 	*/
 	ArrayObj* fprintfFunc(ArrayObj* pArguments)
 	{
@@ -2074,40 +2732,24 @@ namespace mcvm_std_lib
 		// Extract the firat argument
 		DataObject* pFirstArg = pArguments->getObject(0);
 		
-		// Declare a variable for the output file index
-		size_t outIndex;
+		// If the first argument is a string, the output file is
+		// standard output, otherwise it is the output file index
+		bool hasFileId = (pFirstArg->getType() != DataObject::Type::CHARARRAY);
+		size_t outIndex = hasFileId? getIndexValue(pFirstArg):1;
 		
-		// Declare a string to the output text
-		std::string outText;
+		// Get the index of the format argument
+		size_t formatArg = hasFileId? 1:0;
 		
-		// If the first argument is a string
-		if (pFirstArg->getType() == DataObject::Type::CHARARRAY)
+		// If the desired output is standard out or standard error
+		if (outIndex == 1 || outIndex == 2)
 		{
-			// The output file is standard output
-			outIndex = 1;
+			// Format the output text into the reusable buffer
+			stdOutBuffer.clear();
+			formatPrint(pArguments, formatArg, stdOutBuffer);
 			
-			// Perform formatted printing on the input arguments directly
-			outText = formatPrint(pArguments);
-		}
-		else
-		{
-			// Extract the output index argument
-			outIndex = getIndexValue(pFirstArg);
-		
-			// Store the remaining arguments in a separate array
-			ArrayObj* pRemArgs = new ArrayObj();
-			for (size_t i = 1; i < pArguments->getSize(); ++i)
-				ArrayObj::addObject(pRemArgs, pArguments->getObject(i));
-			
-			// Perform formatted printing
-			outText = formatPrint(pRemArgs);
-		}		
-		
-		// If the desired output is standard out
-		if (outIndex == 1)
-		{
-			// Send the output to stdout
-			std::cout << outText;
+			// Send the output to the stream in one write
+			std::ostream& outStream = (outIndex == 1)? std::cout:std::cerr;
+			outStream.write(stdOutBuffer.data(), stdOutBuffer.size());
 		}
 		
 		// For all other output index values
@@ -2120,8 +2762,12 @@ namespace mcvm_std_lib
 			if (fileItr == openFileMap.end())
 				throw RunError("invalid file id");
 			
-			// Write the output text to the file
-			::fputs(outText.c_str(), fileItr->second);
+			// Format the output text into the file's buffer
+			formatPrint(pArguments, formatArg, fileItr->second.buffer);
+			
+			// If enough output is pending, write it out
+			if (fileItr->second.buffer.size() >= FILE_BUFFER_SIZE && flushOutFile(fileItr->second) == false)
+				throw RunError("could not write to file");
 		}		
 		
 		// Return nothing
@@ -2267,6 +2913,9 @@ namespace mcvm_std_lib
 	* Initial : Maxime Chevalier-Boisvert on February 22, 2009
 	****************************************************************
 	Revisions and bug fixes:
+
+	agent on October 18, 2026
+	Lazy ranges are measured without being expanded.
 	*/
 	ArrayObj* lengthFunc(ArrayObj* pArguments)
 	{
@@ -2277,6 +2926,10 @@ namespace mcvm_std_lib
 		// Get a pointer to the argument
 		DataObject* pArgument = pArguments->getObject(0);
 		
+		// If the argument is a lazy range, it is a row vector of its element count
+		if (pArgument->getType() == DataObject::Type::RANGE)
+			return new ArrayObj(new MatrixF64Obj(((RangeObj*)pArgument)->getElemCount()));
+		
 		// If the argument is a matrix
 		if (pArgument->isMatrixObj())
 		{
@@ -2331,6 +2984,26 @@ namespace mcvm_std_lib
 		// Extract the filename string
 		std::string fileName = ((CharArrayObj*)pArgument)->getString();
 		
+		// If this is a binary variable file
+		if (MatFile::isMatFile(fileName))
+		{
+			// Load the variables from the file
+			MatFile::VarVector variables = MatFile::loadFile(fileName);
+			
+			// Create a scalar struct with one field per variable
+			StructArrayObj* pStruct = new StructArrayObj();
+			ScalarStruct* pScalar = makeScalarStructPtr();
+			for (MatFile::VarVector::iterator itr = variables.begin(); itr != variables.end(); ++itr)
+			{
+				(*pScalar)[itr->first] = itr->second;
+				pStruct->m_Fields.insert(itr->first);
+			}
+			StructArrayObj::writeElem1D(pStruct, 1, pScalar);
+			
+			// Return the variable struct
+			return new ArrayObj(pStruct);
+		}
+		
 		// Declare a string to store the text input
 		std::string input;
 		
@@ -2402,8 +3075,11 @@ namespace mcvm_std_lib
 	*/
 	TypeSetString loadFuncTypeMapping(const TypeSetString& argTypes)
 	{
-		// Return the type info for a 2D floating-point matrix
-		return typeSetStrMake(TypeInfo(
+		// Create a type set to store the output type
+		TypeSet outSet;
+		
+		// Text files produce a 2D floating-point matrix
+		outSet.insert(TypeInfo(
 			DataObject::Type::MATRIX_F64,
 			true,
 			false,
@@ -2413,6 +3089,21 @@ namespace mcvm_std_lib
 			NULL,
 			TypeSet()
 		));
+		
+		// Binary variable files produce a scalar struct
+		outSet.insert(TypeInfo(
+			DataObject::Type::STRUCTARRAY,
+			true,
+			true,
+			false,
+			true,
+			TypeInfo::DimVector(2, 1),
+			NULL,
+			TypeSet()
+		));
+		
+		// Return the possible output types
+		return TypeSetString(1, outSet);
 	}
 	
 	/***************************************************************
@@ -2508,6 +3199,9 @@ namespace mcvm_std_lib
 	* Initial : Maxime Chevalier-Boisvert on February 23, 2009
 	****************************************************************
 	Revisions and bug fixes:
+
+	agent on October 18, 2026
+	The maximum of a lazy range is read from its ends.
 	*/
 	ArrayObj* maxFunc(ArrayObj* pArguments)
 	{
@@ -2516,6 +3210,10 @@ namespace mcvm_std_lib
 		{	
 			// Get a pointer to the argument
 			DataObject* pArgument = pArguments->getObject(0);
+			
+			// If the argument is a lazy range, its maximum is at one of its ends
+			if (pArgument->getType() == DataObject::Type::RANGE)
+				return new ArrayObj(new MatrixF64Obj(((RangeObj*)pArgument)->getMaxVal()));
 	
 			// If the argument is a matrix
 			if (pArgument->getType() == DataObject::Type::MATRIX_F64)
@@ -2660,6 +3358,9 @@ namespace mcvm_std_lib
 	* Initial : Maxime Chevalier-Boisvert on February 2, 2009
 	****************************************************************
 	Revisions and bug fixes:
+
+	agent on October 18, 2026
+	Lazy ranges are averaged in closed form.
 	*/
 	ArrayObj* meanFunc(ArrayObj* pArguments)
 	{
@@ -2670,6 +3371,10 @@ namespace mcvm_std_lib
 		// Get a pointer to the argument
 		DataObject* pArgument = pArguments->getObject(0);
 
+		// If the argument is a lazy range, its mean is the midpoint of its ends
+		if (pArgument->getType() == DataObject::Type::RANGE)
+			return new ArrayObj(new MatrixF64Obj((((RangeObj*)pArgument)->getStartVal() + ((RangeObj*)pArgument)->getLastVal()) / 2));
+
 		// If the argument is not a 64-bit float matrix, convert its type
 		if (pArgument->getType() != DataObject::Type::MATRIX_F64)
 			pArgument = pArgument->convert(DataObject::Type::MATRIX_F64);
@@ -2738,6 +3443,9 @@ namespace mcvm_std_lib
 	* Initial : Maxime Chevalier-Boisvert on February 18, 2009
 	****************************************************************
 	Revisions and bug fixes:
+
+	agent on October 18, 2026
+	The minimum of a lazy range is read from its ends.
 	*/
 	ArrayObj* minFunc(ArrayObj* pArguments)
 	{
@@ -2746,6 +3454,10 @@ namespace mcvm_std_lib
 		{	
 			// Get a pointer to the argument
 			DataObject* pArgument = pArguments->getObject(0);
+			
+			// If the argument is a lazy range, its minimum is at one of its ends
+			if (pArgument->getType() == DataObject::Type::RANGE)
+				return new ArrayObj(new MatrixF64Obj(((RangeObj*)pArgument)->getMinVal()));
 	
 			// If the argument is a matrix
 			if (pArgument->getType() == DataObject::Type::MATRIX_F64)
@@ -3035,6 +3747,9 @@ namespace mcvm_std_lib
 	* Initial : Maxime Chevalier-Boisvert on January 25, 2009
 	****************************************************************
 	Revisions and bug fixes:
+
+	agent on October 18, 2026
+	Lazy ranges are counted without being expanded.
 	*/
 	ArrayObj* numelFunc(ArrayObj* pArguments)
 	{
@@ -3045,6 +3760,10 @@ namespace mcvm_std_lib
 		// Get a pointer to the first argument
 		DataObject* pObject = pArguments->getObject(0);
 		
+		// If the object is a lazy range, return its element count
+		if (pObject->getType() == DataObject::Type::RANGE)
+			return new ArrayObj(new MatrixF64Obj(((RangeObj*)pObject)->getElemCount()));
+		
 		// If the object is a matrix
 		if (pObject->isMatrixObj())
 		{
@@ -3056,24 +3775,348 @@ namespace mcvm_std_lib
 		}
 		else
 		{
-			// Return 1
-			return new ArrayObj(new MatrixF64Obj(1));
+			// Return 1
+			return new ArrayObj(new MatrixF64Obj(1));
+		}
+	}
+	
+	/***************************************************************
+	* Function: onesFunc()
+	* Purpose : Create and initialize a matrix
+	* Initial : Maxime Chevalier-Boisvert on January 29, 2009
+	****************************************************************
+	Revisions and bug fixes:
+	*/
+	ArrayObj* onesFunc(ArrayObj* pArguments)
+	{
+		// Create and initialize the matrix
+		return createMatrix(pArguments, 1);
+	}
+
+#ifdef MCVM_USE_JIT
+	// State of a parallel loop shared by its chunk tasks
+	struct ParallelLoopState
+	{
+		// Function running a chunk of the loop
+		ProgFunction* pChunkFunc;
+		
+		// Number of output values of the chunk function
+		size_t numOutputs;
+		
+		// Arguments and output values of each chunk
+		std::vector<ArrayObj*, gc_allocator<ArrayObj*> > chunkArgs;
+		std::vector<ArrayObj*, gc_allocator<ArrayObj*> > chunkOutputs;
+		
+		// Flags indicating that a chunk failed
+		std::vector<char> chunkFailed;
+		
+		// Random number seeds of the chunks
+		std::vector<unsigned int> chunkSeeds;
+	};
+	
+	/***************************************************************
+	* Function: runParallelChunk()
+	* Purpose : Run one chunk of a parallel loop
+	* Initial : agent on October 18, 2026
+	****************************************************************
+	Revisions and bug fixes:
+	*/
+	void runParallelChunk(size_t chunkIndex, void* pData)
+	{
+		// Get a typed pointer to the loop state
+		ParallelLoopState* pState = (ParallelLoopState*)pData;
+		
+		// Seed the random numbers drawn by the chunk
+		// Note: this thread may be the caller's, which keeps drawing
+		// from its own sequence once the chunk is done
+		randThreadSeed = pState->chunkSeeds[chunkIndex];
+		randInChunk = true;
+		
+		// Errors cannot be thrown across threads, a failed chunk
+		// makes the caller run the loop serially instead, which
+		// reports the error at the iteration where it occurs
+		try
+		{
+			pState->chunkOutputs[chunkIndex] = JITCompiler::callFunction(
+				pState->pChunkFunc,
+				pState->chunkArgs[chunkIndex],
+				pState->numOutputs
+			);
+		}
+		catch (...)
+		{
+			pState->chunkFailed[chunkIndex] = true;
+		}
+		
+		randInChunk = false;
+	}
+	
+	/***************************************************************
+	* Function: getSliceShape()
+	* Purpose : Get the layout of the slices of an array indexed
+	*           by a loop variable
+	* Initial : agent on October 18, 2026
+	****************************************************************
+	Revisions and bug fixes:
+	*/
+	void getSliceShape(const BaseMatrixObj* pMatrix, size_t loopVarPos, size_t numSubs, size_t& sliceSize, size_t& extent, size_t& numBlocks)
+	{
+		// Get the size of the matrix
+		const DimVector& size = pMatrix->getSize();
+		
+		// Linear indexing slices single elements
+		if (numSubs == 1)
+		{
+			sliceSize = 1;
+			extent = pMatrix->getNumElems();
+			numBlocks = 1;
+			return;
+		}
+		
+		// Elements of the dimensions before the loop variable are
+		// contiguous, the last index spans the remaining dimensions
+		sliceSize = 1;
+		for (size_t i = 0; i < loopVarPos && i < size.size(); ++i)
+			sliceSize *= size[i];
+		extent = (loopVarPos < size.size())? size[loopVarPos]:1;
+		numBlocks = 1;
+		for (size_t i = loopVarPos + 1; i < size.size(); ++i)
+			numBlocks *= size[i];
+		if (loopVarPos == numSubs - 1)
+		{
+			extent *= numBlocks;
+			numBlocks = 1;
+		}
+	}
+	
+	/***************************************************************
+	* Function: getChunkSlice()
+	* Purpose : Create the indices selecting the slices of an array
+	*           accessed by a chunk of a parallel loop
+	* Initial : agent on October 18, 2026
+	****************************************************************
+	Revisions and bug fixes:
+	*/
+	ArrayObj* getChunkSlice(size_t loopVarPos, size_t numSubs, float64 firstIndex, float64 lastIndex)
+	{
+		// Select the index range of the chunk along the loop variable,
+		// and the full range along the other indices
+		ArrayObj* pSlice = new ArrayObj(numSubs);
+		for (size_t i = 0; i < numSubs; ++i)
+		{
+			if (i == loopVarPos)
+				ArrayObj::addObject(pSlice, new RangeObj(firstIndex, 1, lastIndex));
+			else
+				ArrayObj::addObject(pSlice, new RangeObj(RangeObj::FULL_RANGE));
 		}
+		
+		// Return the slice indices
+		return pSlice;
 	}
 	
 	/***************************************************************
-	* Function: onesFunc()
-	* Purpose : Create and initialize a matrix
-	* Initial : Maxime Chevalier-Boisvert on January 29, 2009
+	* Function: parallelLoopNotRun()
+	* Purpose : Produce the output of a parallel loop left to be
+	*           run serially
+	* Initial : agent on October 18, 2026
 	****************************************************************
 	Revisions and bug fixes:
 	*/
-	ArrayObj* onesFunc(ArrayObj* pArguments)
+	ArrayObj* parallelLoopNotRun(const std::vector<DataObject*, gc_allocator<DataObject*> >& values)
 	{
-		// Create and initialize the matrix
-		return createMatrix(pArguments, 1);
+		// Return the false flag and the unchanged values
+		ArrayObj* pOutput = new ArrayObj(values.size() + 1);
+		ArrayObj::addObject(pOutput, new LogicalArrayObj(false));
+		for (size_t i = 0; i < values.size(); ++i)
+			ArrayObj::addObject(pOutput, values[i]);
+		return pOutput;
 	}
-
+	
+	/***************************************************************
+	* Function: parallelLoopFunc()
+	* Purpose : Run the chunks of a parallel loop on the worker
+	*           threads
+	* Initial : agent on October 18, 2026
+	****************************************************************
+	Revisions and bug fixes:
+	*/
+	ArrayObj* parallelLoopFunc(ArrayObj* pArguments)
+	{
+		// Ensure the function handle, index range and variable counts are present
+		if (pArguments->getSize() < 5 || pArguments->getObject(0)->getType() != DataObject::Type::FN_HANDLE)
+			throw RunError("invalid parallel loop arguments");
+		
+		// Get the chunk function
+		Function* pFunction = ((FnHandleObj*)pArguments->getObject(0))->getFunction();
+		if (pFunction->isProgFunction() == false)
+			throw RunError("invalid parallel loop arguments");
+		ProgFunction* pChunkFunc = (ProgFunction*)pFunction;
+		
+		// Get the index range and the variable counts
+		float64 first = getFloat64Value(pArguments->getObject(1));
+		float64 last = getFloat64Value(pArguments->getObject(2));
+		size_t numSliced = getInt64Value(pArguments->getObject(3));
+		size_t numReduct = getInt64Value(pArguments->getObject(4));
+		if (pArguments->getSize() < 5 + 3 * numSliced + 2 * numReduct)
+			throw RunError("invalid parallel loop arguments");
+		
+		// Get the sliced arrays with the position of the loop variable and
+		// their number of indices, and the reductions with their operator
+		std::vector<DataObject*, gc_allocator<DataObject*> > values;
+		std::vector<size_t> slicedPos;
+		std::vector<size_t> slicedSubs;
+		std::vector<BinaryOpExpr::Operator> reductOps;
+		size_t argIndex = 5;
+		for (size_t i = 0; i < numSliced; ++i, argIndex += 3)
+		{
+			values.push_back(pArguments->getObject(argIndex));
+			slicedPos.push_back(getInt64Value(pArguments->getObject(argIndex + 1)) - 1);
+			slicedSubs.push_back(getInt64Value(pArguments->getObject(argIndex + 2)));
+		}
+		for (size_t i = 0; i < numReduct; ++i, argIndex += 2)
+		{
+			values.push_back(pArguments->getObject(argIndex));
+			reductOps.push_back((BinaryOpExpr::Operator)getInt64Value(pArguments->getObject(argIndex + 1)));
+		}
+		
+		// Get the number of iterations
+		float64 numIters = ::floor(last - first) + 1;
+		
+		// Run the loop serially if there is nothing to run in parallel, or if
+		// the worker threads are in use, such as by an enclosing parallel loop
+		if (numIters < 2 || first != ::floor(first) || WorkerPool::getNumThreads() < 2 ||
+			WorkerPool::getThreadIndex() != 0 || WorkerPool::isBusy())
+			return parallelLoopNotRun(values);
+		
+		// Get the number of chunks to split the iterations into
+		size_t numChunks = std::min((float64)WorkerPool::getNumThreads(), numIters);
+		
+		// The loop must only write inside the sliced arrays
+		float64 firstIndex = first;
+		float64 lastIndex = first + numIters - 1;
+		std::vector<size_t> sliceSizes(numSliced);
+		std::vector<size_t> extents(numSliced);
+		std::vector<size_t> numBlocks(numSliced);
+		for (size_t i = 0; i < numSliced; ++i)
+		{
+			// The array must be one whose slices can be copied
+			DataObject::Type type = values[i]->getType();
+			if (type != DataObject::Type::MATRIX_F32 && type != DataObject::Type::MATRIX_F64 &&
+				type != DataObject::Type::MATRIX_C128 && type != DataObject::Type::LOGICALARRAY &&
+				type != DataObject::Type::CHARARRAY && type != DataObject::Type::CELLARRAY)
+				return parallelLoopNotRun(values);
+			
+			// The indices may not outnumber the array dimensions
+			if (slicedSubs[i] > ((BaseMatrixObj*)values[i])->getSize().size())
+				return parallelLoopNotRun(values);
+			
+			// The indexed slices must lie inside the array, which writes could not grow
+			getSliceShape((BaseMatrixObj*)values[i], slicedPos[i], slicedSubs[i], sliceSizes[i], extents[i], numBlocks[i]);
+			if (firstIndex < 1 || lastIndex > extents[i])
+				return parallelLoopNotRun(values);
+		}
+		
+		// Prepare the arguments of each chunk
+		// Note: each chunk gets a copy of its own slices of the sliced arrays,
+		// and the random number seeds are drawn from the caller's sequence
+		ParallelLoopState state;
+		state.pChunkFunc = pChunkFunc;
+		state.numOutputs = numSliced + numReduct;
+		state.chunkArgs.resize(numChunks);
+		state.chunkOutputs.resize(numChunks);
+		state.chunkFailed.resize(numChunks, false);
+		state.chunkSeeds.resize(numChunks);
+		std::vector<float64> chunkStarts(numChunks + 1);
+		for (size_t c = 0; c <= numChunks; ++c)
+			chunkStarts[c] = first + ::floor(c * numIters / numChunks);
+		std::vector<ArrayObj*, gc_allocator<ArrayObj*> > chunkSlices(numChunks * numSliced);
+		for (size_t c = 0; c < numChunks; ++c)
+		{
+			ArrayObj* pChunkArgs = new ArrayObj(pArguments->getSize() - argIndex + numSliced + 2);
+			ArrayObj::addObject(pChunkArgs, new MatrixF64Obj(chunkStarts[c]));
+			ArrayObj::addObject(pChunkArgs, new MatrixF64Obj(chunkStarts[c+1] - 1));
+			for (size_t i = 0; i < numSliced; ++i)
+			{
+				ArrayObj* pSlice = getChunkSlice(slicedPos[i], slicedSubs[i], chunkStarts[c], chunkStarts[c+1] - 1);
+				chunkSlices[c * numSliced + i] = pSlice;
+				ArrayObj::addObject(pChunkArgs, ((BaseMatrixObj*)values[i])->getSliceND(pSlice));
+			}
+			for (size_t i = argIndex; i < pArguments->getSize(); ++i)
+				ArrayObj::addObject(pChunkArgs, DataObject::lazyCopyObject(pArguments->getObject(i)));
+			state.chunkArgs[c] = pChunkArgs;
+			state.chunkSeeds[c] = ::rand();
+		}
+		
+		// Compile the chunk function before the workers call it
+		JITCompiler::findFunction(pChunkFunc, state.chunkArgs[0], state.numOutputs);
+		
+		// Run the chunks on the worker threads
+		WorkerPool::run(runParallelChunk, numChunks, &state);
+		
+		// If a chunk failed, run the loop serially
+		for (size_t c = 0; c < numChunks; ++c)
+			if (state.chunkFailed[c])
+				return parallelLoopNotRun(values);
+		
+		// Create the output array
+		ArrayObj* pOutput = new ArrayObj(numSliced + numReduct + 1);
+		ArrayObj::addObject(pOutput, new LogicalArrayObj(true));
+		
+		// The chunks must not have changed the type or size of their slices
+		for (size_t c = 0; c < numChunks; ++c)
+		{
+			for (size_t i = 0; i < numSliced; ++i)
+			{
+				DataObject* pInSlice = state.chunkArgs[c]->getObject(i + 2);
+				DataObject* pOutSlice = state.chunkOutputs[c]->getObject(i);
+				if (pOutSlice->getType() != pInSlice->getType() ||
+					((BaseMatrixObj*)pOutSlice)->getSize() != ((BaseMatrixObj*)pInSlice)->getSize())
+					return parallelLoopNotRun(values);
+			}
+		}
+		
+		// For each sliced array
+		for (size_t i = 0; i < numSliced; ++i)
+		{
+			// Copy the array once, the slices written by the chunks are merged into it
+			BaseMatrixObj* pResultMatrix = (BaseMatrixObj*)values[i]->copy();
+			for (size_t c = 0; c < numChunks; ++c)
+				pResultMatrix->setSliceND(chunkSlices[c * numSliced + i], state.chunkOutputs[c]->getObject(i));
+			
+			ArrayObj::addObject(pOutput, pResultMatrix);
+		}
+		
+		// Combine the partial values of the reductions, in chunk order
+		Environment* pEnv = new Environment();
+		SymbolExpr* pLeftSym = SymbolExpr::getSymbol("$a");
+		SymbolExpr* pRightSym = SymbolExpr::getSymbol("$b");
+		for (size_t i = 0; i < numReduct; ++i)
+		{
+			BinaryOpExpr combineExpr(reductOps[i], pLeftSym, pRightSym);
+			DataObject* pValue = values[numSliced + i];
+			
+			try
+			{
+				for (size_t c = 0; c < numChunks; ++c)
+				{
+					Environment::bind(pEnv, pLeftSym, pValue);
+					Environment::bind(pEnv, pRightSym, state.chunkOutputs[c]->getObject(numSliced + i));
+					pValue = Interpreter::evalBinaryExpr(&combineExpr, pEnv);
+				}
+			}
+			catch (RunError error)
+			{
+				return parallelLoopNotRun(values);
+			}
+			
+			ArrayObj::addObject(pOutput, pValue);
+		}
+		
+		// Return the output values
+		return pOutput;
+	}
+#endif
+	
 	/***************************************************************
 	* Function: piFunc()
 	* Purpose : Return the constant pi
@@ -3198,6 +4241,10 @@ namespace mcvm_std_lib
 	* Initial : Maxime Chevalier-Boisvert on February 18, 2009
 	****************************************************************
 	Revisions and bug fixes:
+
+	agent on October 18, 2026
+	Parallel loop chunks draw from their own random number sequence,
+	seeded from the caller's sequence when the loop starts.
 	*/
 	ArrayObj* randFunc(ArrayObj* pArguments)
 	{
@@ -3210,17 +4257,203 @@ namespace mcvm_std_lib
 		// Compute a pointer to the last element of the matrix
 		float64* pLastElem = pMatrix->getElements() + pMatrix->getNumElems();
 		
+		// Note: the rand state may not be shared between threads,
+		// parallel loop chunks use a state of their own instead
 		// For each element of the matrix
 		for (float64 *pVal = pMatrix->getElements(); pVal < pLastElem; ++pVal)
 		{
 			// Generate a pseudo-random number in the range [0,1]
-			*pVal = double(::rand()) / double(RAND_MAX);
+			int randVal = randInChunk? ::rand_r(&randThreadSeed) : ::rand();
+			*pVal = double(randVal) / double(RAND_MAX);
 		}	
 		
 		// Return the output matrix
 		return new ArrayObj(pMatrix);
 	}
 	
+	/***************************************************************
+	* Function: readtableAllocColumn()
+	* Purpose : Create the vector storing a readtable column
+	* Initial : agent on October 18, 2026
+	****************************************************************
+	Revisions and bug fixes:
+	*/
+	float64* readtableAllocColumn(uint32 x, size_t numRows, uint32 numCols, void* pUserData)
+	{
+		// Get the column object vector
+		ArrayObj::ObjVector* pColumns = (ArrayObj::ObjVector*)pUserData;
+		pColumns->resize(numCols);
+		
+		// Create a column vector, the numbers are parsed into it
+		MatrixF64Obj* pVector = new MatrixF64Obj(numRows, 1);
+		(*pColumns)[x] = pVector;
+		
+		// Return the vector storage
+		return pVector->getElements();
+	}
+	
+	/***************************************************************
+	* Function: readtableFunc()
+	* Purpose : Read a CSV file with a header row into typed columns
+	* Initial : agent on October 18, 2026
+	****************************************************************
+	Revisions and bug fixes:
+	*/
+	ArrayObj* readtableFunc(ArrayObj* pArguments)
+	{
+		// Ensure there are one or two arguments
+		if (pArguments->getSize() != 1 && pArguments->getSize() != 2)
+			throw RunError("invalid argument count");
+		
+		// Ensure the arguments are strings
+		for (size_t i = 0; i < pArguments->getSize(); ++i)
+			if (pArguments->getObject(i)->getType() != DataObject::Type::CHARARRAY)
+				throw RunError("invalid input argument types");
+		
+		// Extract the filename string
+		std::string fileName = ((CharArrayObj*)pArguments->getObject(0))->getString();
+		
+		// Load the file into typed columns, empty cells are NaN,
+		// the numbers are parsed directly into column vectors
+		SpreadSheet sheet;
+		ArrayObj::ObjVector columns;
+		if (!sheet.loadColumns(fileName, 0, true, std::numeric_limits<float64>::quiet_NaN(), readtableAllocColumn, &columns))
+			throw RunError("could not read input file: \"" + fileName + "\"");
+		
+		// Get the number of rows in the columns
+		size_t numRows = sheet.getColumnLength();
+		
+		// For each column
+		for (size_t c = 0; c < columns.size(); ++c)
+		{
+			// Get the spreadsheet column
+			const SpreadSheet::Column& column = sheet.getColumn(c);
+			
+			// If the column is numeric, its vector is already filled
+			if (column.Type == SpreadSheet::NUMERIC)
+			{
+				continue;
+			}
+			
+			// Otherwise, store it as a packed cell array of strings
+			else if (Interpreter::s_cellPacking.getBoolValue())
+			{
+				columns[c] = PackedCells::packStrings(column.Strings);
+			}
+			
+			// Otherwise, store it as a cell array of strings
+			else
+			{
+				CellArrayObj* pCellArray = new CellArrayObj(numRows, 1);
+				for (size_t r = 0; r < numRows; ++r)
+					pCellArray->getElements()[r] = new CharArrayObj(column.Strings[r]);
+				columns[c] = pCellArray;
+			}
+		}
+		
+		// If a column name was specified
+		if (pArguments->getSize() == 2)
+		{
+			// Find the column by name in the header row
+			std::string colName = ((CharArrayObj*)pArguments->getObject(1))->getString();
+			int colIndex = sheet.findColumn(colName);
+			
+			// Ensure the column was found
+			if (colIndex < 0 || colIndex >= (int)columns.size())
+				throw RunError("column \"" + colName + "\" not found in \"" + fileName + "\"");
+			
+			// Return the column
+			return new ArrayObj(columns[colIndex]);
+		}
+		
+		// Create a scalar struct with one field per column
+		StructArrayObj* pStruct = new StructArrayObj();
+		ScalarStruct* pScalar = makeScalarStructPtr();
+		for (size_t c = 0; c < columns.size(); ++c)
+		{
+			// Build a valid field name from the column header
+			std::string header = sheet.readCell(c, 0);
+			std::string fieldName;
+			for (size_t i = 0; i < header.length(); ++i)
+				fieldName += isalnum((unsigned char)header[i])? header[i]:'_';
+			if (fieldName.empty())
+				fieldName = "Var" + ::toString(c + 1);
+			else if (!isalpha((unsigned char)fieldName[0]))
+				fieldName = "x" + fieldName;
+			
+			// Make duplicate field names unique
+			if (pScalar->find(fieldName) != pScalar->end())
+				fieldName += "_" + ::toString(c + 1);
+			
+			// Add the column to the struct
+			(*pScalar)[fieldName] = columns[c];
+			pStruct->m_Fields.insert(fieldName);
+		}
+		StructArrayObj::writeElem1D(pStruct, 1, pScalar);
+		
+		// Return the column struct
+		return new ArrayObj(pStruct);
+	}
+	
+	/***************************************************************
+	* Function: readtableFuncTypeMapping()
+	* Purpose : Type mapping for the "readtable" library function
+	* Initial : agent on October 18, 2026
+	****************************************************************
+	Revisions and bug fixes:
+	*/
+	TypeSetString readtableFuncTypeMapping(const TypeSetString& argTypes)
+	{
+		// Create a type set to store the output type
+		TypeSet outSet;
+		
+		// If a single column is requested
+		if (argTypes.size() == 2)
+		{
+			// Numeric columns are column vectors
+			outSet.insert(TypeInfo(
+				DataObject::Type::MATRIX_F64,
+				true,
+				false,
+				false,
+				false,
+				TypeInfo::DimVector(),
+				NULL,
+				TypeSet()
+			));
+			
+			// Text columns are cell arrays of strings
+			outSet.insert(TypeInfo(
+				DataObject::Type::CELLARRAY,
+				true,
+				false,
+				false,
+				false,
+				TypeInfo::DimVector(),
+				NULL,
+				TypeSet()
+			));
+		}
+		
+		// Otherwise, a struct of columns is returned
+		else
+		{
+			outSet.insert(TypeInfo(
+				DataObject::Type::STRUCTARRAY,
+				true,
+				true,
+				false,
+				true,
+				TypeInfo::DimVector(2, 1),
+				NULL,
+				TypeSet()
+			));
+		}
+		
+		// Return the possible output types
+		return TypeSetString(1, outSet);
+	}
+	
 	/***************************************************************
 	* Function: reshapeFunc()
 	* Purpose : Change the shape of matrices
@@ -3506,6 +4739,72 @@ namespace mcvm_std_lib
 		}
 	}
 	
+	/***************************************************************
+	* Function: saveFunc()
+	* Purpose : Save variables to a binary file
+	* Initial : agent on October 18, 2026
+	****************************************************************
+	Revisions and bug fixes:
+	*/
+	ArrayObj* saveFunc(ArrayObj* pArguments)
+	{
+		// Ensure there are at least two arguments
+		if (pArguments->getSize() < 2)
+			throw RunError("invalid argument count");
+		
+		// Ensure the file name argument is a string
+		if (pArguments->getObject(0)->getType() != DataObject::Type::CHARARRAY)
+			throw RunError("the file name argument must be a string");
+		
+		// Extract the filename string
+		std::string fileName = ((CharArrayObj*)pArguments->getObject(0))->getString();
+		
+		// Declare a vector for the variables to save
+		MatFile::VarVector variables;
+		
+		// If a single struct argument is given
+		if (pArguments->getSize() == 2 && pArguments->getObject(1)->getType() == DataObject::Type::STRUCTARRAY)
+		{
+			// Get a typed pointer to the struct
+			StructArrayObj* pStruct = (StructArrayObj*)pArguments->getObject(1);
+			
+			// Ensure the struct is a scalar
+			if (!pStruct->isScalar())
+				throw RunError("the variable struct must be a scalar");
+			
+			// Save each field of the struct as a variable
+			ScalarStruct* pScalar = pStruct->getScalar();
+			for (ScalarStruct::iterator itr = pScalar->begin(); itr != pScalar->end(); ++itr)
+				variables.push_back(MatFile::Variable(itr->first, itr->second));
+		}
+		
+		// Otherwise, the arguments are name/value pairs
+		else
+		{
+			// Ensure the names and values are paired
+			if (pArguments->getSize() % 2 != 1)
+				throw RunError("variable names and values must be given in pairs");
+			
+			// For each name/value pair
+			for (size_t i = 1; i < pArguments->getSize(); i += 2)
+			{
+				// Ensure the variable name is a string
+				if (pArguments->getObject(i)->getType() != DataObject::Type::CHARARRAY)
+					throw RunError("variable names must be strings");
+				
+				// Add the variable to the list
+				std::string name = ((CharArrayObj*)pArguments->getObject(i))->getString();
+				variables.push_back(MatFile::Variable(name, pArguments->getObject(i+1)));
+			}
+		}
+		
+		// Save the variables to the file
+		MatFile::saveFile(fileName, variables);
+		
+		// Return nothing
+		return new ArrayObj();
+	}
+	
 	/***************************************************************
 	* Function: signFunc()
 	* Purpose : Compute the sign of numbers
@@ -3596,6 +4895,9 @@ namespace mcvm_std_lib
 	* Initial : Maxime Chevalier-Boisvert on January 25, 2009
 	****************************************************************
 	Revisions and bug fixes:
+
+	agent on October 18, 2026
+	Lazy ranges are sized without being expanded.
 	*/
 	ArrayObj* sizeFunc(ArrayObj* pArguments)
 	{
@@ -3615,6 +4917,14 @@ namespace mcvm_std_lib
 			// Get the size vector of the matrix
 			sizeVector = ((BaseMatrixObj*)pObject)->getSize();
 		}
+		
+		// If the object is a lazy range, it is a row vector
+		else if (pObject->getType() == DataObject::Type::RANGE)
+		{
+			// Set the size to 1xN
+			sizeVector.resize(2,1);
+			sizeVector[1] = ((RangeObj*)pObject)->getElemCount();
+		}
 		else
 		{
 			// Set the size to 1x1
@@ -3852,11 +5162,12 @@ namespace mcvm_std_lib
 	*/
 	ArrayObj* sprintfFunc(ArrayObj* pArguments)
 	{
-		// Perform formatted printing
-		std::string outText = formatPrint(pArguments);	
+		// Perform formatted printing into the reusable buffer
+		stringBuffer.clear();
+		formatPrint(pArguments, 0, stringBuffer);
 		
 		// Return the formatted string
-		return new ArrayObj(new CharArrayObj(outText));
+		return new ArrayObj(new CharArrayObj(stringBuffer));
 	}
 
 	/***************************************************************
@@ -4073,12 +5384,36 @@ namespace mcvm_std_lib
 		return new ArrayObj(new LogicalArrayObj(strEq));
 	}
 	
+	/***************************************************************
+	* Function: getStructValue()
+	* Purpose : Get the field value of a struct array element
+	*           from an argument of the struct function
+	* Initial : agent on October 18, 2026
+	****************************************************************
+	Revisions and bug fixes:
+	*/
+	DataObject* getStructValue(DataObject* pArgValue, size_t index)
+	{
+		// Values other than cell arrays are shared by all elements
+		if (pArgValue->getType() != DataObject::Type::CELLARRAY)
+			return pArgValue;
+
+		// 1x1 cell arrays hold the value of all elements, other
+		// cell arrays hold the value of each element
+		CellArrayObj* pCellArray = (CellArrayObj*)pArgValue;
+		return pCellArray->getElem1D(pCellArray->isScalar()? 1:(index + 1));
+	}
+	
 	/***************************************************************
 	* Function: createStructFunc()
 	* Purpose : Create a structure
 	* Initial : Matthieu Dubet on March 28, 2012
   *****************************************************************
 	Revisions and bug fixes:
+	
+	agent on October 18, 2026
+	Cell array values create struct arrays with one element per cell.
+	Large arrays of real scalar fields are created packed in columns.
 	*/
 	ArrayObj* createStructFunc(ArrayObj* pArguments) {
 
@@ -4096,27 +5431,95 @@ namespace mcvm_std_lib
 		if (pArguments->getSize() % 2 != 0)
 			throw RunError("invalid argument count, il should be an even number") ;
 
-    StructArrayObj* pSAO = new StructArrayObj () ;
+		// Get the field names and values, and the size of the struct array
+		// Note: a cell array value holds the field value of each element,
+		// 1x1 cell arrays and other values are shared by all the elements
+		StructShape::FieldVector fields;
+		std::vector<DataObject*> values;
+		DimVector arraySize(2, 1);
+		bool sizeSet = false;
+		for (size_t i = 0; i < pArguments->getSize(); i += 2)
+		{
+			DataObject* pArgKey = pArguments->getObject(i);
+			DataObject* pArgValue = pArguments->getObject(i + 1);
 
-    ScalarStruct* ss = new ScalarStruct() ;
+			if (pArgKey->getType() != DataObject::Type::CHARARRAY)
+				throw RunError("invalid input argument types, field names should be a chararray");
 
-    for (size_t i = 0 ; i < pArguments->getSize() ;) {
-      DataObject* pArgKey = pArguments->getObject(i++);
-      DataObject* pArgValue= pArguments->getObject(i++);
+			fields.push_back(((CharArrayObj*)pArgKey)->getString());
+			values.push_back(pArgValue);
 
-      if (pArgKey->getType() != DataObject::Type::CHARARRAY )
-        throw RunError("invalid input argument types, field names should be a chararray");
+			// Cell array values other than 1x1 give the size of the struct array
+			if (pArgValue->getType() != DataObject::Type::CELLARRAY || ((CellArrayObj*)pArgValue)->isScalar())
+				continue;
+			if (sizeSet && ((CellArrayObj*)pArgValue)->getSize() != arraySize)
+				throw RunError("cell array values must all have the same size");
+			arraySize = ((CellArrayObj*)pArgValue)->getSize();
+			sizeSet = true;
+		}
 
-      if (pArgValue->getType() == DataObject::Type::CELLARRAY )
-        throw RunError("Multidimentionnal structure is not implemented yet");
+		// Get the shape shared by the elements
+		const StructShape* pShape = StructShape::get(fields);
 
-      std::string key = ((CharArrayObj*)pArgKey)->getString();
-      (* ss ) [key] = pArgValue ;
-      pSAO->m_Fields.insert( pSAO->m_Fields.begin() , key ) ;
-    }
+		// Create the struct array, packed in columns if the fields of
+		// enough elements all hold real scalars
+		StructArrayObj* pSAO = NULL;
+		StructColumns* pColumns = NULL;
+		size_t numElems = 1;
+		for (size_t i = 0; i < arraySize.size(); ++i)
+			numElems *= arraySize[i];
+		if (Interpreter::s_structColumns.getBoolValue() && numElems >= StructColumns::MIN_PACK_ELEMS)
+		{
+			bool realScalars = true;
+			for (size_t j = 0; j < values.size() && realScalars; ++j)
+			{
+				for (size_t i = 0; i < numElems && realScalars; ++i)
+				{
+					DataObject* pValue = getStructValue(values[j], i);
+					realScalars = (pValue != NULL && pValue->getType() == DataObject::Type::MATRIX_F64 && ((MatrixF64Obj*)pValue)->isScalar());
+				}
+			}
+
+			if (realScalars)
+			{
+				pSAO = StructColumns::createArray(pShape, arraySize);
+				pColumns = pSAO->getElements()[0]->getColumns();
+			}
+		}
+		if (pSAO == NULL)
+		{
+			pSAO = new StructArrayObj(arraySize);
+			pSAO->m_Fields.insert(fields.begin(), fields.end());
+			ScalarStruct** pElements = pSAO->getElements();
+			for (size_t i = 0; i < numElems; ++i)
+				pElements[i] = makeShapedScalarStruct(pShape);
+		}
+
+		// Set the field values of each element, later fields with
+		// the same name replacing earlier ones
+		ScalarStruct** pElements = pSAO->getElements();
+		for (size_t j = 0; j < values.size(); ++j)
+		{
+			size_t slot = pShape->findSlot(fields[j]);
+
+			for (size_t i = 0; i < numElems; ++i)
+			{
+				DataObject* pValue = getStructValue(values[j], i);
+
+				if (pColumns != NULL)
+					pColumns->getColumn(slot)[i] = ((MatrixF64Obj*)pValue)->getScalar();
+				else
+					pElements[i]->setSlot(slot, pValue);
+			}
+		}
+
+		// Count the packed array
+		if (pColumns != NULL)
+		{
+			PROF_INCR_COUNTER(Profiler::STRUCT_PACK_COUNT);
+		}
 
-    StructArrayObj::writeElem1D(pSAO,1,ss) ;
-    return new ArrayObj (pSAO) ;
+		return new ArrayObj (pSAO) ;
 	}
 	
 	/***************************************************************
@@ -4210,9 +5613,16 @@ namespace mcvm_std_lib
 	* Initial : Maxime Chevalier-Boisvert on February 20, 2009
 	****************************************************************
 	Revisions and bug fixes:
+
+	agent on October 18, 2026
+	Lazy ranges are summed in closed form.
 	*/
 	ArrayObj* sumFunc(ArrayObj* pArguments)
 	{
+		// If the argument is a lazy range, sum it in closed form
+		if (pArguments->getSize() == 1 && pArguments->getObject(0)->getType() == DataObject::Type::RANGE)
+			return new ArrayObj(new MatrixF64Obj(((RangeObj*)pArguments->getObject(0))->getSum()));
+		
 		// Parse the input arguments
 		size_t opDim;
 		BaseMatrixObj* pMatrixArg = parseVectorArgs(pArguments, opDim);
@@ -4724,8 +6134,11 @@ namespace mcvm_std_lib
 	LibFunction cd			("cd"		, cdFunc		, nullTypeMapping				);
 	LibFunction ceil		("ceil"		, ceilFunc		, intUnaryOpTypeMapping			);
 	LibFunction cell		("cell"		, cellFunc		, createCellArrTypeMapping		);
+	LibFunction cellfun		("cellfun"	, cellfunFunc	, nullTypeMapping				);
 	LibFunction clock		("clock"	, clockFunc		, clockFuncTypeMapping			);
 	LibFunction cos			("cos"		, cosFunc		, unaryOpTypeMapping<false>		);
+	LibFunction csvread		("csvread"	, csvreadFunc	, csvreadFuncTypeMapping		);
+	LibFunction csvwrite	("csvwrite"	, csvwriteFunc	, nullTypeMapping				);
 	LibFunction diag		("diag"		, diagFunc		, diagFuncTypeMapping			);
 	LibFunction disp		("disp"		, dispFunc		, nullTypeMapping				);
 	LibFunction dot			("dot"		, dotFunc		, dotFuncTypeMapping			);
@@ -4759,14 +6172,19 @@ namespace mcvm_std_lib
 	LibFunction num2str		("num2str"	, num2strFunc	, stringValueTypeMapping		);
 	LibFunction numel		("numel"	, numelFunc		, intScalarTypeMapping			);
 	LibFunction ones		("ones"		, onesFunc		, createF64MatTypeMapping		);
+#ifdef MCVM_USE_JIT
+	LibFunction parallelLoop(PARALLEL_LOOP_FUNC, parallelLoopFunc, nullTypeMapping			);
+#endif
 	LibFunction pi			("pi"		, piFunc		, realScalarTypeMapping			);
 #ifdef MCVM_USE_PLOTTING
 	LibFunction plot        ("plot"     , plotFunc      , plotFuncTypeMapping           );
 #endif
 	LibFunction pwd			("pwd"		, pwdFunc		, stringValueTypeMapping		);
 	LibFunction rand		("rand"		, randFunc		, createF64MatTypeMapping		);
+	LibFunction readtable	("readtable", readtableFunc	, readtableFuncTypeMapping		);
 	LibFunction reshape		("reshape"	, reshapeFunc	, reshapeFuncTypeMapping		);
 	LibFunction round		("round"	, roundFunc		, intUnaryOpTypeMapping			);
+	LibFunction save		("save"		, saveFunc		, nullTypeMapping				);
 	LibFunction sign		("sign"		, signFunc		, intUnaryOpTypeMapping			);
 	LibFunction sin			("sin"		, sinFunc		, unaryOpTypeMapping<false>		);
 	LibFunction size		("size"		, sizeFunc		, sizeFuncTypeMapping			);
@@ -4792,9 +6210,17 @@ namespace mcvm_std_lib
 	* Initial : Maxime Chevalier-Boisvert on January 28, 2009
 	****************************************************************
 	Revisions and bug fixes:
+
+	agent on October 18, 2026
+	Scalar math functions are registered as JIT intrinsics from a table.
+	Buffered output is written out when the program exits or terminates.
 	*/
 	void loadLibrary()
 	{
+		// Write out buffered output however the program ends
+		::atexit(flushOutput);
+		prevTerminateHandler = std::set_terminate(flushOutputTerminate);
+		
 		// Bind the library functions in the interpreter's environment
 		Interpreter::setBinding(abs.getFuncName()		, (DataObject*)&abs			);
 		Interpreter::setBinding(any.getFuncName()		, (DataObject*)&any			);
@@ -4803,8 +6229,11 @@ namespace mcvm_std_lib
 		Interpreter::setBinding(cd.getFuncName()		, (DataObject*)&cd			);
 		Interpreter::setBinding(ceil.getFuncName()		, (DataObject*)&ceil		);
 		Interpreter::setBinding(cell.getFuncName()		, (DataObject*)&cell		);
+		Interpreter::setBinding(cellfun.getFuncName()	, (DataObject*)&cellfun		);
 		Interpreter::setBinding(clock.getFuncName()		, (DataObject*)&clock		);
 		Interpreter::setBinding(cos.getFuncName()		, (DataObject*)&cos			);
+		Interpreter::setBinding(csvread.getFuncName()	, (DataObject*)&csvread		);
+		Interpreter::setBinding(csvwrite.getFuncName()	, (DataObject*)&csvwrite	);
 		Interpreter::setBinding(diag.getFuncName()		, (DataObject*)&diag		);
 		Interpreter::setBinding(disp.getFuncName()		, (DataObject*)&disp		);
 		Interpreter::setBinding(dot.getFuncName()		, (DataObject*)&dot			);
@@ -4838,14 +6267,19 @@ namespace mcvm_std_lib
 		Interpreter::setBinding(num2str.getFuncName()	, (DataObject*)&num2str		);
 		Interpreter::setBinding(numel.getFuncName()		, (DataObject*)&numel		);
 		Interpreter::setBinding(ones.getFuncName()		, (DataObject*)&ones		);
+#ifdef MCVM_USE_JIT
+		Interpreter::setBinding(parallelLoop.getFuncName(), (DataObject*)&parallelLoop);
+#endif
 		Interpreter::setBinding(pi.getFuncName()		, (DataObject*)&pi			);
 #ifdef MCVM_USE_PLOTTING
 		Interpreter::setBinding(plot.getFuncName()      , (DataObject*)&plot        );
 #endif
 		Interpreter::setBinding(pwd.getFuncName()		, (DataObject*)&pwd			);
 		Interpreter::setBinding(rand.getFuncName()		, (DataObject*)&rand		);
+		Interpreter::setBinding(readtable.getFuncName()	, (DataObject*)&readtable	);
 		Interpreter::setBinding(reshape.getFuncName()	, (DataObject*)&reshape		);
 		Interpreter::setBinding(round.getFuncName()		, (DataObject*)&round		);
+		Interpreter::setBinding(save.getFuncName()		, (DataObject*)&save		);
 		Interpreter::setBinding(sign.getFuncName()		, (DataObject*)&sign		);
 		Interpreter::setBinding(sin.getFuncName()		, (DataObject*)&sin			);
 		Interpreter::setBinding(size.getFuncName()		, (DataObject*)&size		);
@@ -4865,54 +6299,48 @@ namespace mcvm_std_lib
 		Interpreter::setBinding(unique.getFuncName()	, (DataObject*)&unique		);
 		Interpreter::setBinding(zeros.getFuncName()		, (DataObject*)&zeros		);
 		
-		// Declare a type set for a float64 scalar type
-		TypeSet f64ScalarArg = typeSetMake(TypeInfo(
-			DataObject::Type::MATRIX_F64,
-			true,
-			true,
-			false,
-			true,
-			TypeInfo::DimVector(2,1),
-			NULL,
-			TypeSet()
-		));
-	
-#ifdef MCVM_USE_JIT  
-		// Register an optimized abs function
-		float64 (*pAbsFuncF64)(float64) = std::abs;
-		JITCompiler::regLibraryFunc(
-			&abs,
-			(void*)pAbsFuncF64,
-			TypeSetString(1, f64ScalarArg),
-			f64ScalarArg,
-			true,
-			true,
-			true		
-		);
+		// Let the reductions and size queries take ranges without expanding them
+		length.setAcceptsRange(true);
+		max.setAcceptsRange(true);
+		mean.setAcceptsRange(true);
+		min.setAcceptsRange(true);
+		numel.setAcceptsRange(true);
+		size.setAcceptsRange(true);
+		sum.setAcceptsRange(true);
 		
-		// Register an optimized exp function
-		float64 (*pExpFuncF64)(float64) = ::exp;
-		JITCompiler::regLibraryFunc(
-			&exp,
-			(void*)pExpFuncF64,
-			TypeSetString(1, f64ScalarArg),
-			f64ScalarArg,
-			true,
-			true,
-			true		
-		);
+#ifdef MCVM_USE_JIT  
+		// Library intrinsic table entry type definition
+		struct IntrinsicEntry
+		{
+			const LibFunction* pLibFunc;
+			size_t numArgs;
+			JITCompiler::LibIntrinsic intrinsic;
+		};
 		
-		// Register an optimized sin function
-		float64 (*pSinFuncF64)(float64) = ::sin;
-		JITCompiler::regLibraryFunc(
-			&sin,
-			(void*)pSinFuncF64,
-			TypeSetString(1, f64ScalarArg),
-			f64ScalarArg,
-			true,
-			true,
-			true		
-		);	
+		// Library functions compiled inline when their arguments are real scalars
+		const IntrinsicEntry intrinsics[] =
+		{
+			{ &abs		, 1, JITCompiler::INTR_ABS		},
+			{ &ceil		, 1, JITCompiler::INTR_CEIL		},
+			{ &cos		, 1, JITCompiler::INTR_COS		},
+			{ &eps		, 0, JITCompiler::INTR_EPS		},
+			{ &exp		, 1, JITCompiler::INTR_EXP		},
+			{ &fix		, 1, JITCompiler::INTR_FIX		},
+			{ &floor	, 1, JITCompiler::INTR_FLOOR	},
+			{ &log2		, 1, JITCompiler::INTR_LOG2		},
+			{ &max		, 2, JITCompiler::INTR_MAX		},
+			{ &min		, 2, JITCompiler::INTR_MIN		},
+			{ &mod		, 2, JITCompiler::INTR_MOD		},
+			{ &pi		, 0, JITCompiler::INTR_PI		},
+			{ &round	, 1, JITCompiler::INTR_ROUND	},
+			{ &sign		, 1, JITCompiler::INTR_SIGN		},
+			{ &sin		, 1, JITCompiler::INTR_SIN		},
+			{ &sqrt		, 1, JITCompiler::INTR_SQRT		}
+		};
+		
+		// Register the library intrinsics
+		for (size_t i = 0; i < sizeof(intrinsics) / sizeof(intrinsics[0]); ++i)
+			JITCompiler::regLibraryIntrinsic(intrinsics[i].pLibFunc, intrinsics[i].numArgs, intrinsics[i].intrinsic);
 #endif
 	}
 };
@@ -48,12 +48,21 @@ namespace mcvm_std_lib
 	// Library function used create cell arrays
 	extern LibFunction cell;
 	
+	// Library function used to apply a function to each cell array element
+	extern LibFunction cellfun;
+	
 	// Library function used to get the current time
 	extern LibFunction clock;
 	
 	// Library function used apply the cosine function
 	extern LibFunction cos;
 	
+	// Library function used to read numeric matrices from CSV files
+	extern LibFunction csvread;
+	
+	// Library function used to write matrices to CSV files
+	extern LibFunction csvwrite;
+	
 	// Library function used for creating diagonal matrices
 	extern LibFunction diag;
 	
@@ -162,12 +171,18 @@ namespace mcvm_std_lib
 	// Library function used to generate uniform random numbers
 	extern LibFunction rand;
 	
+	// Library function used to read CSV files into typed columns
+	extern LibFunction readtable;
+	
 	// Library function used to change the shape of matrices
 	extern LibFunction reshape;
 
 	// Library function used to round floating-point numbers
 	extern LibFunction round;
 
+	// Library function used to save variables to binary files
+	extern LibFunction save;
+	
 	// Library function used to obtain the sign of numbers
 	extern LibFunction sign;
 	
@@ -224,6 +239,9 @@ namespace mcvm_std_lib
 	
 	// Function to load the library functions
 	void loadLibrary();
+	
+	// Function to write out all buffered library output
+	void flushOutput();
 };
 
 #endif // #ifndef STDLIB_H_ 
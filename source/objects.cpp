@@ -97,4 +97,11 @@ DataObject* DataObject::copyObject(const DataObject* pObject)
 	PROF_INCR_COUNTER(Profiler::ARRAY_COPY_COUNT); 
 	return pObject->copy();
 }
+
+// Static version of the lazy copy method
+DataObject* DataObject::lazyCopyObject(const DataObject* pObject)
+{ 
+	PROF_INCR_COUNTER(Profiler::ARRAY_LAZY_COPY_COUNT); 
+	return pObject->lazyCopy();
+}
 	
@@ -73,6 +73,9 @@ public:
 	// Method to recursively copy this object
 	virtual DataObject* copy() const = 0;
 	
+	// Method to copy this object, deferring data copies until it is modified
+	virtual DataObject* lazyCopy() const { return copy(); }
+	
 	// Method to obtain a string representation of this node
 	virtual std::string toString() const = 0;
 
@@ -85,6 +88,9 @@ public:
 	// Static version of the copy method
 	static DataObject* copyObject(const DataObject* pObject);
 	
+	// Static version of the lazy copy method
+	static DataObject* lazyCopyObject(const DataObject* pObject);
+	
 	// Static method to get the name of an object type
 	static std::string getTypeName(Type type);
 	
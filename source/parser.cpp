@@ -551,7 +551,7 @@ Statement* CodeParser::parseStatement(const XML::Element* pElement)
 	}
 
 	// If this is a for loop statement
-	else if (pElement->getName() == "ForStmt")
+	else if (pElement->getName() == "ForStmt" || pElement->getName() == "ParforStmt")
 	{
 		// Parse the for loop statement
 		return parseForStmt(pElement);
@@ -1199,6 +1199,9 @@ Statement* CodeParser::parseSwitchStmt(const XML::Element* pElement)
 * Initial : Maxime Chevalier-Boisvert on November 8, 2008
 ****************************************************************
 Revisions and bug fixes:
+
+agent on October 18, 2026
+Parfor statements are parsed as for loops marked as parallel.
 */
 Statement* CodeParser::parseForStmt(const XML::Element* pElement)
 {
@@ -1226,6 +1229,10 @@ Statement* CodeParser::parseForStmt(const XML::Element* pElement)
       // reset the counters
       maxLoopDepth = 0;
     }
+    if (pElement->getName() == "ParforStmt") {
+      // the iterations of a parfor loop are independent
+      annotations |= Statement::PARALLEL;
+    }
 
 	// return the new for statement object
     return new ForStmt((AssignStmt*)pAssignStmt, pLoopBody, annotations);
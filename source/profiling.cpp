@@ -19,8 +19,11 @@
 // Header files
 #include <cassert>
 #include <iostream>
+#include <fstream>
+#include <algorithm>
 #include <cstring>
 #include <sys/time.h>
+#include <gc/gc.h>
 #include "profiling.h"
 #include "interpreter.h"
 #include "cellarrayobj.h"
@@ -47,16 +50,51 @@ const std::string Profiler::COUNTER_VAR_NAMES[NUM_COUNTERS] =
 	"num scalars known",
 	"num matrices found",
 	"num mat. size known",
-	"array copy count"
+	"array copy count",
+	"lazy array copies",
+	"deferred array copies",
+	"unboxed scalar evals",
+	"scalars boxed",
+	"temporaries freed",
+	"pooled buffers reused",
+	"buffers recycled to pool",
+	"gc collections",
+	"gc bytes allocated",
+	"gc heap size",
+	"gc pauses < 1 ms",
+	"gc pauses < 10 ms",
+	"gc pauses < 100 ms",
+	"gc pauses >= 100 ms",
+	"struct arrays packed into columns",
+	"cell arrays packed"
 };
 
 // Timer variable names
 const std::string Profiler::TIMER_VAR_NAMES[NUM_TIMERS] =
 {
 	"total comp. time",
-	"total analysis time"
+	"total analysis time",
+	"total gc time"
 };
 
+// Fallback reason names
+const std::string Profiler::FALLBACK_REASON_NAMES[NUM_FALLBACK_REASONS] =
+{
+	"unsupported statement",
+	"unsupported expression",
+	"unsupported operator",
+	"unknown type",
+	"unresolved symbol",
+	"cell indexing",
+	"struct field access",
+	"nested function",
+	"output display",
+	"optimizations disabled"
+};
+
+// Fallback site dump file name config variable
+ConfigVar Profiler::s_fallbackDumpVar("prof_fallback_dump", ConfigVar::STRING, "");
+
 // Library function to reset the profiling context
 LibFunction Profiler::s_resetContextCmd("mcvm_reset_prof_context", Profiler::resetContextCmd);
 
@@ -69,6 +107,9 @@ LibFunction Profiler::s_printInfoCmd("mcvm_print_prof_info", Profiler::printInfo
 // Current profiler context
 Profiler::Context Profiler::s_curContext;
 
+// Interpreter fallback sites
+Profiler::FallbackSiteMap Profiler::s_fallbackSites;
+
 /***************************************************************
 * Function: Profiler::initialize()
 * Purpose : Initialize the profiler
@@ -82,6 +123,23 @@ void Profiler::initialize()
 	Interpreter::setBinding(s_resetContextCmd.getFuncName(), (DataObject*)&s_resetContextCmd);
 	Interpreter::setBinding(s_getInfoCmd.getFuncName(), (DataObject*)&s_getInfoCmd);
 	Interpreter::setBinding(s_printInfoCmd.getFuncName(), (DataObject*)&s_printInfoCmd);
+	
+	// Register the local config variables
+	ConfigManager::registerVar(&s_fallbackDumpVar);
+}
+
+/***************************************************************
+* Function: Profiler::shutdown()
+* Purpose : Shut down the profiler
+* Initial : agent on October 18, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+void Profiler::shutdown()
+{
+	// If a fallback site dump file was specified, write it
+	if (s_fallbackDumpVar.getStringValue() != "")
+		dumpFallbackSites(s_fallbackDumpVar.getStringValue());
 }
 
 /***************************************************************
@@ -209,6 +267,130 @@ double Profiler::getTimeSeconds()
 	return timeSecs;
 }
 
+/***************************************************************
+* Function: Profiler::regFallbackSite()
+* Purpose : Register an interpreter fallback site of compiled code
+* Initial : agent on October 18, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+Profiler::FallbackSite* Profiler::regFallbackSite(
+	const IIRNode* pNode,
+	const IIRNode* pStmt,
+	const void* pVersion,
+	const std::string& funcName,
+	FallbackReason reason,
+	size_t numSyncVars
+)
+{
+	// Ensure that the reason is valid
+	assert (reason < NUM_FALLBACK_REASONS);
+	
+	// Get the site for this node in this compiled version
+	FallbackSite*& pSite = s_fallbackSites[std::make_pair(pNode, pVersion)];
+	
+	// If the site is new, create it
+	// NOTE: sites are kept when a version is recompiled, so that
+	//       the counts accumulate over all of its compilations
+	if (pSite == NULL)
+		pSite = new FallbackSite(pNode, pStmt, pVersion, funcName);
+	
+	// Update the fallback reason and synchronization cost
+	pSite->reason = reason;
+	pSite->numSyncVars = numSyncVars;
+	
+	// Return the site
+	return pSite;
+}
+
+/***************************************************************
+* Function: Profiler::getFallbackSites()
+* Purpose : Get the fallback sites sorted by execution count
+* Initial : agent on October 18, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+std::vector<const Profiler::FallbackSite*> Profiler::getFallbackSites()
+{
+	// Create a vector to store the sites
+	std::vector<const FallbackSite*> sites;
+	
+	// For each fallback site
+	for (FallbackSiteMap::const_iterator itr = s_fallbackSites.begin(); itr != s_fallbackSites.end(); ++itr)
+		sites.push_back(itr->second);
+	
+	// Sort the sites by decreasing execution count
+	std::stable_sort(sites.begin(), sites.end(),
+		[](const FallbackSite* pA, const FallbackSite* pB) { return pA->execCount > pB->execCount; }
+	);
+	
+	// Return the sorted sites
+	return sites;
+}
+
+/***************************************************************
+* Function: Profiler::dumpFallbackSites()
+* Purpose : Write the fallback site counters to a file
+* Initial : agent on October 18, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+void Profiler::dumpFallbackSites(const std::string& fileName)
+{
+	// Open the output file
+	std::ofstream out(fileName.c_str());
+	
+	// If the file could not be opened, stop
+	if (!out.good())
+	{
+		std::cout << "WARNING: could not open fallback dump file \"" << fileName << "\"" << std::endl;
+		return;
+	}
+	
+	// Write the column header
+	out << "function,version,reason,count,env_writes,statement,expression" << std::endl;
+	
+	// Get the sites, most executed first
+	std::vector<const FallbackSite*> sites = getFallbackSites();
+	
+	// For each fallback site
+	for (size_t i = 0; i < sites.size(); ++i)
+	{
+		const FallbackSite* pSite = sites[i];
+		
+		// Get the text of the statement and of the node, on one line each
+		std::string stmtText = (pSite->pStmt != NULL)? pSite->pStmt->toString():"";
+		std::string nodeText = pSite->pNode->toString();
+		std::replace(stmtText.begin(), stmtText.end(), '\n', ' ');
+		std::replace(nodeText.begin(), nodeText.end(), '\n', ' ');
+		std::replace(stmtText.begin(), stmtText.end(), '"', '\'');
+		std::replace(nodeText.begin(), nodeText.end(), '"', '\'');
+		
+		// Write the site information
+		out << pSite->funcName << "," << pSite->pVersion << ",";
+		out << FALLBACK_REASON_NAMES[pSite->reason] << ",";
+		out << pSite->execCount << "," << pSite->syncCount << ",";
+		out << "\"" << stmtText << "\",\"" << nodeText << "\"" << std::endl;
+	}
+	
+	// Close the output file
+	out.close();
+}
+
+/***************************************************************
+* Function: Profiler::sampleGCStats()
+* Purpose : Update the collector statistics counters
+* Initial : agent on October 18, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+void Profiler::sampleGCStats()
+{
+	// The other collector counters are updated by the collection
+	// event callback, but the heap may also grow between collections
+	s_curContext.counters[GC_HEAP_BYTES] = GC_get_heap_size();
+}
+
 /***************************************************************
 * Function: static Profiler::resetContextCmd()
 * Purpose : Library function to reset the profiling context
@@ -231,6 +413,13 @@ ArrayObj* Profiler::resetContextCmd(ArrayObj* pArguments)
 	// Replace the current profiling context, clearing all counters
 	s_curContext = Context();
 	
+	// Clear the fallback site counters
+	for (FallbackSiteMap::iterator itr = s_fallbackSites.begin(); itr != s_fallbackSites.end(); ++itr)
+	{
+		itr->second->execCount = 0;
+		itr->second->syncCount = 0;
+	}
+	
 	// Return no output
 	return new ArrayObj();
 }
@@ -241,11 +430,16 @@ ArrayObj* Profiler::resetContextCmd(ArrayObj* pArguments)
 * Initial : Maxime Chevalier-Boisvert on July 12, 2009
 ****************************************************************
 Revisions and bug fixes:
+
+agent on October 18, 2026
+The collector statistics are sampled before reporting.
+Added the fallback counts, and the "fallbacks" argument
+to get the counters of each fallback site.
 */
 ArrayObj* Profiler::getInfoCmd(ArrayObj* pArguments)
 {
 	// Ensure that the argument count is valid
-	if (pArguments->getSize() != 0)
+	if (pArguments->getSize() > 1)
 		throw RunError("too many arguments");
 	
 	// If profiling is disabled, let the user know and exit
@@ -254,8 +448,52 @@ ArrayObj* Profiler::getInfoCmd(ArrayObj* pArguments)
 	return new ArrayObj();
 	#endif
 	
+	// If an argument is specified
+	if (pArguments->getSize() == 1)
+	{
+		// Ensure that the fallback sites are requested
+		if (pArguments->getObject(0)->getType() != DataObject::Type::CHARARRAY ||
+			((CharArrayObj*)pArguments->getObject(0))->getString() != "fallbacks")
+			throw RunError("invalid argument, expected \"fallbacks\"");
+		
+		// Get the sites, most executed first
+		std::vector<const FallbackSite*> sites = getFallbackSites();
+		
+		// Create a cell array with one row per fallback site
+		CellArrayObj* pSiteGrid = new CellArrayObj(sites.size(), 6);
+		
+		// For each fallback site
+		for (size_t i = 0; i < sites.size(); ++i)
+		{
+			const FallbackSite* pSite = sites[i];
+			
+			// Write the site location, reason and counters
+			pSiteGrid->setElem2D(i+1, 1, new CharArrayObj(pSite->funcName));
+			pSiteGrid->setElem2D(i+1, 2, new CharArrayObj((pSite->pStmt != NULL)? pSite->pStmt->toString():""));
+			pSiteGrid->setElem2D(i+1, 3, new CharArrayObj(pSite->pNode->toString()));
+			pSiteGrid->setElem2D(i+1, 4, new CharArrayObj(FALLBACK_REASON_NAMES[pSite->reason]));
+			pSiteGrid->setElem2D(i+1, 5, new MatrixF64Obj(pSite->execCount));
+			pSiteGrid->setElem2D(i+1, 6, new MatrixF64Obj(pSite->syncCount));
+		}
+		
+		// Return the cell array
+		return new ArrayObj(pSiteGrid);
+	}
+	
+	// Update the collector statistics sampled outside of collections
+	sampleGCStats();
+	
+	// Sum the fallback counts by reason, and the environment writes
+	uint64 reasonCounts[NUM_FALLBACK_REASONS] = { 0 };
+	uint64 syncCount = 0;
+	for (FallbackSiteMap::const_iterator itr = s_fallbackSites.begin(); itr != s_fallbackSites.end(); ++itr)
+	{
+		reasonCounts[itr->second->reason] += itr->second->execCount;
+		syncCount += itr->second->syncCount;
+	}
+	
 	// Create a cell array with two columns to store the profiling info
-	CellArrayObj* pOutGrid = new CellArrayObj(NUM_COUNTERS + NUM_TIMERS, 2);	
+	CellArrayObj* pOutGrid = new CellArrayObj(NUM_COUNTERS + NUM_TIMERS + NUM_FALLBACK_REASONS + 1, 2);	
 	
 	// For each counter variable
 	for (size_t i = 0; i < NUM_COUNTERS; ++i)
@@ -277,6 +515,20 @@ ArrayObj* Profiler::getInfoCmd(ArrayObj* pArguments)
 		pOutGrid->setElem2D(NUM_COUNTERS + i + 1, 2, new MatrixF64Obj(s_curContext.timers[i]));
 	}
 	
+	// For each fallback reason
+	for (size_t i = 0; i < NUM_FALLBACK_REASONS; ++i)
+	{
+		// Write the number of fallbacks for this reason
+		size_t row = NUM_COUNTERS + NUM_TIMERS + i + 1;
+		pOutGrid->setElem2D(row, 1, new CharArrayObj("fallbacks (" + FALLBACK_REASON_NAMES[i] + ")"));
+		pOutGrid->setElem2D(row, 2, new MatrixF64Obj(reasonCounts[i]));
+	}
+	
+	// Write the number of variables written to the environment by fallbacks
+	size_t syncRow = NUM_COUNTERS + NUM_TIMERS + NUM_FALLBACK_REASONS + 1;
+	pOutGrid->setElem2D(syncRow, 1, new CharArrayObj("fallback env. writes"));
+	pOutGrid->setElem2D(syncRow, 2, new MatrixF64Obj(syncCount));
+	
 	// Return the cell array
 	return new ArrayObj(pOutGrid);
 }
@@ -287,6 +539,9 @@ ArrayObj* Profiler::getInfoCmd(ArrayObj* pArguments)
 * Initial : Maxime Chevalier-Boisvert on April 7, 2009
 ****************************************************************
 Revisions and bug fixes:
+
+agent on October 18, 2026
+The collector statistics are sampled before reporting.
 */
 ArrayObj* Profiler::printInfoCmd(ArrayObj* pArguments)
 {
@@ -300,6 +555,9 @@ ArrayObj* Profiler::printInfoCmd(ArrayObj* pArguments)
 	return new ArrayObj();
 	#endif
 	
+	// Update the collector statistics sampled outside of collections
+	sampleGCStats();
+	
 	// Log that we are about to print the counter variables
 	std::cout << "Counter variables: " << std::endl;
 	
@@ -22,7 +22,10 @@
 
 // Header files
 #include <string>
+#include <vector>
+#include <map>
 #include "platform.h"
+#include "iir.h"
 #include "spreadsheet.h"
 #include "configmanager.h"
 
@@ -50,6 +53,9 @@
 * Initial : Maxime Chevalier-Boisvert on April 7, 2009
 ****************************************************************
 Revisions and bug fixes:
+
+agent on October 18, 2026
+Added the interpreter fallback site counters.
 */
 class Profiler
 {
@@ -77,6 +83,22 @@ public:
 		TYPE_NUM_MATRICES,
 		TYPE_NUM_KNOWN_SIZE,
 		ARRAY_COPY_COUNT,
+		ARRAY_LAZY_COPY_COUNT,
+		ARRAY_UNSHARE_COUNT,
+		SCALAR_UNBOXED_COUNT,
+		SCALAR_BOX_COUNT,
+		TEMP_FREE_COUNT,
+		BUFFER_REUSE_COUNT,
+		BUFFER_RECYCLE_COUNT,
+		GC_COLLECT_COUNT,
+		GC_ALLOC_BYTES,
+		GC_HEAP_BYTES,
+		GC_PAUSE_1MS_COUNT,
+		GC_PAUSE_10MS_COUNT,
+		GC_PAUSE_100MS_COUNT,
+		GC_PAUSE_LONG_COUNT,
+		STRUCT_PACK_COUNT,
+		CELL_PACK_COUNT,
 		NUM_COUNTERS
 	};
 
@@ -85,6 +107,7 @@ public:
 	{
 		COMP_TIME_TOTAL,
 		ANA_TIME_TOTAL,
+		GC_TIME_TOTAL,
 		NUM_TIMERS
 	};
 	
@@ -94,9 +117,68 @@ public:
 	// Timer variable names
 	const static std::string TIMER_VAR_NAMES[NUM_TIMERS];
 	
+	// Reasons for falling back to the interpreter in compiled code
+	enum FallbackReason
+	{
+		FALLBACK_UNSUPPORTED_STMT,
+		FALLBACK_UNSUPPORTED_EXPR,
+		FALLBACK_UNSUPPORTED_OP,
+		FALLBACK_UNKNOWN_TYPE,
+		FALLBACK_UNKNOWN_SYMBOL,
+		FALLBACK_CELL_INDEX,
+		FALLBACK_STRUCT_FIELD,
+		FALLBACK_NESTED_FUNC,
+		FALLBACK_OUTPUT_DISPLAY,
+		FALLBACK_OPTS_DISABLED,
+		NUM_FALLBACK_REASONS
+	};
+	
+	// Fallback reason names
+	const static std::string FALLBACK_REASON_NAMES[NUM_FALLBACK_REASONS];
+	
+	// Interpreter fallback site information class
+	class FallbackSite
+	{
+	public:
+		
+		// Constructor
+		FallbackSite(const IIRNode* pN, const IIRNode* pS, const void* pV, const std::string& func)
+		: pNode(pN), pStmt(pS), pVersion(pV), funcName(func), reason(NUM_FALLBACK_REASONS),
+		  numSyncVars(0), execCount(0), syncCount(0) {}
+		
+		// Node evaluated by the interpreter
+		const IIRNode* pNode;
+		
+		// Statement containing the node
+		const IIRNode* pStmt;
+		
+		// Compiled function version containing the site
+		const void* pVersion;
+		
+		// Name of the function containing the site
+		std::string funcName;
+		
+		// Reason for falling back to the interpreter
+		FallbackReason reason;
+		
+		// Number of variables written to the environment at each execution
+		uint64 numSyncVars;
+		
+		// Number of times the fallback was executed
+		// NOTE: incremented directly by compiled code
+		uint64 execCount;
+		
+		// Total number of variables written to the environment
+		// NOTE: incremented directly by compiled code
+		uint64 syncCount;
+	};
+	
 	// Method to initialize the profiler
 	static void initialize();
 	
+	// Method to shut down the profiler
+	static void shutdown();
+	
 	// Method to increment a counter variable
 	static void incrCounter(CounterVar counterVar);
 	
@@ -111,6 +193,22 @@ public:
 	// Method to get the current time in seconds
 	static double getTimeSeconds();
 	
+	// Method to register an interpreter fallback site of compiled code
+	static FallbackSite* regFallbackSite(
+		const IIRNode* pNode,
+		const IIRNode* pStmt,
+		const void* pVersion,
+		const std::string& funcName,
+		FallbackReason reason,
+		size_t numSyncVars
+	);
+	
+	// Method to write the fallback site counters to a file
+	static void dumpFallbackSites(const std::string& fileName);
+	
+	// Fallback site dump file name config variable
+	static ConfigVar s_fallbackDumpVar;
+	
 	// Library function to reset the profiling context
 	static ArrayObj* resetContextCmd(ArrayObj* pArguments);
 	static LibFunction s_resetContextCmd;
@@ -125,6 +223,9 @@ public:
 	
 private:
 	
+	// Method to update the collector statistics counters
+	static void sampleGCStats();
+	
 	// Profiling context information class
 	class Context
 	{
@@ -148,6 +249,15 @@ private:
 	
 	// Current profiling context
 	static Context s_curContext;
+	
+	// Fallback site map type definition
+	typedef std::map<std::pair<const IIRNode*, const void*>, FallbackSite*> FallbackSiteMap;
+	
+	// Interpreter fallback sites, by node and compiled version
+	static FallbackSiteMap s_fallbackSites;
+	
+	// Method to get the fallback sites sorted by execution count
+	static std::vector<const FallbackSite*> getFallbackSites();
 };
 
 #endif // #ifndef PROFILING_H_
@@ -18,6 +18,7 @@
 
 // Header files
 #include <cassert>
+#include <cmath>
 #include "rangeobj.h"
 #include "matrixobjs.h"
 #include "utility.h"
@@ -117,6 +118,10 @@ size_t RangeObj::getElemCount() const
 * Initial : Maxime Chevalier-Boisvert on February 16, 2008
 ****************************************************************
 Revisions and bug fixes:
+
+agent on October 18, 2026
+Values are computed from their index so that they match the
+lazy range, rounding errors no longer accumulate.
 */
 DataObject* RangeObj::expand() const
 {
@@ -129,19 +134,88 @@ DataObject* RangeObj::expand() const
 	// Create a matrix to store the expanded range
 	MatrixF64Obj* pMatrix = new MatrixF64Obj(1, elemCount);
 	
-	// Initialize the current value to the start value
-	double value = m_startVal;
+	// Get a pointer to the matrix elements
+	float64* pElements = pMatrix->getElements();
 	
-	// For each range element
-	for (size_t i = 1; i <= elemCount; ++i)
-	{
-		// Set the current element
-		pMatrix->setElem1D(i, value);
-		
-		// Update the current value
-		value += m_stepVal;
-	}
+	// Compute the value of each range element
+	for (size_t i = 0; i < elemCount; ++i)
+		pElements[i] = m_startVal + i * m_stepVal;
 	
 	// Return the expanded range
 	return pMatrix;
 }
+
+/***************************************************************
+* Function: RangeObj::getSum()
+* Purpose : Compute the sum of the range values
+* Initial : agent on October 18, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+double RangeObj::getSum() const
+{
+	// Compute the element count
+	size_t elemCount = getElemCount();
+	
+	// If the range is empty, its sum is 0
+	if (elemCount == 0)
+		return 0;
+	
+	// Sum the arithmetic series
+	return elemCount * (m_startVal + getLastVal()) / 2;
+}
+
+/***************************************************************
+* Function: isExactInteger()
+* Purpose : Test if a value is an integer on which double
+*           arithmetic is exact
+* Initial : agent on October 18, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+static bool isExactInteger(double value)
+{
+	// Integers up to 2^53 in magnitude are represented exactly
+	return (std::abs(value) <= 9007199254740992.0 && value == std::floor(value));
+}
+
+/***************************************************************
+* Function: RangeObj::affine()
+* Purpose : Get the range of the values scaled and offset
+* Initial : agent on October 18, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+RangeObj* RangeObj::affine(double scale, double offset) const
+{
+	// Ensure that this is not a full range
+	assert (!isFullRange());
+	
+	// Compute the element count
+	size_t elemCount = getElemCount();
+	
+	// Empty ranges and collapsed steps are not representable
+	double newStep = m_stepVal * scale;
+	if (elemCount == 0 || newStep == 0)
+		return NULL;
+	
+	// Transform the first and last values
+	double newStart = m_startVal * scale + offset;
+	double newEnd = getLastVal() * scale + offset;
+	
+	// Unless every value involved is an exact integer, the transformed
+	// range would not match element-wise evaluation bit for bit
+	if (!isExactInteger(m_startVal) || !isExactInteger(m_stepVal) || !isExactInteger(scale) || !isExactInteger(offset) ||
+		!isExactInteger(newStart) || !isExactInteger(newStep) || !isExactInteger(newEnd) || !isExactInteger(getLastVal() * scale))
+		return NULL;
+	
+	// Create the transformed range
+	RangeObj* pNewRange = new RangeObj(newStart, newStep, newEnd);
+	
+	// If rounding changed the element count, the range cannot be used
+	if (pNewRange->getElemCount() != elemCount)
+		return NULL;
+	
+	// Return the transformed range
+	return pNewRange;
+}
@@ -29,6 +29,9 @@
 * Initial : Maxime Chevalier-Boisvert on February 16, 2009
 ****************************************************************
 Revisions and bug fixes:
+
+agent on October 18, 2026
+Added closed-form reductions and affine transformations.
 */
 class RangeObj : public DataObject
 {
@@ -61,6 +64,17 @@ public:
 	
 	// Method to expand this range into a vector
 	DataObject* expand() const;
+
+	// Method to get the value of the last element in the range
+	double getLastVal() const { return m_startVal + (getElemCount() - 1) * m_stepVal; }
+
+	// Methods to compute the sum, minimum and maximum of the range values
+	double getSum() const;
+	double getMinVal() const { return (m_stepVal > 0)? m_startVal:getLastVal(); }
+	double getMaxVal() const { return (m_stepVal > 0)? getLastVal():m_startVal; }
+
+	// Method to get the range of the values scaled and offset
+	RangeObj* affine(double scale, double offset) const;
 	
 	// Accessors to get the start, step and env values
 	double getStartVal() const { return m_startVal; }
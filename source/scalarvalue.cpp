@@ -0,0 +1,95 @@
+// =========================================================================== //
+//                                                                             //
+// Copyright 2026 agent.                                                       //
+//                                                                             //
+//   Licensed under the Apache License, Version 2.0 (the "License");           //
+//   you may not use this file except in compliance with the License.          //
+//   You may obtain a copy of the License at                                   //
+//                                                                             //
+//       http://www.apache.org/licenses/LICENSE-2.0                            //
+//                                                                             //
+//   Unless required by applicable law or agreed to in writing, software       //
+//   distributed under the License is distributed on an "AS IS" BASIS,         //
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  //
+//   See the License for the specific language governing permissions and       //
+//  limitations under the License.                                             //
+//                                                                             //
+// =========================================================================== //
+
+
+// Header files
+#include <cassert>
+#include "scalarvalue.h"
+#include "matrixobjs.h"
+#include "profiling.h"
+
+/***************************************************************
+* Function: ScalarValue::box()
+* Purpose : Allocate a matrix object holding this value
+* Initial : agent on October 18, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+DataObject* ScalarValue::box() const
+{
+	// Ensure that the value is valid
+	assert (m_tag != NONE);
+	
+	// Increment the scalar boxing count
+	PROF_INCR_COUNTER(Profiler::SCALAR_BOX_COUNT);
+	
+	// If this is a logical value, create a logical array
+	if (m_tag == BOOL)
+		return new LogicalArrayObj(m_boolVal);
+	
+	// Otherwise, create a floating-point matrix
+	return new MatrixF64Obj(m_f64Val);
+}
+
+/***************************************************************
+* Function: static ScalarValue::unbox()
+* Purpose : Extract the value of a real or logical scalar
+* Initial : agent on October 18, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+bool ScalarValue::unbox(const DataObject* pObject, ScalarValue& value)
+{
+	// Switch on the object type
+	switch (pObject->getType())
+	{
+		// Floating-point matrix
+		case DataObject::Type::MATRIX_F64:
+		{
+			// Get a typed pointer to the matrix
+			const MatrixF64Obj* pMatrix = (const MatrixF64Obj*)pObject;
+			
+			// If the matrix is not scalar, it cannot be unboxed
+			if (pMatrix->isScalar() == false)
+				return false;
+			
+			// Extract the scalar value
+			value = makeF64(pMatrix->getScalar());
+		}
+		return true;
+		
+		// Logical array
+		case DataObject::Type::LOGICALARRAY:
+		{
+			// Get a typed pointer to the matrix
+			const LogicalArrayObj* pMatrix = (const LogicalArrayObj*)pObject;
+			
+			// If the matrix is not scalar, it cannot be unboxed
+			if (pMatrix->isScalar() == false)
+				return false;
+			
+			// Extract the scalar value
+			value = makeBool(pMatrix->getScalar());
+		}
+		return true;
+		
+		// Other object types are not unboxed
+		default:
+		return false;
+	}
+}
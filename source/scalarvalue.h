@@ -0,0 +1,84 @@
+// =========================================================================== //
+//                                                                             //
+// Copyright 2026 agent.                                                       //
+//                                                                             //
+//   Licensed under the Apache License, Version 2.0 (the "License");           //
+//   you may not use this file except in compliance with the License.          //
+//   You may obtain a copy of the License at                                   //
+//                                                                             //
+//       http://www.apache.org/licenses/LICENSE-2.0                            //
+//                                                                             //
+//   Unless required by applicable law or agreed to in writing, software       //
+//   distributed under the License is distributed on an "AS IS" BASIS,         //
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  //
+//   See the License for the specific language governing permissions and       //
+//  limitations under the License.                                             //
+//                                                                             //
+// =========================================================================== //
+
+
+// Include guards
+#ifndef SCALARVALUE_H_
+#define SCALARVALUE_H_
+
+// Header files
+#include "platform.h"
+#include "objects.h"
+
+/***************************************************************
+* Class   : ScalarValue
+* Purpose : Tagged, unboxed real or logical scalar value
+* Initial : agent on October 18, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+class ScalarValue
+{
+public:
+	
+	// Enumerate value tags
+	enum Tag
+	{
+		NONE,
+		F64,
+		BOOL
+	};
+	
+	// Default constructor, produces an invalid value
+	ScalarValue() : m_tag(NONE), m_f64Val(0) {}
+	
+	// Static methods to create tagged values
+	static ScalarValue makeF64(float64 value) { ScalarValue v; v.m_tag = F64; v.m_f64Val = value; return v; }
+	static ScalarValue makeBool(bool value) { ScalarValue v; v.m_tag = BOOL; v.m_boolVal = value; return v; }
+	
+	// Accessors
+	Tag getTag() const { return m_tag; }
+	bool isValid() const { return m_tag != NONE; }
+	bool isBool() const { return m_tag == BOOL; }
+	
+	// Method to get the value as a floating-point number
+	float64 toF64() const { return (m_tag == BOOL)? (m_boolVal? 1:0):m_f64Val; }
+	
+	// Method to get the truth value
+	bool toBool() const { return (m_tag == BOOL)? m_boolVal:(m_f64Val != 0); }
+	
+	// Method to allocate a matrix object holding this value
+	DataObject* box() const;
+	
+	// Static method to extract the value of a real or logical scalar matrix
+	static bool unbox(const DataObject* pObject, ScalarValue& value);
+	
+private:
+	
+	// Value tag
+	Tag m_tag;
+	
+	// Value storage
+	union
+	{
+		float64 m_f64Val;
+		bool m_boolVal;
+	};
+};
+
+#endif // #ifndef SCALARVALUE_H_
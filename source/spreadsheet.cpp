@@ -18,9 +18,21 @@
 
 // Header files
 #include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <algorithm>
+#include <iterator>
+#include <thread>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 #include "spreadsheet.h"
 #include "utility.h"
 
+// Minimum size of a parsing chunk (4 MB)
+const size_t SpreadSheet::MIN_CHUNK_SIZE = 1 << 22;
+
 /***************************************************************
 * Function: SpreadSheet::SpreadSheet()
 * Purpose : Constructor for spreadsheet class
@@ -29,6 +41,7 @@
 Revisions and bug fixes:
 */
 SpreadSheet::SpreadSheet()
+: m_columnLength(0)
 {
 }
 
@@ -324,3 +337,564 @@ int SpreadSheet::findColumn(const std::string& Name) const
     // Column not found
     return -1;
 }
+
+/***************************************************************
+* Function: SpreadSheet::loadColumns()
+* Purpose : Load a CSV file into typed columns
+* Initial : agent on October 18, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+bool SpreadSheet::loadColumns(const std::string& FileName, uint32 SkipRows, bool HasHeader, float64 EmptyValue, ColumnAllocator pAllocator, void* pUserData)
+{
+    // Clear any previously loaded data
+    m_grid.clear();
+    m_columns.clear();
+    m_columnLength = 0;
+    
+    // Attempt to open the file
+    int File = open(FileName.c_str(), O_RDONLY);
+    
+    // Ensure that the file was opened
+    if (File < 0)
+        return false;
+    
+    // Get the file size
+    struct stat Stat;
+    if (fstat(File, &Stat) != 0)
+    {
+        close(File);
+        return false;
+    }
+    size_t Size = Stat.st_size;
+    
+    // If the file is empty, there is nothing to parse
+    if (Size == 0)
+    {
+        close(File);
+        return true;
+    }
+    
+    // Map the file, its pages are read in as parsing proceeds
+    void* pMap = mmap(NULL, Size, PROT_READ, MAP_PRIVATE, File, 0);
+    
+    // The mapping remains valid after the file is closed
+    close(File);
+    
+    // Ensure that the file was mapped
+    if (pMap == MAP_FAILED)
+        return false;
+    
+    // Tell the system the file will be read in order
+    madvise(pMap, Size, MADV_SEQUENTIAL);
+    
+    // Get the bounds of the file text
+    const char* pData = (const char*)pMap;
+    const char* pEnd = pData + Size;
+    
+    // Skip the requested number of rows
+    pData = skipRows(pData, pEnd, SkipRows);
+    
+    // If there is a header row
+    if (HasHeader && pData < pEnd)
+    {
+        // Parse the header cells into the first grid row
+        Row Header;
+        Cell Cell;
+        do
+        {
+            pData = parseCell(pData, pEnd, Cell);
+            Header.push_back(cellText(Cell));
+        }
+        while (!Cell.EndRow);
+        
+        // Store the header row, so that columns can be found by name
+        m_grid.push_back(Header);
+    }
+    
+    // Use one chunk per hardware thread, unless the chunks would be too small
+    size_t NumThreads = std::max(1u, std::thread::hardware_concurrency());
+    size_t NumChunks = std::max<size_t>(1, std::min<size_t>(NumThreads, (pEnd - pData) / MIN_CHUNK_SIZE));
+    
+    // Test if the file contains quotes (quoted text may contain newlines)
+    bool HasQuotes = (memchr(pData, '\"', pEnd - pData) != NULL);
+    
+    // Declare a vector for the parsing chunks
+    std::vector<Chunk> Chunks(NumChunks);
+    
+    // Variable to tell if we are inside a string
+    bool InString = false;
+    
+    // Split the text into chunks, each starting at the beginning of a row
+    const char* pCur = pData;
+    for (size_t i = 0; i < NumChunks; ++i)
+    {
+        // Set the start of this chunk
+        Chunks[i].pBegin = pCur;
+        
+        // If this is the last chunk, it ends at the end of the file
+        if (i == NumChunks - 1)
+        {
+            Chunks[i].pEnd = pEnd;
+            break;
+        }
+        
+        // Compute the target end of this chunk
+        const char* pTarget = pData + (pEnd - pData) * (i + 1) / NumChunks;
+        
+        // If there are quotes, track them up to the next row boundary
+        if (HasQuotes)
+        {
+            for (; pCur < pEnd && (pCur < pTarget || *pCur != '\n' || InString); ++pCur)
+            {
+                if (*pCur == '\"')
+                    InString = !InString;
+            }
+        }
+        
+        // Otherwise, find the next newline directly
+        else
+        {
+            pCur = std::max(pCur, pTarget);
+            const char* pNewLine = (const char*)memchr(pCur, '\n', pEnd - pCur);
+            pCur = pNewLine? pNewLine:pEnd;
+        }
+        
+        // Move past the newline
+        if (pCur < pEnd)
+            ++pCur;
+        
+        // Set the end of this chunk
+        Chunks[i].pEnd = pCur;
+    }
+    
+    // Count the rows and columns of the chunks in parallel
+    std::vector<std::thread> Threads;
+    for (size_t i = 1; i < NumChunks; ++i)
+        Threads.push_back(std::thread(countChunk, &Chunks[i]));
+    countChunk(&Chunks[0]);
+    for (size_t i = 0; i < Threads.size(); ++i)
+        Threads[i].join();
+    Threads.clear();
+    
+    // Find the number of columns and the first row of each chunk
+    uint32 NumColumns = 0;
+    for (size_t i = 0; i < NumChunks; ++i)
+    {
+        NumColumns = std::max(NumColumns, Chunks[i].NumColumns);
+        Chunks[i].FirstRow = m_columnLength;
+        m_columnLength += Chunks[i].NumRows;
+    }
+    
+    // Get the numeric storage of each column from the caller
+    m_columns.resize(NumColumns);
+    for (uint32 X = 0; X < NumColumns; ++X)
+    {
+        m_columns[X].Type = NUMERIC;
+        m_columns[X].pNumbers = pAllocator? pAllocator(X, m_columnLength, NumColumns, pUserData):NULL;
+    }
+    
+    // Parse the chunks in parallel, the first one on this thread,
+    // each chunk writes the numbers of its rows in place
+    for (size_t i = 1; i < NumChunks; ++i)
+        Threads.push_back(std::thread(parseChunk, &Chunks[i], &m_columns, EmptyValue));
+    parseChunk(&Chunks[0], &m_columns, EmptyValue);
+    for (size_t i = 0; i < Threads.size(); ++i)
+        Threads[i].join();
+    
+    // For each output column
+    for (uint32 X = 0; X < NumColumns; ++X)
+    {
+        // The column holds text if any chunk holds text for it
+        Column& Output = m_columns[X];
+        for (size_t i = 0; i < NumChunks; ++i)
+        {
+            if (Chunks[i].Columns[X].Type == TEXT)
+                Output.Type = TEXT;
+        }
+        
+        // Numeric columns are already complete
+        if (Output.Type == NUMERIC)
+            continue;
+        
+        // The numeric storage is not used for text columns
+        Output.pNumbers = NULL;
+        
+        // Append the strings of each chunk
+        Output.Strings.reserve(m_columnLength);
+        for (size_t i = 0; i < NumChunks; ++i)
+        {
+            // If the chunk holds text for this column, move it over
+            if (Chunks[i].Columns[X].Type == TEXT)
+            {
+                std::vector<std::string>& Strings = Chunks[i].Columns[X].Strings;
+                Output.Strings.insert(
+                    Output.Strings.end(),
+                    std::make_move_iterator(Strings.begin()),
+                    std::make_move_iterator(Strings.end())
+                );
+                std::vector<std::string>().swap(Strings);
+            }
+            
+            // Otherwise, recover the text of the chunk's cells
+            else
+            {
+                extractColumnText(Chunks[i].pBegin, Chunks[i].pEnd, X, Output.Strings);
+            }
+        }
+    }
+    
+    // Release the file mapping
+    munmap(pMap, Size);
+    
+    // Nothing went wrong
+    return true;
+}
+
+/***************************************************************
+* Function: SpreadSheet::parseCell()
+* Purpose : Parse one cell of CSV text
+* Initial : agent on October 18, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+const char* SpreadSheet::parseCell(const char* pCur, const char* pEnd, Cell& Cell)
+{
+    // Skip leading whitespace
+    while (pCur < pEnd && (*pCur == ' ' || *pCur == '\t'))
+        ++pCur;
+    
+    // The cell has no doubled quotes until one is found
+    Cell.Escaped = false;
+    
+    // If this cell is a quoted string
+    if (pCur < pEnd && *pCur == '\"')
+    {
+        // The text starts after the opening quote
+        Cell.pBegin = ++pCur;
+        
+        // Until the closing quote is found
+        for (;;)
+        {
+            // Find the next quote
+            const char* pQuote = (const char*)memchr(pCur, '\"', pEnd - pCur);
+            
+            // If there is none, the string ends with the file
+            if (pQuote == NULL)
+            {
+                Cell.pEnd = pCur = pEnd;
+                break;
+            }
+            
+            // If this is a doubled quote, it is part of the text
+            if (pQuote + 1 < pEnd && pQuote[1] == '\"')
+            {
+                Cell.Escaped = true;
+                pCur = pQuote + 2;
+                continue;
+            }
+            
+            // This is the closing quote
+            Cell.pEnd = pQuote;
+            pCur = pQuote + 1;
+            break;
+        }
+        
+        // Skip any text after the string
+        while (pCur < pEnd && *pCur != ',' && *pCur != '\n')
+            ++pCur;
+    }
+    else
+    {
+        // The text extends until the next separator
+        Cell.pBegin = pCur;
+        while (pCur < pEnd && *pCur != ',' && *pCur != '\n')
+            ++pCur;
+        Cell.pEnd = pCur;
+        
+        // Trim trailing whitespace
+        while (Cell.pEnd > Cell.pBegin && isWhiteSpace(Cell.pEnd[-1]))
+            --Cell.pEnd;
+    }
+    
+    // Note whether this cell ends its row
+    Cell.EndRow = (pCur >= pEnd || *pCur == '\n');
+    
+    // Move past the separator
+    if (pCur < pEnd)
+        ++pCur;
+    
+    // Return the position of the next cell
+    return pCur;
+}
+
+/***************************************************************
+* Function: SpreadSheet::cellText()
+* Purpose : Get the text of a parsed cell
+* Initial : agent on October 18, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+std::string SpreadSheet::cellText(const Cell& Cell)
+{
+    // If there are no doubled quotes, the text is used as-is
+    if (!Cell.Escaped)
+        return std::string(Cell.pBegin, Cell.pEnd);
+    
+    // Otherwise, replace doubled quotes by single quotes
+    std::string Text;
+    for (const char* pCur = Cell.pBegin; pCur < Cell.pEnd; ++pCur)
+    {
+        Text += *pCur;
+        if (*pCur == '\"' && pCur + 1 < Cell.pEnd && pCur[1] == '\"')
+            ++pCur;
+    }
+    
+    // Return the cell text
+    return Text;
+}
+
+/***************************************************************
+* Function: SpreadSheet::cellNumber()
+* Purpose : Parse the value of a numeric cell
+* Initial : agent on October 18, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+bool SpreadSheet::cellNumber(const Cell& Cell, float64 EmptyValue, float64& Value)
+{
+    // Get the length of the cell text
+    size_t Length = Cell.pEnd - Cell.pBegin;
+    
+    // If the cell is empty, it takes the empty value
+    if (Length == 0)
+    {
+        Value = EmptyValue;
+        return true;
+    }
+    
+    // Text with quotes or too long for a number is not numeric
+    char Buffer[64];
+    if (Cell.Escaped || Length >= sizeof(Buffer))
+        return false;
+    
+    // Copy the text so that it is null-terminated
+    memcpy(Buffer, Cell.pBegin, Length);
+    Buffer[Length] = '\0';
+    
+    // Parse the number, the whole text must be consumed
+    char* pNumEnd;
+    Value = strtod(Buffer, &pNumEnd);
+    return (pNumEnd == Buffer + Length);
+}
+
+/***************************************************************
+* Function: SpreadSheet::countChunk()
+* Purpose : Count the rows and columns in a chunk of CSV text
+* Initial : agent on October 18, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+void SpreadSheet::countChunk(Chunk* pChunk)
+{
+    // Get references to the chunk row and column counts
+    size_t& NumRows = pChunk->NumRows;
+    uint32& NumColumns = pChunk->NumColumns;
+    NumRows = 0;
+    NumColumns = 0;
+    
+    // Get the bounds of the chunk text
+    const char* pCur = pChunk->pBegin;
+    const char* pEnd = pChunk->pEnd;
+    
+    // Until we are done parsing the chunk
+    while (pCur < pEnd)
+    {
+        // If this is a blank line, skip it
+        const char* pLineEnd = pCur;
+        while (pLineEnd < pEnd && (*pLineEnd == ' ' || *pLineEnd == '\t' || *pLineEnd == '\r'))
+            ++pLineEnd;
+        if (pLineEnd >= pEnd)
+            break;
+        if (*pLineEnd == '\n')
+        {
+            pCur = pLineEnd + 1;
+            continue;
+        }
+        
+        // Count the cells of this row
+        uint32 X = 0;
+        Cell Cell;
+        do
+        {
+            pCur = parseCell(pCur, pEnd, Cell);
+            ++X;
+        }
+        while (!Cell.EndRow);
+        
+        // Count this row
+        NumColumns = std::max(NumColumns, X);
+        ++NumRows;
+    }
+}
+
+/***************************************************************
+* Function: SpreadSheet::parseChunk()
+* Purpose : Parse a chunk of CSV text into typed columns
+* Initial : agent on October 18, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+void SpreadSheet::parseChunk(Chunk* pChunk, const ColumnVector* pColumns, float64 EmptyValue)
+{
+    // The chunk columns point into the output storage at its first row,
+    // they hold the text of the columns found to contain text
+    ColumnVector& Columns = pChunk->Columns;
+    Columns.resize(pColumns->size());
+    for (size_t X = 0; X < Columns.size(); ++X)
+    {
+        float64* pNumbers = (*pColumns)[X].pNumbers;
+        Columns[X].Type = NUMERIC;
+        Columns[X].pNumbers = pNumbers? (pNumbers + pChunk->FirstRow):NULL;
+    }
+    
+    // Get the bounds of the chunk text
+    const char* pCur = pChunk->pBegin;
+    const char* pEnd = pChunk->pEnd;
+    
+    // Until we are done parsing the chunk
+    size_t Y = 0;
+    while (pCur < pEnd)
+    {
+        // If this is a blank line, skip it
+        const char* pLineEnd = pCur;
+        while (pLineEnd < pEnd && (*pLineEnd == ' ' || *pLineEnd == '\t' || *pLineEnd == '\r'))
+            ++pLineEnd;
+        if (pLineEnd >= pEnd)
+            break;
+        if (*pLineEnd == '\n')
+        {
+            pCur = pLineEnd + 1;
+            continue;
+        }
+        
+        // Remember where this row starts
+        const char* pRowBegin = pCur;
+        
+        // For each cell of this row
+        size_t X = 0;
+        Cell Cell;
+        do
+        {
+            // Parse the cell
+            pCur = parseCell(pCur, pEnd, Cell);
+            
+            // Get a reference to the column
+            Column& Column = Columns[X];
+            
+            // If the column is numeric and so is the cell, store the value
+            float64 Value;
+            if (Column.Type == NUMERIC && cellNumber(Cell, EmptyValue, Value))
+            {
+                if (Column.pNumbers != NULL)
+                    Column.pNumbers[Y] = Value;
+            }
+            else
+            {
+                // If the column was numeric, it now holds text,
+                // recover the text of the previous rows
+                if (Column.Type == NUMERIC)
+                {
+                    Column.Type = TEXT;
+                    extractColumnText(pChunk->pBegin, pRowBegin, X, Column.Strings);
+                }
+                
+                // Store the cell text
+                Column.Strings.push_back(cellText(Cell));
+            }
+            
+            // Move to the next column
+            ++X;
+        }
+        while (!Cell.EndRow);
+        
+        // Fill the columns missing from this row with empty values
+        for (; X < Columns.size(); ++X)
+        {
+            if (Columns[X].Type == TEXT)
+                Columns[X].Strings.push_back("");
+            else if (Columns[X].pNumbers != NULL)
+                Columns[X].pNumbers[Y] = EmptyValue;
+        }
+        
+        // Move to the next row
+        ++Y;
+    }
+}
+
+/***************************************************************
+* Function: SpreadSheet::extractColumnText()
+* Purpose : Extract the text of one column from CSV text
+* Initial : agent on October 18, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+void SpreadSheet::extractColumnText(const char* pBegin, const char* pEnd, size_t X, std::vector<std::string>& Strings)
+{
+    // Until we are done parsing the text
+    const char* pCur = pBegin;
+    while (pCur < pEnd)
+    {
+        // If this is a blank line, skip it
+        const char* pLineEnd = pCur;
+        while (pLineEnd < pEnd && (*pLineEnd == ' ' || *pLineEnd == '\t' || *pLineEnd == '\r'))
+            ++pLineEnd;
+        if (pLineEnd >= pEnd)
+            break;
+        if (*pLineEnd == '\n')
+        {
+            pCur = pLineEnd + 1;
+            continue;
+        }
+        
+        // Parse the cells of this row, keeping the requested one
+        std::string Text;
+        Cell Cell;
+        size_t CellIndex = 0;
+        do
+        {
+            pCur = parseCell(pCur, pEnd, Cell);
+            if (CellIndex++ == X)
+                Text = cellText(Cell);
+        }
+        while (!Cell.EndRow);
+        
+        // Store the cell text (empty if the row is too short)
+        Strings.push_back(Text);
+    }
+}
+
+/***************************************************************
+* Function: SpreadSheet::skipRows()
+* Purpose : Skip a number of rows of CSV text
+* Initial : agent on October 18, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+const char* SpreadSheet::skipRows(const char* pCur, const char* pEnd, size_t NumRows)
+{
+    // For each row to skip
+    for (size_t i = 0; i < NumRows && pCur < pEnd; ++i)
+    {
+        // Parse the cells of the row
+        Cell Cell;
+        do
+        {
+            pCur = parseCell(pCur, pEnd, Cell);
+        }
+        while (!Cell.EndRow);
+    }
+    
+    // Return the start of the next row
+    return pCur;
+}
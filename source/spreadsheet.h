@@ -66,10 +66,45 @@ public:
     int findColumn(const std::string& Name) const;
 
     // Accessor to get the number of rows
-    uint32 getNumRows() { return (uint32)m_grid.size(); }
+    uint32 getNumRows() const { return (uint32)m_grid.size(); }
     
     // Accessor to get the number of cells in a row
-    uint32 getRowLength(uint16 j) { return (j >= m_grid.size())? 0:(uint32)m_grid[j].size(); }
+    uint32 getRowLength(uint32 j) const { return (j >= m_grid.size())? 0:(uint32)m_grid[j].size(); }
+
+    // Column type enumeration
+    enum ColumnType
+    {
+        NUMERIC,
+        TEXT
+    };
+
+    // Typed column structure
+    struct Column
+    {
+        // Column type
+        ColumnType Type;
+        
+        // Values of a numeric column, in storage given by the caller
+        float64* pNumbers;
+        
+        // Values of a text column
+        std::vector<std::string> Strings;
+    };
+
+    // Numeric column storage callback type, may return NULL to skip a column
+    typedef float64* (*ColumnAllocator)(uint32 X, size_t NumRows, uint32 NumColumns, void* pUserData);
+
+    // Method to load a CSV file into typed columns
+    bool loadColumns(const std::string& FileName, uint32 SkipRows, bool HasHeader, float64 EmptyValue, ColumnAllocator pAllocator, void* pUserData);
+
+    // Accessor to get the number of typed columns
+    uint32 getNumColumns() const { return (uint32)m_columns.size(); }
+    
+    // Accessor to get a typed column
+    const Column& getColumn(uint32 X) const { return m_columns[X]; }
+    
+    // Accessor to get the number of rows in the typed columns
+    size_t getColumnLength() const { return m_columnLength; }
 
 private:
 
@@ -79,8 +114,73 @@ private:
     // Grid type definition
     typedef std::vector<Row> Grid;
     
+    // Column vector type definition
+    typedef std::vector<Column> ColumnVector;
+    
+    // Parsed cell structure
+    struct Cell
+    {
+        // Cell text bounds
+        const char* pBegin;
+        const char* pEnd;
+        
+        // Flag indicating the text contains doubled quotes
+        bool Escaped;
+        
+        // Flag indicating this cell ends its row
+        bool EndRow;
+    };
+    
+    // Parsed chunk structure
+    struct Chunk
+    {
+        // Chunk text bounds
+        const char* pBegin;
+        const char* pEnd;
+        
+        // Columns parsed from this chunk
+        ColumnVector Columns;
+        
+        // Number of rows and columns in this chunk
+        size_t NumRows;
+        uint32 NumColumns;
+        
+        // Index of the first row of this chunk in the output columns
+        size_t FirstRow;
+    };
+
+    // Method to parse one cell of CSV text
+    static const char* parseCell(const char* pCur, const char* pEnd, Cell& Cell);
+    
+    // Method to get the text of a parsed cell
+    static std::string cellText(const Cell& Cell);
+    
+    // Method to parse the value of a numeric cell
+    static bool cellNumber(const Cell& Cell, float64 EmptyValue, float64& Value);
+    
+    // Method to count the rows and columns in a chunk of CSV text
+    static void countChunk(Chunk* pChunk);
+    
+    // Method to parse a chunk of CSV text into typed columns
+    static void parseChunk(Chunk* pChunk, const ColumnVector* pColumns, float64 EmptyValue);
+    
+    // Method to extract the text of one column from a chunk of CSV text
+    static void extractColumnText(const char* pBegin, const char* pEnd, size_t X, std::vector<std::string>& Strings);
+    
+    // Method to find the start of the next row outside quoted text
+    static const char* skipRows(const char* pCur, const char* pEnd, size_t NumRows);
+    
     // Internal storage grid
     Grid m_grid;
+    
+    // Typed column storage
+    ColumnVector m_columns;
+    
+    // Number of rows in the typed columns
+    size_t m_columnLength;
+    
+    // Minimum size of a parsing chunk
+    static const size_t MIN_CHUNK_SIZE;
 };
 
 #endif // #ifndef __SPREADSHEETS_H__
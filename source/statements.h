@@ -49,7 +49,10 @@ class Statement : public IIRNode
     OUTERMOST = 1 << 1,
 
     // is in the innermost loop of a loop nest
-    INNERMOST = 1 << 2
+    INNERMOST = 1 << 2,
+
+    // the loop iterations are independent (parfor loop)
+    PARALLEL = 1 << 3
   };
 
   // Enumerate statement types
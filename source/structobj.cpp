@@ -17,7 +17,638 @@
 // =========================================================================== //
 
 // Header files
+#include <algorithm>
 #include "structobj.h"
+#include "profiling.h"
+
+/***************************************************************
+* Function: StructShape::StructShape()
+* Purpose : Constructor for the struct shape class
+* Initial : agent on October 18, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+StructShape::StructShape(const FieldVector& fields)
+: m_fields(fields)
+{
+	// Map each field name to its slot
+	for (size_t i = 0; i < m_fields.size(); ++i)
+		m_slotMap[m_fields[i]] = i;
+}
+
+/***************************************************************
+* Function: static StructShape::get()
+* Purpose : Get the shape shared by all structs with a field set
+* Initial : agent on October 18, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+const StructShape* StructShape::get(const FieldVector& fields)
+{
+	// Map of the shapes created so far
+	// Note: shapes are never deleted, struct objects point to them
+	static ShapeMap shapeMap;
+
+	// Sort the field names, the slot order depends only on the field set
+	FieldVector sortedFields = fields;
+	std::sort(sortedFields.begin(), sortedFields.end());
+	sortedFields.erase(std::unique(sortedFields.begin(), sortedFields.end()), sortedFields.end());
+
+	// If a shape with these fields already exists, return it
+	ShapeMap::iterator itr = shapeMap.find(sortedFields);
+	if (itr != shapeMap.end())
+		return itr->second;
+
+	// Otherwise, create a new shape for these fields
+	const StructShape* pShape = new StructShape(sortedFields);
+	shapeMap[sortedFields] = pShape;
+
+	// Return the new shape
+	return pShape;
+}
+
+/***************************************************************
+* Function: static StructShape::getEmpty()
+* Purpose : Get the shape of structs without fields
+* Initial : agent on October 18, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+const StructShape* StructShape::getEmpty()
+{
+	// Get the empty shape once
+	static const StructShape* pEmptyShape = get(FieldVector());
+
+	// Return the empty shape
+	return pEmptyShape;
+}
+
+/***************************************************************
+* Function: StructShape::withField()
+* Purpose : Get the shape with an additional field
+* Initial : agent on October 18, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+const StructShape* StructShape::withField(const std::string& field) const
+{
+	// If the field is already present, the shape is unchanged
+	if (findSlot(field) != NO_SLOT)
+		return this;
+
+	// If this transition was already taken, reuse its result
+	TransMap::iterator itr = m_transitions.find(field);
+	if (itr != m_transitions.end())
+		return itr->second;
+
+	// Get the shape for the extended field set
+	FieldVector newFields = m_fields;
+	newFields.push_back(field);
+	const StructShape* pNewShape = get(newFields);
+
+	// Memoize the transition
+	m_transitions[field] = pNewShape;
+
+	// Return the new shape
+	return pNewShape;
+}
+
+/***************************************************************
+* Function: ScalarStruct::ScalarStruct()
+* Purpose : Constructors for the scalar struct class
+* Initial : agent on October 18, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+ScalarStruct::ScalarStruct()
+: m_pShape(StructShape::getEmpty()),
+  m_pSlots(NULL),
+  m_pColumns(NULL),
+  m_row(0)
+{
+}
+ScalarStruct::ScalarStruct(const StructShape* pShape)
+: m_pShape(pShape),
+  m_pSlots(NULL),
+  m_pColumns(NULL),
+  m_row(0)
+{
+	// Allocate the slots, initially without values
+	// Note: the slots point to objects, so they are scanned by the GC
+	if (m_pShape->getNumFields() != 0)
+		m_pSlots = (DataObject**)GC_MALLOC(m_pShape->getNumFields() * sizeof(DataObject*));
+}
+ScalarStruct::ScalarStruct(StructColumns* pColumns, size_t row)
+: m_pShape(pColumns->getShape()),
+  m_pSlots(NULL),
+  m_pColumns(pColumns),
+  m_row(row)
+{
+}
+ScalarStruct::ScalarStruct(const ScalarStruct& other)
+: gc(),
+  m_pShape(other.m_pShape),
+  m_pSlots(NULL),
+  m_pColumns(NULL),
+  m_row(0)
+{
+	// If there are no fields, there is nothing to copy
+	if (m_pShape->getNumFields() == 0)
+		return;
+
+	// Allocate the slots
+	m_pSlots = (DataObject**)GC_MALLOC(m_pShape->getNumFields() * sizeof(DataObject*));
+
+	// Copy the field values, boxing them if the other struct is a view
+	if (other.m_pColumns == NULL)
+		memcpy(m_pSlots, other.m_pSlots, m_pShape->getNumFields() * sizeof(DataObject*));
+	else
+		for (size_t i = 0; i < m_pShape->getNumFields(); ++i)
+			m_pSlots[i] = other.getColumnValue(i);
+}
+
+/***************************************************************
+* Function: ScalarStruct::operator[]()
+* Purpose : Get a reference to a field, adding it if needed
+* Initial : agent on October 18, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+DataObject*& ScalarStruct::operator [] (const std::string& field)
+{
+	// References into columns are not possible, the struct needs its own slots
+	materialize();
+
+	// Find the slot for this field
+	size_t slot = m_pShape->findSlot(field);
+
+	// If the field is absent, move to the shape including it
+	if (slot == StructShape::NO_SLOT)
+	{
+		reshape(m_pShape->withField(field));
+		slot = m_pShape->findSlot(field);
+	}
+
+	// Return a reference to the slot
+	return m_pSlots[slot];
+}
+
+/***************************************************************
+* Function: ScalarStruct::insert()
+* Purpose : Add a field if it is not already present
+* Initial : agent on October 18, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+void ScalarStruct::insert(const std::pair<std::string, DataObject*>& entry)
+{
+	// If the field is already present, do nothing
+	if (m_pShape->findSlot(entry.first) != StructShape::NO_SLOT)
+		return;
+
+	// Add the field with its value
+	(*this)[entry.first] = entry.second;
+}
+
+/***************************************************************
+* Function: ScalarStruct::reshape()
+* Purpose : Change the shape of this struct, keeping field values
+* Initial : agent on October 18, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+void ScalarStruct::reshape(const StructShape* pNewShape)
+{
+	// Column views have no slots to move
+	materialize();
+
+	// Allocate slots for the new shape
+	DataObject** pNewSlots = (DataObject**)GC_MALLOC(pNewShape->getNumFields() * sizeof(DataObject*));
+
+	// Move each field value to its slot in the new shape
+	const StructShape::FieldVector& fields = m_pShape->getFields();
+	for (size_t i = 0; i < fields.size(); ++i)
+		pNewSlots[pNewShape->findSlot(fields[i])] = m_pSlots[i];
+
+	// Switch to the new shape
+	m_pShape = pNewShape;
+	m_pSlots = pNewSlots;
+}
+
+/***************************************************************
+* Function: ScalarStruct::materialize()
+* Purpose : Give a column view its own slots
+* Initial : agent on October 18, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+void ScalarStruct::materialize()
+{
+	// If this struct is not a view, it already has its own slots
+	if (m_pColumns == NULL)
+		return;
+
+	// Box the column values into new slots
+	DataObject** pNewSlots = (DataObject**)GC_MALLOC(m_pShape->getNumFields() * sizeof(DataObject*));
+	for (size_t i = 0; i < m_pShape->getNumFields(); ++i)
+		pNewSlots[i] = getColumnValue(i);
+
+	// Detach this struct from the columns
+	// Note: the stale column row is no longer viewed by anything
+	m_pSlots = pNewSlots;
+	m_pColumns = NULL;
+	m_row = 0;
+}
+
+/***************************************************************
+* Function: ScalarStruct::getColumnValue()
+* Purpose : Read a field value of a column view
+* Initial : agent on October 18, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+DataObject* ScalarStruct::getColumnValue(size_t slot) const
+{
+	// Box the value stored in the column
+	return new MatrixF64Obj(m_pColumns->getColumn(slot)[m_row]);
+}
+
+/***************************************************************
+* Function: ScalarStruct::setColumnValue()
+* Purpose : Write a field value of a column view
+* Initial : agent on October 18, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+void ScalarStruct::setColumnValue(size_t slot, DataObject* pValue)
+{
+	// If the value is a real scalar, store it in the column
+	if (pValue != NULL && pValue->getType() == DataObject::Type::MATRIX_F64 && ((MatrixF64Obj*)pValue)->isScalar())
+	{
+		m_pColumns->getColumn(slot)[m_row] = ((MatrixF64Obj*)pValue)->getScalar();
+		return;
+	}
+
+	// Otherwise, the element diverges from the columns and gets its own slots
+	materialize();
+	m_pSlots[slot] = pValue;
+}
+
+/***************************************************************
+* Function: ScalarStruct::getSlotF64()
+* Purpose : Read a real scalar field value without boxing it
+* Initial : agent on October 18, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+bool ScalarStruct::getSlotF64(size_t slot, float64& value) const
+{
+	// If this struct is a view, read the column directly
+	if (m_pColumns != NULL)
+	{
+		value = m_pColumns->getColumn(slot)[m_row];
+		return true;
+	}
+
+	// Get the field value object
+	DataObject* pValue = m_pSlots[slot];
+
+	// If the value is not a real scalar, it cannot be read unboxed
+	if (pValue == NULL || pValue->getType() != DataObject::Type::MATRIX_F64 || !((MatrixF64Obj*)pValue)->isScalar())
+		return false;
+
+	// Read the scalar value
+	value = ((MatrixF64Obj*)pValue)->getScalar();
+	return true;
+}
+
+/***************************************************************
+* Function: makeScalarStructPtr()
+* Purpose : Create an empty scalar struct
+* Initial : agent on October 18, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+ScalarStructPtr makeScalarStructPtr()
+{
+	return new ScalarStruct();
+}
+
+/***************************************************************
+* Function: makeShapedScalarStruct()
+* Purpose : Create a scalar struct with a given shape
+* Initial : agent on October 18, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+ScalarStructPtr makeShapedScalarStruct(const StructShape* pShape)
+{
+	return new ScalarStruct(pShape);
+}
+
+/***************************************************************
+* Function: insertInScalarStruct()
+* Purpose : Add a field to a scalar struct
+* Initial : agent on October 18, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+void insertInScalarStruct(ScalarStructPtr scalar_struct, const char* string, DataObject* obj)
+{
+	scalar_struct->insert(std::pair<std::string, DataObject*>(string, obj));
+}
+
+/***************************************************************
+* Function: setScalarStructSlot()
+* Purpose : Set a scalar struct field by slot index
+* Initial : agent on October 18, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+void setScalarStructSlot(ScalarStructPtr pStruct, int64 slot, DataObject* pValue)
+{
+	pStruct->setSlot(size_t(slot), pValue);
+}
+
+/***************************************************************
+* Function: readStructField()
+* Purpose : Read a field of a scalar struct object
+* Initial : agent on October 18, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+DataObject* readStructField(const DataObject* pObject, const StructShape* pShape, int64 slot, const std::string* pField)
+{
+	// Ensure that the object is a scalar struct
+	if (pObject->getType() != DataObject::Type::STRUCTARRAY || !((StructArrayObj*)pObject)->isScalar())
+		throw RunError("expected scalar struct in field access ." + *pField);
+
+	// Get the struct element
+	const ScalarStruct* pStruct = ((StructArrayObj*)pObject)->getScalar();
+
+	// If the struct has the expected shape, read the slot directly,
+	// otherwise, look the field up by name
+	DataObject* pValue = (pStruct->getShape() == pShape)? pStruct->getSlot(size_t(slot)):pStruct->getField(*pField);
+
+	// If the field has no value, report it
+	if (pValue == NULL)
+		throw RunError("unknown or empty field '" + *pField + "'");
+
+	// Return the field value
+	return pValue;
+}
+
+/***************************************************************
+* Function: readStructFieldF64()
+* Purpose : Read a real scalar field of a scalar struct object
+* Initial : agent on October 18, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+float64 readStructFieldF64(const DataObject* pObject, const StructShape* pShape, int64 slot, const std::string* pField)
+{
+	// Ensure that the object is a scalar struct
+	if (pObject->getType() != DataObject::Type::STRUCTARRAY || !((StructArrayObj*)pObject)->isScalar())
+		throw RunError("expected scalar struct in field access ." + *pField);
+
+	// Get the struct element
+	const ScalarStruct* pStruct = ((StructArrayObj*)pObject)->getScalar();
+
+	// If the struct has the expected shape, read the slot without boxing
+	float64 value;
+	if (pStruct->getShape() == pShape && pStruct->getSlotF64(size_t(slot), value))
+		return value;
+
+	// Otherwise, read the field object and ensure it is a real scalar
+	DataObject* pValue = readStructField(pObject, pShape, slot, pField);
+	if (pValue->getType() != DataObject::Type::MATRIX_F64 || !((MatrixF64Obj*)pValue)->isScalar())
+		throw RunError("expected real scalar in field '" + *pField + "'");
+
+	// Return the scalar value
+	return ((MatrixF64Obj*)pValue)->getScalar();
+}
+
+/***************************************************************
+* Function: StructColumns::StructColumns()
+* Purpose : Constructor for the struct columns class
+* Initial : agent on October 18, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+StructColumns::StructColumns(const StructShape* pShape, size_t numRows)
+: m_pShape(pShape),
+  m_numRows(numRows)
+{
+	// Allocate a column vector for each slot
+	m_pColumns = (MatrixF64Obj**)GC_MALLOC(m_pShape->getNumFields() * sizeof(MatrixF64Obj*));
+	for (size_t i = 0; i < m_pShape->getNumFields(); ++i)
+		m_pColumns[i] = new MatrixF64Obj(m_numRows, 1);
+}
+
+/***************************************************************
+* Function: static StructColumns::getPacked()
+* Purpose : Get the columns a struct array is fully packed in
+* Initial : agent on October 18, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+StructColumns* StructColumns::getPacked(const StructArrayObj* pArray)
+{
+	// Get the number of array elements
+	size_t numElems = pArray->getNumElems();
+
+	// If the array is empty, it is not packed
+	if (numElems == 0)
+		return NULL;
+
+	// Get the columns viewed by the first element, if any
+	const ScalarStruct* const* pElements = pArray->getElements();
+	StructColumns* pColumns = (pElements[0] != NULL)? pElements[0]->getColumns():NULL;
+
+	// If the columns do not hold exactly the array elements, it is not packed
+	if (pColumns == NULL || pColumns->m_numRows != numElems)
+		return NULL;
+
+	// Ensure that each element is still the view of its own row
+	for (size_t i = 0; i < numElems; ++i)
+		if (pElements[i] == NULL || pElements[i]->getColumns() != pColumns || pElements[i]->getRow() != i)
+			return NULL;
+
+	// The array is fully packed in these columns
+	return pColumns;
+}
+
+/***************************************************************
+* Function: static StructColumns::pack()
+* Purpose : Get the columns of a struct array, packing it if
+*           its elements share a shape and hold real scalars
+* Initial : agent on October 18, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+StructColumns* StructColumns::pack(StructArrayObj* pArray)
+{
+	// If the array is already packed, return its columns
+	StructColumns* pColumns = getPacked(pArray);
+	if (pColumns != NULL)
+		return pColumns;
+
+	// Get the number of array elements
+	size_t numElems = pArray->getNumElems();
+
+	// If the array is too small to benefit from packing, stop
+	if (numElems < MIN_PACK_ELEMS)
+		return NULL;
+
+	// Get the shape of the first element
+	ScalarStruct** pElements = pArray->getElements();
+	if (pElements[0] == NULL)
+		return NULL;
+	const StructShape* pShape = pElements[0]->getShape();
+
+	// If the elements have no fields, there is nothing to pack
+	if (pShape->getNumFields() == 0)
+		return NULL;
+
+	// Ensure that all elements share the shape and hold only real scalars
+	for (size_t i = 0; i < numElems; ++i)
+	{
+		const ScalarStruct* pStruct = pElements[i];
+
+		if (pStruct == NULL || pStruct->getShape() != pShape)
+			return NULL;
+
+		// Elements viewing other columns already hold real scalars
+		if (pStruct->getColumns() != NULL)
+			continue;
+
+		for (size_t slot = 0; slot < pShape->getNumFields(); ++slot)
+		{
+			DataObject* pValue = pStruct->getSlot(slot);
+
+			if (pValue == NULL || pValue->getType() != DataObject::Type::MATRIX_F64 || !((MatrixF64Obj*)pValue)->isScalar())
+				return NULL;
+		}
+	}
+
+	// Create the columns and fill them with the field values
+	pColumns = new StructColumns(pShape, numElems);
+	for (size_t i = 0; i < numElems; ++i)
+		for (size_t slot = 0; slot < pShape->getNumFields(); ++slot)
+			pElements[i]->getSlotF64(slot, pColumns->getColumn(slot)[i]);
+
+	// Replace the elements by views of the columns
+	// Note: sub-arrays sharing the old elements keep their own values
+	for (size_t i = 0; i < numElems; ++i)
+		pElements[i] = new ScalarStruct(pColumns, i);
+
+	// Count the packed array
+	PROF_INCR_COUNTER(Profiler::STRUCT_PACK_COUNT);
+
+	// Return the new columns
+	return pColumns;
+}
+
+/***************************************************************
+* Function: static StructColumns::createArray()
+* Purpose : Create a struct array packed in new columns, whose
+*           values are to be filled in by the caller
+* Initial : agent on October 18, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+StructArrayObj* StructColumns::createArray(const StructShape* pShape, const DimVector& size)
+{
+	// Create a struct array of the requested size
+	StructArrayObj* pArray = new StructArrayObj(size);
+	pArray->m_Fields.insert(pShape->getFields().begin(), pShape->getFields().end());
+
+	// Create the columns and make the elements views of their rows
+	StructColumns* pColumns = new StructColumns(pShape, pArray->getNumElems());
+	ScalarStruct** pElements = pArray->getElements();
+	for (size_t i = 0; i < pColumns->m_numRows; ++i)
+		pElements[i] = new ScalarStruct(pColumns, i);
+
+	// Return the new struct array
+	return pArray;
+}
+
+/***************************************************************
+* Function: StructColumns::copyArray()
+* Purpose : Copy a packed struct array along with its columns
+* Initial : agent on October 18, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+StructArrayObj* StructColumns::copyArray(const StructArrayObj* pArray) const
+{
+	// Create a struct array of the same size viewing new columns
+	StructArrayObj* pNewArray = createArray(m_pShape, pArray->getSize());
+	pNewArray->m_Fields = pArray->m_Fields;
+
+	// Copy the values in bulk
+	StructColumns* pNewColumns = pNewArray->getElements()[0]->getColumns();
+	for (size_t i = 0; i < m_pShape->getNumFields(); ++i)
+		memcpy(pNewColumns->getColumn(i), getColumn(i), m_numRows * sizeof(float64));
+
+	// Return the copy
+	return pNewArray;
+}
+
+/***************************************************************
+* Function: StructColumns::readColumn()
+* Purpose : Read the values of a field as a row vector
+* Initial : agent on October 18, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+MatrixF64Obj* StructColumns::readColumn(size_t slot) const
+{
+	// Copy the column into a new row vector
+	MatrixF64Obj* pRow = new MatrixF64Obj(1, m_numRows);
+	memcpy(pRow->getElements(), getColumn(slot), m_numRows * sizeof(float64));
+
+	// Return the row vector
+	return pRow;
+}
+
+/***************************************************************
+* Function: StructArrayObj::allocMatrix()
+* Purpose : Matrix allocation method for struct arrays
+* Initial : agent on October 18, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+template <> void StructArrayObj::allocMatrix()
+{
+	// Compute the number of matrix elements
+	m_numElements = m_size[0];
+	for (size_t i = 1; i < m_size.size(); ++i)
+		m_numElements *= m_size[i];
+	
+	// If the elements fit in the inline buffer, store them there
+	if (m_numElements * sizeof(ScalarStruct*) <= INLINE_BYTES)
+	{
+		m_pElements = (ScalarStruct**)m_inlineData.bytes;
+		return;
+	}
+	
+	// Allocate memory for the matrix elements
+	// This allocation is non-atomic, the struct elements are collected
+	m_pElements = (ScalarStruct**)GC_MALLOC_IGNORE_OFF_PAGE(m_numElements * sizeof(ScalarStruct*));
+}
+
+/***************************************************************
+* Function: StructArrayObj::releaseBuffer()
+* Purpose : Buffer release method for struct arrays
+* Initial : agent on October 18, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+template <> void StructArrayObj::releaseBuffer(ScalarStruct** pBuffer)
+{
+	// Struct buffers are scanned by the collector, leave them to it
+}
 
 template <> DataObject* MatrixObj< ScalarStruct* >::convert(DataObject::Type outType) const {
   assert(false) ;
@@ -56,6 +687,11 @@ template <> std::string StructArrayObj::toString() const {
 }
 
 template <> StructArrayObj* StructArrayObj::copy() const {
+  // Packed arrays copy their columns in bulk
+  StructColumns* pColumns = StructColumns::getPacked(this) ;
+  if ( pColumns != NULL )
+    return pColumns->copyArray(this) ;
+
   StructArrayObj* res = new StructArrayObj() ;
   res->m_size = m_size ;
   res->m_Fields = m_Fields ;
@@ -63,19 +699,19 @@ template <> StructArrayObj* StructArrayObj::copy() const {
   //std::cout << m_numElements << std::endl ;
   for ( size_t i = 1 ; i <= m_numElements ; i++) {
     ScalarStruct* pSS = getElem1D(i) ;
-    ScalarStruct* pCopySS = new ScalarStruct() ;
 
     if (pSS == NULL ) {
       res->setElem1D(i,NULL) ;
     } else {
 
-      for ( ScalarStruct::const_iterator it = pSS->begin(); it != pSS->end() ; it++) {
-        DataObject* pObject = it->second ;
-        if ( pObject->getType() == Type::STRUCTARRAY ) {
+      // The copy shares the shape of the original
+      ScalarStruct* pCopySS = new ScalarStruct(*pSS) ;
+      for ( size_t slot = 0 ; slot < pCopySS->size() ; slot++) {
+        DataObject* pObject = pCopySS->getSlot(slot) ;
+        if ( pObject != NULL && pObject->getType() == Type::STRUCTARRAY ) {
           // Deep copy
-          pObject = pObject->copy() ;
+          pCopySS->setSlot(slot, pObject->copy()) ;
         }
-        (*pCopySS)[it->first] = pObject ;
       }
       res->setElem1D(i,pCopySS) ;
     }
@@ -83,3 +719,7 @@ template <> StructArrayObj* StructArrayObj::copy() const {
   return res ;
 }
 
+template <> StructArrayObj* StructArrayObj::lazyCopy() const {
+  return copy() ;
+}
+
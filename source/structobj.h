@@ -23,38 +23,303 @@
 // Header files
 #include "matrixobjs.h"
 #include <map>
+#include <vector>
+#include <string>
+#include <unordered_map>
 
-/****************************************************************************
- * ScalarStruct is the base element of a structarray.
-****************************************************************************/
-typedef std::unordered_map<
-            std::string,
-            DataObject*
-            //std::hash<std::string>,
-            //std::equal_to<std::string>,
-            //gc_allocator<DataObject*>
-        >ScalarStruct;
+// Forward declarations
+class StructColumns;
+
+/***************************************************************
+* Class   : StructShape
+* Purpose : Map the field names of a struct to slot indices
+* Initial : agent on October 18, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+class StructShape
+{
+public:
+
+	// Field name vector type definition
+	typedef std::vector<std::string> FieldVector;
+
+	// Slot index of fields not in a shape
+	static const size_t NO_SLOT = size_t(-1);
+
+	// Method to get the shape shared by all structs with a field set
+	static const StructShape* get(const FieldVector& fields);
+
+	// Method to get the shape of structs without fields
+	static const StructShape* getEmpty();
+
+	// Method to get the shape with an additional field
+	const StructShape* withField(const std::string& field) const;
+
+	// Method to find the slot of a field
+	size_t findSlot(const std::string& field) const
+	{
+		SlotMap::const_iterator itr = m_slotMap.find(field);
+		return (itr != m_slotMap.end())? itr->second:NO_SLOT;
+	}
+
+	// Accessor to get the field names, in slot order
+	const FieldVector& getFields() const { return m_fields; }
+
+	// Accessor to get the number of fields
+	size_t getNumFields() const { return m_fields.size(); }
+
+private:
+
+	// Field name to slot index map type definition
+	typedef std::unordered_map<std::string, size_t> SlotMap;
+
+	// Transition map type definition
+	typedef std::map<std::string, const StructShape*> TransMap;
+
+	// Shape map type definition
+	typedef std::map<FieldVector, const StructShape*> ShapeMap;
+
+	// Constructor, the field names must be sorted
+	StructShape(const FieldVector& fields);
+
+	// Field names, sorted, the slot of a field is its position
+	FieldVector m_fields;
+
+	// Field name to slot index map
+	SlotMap m_slotMap;
+
+	// Memoized shape transitions, by added field
+	mutable TransMap m_transitions;
+};
+
+/***************************************************************
+* Class   : ScalarStruct
+* Purpose : Base element of a struct array, holds field values
+*           in a flat slot array laid out by a shared shape
+* Initial : agent on October 18, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+class ScalarStruct : public gc
+{
+	// Declare the JIT compiler as a friend class
+	// This is so the JIT can read the shape and slots directly
+#ifdef MCVM_USE_JIT
+	friend class JITCompiler;
+#endif
+
+public:
+
+	// Field iterator class
+	class const_iterator
+	{
+	public:
+
+		// Constructor
+		const_iterator(const ScalarStruct* pStruct, size_t slot) : m_pStruct(pStruct), m_slot(slot) {}
+
+		// Methods to get the current field name and value
+		const std::pair<std::string, DataObject*>& operator * () const { load(); return m_entry; }
+		const std::pair<std::string, DataObject*>* operator -> () const { load(); return &m_entry; }
+
+		// Method to move to the next field
+		const_iterator& operator ++ () { ++m_slot; return *this; }
+		const_iterator operator ++ (int) { const_iterator old = *this; ++m_slot; return old; }
+
+		// Comparison operators
+		bool operator == (const const_iterator& other) const { return m_slot == other.m_slot; }
+		bool operator != (const const_iterator& other) const { return m_slot != other.m_slot; }
+
+	private:
+
+		// Method to load the current field entry
+		void load() const
+		{
+			m_entry.first = m_pStruct->m_pShape->getFields()[m_slot];
+			m_entry.second = m_pStruct->getSlot(m_slot);
+		}
+
+		// Struct being iterated over
+		const ScalarStruct* m_pStruct;
+
+		// Current slot index
+		size_t m_slot;
+
+		// Current field entry
+		mutable std::pair<std::string, DataObject*> m_entry;
+	};
+
+	// Fields are only modified through the struct
+	typedef const_iterator iterator;
+
+	// Constructors
+	ScalarStruct();
+	ScalarStruct(const StructShape* pShape);
+	ScalarStruct(StructColumns* pColumns, size_t row);
+	ScalarStruct(const ScalarStruct& other);
+
+	// Accessor to get the shape of this struct
+	const StructShape* getShape() const { return m_pShape; }
+
+	// Methods to access a field by slot index
+	DataObject* getSlot(size_t slot) const { return (m_pColumns == NULL)? m_pSlots[slot]:getColumnValue(slot); }
+	void setSlot(size_t slot, DataObject* pValue) { if (m_pColumns == NULL) m_pSlots[slot] = pValue; else setColumnValue(slot, pValue); }
+
+	// Method to read a real scalar field value without boxing it
+	bool getSlotF64(size_t slot, float64& value) const;
+
+	// Method to get a field value, NULL if the field is absent
+	DataObject* getField(const std::string& field) const
+	{
+		size_t slot = m_pShape->findSlot(field);
+		return (slot != StructShape::NO_SLOT)? getSlot(slot):NULL;
+	}
+
+	// Method to set a field value, adding the field if needed
+	void setField(const std::string& field, DataObject* pValue)
+	{
+		size_t slot = m_pShape->findSlot(field);
+		if (slot != StructShape::NO_SLOT) setSlot(slot, pValue); else (*this)[field] = pValue;
+	}
+
+	// Method to get a reference to a field, adding the field if needed
+	DataObject*& operator [] (const std::string& field);
+
+	// Method to add a field if it is not already present
+	void insert(const std::pair<std::string, DataObject*>& entry);
+
+	// Method to find a field
+	const_iterator find(const std::string& field) const
+	{
+		size_t slot = m_pShape->findSlot(field);
+		return (slot != StructShape::NO_SLOT)? const_iterator(this, slot):end();
+	}
+
+	// Methods to iterate over the fields, in slot order
+	const_iterator begin() const { return const_iterator(this, 0); }
+	const_iterator end() const { return const_iterator(this, m_pShape->getNumFields()); }
+
+	// Method to get the number of fields
+	size_t size() const { return m_pShape->getNumFields(); }
+
+	// Accessors for the columns this struct is a view of, if any
+	StructColumns* getColumns() const { return m_pColumns; }
+	size_t getRow() const { return m_row; }
+
+	// Method to give this struct its own slots if it is a column view
+	void materialize();
+
+private:
+
+	// Method to change the shape of this struct, keeping field values
+	void reshape(const StructShape* pNewShape);
+
+	// Methods to access the column values of a view
+	DataObject* getColumnValue(size_t slot) const;
+	void setColumnValue(size_t slot, DataObject* pValue);
+
+	// Shape of this struct
+	const StructShape* m_pShape;
+
+	// Field values, indexed by slot, NULL for column views
+	DataObject** m_pSlots;
+
+	// Columns holding the field values of a view, NULL otherwise
+	StructColumns* m_pColumns;
+
+	// Row of this struct in the columns
+	size_t m_row;
+};
         
 typedef ScalarStruct* ScalarStructPtr;
 typedef MatrixObj<ScalarStruct*> StructArrayObj;
 typedef StructArrayObj* StructPtr ;
 
-inline ScalarStructPtr makeScalarStructPtr() {
-    return new ScalarStruct() ;
-}
-
-inline void insertInScalarStruct(
-        ScalarStructPtr scalar_struct,
-        const char* string,
-        DataObject* obj)
+/***************************************************************
+* Class   : StructColumns
+* Purpose : Column storage for the elements of a struct array
+*           sharing a shape and holding only real scalar fields
+* Initial : agent on October 18, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+class StructColumns : public gc
 {
-    std::pair<std::string,DataObject*> p(string,obj) ;
-    scalar_struct->insert(p);
-}
+public:
+
+	// Method to get the columns of a struct array, packing it if possible
+	static StructColumns* pack(StructArrayObj* pArray);
+
+	// Method to get the columns a struct array is fully packed in, if any
+	static StructColumns* getPacked(const StructArrayObj* pArray);
+
+	// Method to create a struct array packed in new columns, to be filled
+	static StructArrayObj* createArray(const StructShape* pShape, const DimVector& size);
+
+	// Method to copy a packed struct array along with its columns
+	StructArrayObj* copyArray(const StructArrayObj* pArray) const;
+
+	// Method to read a column as a row vector
+	MatrixF64Obj* readColumn(size_t slot) const;
+
+	// Accessor to get the shape of the packed elements
+	const StructShape* getShape() const { return m_pShape; }
+
+	// Accessor to get the number of packed elements
+	size_t getNumRows() const { return m_numRows; }
+
+	// Accessor to get the values of a field, by slot
+	float64* getColumn(size_t slot) const { return m_pColumns[slot]->getElements(); }
+
+	// Minimum number of elements for a struct array to be packed
+	static const size_t MIN_PACK_ELEMS = 64;
+
+private:
+
+	// Constructor
+	StructColumns(const StructShape* pShape, size_t numRows);
+
+	// Shape of the packed elements
+	const StructShape* m_pShape;
+
+	// Number of packed elements
+	size_t m_numRows;
+
+	// Column vector of values for each slot
+	MatrixF64Obj** m_pColumns;
+};
+
+// Function to create an empty scalar struct
+ScalarStructPtr makeScalarStructPtr();
+
+// Function to create a scalar struct with a given shape
+ScalarStructPtr makeShapedScalarStruct(const StructShape* pShape);
+
+// Function to add a field to a scalar struct
+void insertInScalarStruct(ScalarStructPtr scalar_struct, const char* string, DataObject* obj);
+
+// Function to set a scalar struct field by slot index
+void setScalarStructSlot(ScalarStructPtr pStruct, int64 slot, DataObject* pValue);
+
+// Function to read a field of a scalar struct object, by slot if the shape matches
+DataObject* readStructField(const DataObject* pObject, const StructShape* pShape, int64 slot, const std::string* pField);
+
+// Function to read a real scalar field of a scalar struct object, by slot if the shape matches
+float64 readStructFieldF64(const DataObject* pObject, const StructShape* pShape, int64 slot, const std::string* pField);
+
+// Struct elements point to collected objects, so their buffers may
+// not be atomic, nor recycled through the buffer pool
+template <> void StructArrayObj::allocMatrix();
+template <> void StructArrayObj::releaseBuffer(ScalarStruct** pBuffer);
 
 template <> inline DataObject::Type StructArrayObj::getClassType() 
 { return DataObject::Type::STRUCTARRAY; }
 
 template <> DataObject* StructArrayObj::convert(DataObject::Type outType) const ;
 
+// Struct elements are modified in place, so lazy copies are full copies
+template <> StructArrayObj* StructArrayObj::copy() const ;
+template <> StructArrayObj* StructArrayObj::lazyCopy() const ;
+
 #endif // #ifndef STRUCTOBJ_H_
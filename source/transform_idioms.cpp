@@ -0,0 +1,601 @@
+// =========================================================================== //
+//                                                                             //
+// Copyright 2026 agent.                                                       //
+//                                                                             //
+//   Licensed under the Apache License, Version 2.0 (the "License");           //
+//   you may not use this file except in compliance with the License.          //
+//   You may obtain a copy of the License at                                   //
+//                                                                             //
+//       http://www.apache.org/licenses/LICENSE-2.0                            //
+//                                                                             //
+//   Unless required by applicable law or agreed to in writing, software       //
+//   distributed under the License is distributed on an "AS IS" BASIS,         //
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  //
+//   See the License for the specific language governing permissions and       //
+//  limitations under the License.                                             //
+//                                                                             //
+// =========================================================================== //
+
+// Header files
+#include <cassert>
+#include "transform_idioms.h"
+#include "assignstmt.h"
+#include "ifelsestmt.h"
+#include "loopstmts.h"
+#include "paramexpr.h"
+#include "symbolexpr.h"
+#include "constexprs.h"
+#include "binaryopexpr.h"
+#include "unaryopexpr.h"
+#include "rangeexpr.h"
+
+// Library functions called by the generated code, which must
+// not be shadowed by variables of the transformed function
+static const char* IDIOM_FUNCS[] =
+{
+	"sum",
+	"floor",
+	"numel",
+	"size",
+	"isnumeric"
+};
+
+// Description of a loop being replaced by array operations
+struct IdiomLoop
+{
+	// Variables of the function
+	const Expression::SymbolSet* pFuncVars;
+
+	// Loop variable
+	SymbolExpr* pLoopVar;
+
+	// Variables holding the first and last loop index values
+	SymbolExpr* pStartVar;
+	SymbolExpr* pEndVar;
+
+	// Variable written by the loop body
+	SymbolExpr* pTargetVar;
+
+	// Indicates that the element being written may be read
+	bool targetReadable;
+
+	// Arrays sliced by the array operations
+	Expression::SymbolSet slicedArrays;
+
+	// Loop-invariant variables read by the array operations
+	Expression::SymbolSet invariantVars;
+};
+
+/***************************************************************
+* Function: isLoopInvariant()
+* Purpose : Test if an expression is a loop-invariant operand
+* Initial : agent on October 18, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+static bool isLoopInvariant(const Expression* pExpr, IdiomLoop& loop)
+{
+	// Constants are invariant
+	if (pExpr->getExprType() == Expression::ExprType::INT_CONST ||
+		pExpr->getExprType() == Expression::ExprType::FP_CONST)
+		return true;
+
+	// Other than constants, only variables not written in the loop are invariant.
+	// Symbols which are not variables of the function may be function calls.
+	if (pExpr->getExprType() != Expression::ExprType::SYMBOL)
+		return false;
+	SymbolExpr* pSymbol = (SymbolExpr*)pExpr;
+	if (loop.pFuncVars->find(pSymbol) == loop.pFuncVars->end() ||
+		pSymbol == loop.pLoopVar || pSymbol == loop.pTargetVar)
+		return false;
+
+	// Remember the variable, its value must be scalar
+	loop.invariantVars.insert(pSymbol);
+	return true;
+}
+
+/***************************************************************
+* Function: sliceBound()
+* Purpose : Get the bound of an array slice for an index
+*           expression of the loop variable
+* Initial : agent on October 18, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+static Expression* sliceBound(const Expression* pIndexExpr, SymbolExpr* pBoundVar, IdiomLoop& loop)
+{
+	// If the index is the loop variable, the bound is that of the loop
+	if (pIndexExpr == loop.pLoopVar)
+		return pBoundVar;
+
+	// Otherwise, the index must be offset from the loop variable by an invariant
+	if (pIndexExpr->getExprType() != Expression::ExprType::BINARY_OP)
+		return NULL;
+	const BinaryOpExpr* pBinExpr = (const BinaryOpExpr*)pIndexExpr;
+	Expression* pLeftExpr = pBinExpr->getLeftExpr();
+	Expression* pRightExpr = pBinExpr->getRightExpr();
+
+	// Index of the form i + k or i - k
+	if ((pBinExpr->getOperator() == BinaryOpExpr::PLUS || pBinExpr->getOperator() == BinaryOpExpr::MINUS) &&
+		pLeftExpr == loop.pLoopVar && isLoopInvariant(pRightExpr, loop))
+		return new BinaryOpExpr(pBinExpr->getOperator(), pBoundVar, pRightExpr->copy());
+
+	// Index of the form k + i
+	if (pBinExpr->getOperator() == BinaryOpExpr::PLUS &&
+		pRightExpr == loop.pLoopVar && isLoopInvariant(pLeftExpr, loop))
+		return new BinaryOpExpr(BinaryOpExpr::PLUS, pLeftExpr->copy(), pBoundVar);
+
+	// Other index expressions are not supported
+	return NULL;
+}
+
+/***************************************************************
+* Function: vectorizeExpr()
+* Purpose : Convert an expression computing one element of the
+*           loop iteration space into an array expression
+* Initial : agent on October 18, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+static Expression* vectorizeExpr(const Expression* pExpr, IdiomLoop& loop)
+{
+	// Switch on the expression type
+	switch (pExpr->getExprType())
+	{
+		// Constants and invariant variables are broadcast as-is
+		case Expression::ExprType::INT_CONST:
+		case Expression::ExprType::FP_CONST:
+		case Expression::ExprType::SYMBOL:
+		return isLoopInvariant(pExpr, loop)? pExpr->copy():NULL;
+
+		// Element reads become slice reads
+		case Expression::ExprType::PARAM:
+		{
+			// Get a typed pointer to the expression
+			const ParamExpr* pParamExpr = (const ParamExpr*)pExpr;
+			SymbolExpr* pArray = pParamExpr->getSymExpr();
+			const Expression::ExprVector& arguments = pParamExpr->getArguments();
+
+			// The array must be a variable indexed by a single index
+			if (loop.pFuncVars->find(pArray) == loop.pFuncVars->end() ||
+				pArray == loop.pLoopVar || arguments.size() != 1)
+				return NULL;
+
+			// The written array may only be read at the element being written,
+			// otherwise the iterations would depend on each other
+			if (pArray == loop.pTargetVar && (loop.targetReadable == false || arguments[0] != loop.pLoopVar))
+				return NULL;
+
+			// Get the bounds of the slice
+			Expression* pStartExpr = sliceBound(arguments[0], loop.pStartVar, loop);
+			Expression* pEndExpr = sliceBound(arguments[0], loop.pEndVar, loop);
+			if (pStartExpr == NULL || pEndExpr == NULL)
+				return NULL;
+
+			// Read the contiguous slice of the array
+			loop.slicedArrays.insert(pArray);
+			return new ParamExpr(
+				pArray,
+				Expression::ExprVector(1, new RangeExpr(pStartExpr, pEndExpr, new IntConstExpr(1)))
+			);
+		}
+
+		// Binary operations on elements become element-wise operations
+		case Expression::ExprType::BINARY_OP:
+		{
+			// Get a typed pointer to the expression
+			const BinaryOpExpr* pBinExpr = (const BinaryOpExpr*)pExpr;
+
+			// Map the operator to its element-wise equivalent
+			BinaryOpExpr::Operator op;
+			switch (pBinExpr->getOperator())
+			{
+				case BinaryOpExpr::MULT:     op = BinaryOpExpr::ARRAY_MULT;     break;
+				case BinaryOpExpr::DIV:      op = BinaryOpExpr::ARRAY_DIV;      break;
+				case BinaryOpExpr::LEFT_DIV: op = BinaryOpExpr::ARRAY_LEFT_DIV; break;
+				case BinaryOpExpr::POWER:    op = BinaryOpExpr::ARRAY_POWER;    break;
+
+				// Short-circuit operators cannot be applied to arrays
+				case BinaryOpExpr::OR:
+				case BinaryOpExpr::AND:
+				return NULL;
+
+				default:
+				op = pBinExpr->getOperator();
+			}
+
+			// Vectorize the operands
+			Expression* pLeftExpr = vectorizeExpr(pBinExpr->getLeftExpr(), loop);
+			Expression* pRightExpr = vectorizeExpr(pBinExpr->getRightExpr(), loop);
+			if (pLeftExpr == NULL || pRightExpr == NULL)
+				return NULL;
+
+			return new BinaryOpExpr(op, pLeftExpr, pRightExpr);
+		}
+
+		// Element-wise unary operations
+		case Expression::ExprType::UNARY_OP:
+		{
+			// Get a typed pointer to the expression
+			const UnaryOpExpr* pUnaryExpr = (const UnaryOpExpr*)pExpr;
+
+			// Transposition would change the shape of the arrays
+			if (pUnaryExpr->getOperator() != UnaryOpExpr::PLUS &&
+				pUnaryExpr->getOperator() != UnaryOpExpr::MINUS &&
+				pUnaryExpr->getOperator() != UnaryOpExpr::NOT)
+				return NULL;
+
+			// Vectorize the operand
+			Expression* pOperand = vectorizeExpr(pUnaryExpr->getOperand(), loop);
+			if (pOperand == NULL)
+				return NULL;
+
+			return new UnaryOpExpr(pUnaryExpr->getOperator(), pOperand);
+		}
+
+		// Other expressions, including function calls, are not supported
+		default:
+		return NULL;
+	}
+}
+
+/***************************************************************
+* Function: isAssignOf()
+* Purpose : Test if a statement assigns to a given symbol
+* Initial : agent on October 18, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+static const AssignStmt* isAssignOf(const Statement* pStmt, const SymbolExpr* pSymbol)
+{
+	// The statement must be an assignment of a single symbol
+	if (pStmt->getStmtType() != Statement::ASSIGN)
+		return NULL;
+	const AssignStmt* pAssignStmt = (const AssignStmt*)pStmt;
+	if (pAssignStmt->getLeftExprs().size() != 1 ||
+		pAssignStmt->getLeftExprs()[0]->getExprType() != Expression::ExprType::SYMBOL)
+		return NULL;
+
+	// If a symbol is specified, the assignment must be to this symbol
+	if (pSymbol != NULL && pAssignStmt->getLeftExprs()[0] != pSymbol)
+		return NULL;
+
+	return pAssignStmt;
+}
+
+/***************************************************************
+* Function: transformIdiomLoop()
+* Purpose : Replace a loop matching an element-wise idiom by
+*           array operations
+* Initial : agent on October 18, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+static bool transformIdiomLoop(
+	LoopStmt* pLoopStmt,
+	const Statement* pPrevStmt,
+	const Expression::SymbolSet& funcVars,
+	StmtSequence::StmtVector& output
+)
+{
+	// Get the loop sequences
+	const StmtSequence::StmtVector& initStmts = pLoopStmt->getInitSeq()->getStatements();
+	const StmtSequence::StmtVector& testStmts = pLoopStmt->getTestSeq()->getStatements();
+	const StmtSequence::StmtVector& bodyStmts = pLoopStmt->getBodySeq()->getStatements();
+	const StmtSequence::StmtVector& incrStmts = pLoopStmt->getIncrSeq()->getStatements();
+
+	// The loop must be a range loop as produced by the for loop simplification:
+	// the index, step and end values are initialized in that order
+	SymbolExpr* pIndexVar = pLoopStmt->getIndexVar();
+	if (pIndexVar == NULL || pPrevStmt == NULL || initStmts.size() != 3 ||
+		testStmts.size() != 1 || bodyStmts.size() != 2 || incrStmts.size() != 1)
+		return false;
+	const AssignStmt* pStartAssign = isAssignOf(initStmts[0], pIndexVar);
+	const AssignStmt* pStepAssign = isAssignOf(initStmts[1], NULL);
+	const AssignStmt* pEndAssign = isAssignOf(initStmts[2], NULL);
+	if (pStartAssign == NULL || pStepAssign == NULL || pEndAssign == NULL)
+		return false;
+	SymbolExpr* pStepVar = (SymbolExpr*)pStepAssign->getLeftExprs()[0];
+	SymbolExpr* pEndVar = (SymbolExpr*)pEndAssign->getLeftExprs()[0];
+
+	// The step value must be the constant 1, assigned just before the loop
+	if (pStepAssign->getRightExpr()->getExprType() != Expression::ExprType::SYMBOL)
+		return false;
+	const AssignStmt* pExtStepAssign = isAssignOf(pPrevStmt, (SymbolExpr*)pStepAssign->getRightExpr());
+	if (pExtStepAssign == NULL)
+		return false;
+	Expression* pStepExpr = pExtStepAssign->getRightExpr();
+	if (!(pStepExpr->getExprType() == Expression::ExprType::INT_CONST && ((IntConstExpr*)pStepExpr)->getValue() == 1) &&
+		!(pStepExpr->getExprType() == Expression::ExprType::FP_CONST && ((FPConstExpr*)pStepExpr)->getValue() == 1))
+		return false;
+
+	// The loop must test the index against the end value and increment it by the step
+	const AssignStmt* pTestAssign = isAssignOf(testStmts[0], pLoopStmt->getTestVar());
+	const AssignStmt* pIncrAssign = isAssignOf(incrStmts[0], pIndexVar);
+	if (pTestAssign == NULL || pIncrAssign == NULL ||
+		pTestAssign->getRightExpr()->getExprType() != Expression::ExprType::BINARY_OP ||
+		pIncrAssign->getRightExpr()->getExprType() != Expression::ExprType::BINARY_OP)
+		return false;
+	const BinaryOpExpr* pTestExpr = (const BinaryOpExpr*)pTestAssign->getRightExpr();
+	const BinaryOpExpr* pIncrExpr = (const BinaryOpExpr*)pIncrAssign->getRightExpr();
+	if (pTestExpr->getOperator() != BinaryOpExpr::LESS_THAN_EQ ||
+		pTestExpr->getLeftExpr() != pIndexVar || pTestExpr->getRightExpr() != pEndVar ||
+		pIncrExpr->getOperator() != BinaryOpExpr::PLUS ||
+		pIncrExpr->getLeftExpr() != pIndexVar || pIncrExpr->getRightExpr() != pStepVar)
+		return false;
+
+	// The body must assign the index to the loop variable, followed by
+	// a single suppressed assignment
+	const AssignStmt* pLoopVarAssign = isAssignOf(bodyStmts[0], NULL);
+	if (pLoopVarAssign == NULL || pLoopVarAssign->getRightExpr() != pIndexVar ||
+		bodyStmts[1]->getStmtType() != Statement::ASSIGN)
+		return false;
+	const AssignStmt* pBodyAssign = (const AssignStmt*)bodyStmts[1];
+	if (pBodyAssign->getSuppressFlag() == false || pBodyAssign->getLeftExprs().size() != 1)
+		return false;
+	Expression* pLeftExpr = pBodyAssign->getLeftExprs()[0];
+	Expression* pRightExpr = pBodyAssign->getRightExpr();
+
+	// Describe the loop
+	IdiomLoop loop;
+	loop.pFuncVars = &funcVars;
+	loop.pLoopVar = (SymbolExpr*)pLoopVarAssign->getLeftExprs()[0];
+	loop.pStartVar = pIndexVar;
+	loop.pEndVar = pEndVar;
+
+	// Declare a pointer for the array statement
+	AssignStmt* pArrayStmt = NULL;
+
+	// If the body writes one element of an array per iteration (map, fill and copy idioms)
+	if (pLeftExpr->getExprType() == Expression::ExprType::PARAM)
+	{
+		// The array must be a variable indexed by the loop variable
+		ParamExpr* pParamExpr = (ParamExpr*)pLeftExpr;
+		loop.pTargetVar = pParamExpr->getSymExpr();
+		loop.targetReadable = true;
+		if (loop.pTargetVar == loop.pLoopVar || pParamExpr->getArguments().size() != 1 ||
+			pParamExpr->getArguments()[0] != loop.pLoopVar)
+			return false;
+
+		// Vectorize the value written
+		Expression* pValueExpr = vectorizeExpr(pRightExpr, loop);
+		if (pValueExpr == NULL)
+			return false;
+
+		// Write the whole slice at once
+		pArrayStmt = new AssignStmt(
+			new ParamExpr(
+				loop.pTargetVar,
+				Expression::ExprVector(1, new RangeExpr(pIndexVar, pEndVar, new IntConstExpr(1)))
+			),
+			pValueExpr
+		);
+	}
+
+	// If the body accumulates a sum into a variable (reduction idiom)
+	else if (pLeftExpr->getExprType() == Expression::ExprType::SYMBOL)
+	{
+		// The accumulator must be added to or subtracted from
+		loop.pTargetVar = (SymbolExpr*)pLeftExpr;
+		loop.targetReadable = false;
+		if (loop.pTargetVar == loop.pLoopVar || pRightExpr->getExprType() != Expression::ExprType::BINARY_OP)
+			return false;
+		const BinaryOpExpr* pAccumExpr = (const BinaryOpExpr*)pRightExpr;
+		Expression* pTermExpr;
+		if (pAccumExpr->getOperator() == BinaryOpExpr::PLUS && pAccumExpr->getRightExpr() == loop.pTargetVar)
+			pTermExpr = pAccumExpr->getLeftExpr();
+		else if ((pAccumExpr->getOperator() == BinaryOpExpr::PLUS || pAccumExpr->getOperator() == BinaryOpExpr::MINUS) &&
+			pAccumExpr->getLeftExpr() == loop.pTargetVar)
+			pTermExpr = pAccumExpr->getRightExpr();
+		else
+			return false;
+
+		// Vectorize the accumulated term, which must read array elements
+		Expression* pTermVecExpr = vectorizeExpr(pTermExpr, loop);
+		if (pTermVecExpr == NULL || loop.slicedArrays.empty())
+			return false;
+
+		// Accumulate the sum of the terms at once
+		pArrayStmt = new AssignStmt(
+			loop.pTargetVar,
+			new BinaryOpExpr(
+				pAccumExpr->getOperator(),
+				loop.pTargetVar,
+				new ParamExpr(SymbolExpr::getSymbol("sum"), Expression::ExprVector(1, pTermVecExpr))
+			)
+		);
+	}
+
+	// Other loop bodies are not supported
+	else
+	{
+		return false;
+	}
+
+	// Build the run-time conditions under which the array operations
+	// behave like the loop: the sliced arrays must be numeric, the
+	// invariant operands must be scalars, and the slices must have the
+	// same orientation for element-wise operations between them
+	Expression* pGuardExpr = NULL;
+	SymbolExpr* pPrevArray = NULL;
+	for (Expression::SymbolSet::const_iterator itr = loop.slicedArrays.begin(); itr != loop.slicedArrays.end(); ++itr)
+	{
+		Expression* pCondExpr = new ParamExpr(SymbolExpr::getSymbol("isnumeric"), Expression::ExprVector(1, *itr));
+		pGuardExpr = (pGuardExpr == NULL)? pCondExpr:new BinaryOpExpr(BinaryOpExpr::ARRAY_AND, pGuardExpr, pCondExpr);
+
+		// If another array is sliced, compare their orientations
+		if (pPrevArray != NULL)
+		{
+			Expression::ExprVector prevArgs;
+			prevArgs.push_back(pPrevArray);
+			prevArgs.push_back(new IntConstExpr(2));
+			Expression::ExprVector curArgs;
+			curArgs.push_back(*itr);
+			curArgs.push_back(new IntConstExpr(2));
+
+			pCondExpr = new BinaryOpExpr(
+				BinaryOpExpr::EQUAL,
+				new BinaryOpExpr(BinaryOpExpr::EQUAL, new ParamExpr(SymbolExpr::getSymbol("size"), prevArgs), new IntConstExpr(1)),
+				new BinaryOpExpr(BinaryOpExpr::EQUAL, new ParamExpr(SymbolExpr::getSymbol("size"), curArgs), new IntConstExpr(1))
+			);
+			pGuardExpr = new BinaryOpExpr(BinaryOpExpr::ARRAY_AND, pGuardExpr, pCondExpr);
+		}
+		pPrevArray = *itr;
+	}
+	for (Expression::SymbolSet::const_iterator itr = loop.invariantVars.begin(); itr != loop.invariantVars.end(); ++itr)
+	{
+		Expression* pCondExpr = new BinaryOpExpr(
+			BinaryOpExpr::EQUAL,
+			new ParamExpr(SymbolExpr::getSymbol("numel"), Expression::ExprVector(1, *itr)),
+			new IntConstExpr(1)
+		);
+		pGuardExpr = (pGuardExpr == NULL)? pCondExpr:new BinaryOpExpr(BinaryOpExpr::ARRAY_AND, pGuardExpr, pCondExpr);
+	}
+
+	// The array operation is followed by the assignment of the
+	// last index value to the loop variable
+	StmtSequence::StmtVector arrayStmts;
+	arrayStmts.push_back(pArrayStmt);
+	arrayStmts.push_back(new AssignStmt(
+		loop.pLoopVar,
+		new BinaryOpExpr(
+			BinaryOpExpr::PLUS,
+			pIndexVar,
+			new ParamExpr(
+				SymbolExpr::getSymbol("floor"),
+				Expression::ExprVector(1, new BinaryOpExpr(BinaryOpExpr::MINUS, pEndVar, pIndexVar))
+			)
+		)
+	));
+	StmtSequence* pArraySeq = new StmtSequence(arrayStmts);
+
+	// If the conditions are not met at run time, execute the original loop,
+	// whose index, step and end values are already initialized
+	if (pGuardExpr != NULL)
+	{
+		pArraySeq = new StmtSequence(new IfElseStmt(
+			pGuardExpr,
+			pArraySeq,
+			new StmtSequence(new LoopStmt(
+				pIndexVar,
+				pLoopStmt->getTestVar(),
+				new StmtSequence(),
+				pLoopStmt->getTestSeq()->copy(),
+				pLoopStmt->getBodySeq()->copy(),
+				pLoopStmt->getIncrSeq()->copy(),
+				pLoopStmt->getAnnotations()
+			))
+		));
+	}
+
+	// Initialize the index, step and end values, and perform the
+	// array operations only if the loop has at least one iteration
+	for (size_t i = 0; i < initStmts.size(); ++i)
+		output.push_back(initStmts[i]->copy());
+	output.push_back(testStmts[0]->copy());
+	output.push_back(new IfElseStmt(
+		pLoopStmt->getTestVar(),
+		pArraySeq,
+		new StmtSequence()
+	));
+
+	// The loop was transformed
+	return true;
+}
+
+/***************************************************************
+* Function: transformIdiomSeq()
+* Purpose : Replace the loops matching element-wise idioms in
+*           a statement sequence
+* Initial : agent on October 18, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+static StmtSequence* transformIdiomSeq(const StmtSequence* pSeq, const Expression::SymbolSet& funcVars)
+{
+	// Get the statements of the sequence
+	const StmtSequence::StmtVector& stmts = pSeq->getStatements();
+
+	// Declare a vector for the output statements
+	StmtSequence::StmtVector output;
+
+	// For each statement
+	for (size_t i = 0; i < stmts.size(); ++i)
+	{
+		// Get a pointer to the statement
+		Statement* pStmt = stmts[i];
+
+		// Switch on the statement type
+		switch (pStmt->getStmtType())
+		{
+			// If-else statement
+			case Statement::IF_ELSE:
+			{
+				// Transform the loops in both branches
+				IfElseStmt* pIfStmt = (IfElseStmt*)pStmt;
+				output.push_back(new IfElseStmt(
+					pIfStmt->getCondition(),
+					transformIdiomSeq(pIfStmt->getIfBlock(), funcVars),
+					transformIdiomSeq(pIfStmt->getElseBlock(), funcVars)
+				));
+			}
+			break;
+
+			// Loop statement
+			case Statement::LOOP:
+			{
+				// Get a typed pointer to the statement
+				LoopStmt* pLoopStmt = (LoopStmt*)pStmt;
+
+				// If the loop matches an idiom, it is replaced
+				if (transformIdiomLoop(pLoopStmt, (i > 0)? stmts[i-1]:NULL, funcVars, output))
+					break;
+
+				// Otherwise, transform the loops nested in its body
+				output.push_back(new LoopStmt(
+					pLoopStmt->getIndexVar(),
+					pLoopStmt->getTestVar(),
+					pLoopStmt->getInitSeq(),
+					pLoopStmt->getTestSeq(),
+					transformIdiomSeq(pLoopStmt->getBodySeq(), funcVars),
+					pLoopStmt->getIncrSeq(),
+					pLoopStmt->getAnnotations()
+				));
+			}
+			break;
+
+			// Other statements are kept
+			default:
+			output.push_back(pStmt);
+		}
+	}
+
+	// Return the new sequence
+	return new StmtSequence(output);
+}
+
+/***************************************************************
+* Function: transformLoopIdioms()
+* Purpose : Replace the element-wise loops of a statement
+*           sequence by array operations
+* Initial : agent on October 18, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+StmtSequence* transformLoopIdioms(StmtSequence* pSeq, ProgFunction* pFunction)
+{
+	// The variables are the function parameters and the symbols its body defines
+	const ProgFunction::ParamVector& inParams = pFunction->getInParams();
+	const ProgFunction::ParamVector& outParams = pFunction->getOutParams();
+	Expression::SymbolSet funcVars = pSeq->getSymbolDefs();
+	funcVars.insert(inParams.begin(), inParams.end());
+	funcVars.insert(outParams.begin(), outParams.end());
+
+	// If a library function used by the generated code is shadowed, do nothing
+	for (size_t i = 0; i < sizeof(IDIOM_FUNCS) / sizeof(IDIOM_FUNCS[0]); ++i)
+		if (funcVars.find(SymbolExpr::getSymbol(IDIOM_FUNCS[i])) != funcVars.end())
+			return pSeq;
+
+	// Transform the loops in the sequence
+	return transformIdiomSeq(pSeq, funcVars);
+}
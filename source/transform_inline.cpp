@@ -0,0 +1,868 @@
+// =========================================================================== //
+//                                                                             //
+// Copyright 2026 agent.                                                       //
+//                                                                             //
+//   Licensed under the Apache License, Version 2.0 (the "License");           //
+//   you may not use this file except in compliance with the License.          //
+//   You may obtain a copy of the License at                                   //
+//                                                                             //
+//       http://www.apache.org/licenses/LICENSE-2.0                            //
+//                                                                             //
+//   Unless required by applicable law or agreed to in writing, software       //
+//   distributed under the License is distributed on an "AS IS" BASIS,         //
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  //
+//   See the License for the specific language governing permissions and       //
+//  limitations under the License.                                             //
+//                                                                             //
+// =========================================================================== //
+
+// Header files
+#include <map>
+#include <cassert>
+#include "transform_inline.h"
+#include "transform_logic.h"
+#include "transform_split.h"
+#include "analysis_metrics.h"
+#include "analysis_reachdefs.h"
+#include "interpreter.h"
+#include "assignstmt.h"
+#include "exprstmt.h"
+#include "ifelsestmt.h"
+#include "loopstmts.h"
+#include "returnstmt.h"
+#include "paramexpr.h"
+#include "symbolexpr.h"
+#include "constexprs.h"
+#include "endexpr.h"
+
+// Functions which inspect or modify the workspace of their caller,
+// and can thus not be moved into another function
+static const char* WORKSPACE_FUNCS[] =
+{
+	"eval",
+	"evalin",
+	"assignin",
+	"inputname",
+	"exist",
+	"clear",
+	"who",
+	"whos",
+	"load",
+	"save",
+	"mfilename",
+	"dbstack",
+	"nargchk",
+	"narginchk",
+	"nargoutchk"
+};
+
+// Symbol substitution map type definition
+typedef std::map<const SymbolExpr*, Expression*> SubstMap;
+
+// Inlining state for a caller function
+struct InlineState
+{
+	// Caller function
+	ProgFunction* pCaller;
+
+	// Variables of the caller function
+	Expression::SymbolSet callerVars;
+
+	// Maximum number of statements in an inlined function
+	size_t maxStmts;
+
+	// Loop nesting depth of the current call site
+	size_t loopDepth;
+};
+
+/***************************************************************
+* Function: isInlinableExpr()
+* Purpose : Test if an expression can be moved into a caller
+* Initial : agent on October 18, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+static bool isInlinableExpr(const Expression* pExpr)
+{
+	// Lambda expressions capture the workspace, and function
+	// handles are resolved in the scope of the callee
+	if (pExpr->getExprType() == Expression::ExprType::LAMBDA ||
+		pExpr->getExprType() == Expression::ExprType::FN_HANDLE)
+		return false;
+
+	// Test the sub-expressions
+	Expression::ExprVector subExprs = pExpr->getSubExprs();
+	for (size_t i = 0; i < subExprs.size(); ++i)
+		if (subExprs[i] != NULL && isInlinableExpr(subExprs[i]) == false)
+			return false;
+
+	// The expression can be inlined
+	return true;
+}
+
+/***************************************************************
+* Function: isInlinableSeq()
+* Purpose : Test if a statement sequence can be moved into a
+*           caller function
+* Initial : agent on October 18, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+static bool isInlinableSeq(const StmtSequence* pSeq, bool inLoop)
+{
+	// Get the statements of the sequence
+	const StmtSequence::StmtVector& stmts = pSeq->getStatements();
+
+	// For each statement
+	for (size_t i = 0; i < stmts.size(); ++i)
+	{
+		// Get a pointer to the statement
+		const Statement* pStmt = stmts[i];
+
+		// Switch on the statement type
+		switch (pStmt->getStmtType())
+		{
+			// Expression statement
+			case Statement::EXPR:
+			if (isInlinableExpr(((const ExprStmt*)pStmt)->getExpression()) == false)
+				return false;
+			break;
+
+			// Assignment statement
+			case Statement::ASSIGN:
+			{
+				// Get a typed pointer to the statement
+				const AssignStmt* pAssignStmt = (const AssignStmt*)pStmt;
+
+				// Displayed assignments would show the renamed variables
+				if (pAssignStmt->getSuppressFlag() == false)
+					return false;
+
+				// Test the left and right expressions
+				Expression::ExprVector leftExprs = pAssignStmt->getLeftExprs();
+				for (size_t j = 0; j < leftExprs.size(); ++j)
+					if (isInlinableExpr(leftExprs[j]) == false)
+						return false;
+				if (isInlinableExpr(pAssignStmt->getRightExpr()) == false)
+					return false;
+			}
+			break;
+
+			// If-else statement
+			case Statement::IF_ELSE:
+			{
+				// Get a typed pointer to the statement
+				const IfElseStmt* pIfStmt = (const IfElseStmt*)pStmt;
+
+				// Test the condition and both branches
+				if (isInlinableExpr(pIfStmt->getCondition()) == false ||
+					isInlinableSeq(pIfStmt->getIfBlock(), inLoop) == false ||
+					isInlinableSeq(pIfStmt->getElseBlock(), inLoop) == false)
+					return false;
+			}
+			break;
+
+			// Loop statement
+			case Statement::LOOP:
+			{
+				// Get a typed pointer to the statement
+				const LoopStmt* pLoopStmt = (const LoopStmt*)pStmt;
+
+				// Test the loop sequences
+				if (isInlinableSeq(pLoopStmt->getInitSeq(), true) == false ||
+					isInlinableSeq(pLoopStmt->getTestSeq(), true) == false ||
+					isInlinableSeq(pLoopStmt->getBodySeq(), true) == false ||
+					isInlinableSeq(pLoopStmt->getIncrSeq(), true) == false)
+					return false;
+			}
+			break;
+
+			// Returns can only be removed outside of loops
+			case Statement::RETURN:
+			if (inLoop)
+				return false;
+			break;
+
+			// Break and continue statements must act on a loop of the
+			// callee, once inlined they would act on the caller's loop
+			case Statement::BREAK:
+			case Statement::CONTINUE:
+			if (!inLoop)
+				return false;
+			break;
+
+			// Other statements should have been simplified
+			default:
+			return false;
+		}
+	}
+
+	// The sequence can be inlined
+	return true;
+}
+
+/***************************************************************
+* Function: containsReturn()
+* Purpose : Test if a statement sequence contains a return
+* Initial : agent on October 18, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+static bool containsReturn(const StmtSequence* pSeq)
+{
+	// Get the statements of the sequence
+	const StmtSequence::StmtVector& stmts = pSeq->getStatements();
+
+	// For each statement
+	for (size_t i = 0; i < stmts.size(); ++i)
+	{
+		// If this is a return statement, stop
+		if (stmts[i]->getStmtType() == Statement::RETURN)
+			return true;
+
+		// If this is an if-else statement containing a return, stop
+		if (stmts[i]->getStmtType() == Statement::IF_ELSE &&
+			(containsReturn(((const IfElseStmt*)stmts[i])->getIfBlock()) ||
+			 containsReturn(((const IfElseStmt*)stmts[i])->getElseBlock())))
+			return true;
+	}
+
+	// No return statement was found
+	return false;
+}
+
+/***************************************************************
+* Function: removeReturns()
+* Purpose : Remove the return statements from a function body
+*           by moving the code following conditional returns
+*           into the branches which do not return
+* Initial : agent on October 18, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+static StmtSequence* removeReturns(const StmtSequence::StmtVector& stmts)
+{
+	// Declare a vector for the output statements
+	StmtSequence::StmtVector output;
+
+	// For each statement
+	for (size_t i = 0; i < stmts.size(); ++i)
+	{
+		// Get a pointer to the statement
+		Statement* pStmt = stmts[i];
+
+		// If this is a return statement, the following statements are never executed
+		if (pStmt->getStmtType() == Statement::RETURN)
+			break;
+
+		// If this is an if-else statement containing a return
+		if (pStmt->getStmtType() == Statement::IF_ELSE &&
+			(containsReturn(((IfElseStmt*)pStmt)->getIfBlock()) || containsReturn(((IfElseStmt*)pStmt)->getElseBlock())))
+		{
+			// Get a typed pointer to the statement
+			IfElseStmt* pIfStmt = (IfElseStmt*)pStmt;
+
+			// Append the following statements to both branches
+			StmtSequence::StmtVector ifStmts = pIfStmt->getIfBlock()->getStatements();
+			StmtSequence::StmtVector elseStmts = pIfStmt->getElseBlock()->getStatements();
+			ifStmts.insert(ifStmts.end(), stmts.begin() + i + 1, stmts.end());
+			elseStmts.insert(elseStmts.end(), stmts.begin() + i + 1, stmts.end());
+
+			// Remove the returns from both branches
+			output.push_back(new IfElseStmt(
+				pIfStmt->getCondition(),
+				removeReturns(ifStmts),
+				removeReturns(elseStmts)
+			));
+
+			// The following statements were moved into the branches
+			break;
+		}
+
+		// Keep other statements as-is
+		output.push_back(pStmt);
+	}
+
+	// Return the statements without returns
+	return new StmtSequence(output);
+}
+
+/***************************************************************
+* Function: substExpr()
+* Purpose : Copy an expression, substituting symbols
+* Initial : agent on October 18, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+static Expression* substExpr(const Expression* pExpr, const SubstMap& substMap)
+{
+	// If this is a symbol, substitute it
+	if (pExpr->getExprType() == Expression::ExprType::SYMBOL)
+	{
+		SubstMap::const_iterator substItr = substMap.find((const SymbolExpr*)pExpr);
+		return (substItr != substMap.end())? substItr->second->copy():pExpr->copy();
+	}
+
+	// Copy the expression
+	Expression* pNewExpr = pExpr->copy();
+
+	// If this is an end expression, substitute the associated symbols
+	if (pNewExpr->getExprType() == Expression::ExprType::END)
+	{
+		EndExpr* pEndExpr = (EndExpr*)pNewExpr;
+		EndExpr::AssocVector assocs = pEndExpr->getAssocs();
+		for (size_t i = 0; i < assocs.size(); ++i)
+		{
+			SubstMap::const_iterator substItr = substMap.find(assocs[i].pSymbol);
+			if (substItr != substMap.end())
+				assocs[i].pSymbol = (SymbolExpr*)substItr->second;
+		}
+		pEndExpr->setAssocs(assocs);
+	}
+
+	// Substitute the sub-expressions
+	Expression::ExprVector subExprs = pNewExpr->getSubExprs();
+	for (size_t i = 0; i < subExprs.size(); ++i)
+		if (subExprs[i] != NULL)
+			pNewExpr->replaceSubExpr(i, substExpr(subExprs[i], substMap));
+
+	// Return the new expression
+	return pNewExpr;
+}
+
+/***************************************************************
+* Function: substSeq()
+* Purpose : Copy a statement sequence, substituting symbols
+* Initial : agent on October 18, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+static StmtSequence* substSeq(const StmtSequence* pSeq, const SubstMap& substMap, bool inLoop)
+{
+	// Get the statements of the sequence
+	const StmtSequence::StmtVector& stmts = pSeq->getStatements();
+
+	// Declare a vector for the output statements
+	StmtSequence::StmtVector output;
+
+	// For each statement
+	for (size_t i = 0; i < stmts.size(); ++i)
+	{
+		// Get a pointer to the statement
+		Statement* pStmt = stmts[i];
+
+		// Switch on the statement type
+		switch (pStmt->getStmtType())
+		{
+			// Expression statement
+			case Statement::EXPR:
+			{
+				ExprStmt* pExprStmt = (ExprStmt*)pStmt;
+				output.push_back(new ExprStmt(substExpr(pExprStmt->getExpression(), substMap), pExprStmt->getSuppressFlag()));
+			}
+			break;
+
+			// Assignment statement
+			case Statement::ASSIGN:
+			{
+				AssignStmt* pAssignStmt = (AssignStmt*)pStmt;
+				Expression::ExprVector leftExprs = pAssignStmt->getLeftExprs();
+				for (size_t j = 0; j < leftExprs.size(); ++j)
+					leftExprs[j] = substExpr(leftExprs[j], substMap);
+				output.push_back(new AssignStmt(leftExprs, substExpr(pAssignStmt->getRightExpr(), substMap), pAssignStmt->getSuppressFlag()));
+			}
+			break;
+
+			// If-else statement
+			case Statement::IF_ELSE:
+			{
+				IfElseStmt* pIfStmt = (IfElseStmt*)pStmt;
+				output.push_back(new IfElseStmt(
+					substExpr(pIfStmt->getCondition(), substMap),
+					substSeq(pIfStmt->getIfBlock(), substMap, inLoop),
+					substSeq(pIfStmt->getElseBlock(), substMap, inLoop)
+				));
+			}
+			break;
+
+			// Loop statement
+			case Statement::LOOP:
+			{
+				// Get a typed pointer to the statement
+				LoopStmt* pLoopStmt = (LoopStmt*)pStmt;
+
+				// Substitute the index and test variables
+				SymbolExpr* pIndexVar = pLoopStmt->getIndexVar();
+				SymbolExpr* pTestVar = pLoopStmt->getTestVar();
+				if (pIndexVar != NULL)
+					pIndexVar = (SymbolExpr*)substExpr(pIndexVar, substMap);
+				if (pTestVar != NULL)
+					pTestVar = (SymbolExpr*)substExpr(pTestVar, substMap);
+
+				// A loop inlined inside a loop of the caller is no longer outermost
+				unsigned annotations = pLoopStmt->getAnnotations();
+				if (inLoop)
+					annotations = (annotations & ~Statement::OUTERMOST) | Statement::IN_LOOP;
+
+				// Create the new loop statement
+				output.push_back(new LoopStmt(
+					pIndexVar,
+					pTestVar,
+					substSeq(pLoopStmt->getInitSeq(), substMap, inLoop),
+					substSeq(pLoopStmt->getTestSeq(), substMap, true),
+					substSeq(pLoopStmt->getBodySeq(), substMap, true),
+					substSeq(pLoopStmt->getIncrSeq(), substMap, true),
+					annotations
+				));
+			}
+			break;
+
+			// Other statements are copied
+			default:
+			output.push_back(pStmt->copy());
+		}
+	}
+
+	// Return the new sequence
+	return new StmtSequence(output);
+}
+
+/***************************************************************
+* Function: countStmts()
+* Purpose : Count the statements in a sequence
+* Initial : agent on October 18, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+static size_t countStmts(const StmtSequence* pSeq, bool& hasLoop)
+{
+	// Get the statements of the sequence
+	const StmtSequence::StmtVector& stmts = pSeq->getStatements();
+
+	// Count the statements of this sequence
+	size_t count = stmts.size();
+
+	// Add the statements of the nested sequences
+	for (size_t i = 0; i < stmts.size(); ++i)
+	{
+		if (stmts[i]->getStmtType() == Statement::IF_ELSE)
+		{
+			count += countStmts(((const IfElseStmt*)stmts[i])->getIfBlock(), hasLoop);
+			count += countStmts(((const IfElseStmt*)stmts[i])->getElseBlock(), hasLoop);
+		}
+		else if (stmts[i]->getStmtType() == Statement::LOOP)
+		{
+			hasLoop = true;
+			count += countStmts(((const LoopStmt*)stmts[i])->getInitSeq(), hasLoop);
+			count += countStmts(((const LoopStmt*)stmts[i])->getTestSeq(), hasLoop);
+			count += countStmts(((const LoopStmt*)stmts[i])->getBodySeq(), hasLoop);
+			count += countStmts(((const LoopStmt*)stmts[i])->getIncrSeq(), hasLoop);
+		}
+	}
+
+	// Return the statement count
+	return count;
+}
+
+/***************************************************************
+* Function: lookupFunction()
+* Purpose : Find the function a symbol refers to in a scope
+* Initial : agent on October 18, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+static DataObject* lookupFunction(const SymbolExpr* pSymbol, const ProgFunction* pScope)
+{
+	// Declare a pointer for the symbol's binding
+	DataObject* pObject = NULL;
+
+	// Setup a try block to catch errors
+	try
+	{
+		// Lookup the symbol in the local environment of the function
+		pObject = Interpreter::evalSymbol(pSymbol, ProgFunction::getLocalEnv(pScope));
+	}
+
+	// Catch any run-time error
+	catch (RunError error)
+	{
+		// If the symbol lookup fails, do nothing
+	}
+
+	// Only functions are of interest
+	if (pObject != NULL && pObject->getType() != DataObject::Type::FUNCTION)
+		return NULL;
+
+	// Return the function found, if any
+	return pObject;
+}
+
+/***************************************************************
+* Function: usesUndefinedVars()
+* Purpose : Test if a statement sequence may read variables
+*           which are undefined on some path
+* Initial : agent on October 18, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+static bool usesUndefinedVars(const StmtSequence* pSeq, const ReachDefMap& reachDefMap)
+{
+	// Get the statements of the sequence
+	const StmtSequence::StmtVector& stmts = pSeq->getStatements();
+
+	// For each statement
+	for (size_t i = 0; i < stmts.size(); ++i)
+	{
+		// Get a pointer to the statement
+		const Statement* pStmt = stmts[i];
+
+		// Get the symbols read by the statement itself
+		Expression::SymbolSet uses;
+		if (pStmt->getStmtType() == Statement::IF_ELSE)
+			uses = ((const IfElseStmt*)pStmt)->getCondition()->getSymbolUses();
+		else if (pStmt->getStmtType() != Statement::LOOP)
+			uses = pStmt->getSymbolUses();
+
+		// Get the definitions reaching the statement
+		ReachDefMap::const_iterator defItr = reachDefMap.find(pStmt);
+		assert (defItr != reachDefMap.end());
+
+		// If an undefined value reaches one of the uses, stop
+		for (Expression::SymbolSet::iterator itr = uses.begin(); itr != uses.end(); ++itr)
+		{
+			VarDefMap::const_iterator varItr = defItr->second.find(*itr);
+			if (varItr != defItr->second.end() && varItr->second.find(NULL) != varItr->second.end())
+				return true;
+		}
+
+		// Test the nested sequences
+		if (pStmt->getStmtType() == Statement::IF_ELSE)
+		{
+			const IfElseStmt* pIfStmt = (const IfElseStmt*)pStmt;
+			if (usesUndefinedVars(pIfStmt->getIfBlock(), reachDefMap) || usesUndefinedVars(pIfStmt->getElseBlock(), reachDefMap))
+				return true;
+		}
+		else if (pStmt->getStmtType() == Statement::LOOP)
+		{
+			const LoopStmt* pLoopStmt = (const LoopStmt*)pStmt;
+			if (usesUndefinedVars(pLoopStmt->getInitSeq(), reachDefMap) || usesUndefinedVars(pLoopStmt->getTestSeq(), reachDefMap) ||
+				usesUndefinedVars(pLoopStmt->getBodySeq(), reachDefMap) || usesUndefinedVars(pLoopStmt->getIncrSeq(), reachDefMap))
+				return true;
+		}
+	}
+
+	// No undefined variable is read
+	return false;
+}
+
+/***************************************************************
+* Function: inlineCall()
+* Purpose : Inline a call to a small function
+* Initial : agent on October 18, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+static bool inlineCall(
+	const ParamExpr* pCallExpr,
+	const Expression::ExprVector& leftExprs,
+	bool suppressOut,
+	InlineState& state,
+	StmtSequence::StmtVector& output
+)
+{
+	// The called symbol must not be a variable of the caller
+	const SymbolExpr* pFuncSym = pCallExpr->getSymExpr();
+	if (pCallExpr->getExpr()->getExprType() != Expression::ExprType::SYMBOL ||
+		state.callerVars.find((SymbolExpr*)pFuncSym) != state.callerVars.end())
+		return false;
+
+	// The symbol must refer to a program function
+	Function* pFunc = (Function*)lookupFunction(pFuncSym, state.pCaller);
+	if (pFunc == NULL || pFunc->isProgFunction() == false)
+		return false;
+	ProgFunction* pCallee = (ProgFunction*)pFunc;
+
+	// Get the callee parameters and argument counts
+	const ProgFunction::ParamVector& inParams = pCallee->getInParams();
+	const ProgFunction::ParamVector& outParams = pCallee->getOutParams();
+	const ParamExpr::ExprVector& arguments = pCallExpr->getArguments();
+	size_t nargout = leftExprs.size();
+
+	// The callee must be a plain, non-recursive function called with valid argument counts
+	if (pCallee == state.pCaller || pCallee->isScript() || pCallee->isClosure() ||
+		pCallee->getParent() != NULL || pCallee->getNestedFuncs().empty() == false ||
+		arguments.size() > inParams.size() || nargout > outParams.size() ||
+		(nargout == 0 && outParams.empty() == false))
+		return false;
+
+	// Cell indexing arguments may expand to several values
+	for (size_t i = 0; i < arguments.size(); ++i)
+		if (arguments[i]->getExprType() == Expression::ExprType::CELL_INDEX)
+			return false;
+
+	// The callee must be small enough to be inlined
+	StmtSequence* pCalleeBody = pCallee->getCurrentBody();
+	const MetricsInfo* pMetricsInfo = (const MetricsInfo*)AnalysisManager::requestInfo(
+		&computeMetrics,
+		pCallee,
+		pCalleeBody,
+		TypeSetString()
+	);
+	if (pMetricsInfo->numStmts > state.maxStmts)
+		return false;
+
+	// The callee body must only contain statements which can be moved
+	if (isInlinableSeq(pCalleeBody, false) == false)
+		return false;
+
+	// Get the symbols used and defined by the callee
+	Expression::SymbolSet calleeUses = pCalleeBody->getSymbolUses();
+	Expression::SymbolSet calleeVars = pCalleeBody->getSymbolDefs();
+	calleeVars.insert(inParams.begin(), inParams.end());
+	calleeVars.insert(outParams.begin(), outParams.end());
+
+	// Get the argument count symbols
+	SymbolExpr* pNarginSym = Interpreter::getNarginSym();
+	SymbolExpr* pNargoutSym = Interpreter::getNargoutSym();
+
+	// The argument count symbols must not be redefined
+	if (calleeVars.find(pNarginSym) != calleeVars.end() || calleeVars.find(pNargoutSym) != calleeVars.end())
+		return false;
+
+	// For each symbol used by the callee
+	for (Expression::SymbolSet::iterator itr = calleeUses.begin(); itr != calleeUses.end(); ++itr)
+	{
+		// Variables and argument counts are substituted
+		if (calleeVars.find(*itr) != calleeVars.end() || *itr == pNarginSym || *itr == pNargoutSym)
+			continue;
+
+		// Functions accessing the workspace of their caller cannot be moved
+		for (size_t i = 0; i < sizeof(WORKSPACE_FUNCS) / sizeof(WORKSPACE_FUNCS[0]); ++i)
+			if ((*itr)->getSymName() == WORKSPACE_FUNCS[i])
+				return false;
+
+		// The symbol must refer to the same function in the caller
+		if (state.callerVars.find(*itr) != state.callerVars.end() ||
+			lookupFunction(*itr, pCallee) != lookupFunction(*itr, state.pCaller))
+			return false;
+	}
+
+	// Map the callee variables to new temporaries of the caller
+	SubstMap substMap;
+	for (Expression::SymbolSet::iterator itr = calleeVars.begin(); itr != calleeVars.end(); ++itr)
+		substMap[*itr] = state.pCaller->createTemp();
+
+	// Replace the argument counts by constants
+	substMap[pNarginSym] = new IntConstExpr(arguments.size());
+	substMap[pNargoutSym] = new IntConstExpr(nargout);
+
+	// Remove the returns from the callee body
+	StmtSequence* pNewBody = removeReturns(pCalleeBody->getStatements());
+
+	// The renamed variables keep their values between inlined calls, so every
+	// variable must be assigned before it is read, except the arguments passed
+	VarDefMap startMap;
+	for (Expression::SymbolSet::iterator itr = calleeVars.begin(); itr != calleeVars.end(); ++itr)
+		startMap[*itr].insert(NULL);
+	for (size_t i = 0; i < arguments.size(); ++i)
+	{
+		startMap[inParams[i]].clear();
+		startMap[inParams[i]].insert(pCallee);
+	}
+
+	// Compute the reaching definitions in the callee body
+	// Note: the returns were removed, so all paths reach the exit
+	VarDefMap exitMap;
+	VarDefMap retMap;
+	VarDefMap breakMap;
+	VarDefMap contMap;
+	ReachDefMap reachDefMap;
+	getReachDefs(pNewBody, startMap, exitMap, retMap, breakMap, contMap, reachDefMap);
+
+	// If a variable may be read before it is assigned, stop
+	if (usesUndefinedVars(pNewBody, reachDefMap))
+		return false;
+
+	// If a requested output may be left unassigned, stop
+	for (size_t i = 0; i < nargout; ++i)
+		if (exitMap[outParams[i]].find(NULL) != exitMap[outParams[i]].end())
+			return false;
+
+	// Rename the symbols of the callee body
+	pNewBody = substSeq(pNewBody, substMap, state.loopDepth > 0);
+
+	// Moving the code following returns into branches may duplicate it
+	bool hasLoop = false;
+	if (countStmts(pNewBody, hasLoop) > 2 * state.maxStmts)
+		return false;
+
+	// Convert the inlined body to split form
+	pNewBody = transformLogic(pNewBody, state.pCaller);
+	pNewBody = splitSequence(pNewBody, state.pCaller);
+
+	// Assign the arguments to the renamed input parameters
+	for (size_t i = 0; i < arguments.size(); ++i)
+		output.push_back(new AssignStmt(substMap[inParams[i]]->copy(), arguments[i]->copy()));
+
+	// Add the inlined body
+	output.insert(output.end(), pNewBody->getStatements().begin(), pNewBody->getStatements().end());
+
+	// Assign the renamed output parameters to the left expressions
+	for (size_t i = 0; i < nargout; ++i)
+		output.push_back(new AssignStmt(leftExprs[i]->copy(), substMap[outParams[i]]->copy(), suppressOut));
+
+	// The call was inlined
+	return true;
+}
+
+/***************************************************************
+* Function: inlineSeq()
+* Purpose : Inline the calls in a sequence of statements
+* Initial : agent on October 18, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+static StmtSequence* inlineSeq(const StmtSequence* pSeq, InlineState& state, bool& inlinedLoop)
+{
+	// Get the statements of the sequence
+	const StmtSequence::StmtVector& stmts = pSeq->getStatements();
+
+	// Declare a vector for the output statements
+	StmtSequence::StmtVector output;
+
+	// For each statement
+	for (size_t i = 0; i < stmts.size(); ++i)
+	{
+		// Get a pointer to the statement
+		Statement* pStmt = stmts[i];
+
+		// Switch on the statement type
+		switch (pStmt->getStmtType())
+		{
+			// Expression statement
+			case Statement::EXPR:
+			{
+				// If this is a call whose outputs are unused, attempt to inline it
+				ExprStmt* pExprStmt = (ExprStmt*)pStmt;
+				size_t numStmts = output.size();
+				if (pExprStmt->getExpression()->getExprType() == Expression::ExprType::PARAM &&
+					inlineCall((ParamExpr*)pExprStmt->getExpression(), Expression::ExprVector(), true, state, output))
+				{
+					// Note if a loop was inlined
+					countStmts(new StmtSequence(StmtSequence::StmtVector(output.begin() + numStmts, output.end())), inlinedLoop);
+					continue;
+				}
+
+				// Otherwise, keep the statement
+				output.push_back(pStmt);
+			}
+			break;
+
+			// Assignment statement
+			case Statement::ASSIGN:
+			{
+				// If this is a call assigned to variables, attempt to inline it
+				AssignStmt* pAssignStmt = (AssignStmt*)pStmt;
+				size_t numStmts = output.size();
+				if (pAssignStmt->getRightExpr()->getExprType() == Expression::ExprType::PARAM &&
+					inlineCall((ParamExpr*)pAssignStmt->getRightExpr(), pAssignStmt->getLeftExprs(), pAssignStmt->getSuppressFlag(), state, output))
+				{
+					// Note if a loop was inlined
+					countStmts(new StmtSequence(StmtSequence::StmtVector(output.begin() + numStmts, output.end())), inlinedLoop);
+					continue;
+				}
+
+				// Otherwise, keep the statement
+				output.push_back(pStmt);
+			}
+			break;
+
+			// If-else statement
+			case Statement::IF_ELSE:
+			{
+				// Inline the calls in both branches
+				IfElseStmt* pIfStmt = (IfElseStmt*)pStmt;
+				output.push_back(new IfElseStmt(
+					pIfStmt->getCondition(),
+					inlineSeq(pIfStmt->getIfBlock(), state, inlinedLoop),
+					inlineSeq(pIfStmt->getElseBlock(), state, inlinedLoop)
+				));
+			}
+			break;
+
+			// Loop statement
+			case Statement::LOOP:
+			{
+				// Get a typed pointer to the statement
+				LoopStmt* pLoopStmt = (LoopStmt*)pStmt;
+
+				// Inline the calls in the loop sequences
+				bool bodyLoop = false;
+				StmtSequence* pNewInitSeq = inlineSeq(pLoopStmt->getInitSeq(), state, inlinedLoop);
+				state.loopDepth++;
+				StmtSequence* pNewTestSeq = inlineSeq(pLoopStmt->getTestSeq(), state, bodyLoop);
+				StmtSequence* pNewBodySeq = inlineSeq(pLoopStmt->getBodySeq(), state, bodyLoop);
+				StmtSequence* pNewIncrSeq = inlineSeq(pLoopStmt->getIncrSeq(), state, bodyLoop);
+				state.loopDepth--;
+
+				// If a loop was inlined in this loop, it is no longer innermost
+				unsigned annotations = pLoopStmt->getAnnotations();
+				if (bodyLoop)
+					annotations &= ~Statement::INNERMOST;
+				inlinedLoop = inlinedLoop || bodyLoop;
+
+				// Create the new loop statement
+				output.push_back(new LoopStmt(
+					pLoopStmt->getIndexVar(),
+					pLoopStmt->getTestVar(),
+					pNewInitSeq,
+					pNewTestSeq,
+					pNewBodySeq,
+					pNewIncrSeq,
+					annotations
+				));
+			}
+			break;
+
+			// Other statements are kept
+			default:
+			output.push_back(pStmt);
+		}
+	}
+
+	// Return the new sequence
+	return new StmtSequence(output);
+}
+
+/***************************************************************
+* Function: inlineCalls()
+* Purpose : Inline the calls to small functions in a sequence
+*           of statements in split form
+* Initial : agent on October 18, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+StmtSequence* inlineCalls(StmtSequence* pSeq, ProgFunction* pFunction, size_t maxStmts)
+{
+	// Scripts and nested functions share their variables with other
+	// functions, and the names of the inlined temporaries would be visible
+	if (pFunction->isScript() || pFunction->getParent() != NULL || pFunction->getNestedFuncs().empty() == false)
+		return pSeq;
+
+	// Initialize the inlining state
+	InlineState state;
+	state.pCaller = pFunction;
+	state.maxStmts = maxStmts;
+	state.loopDepth = 0;
+
+	// The caller variables are its parameters and the symbols its body defines
+	const ProgFunction::ParamVector& inParams = pFunction->getInParams();
+	const ProgFunction::ParamVector& outParams = pFunction->getOutParams();
+	state.callerVars = pSeq->getSymbolDefs();
+	state.callerVars.insert(inParams.begin(), inParams.end());
+	state.callerVars.insert(outParams.begin(), outParams.end());
+
+	// Inline the calls in the sequence
+	bool inlinedLoop = false;
+	return inlineSeq(pSeq, state, inlinedLoop);
+}
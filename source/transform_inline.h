@@ -0,0 +1,33 @@
+// =========================================================================== //
+//                                                                             //
+// Copyright 2026 agent.                                                       //
+//                                                                             //
+//   Licensed under the Apache License, Version 2.0 (the "License");           //
+//   you may not use this file except in compliance with the License.          //
+//   You may obtain a copy of the License at                                   //
+//                                                                             //
+//       http://www.apache.org/licenses/LICENSE-2.0                            //
+//                                                                             //
+//   Unless required by applicable law or agreed to in writing, software       //
+//   distributed under the License is distributed on an "AS IS" BASIS,         //
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  //
+//   See the License for the specific language governing permissions and       //
+//  limitations under the License.                                             //
+//                                                                             //
+// =========================================================================== //
+
+// Include guards
+#ifndef TRANSFORM_INLINE_H_
+#define TRANSFORM_INLINE_H_
+
+// Header files
+#include "iir.h"
+#include "functions.h"
+#include "stmtsequence.h"
+#include "statements.h"
+#include "expressions.h"
+
+// Function to inline the calls to small functions in a sequence of statements
+StmtSequence* inlineCalls(StmtSequence* pSeq, ProgFunction* pFunction, size_t maxStmts);
+
+#endif // #ifndef TRANSFORM_INLINE_H_
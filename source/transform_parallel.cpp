@@ -0,0 +1,1312 @@
+// =========================================================================== //
+//                                                                             //
+// Copyright 2026 agent.                                                       //
+//                                                                             //
+//   Licensed under the Apache License, Version 2.0 (the "License");           //
+//   you may not use this file except in compliance with the License.          //
+//   You may obtain a copy of the License at                                   //
+//                                                                             //
+//       http://www.apache.org/licenses/LICENSE-2.0                            //
+//                                                                             //
+//   Unless required by applicable law or agreed to in writing, software       //
+//   distributed under the License is distributed on an "AS IS" BASIS,         //
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  //
+//   See the License for the specific language governing permissions and       //
+//  limitations under the License.                                             //
+//                                                                             //
+// =========================================================================== //
+// Header files
+#include <cassert>
+#include <vector>
+#include <set>
+#include "transform_parallel.h"
+#include "analysis_reachdefs.h"
+#include "assignstmt.h"
+#include "exprstmt.h"
+#include "ifelsestmt.h"
+#include "loopstmts.h"
+#include "paramexpr.h"
+#include "symbolexpr.h"
+#include "constexprs.h"
+#include "binaryopexpr.h"
+#include "rangeexpr.h"
+#include "fnhandleexpr.h"
+#include "environment.h"
+#include "interpreter.h"
+#include "utility.h"
+
+// Library functions without side effects, the only functions which
+// parallel loops may call. Other functions may access the workspace
+// of the caller, perform ordered input and output, load functions
+// or update caches shared by all threads without locking
+static const char* PURE_FUNCS[] =
+{
+	"abs",
+	"any",
+	"ceil",
+	"cos",
+	"diag",
+	"dot",
+	"eps",
+	"exp",
+	"eye",
+	"false",
+	"find",
+	"fix",
+	"floor",
+	"i",
+	"iscell",
+	"isempty",
+	"isequal",
+	"isnumeric",
+	"length",
+	"log2",
+	"max",
+	"mean",
+	"min",
+	"mod",
+	"not",
+	"numel",
+	"ones",
+	"pi",
+	"reshape",
+	"round",
+	"sign",
+	"sin",
+	"size",
+	"sort",
+	"sqrt",
+	"sum",
+	"true",
+	"zeros"
+};
+
+// Library functions which only parfor loops may call, since they
+// give different results when run in parallel than when run serially
+static const char* PARFOR_FUNCS[] =
+{
+	"rand"
+};
+
+// Number of chunk functions created, used to name them
+static size_t numChunkFuncs = 0;
+
+// State of the parallel loop transformation of a function
+struct ParallelFunc
+{
+	// Function being transformed and its body
+	ProgFunction* pFunction;
+	const StmtSequence* pFuncBody;
+
+	// Reaching definitions in the function body
+	const ReachDefInfo* pReachDefInfo;
+
+	// Indicates that parfor loops, and all independent loops, are run in parallel
+	bool parforLoops;
+	bool autoParallel;
+};
+
+// Description of a loop being outlined for parallel execution
+struct ParallelLoop
+{
+	// Function containing the loop
+	const ParallelFunc* pFunc;
+
+	// Indicates that the loop was not marked as a parfor loop
+	bool autoParallel;
+
+	// Loop statement
+	LoopStmt* pLoopStmt;
+
+	// Loop index, step and end value variables
+	SymbolExpr* pIndexVar;
+	SymbolExpr* pStepVar;
+	SymbolExpr* pEndVar;
+
+	// Loop variable
+	SymbolExpr* pLoopVar;
+
+	// Reaching definitions before the loop
+	const VarDefMap* pLoopDefs;
+
+	// Statements of the loop body, at any depth
+	std::vector<const Statement*> bodyStmts;
+
+	// Variables written by the loop body
+	Expression::SymbolSet bodyDefs;
+
+	// Sliced arrays, with the position of the loop variable
+	// among their indices and their number of indices
+	std::vector<SymbolExpr*> slicedVars;
+	std::vector<size_t> slicedPos;
+	std::vector<size_t> slicedSubs;
+
+	// Reduction variables, with the operator combining their partial values
+	std::vector<SymbolExpr*> reductionVars;
+	std::vector<BinaryOpExpr::Operator> reductionOps;
+
+	// Variables read but not written by the loop body
+	std::vector<SymbolExpr*> broadcastVars;
+};
+
+// Kinds of reaching definitions of a variable before a loop
+enum DefKind
+{
+	ENV_DEF,	// Not defined in the function, looked up in the environment
+	VAR_DEF,	// Defined as a variable of the function
+	MIXED_DEF	// Possibly defined as a variable of the function
+};
+
+/***************************************************************
+* Function: isNameIn()
+* Purpose : Test if the name of a symbol is in a name table
+* Initial : agent on October 18, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+static bool isNameIn(const SymbolExpr* pSymbol, const char* const* pNames, size_t numNames)
+{
+	for (size_t i = 0; i < numNames; ++i)
+		if (pSymbol->getSymName() == pNames[i])
+			return true;
+
+	return false;
+}
+
+/***************************************************************
+* Function: usesSharedState()
+* Purpose : Test if evaluating an expression may update state
+*           shared by all threads
+* Initial : agent on October 18, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+static bool usesSharedState(const Expression* pExpr)
+{
+	// Range expressions may have missing sub-expressions
+	if (pExpr == NULL)
+		return false;
+
+	// Field accesses update their inline caches and the struct shape
+	// transitions, and function handles may load functions
+	if (pExpr->getExprType() == Expression::ExprType::DOT ||
+		pExpr->getExprType() == Expression::ExprType::FN_HANDLE)
+		return true;
+
+	// Check the sub-expressions
+	Expression::ExprVector subExprs = pExpr->getSubExprs();
+	for (size_t i = 0; i < subExprs.size(); ++i)
+		if (usesSharedState(subExprs[i]))
+			return true;
+
+	return false;
+}
+
+/***************************************************************
+* Function: collectStmts()
+* Purpose : Collect the statements of a sequence, at any depth
+* Initial : agent on October 18, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+static void collectStmts(const StmtSequence* pSeq, std::vector<const Statement*>& stmts, const Statement* pSkipStmt)
+{
+	// Get the statements of the sequence
+	const StmtSequence::StmtVector& seqStmts = pSeq->getStatements();
+
+	// For each statement
+	for (size_t i = 0; i < seqStmts.size(); ++i)
+	{
+		// Get a pointer to the statement
+		const Statement* pStmt = seqStmts[i];
+
+		// If this statement is to be skipped, ignore it
+		if (pStmt == pSkipStmt)
+			continue;
+
+		// Add the statement to the list
+		stmts.push_back(pStmt);
+
+		// Collect the statements nested in this one
+		if (pStmt->getStmtType() == Statement::IF_ELSE)
+		{
+			const IfElseStmt* pIfStmt = (const IfElseStmt*)pStmt;
+			collectStmts(pIfStmt->getIfBlock(), stmts, pSkipStmt);
+			collectStmts(pIfStmt->getElseBlock(), stmts, pSkipStmt);
+		}
+		else if (pStmt->getStmtType() == Statement::LOOP)
+		{
+			const LoopStmt* pLoopStmt = (const LoopStmt*)pStmt;
+			collectStmts(pLoopStmt->getInitSeq(), stmts, pSkipStmt);
+			collectStmts(pLoopStmt->getTestSeq(), stmts, pSkipStmt);
+			collectStmts(pLoopStmt->getBodySeq(), stmts, pSkipStmt);
+			collectStmts(pLoopStmt->getIncrSeq(), stmts, pSkipStmt);
+		}
+	}
+}
+
+/***************************************************************
+* Function: getStmtUses()
+* Purpose : Get the symbols read by a statement itself, and the
+*           node its reaching definitions are stored for
+* Initial : agent on October 18, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+static Expression::SymbolSet getStmtUses(const Statement* pStmt, const IIRNode*& pDefNode)
+{
+	// Switch on the statement type
+	switch (pStmt->getStmtType())
+	{
+		// Assignment and expression statements
+		case Statement::ASSIGN:
+		case Statement::EXPR:
+		pDefNode = pStmt;
+		return pStmt->getSymbolUses();
+
+		// If-else statements read their condition, their
+		// blocks are collected as separate statements
+		case Statement::IF_ELSE:
+		{
+			Expression* pCondExpr = ((const IfElseStmt*)pStmt)->getCondition();
+			pDefNode = pCondExpr;
+			return pCondExpr->getSymbolUses();
+		}
+
+		// Other statements read nothing by themselves
+		default:
+		pDefNode = NULL;
+		return Expression::SymbolSet();
+	}
+}
+
+/***************************************************************
+* Function: getStmtExprs()
+* Purpose : Get the expressions read or written by a statement
+*           itself
+* Initial : agent on October 18, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+static Expression::ExprVector getStmtExprs(const Statement* pStmt)
+{
+	// Declare a vector for the expressions
+	Expression::ExprVector exprs;
+
+	// Switch on the statement type
+	switch (pStmt->getStmtType())
+	{
+		// Assignments read and write their left expressions
+		case Statement::ASSIGN:
+		{
+			const AssignStmt* pAssignStmt = (const AssignStmt*)pStmt;
+			exprs = pAssignStmt->getLeftExprs();
+			exprs.push_back(pAssignStmt->getRightExpr());
+		}
+		break;
+
+		// Expression statements
+		case Statement::EXPR:
+		exprs.push_back(((const ExprStmt*)pStmt)->getExpression());
+		break;
+
+		// If-else statements
+		case Statement::IF_ELSE:
+		exprs.push_back(((const IfElseStmt*)pStmt)->getCondition());
+		break;
+
+		// Other statements have no expressions of their own
+		default:
+		break;
+	}
+
+	return exprs;
+}
+
+/***************************************************************
+* Function: getDefKind()
+* Purpose : Get the kind of definitions of a variable reaching
+*           a loop
+* Initial : agent on October 18, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+static DefKind getDefKind(SymbolExpr* pSymbol, const ParallelLoop& loop)
+{
+	// Find the definitions reaching the loop
+	VarDefMap::const_iterator defItr = loop.pLoopDefs->find(pSymbol);
+	if (defItr == loop.pLoopDefs->end())
+		return ENV_DEF;
+
+	// Look for definitions from the environment and from the function
+	bool envDef = false;
+	bool varDef = false;
+	for (VarDefSet::const_iterator itr = defItr->second.begin(); itr != defItr->second.end(); ++itr)
+	{
+		if (*itr == NULL)
+			envDef = true;
+		else
+			varDef = true;
+	}
+
+	// If the function does not define the symbol, it is looked up in the environment
+	if (varDef == false)
+		return ENV_DEF;
+
+	// Input parameters not passed by the caller are undefined rather than
+	// looked up in the environment, and reading them fails in either case
+	const ProgFunction::ParamVector& inParams = loop.pFunc->pFunction->getInParams();
+	bool isInParam = false;
+	for (size_t i = 0; i < inParams.size(); ++i)
+		if (inParams[i] == pSymbol)
+			isInParam = true;
+
+	return (envDef && !isInParam)? MIXED_DEF:VAR_DEF;
+}
+
+/***************************************************************
+* Function: isSliceIndex()
+* Purpose : Test if array indices select one slice of the array
+*           per loop iteration
+* Initial : agent on October 18, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+static bool isSliceIndex(const Expression::ExprVector& arguments, const ParallelLoop& loop, size_t& loopVarPos)
+{
+	// Indicates that the loop variable was found
+	bool foundLoopVar = false;
+
+	// For each index
+	for (size_t i = 0; i < arguments.size(); ++i)
+	{
+		// Get a pointer to the index expression
+		const Expression* pArgExpr = arguments[i];
+
+		// Exactly one index must be the loop variable
+		if (pArgExpr == loop.pLoopVar)
+		{
+			if (foundLoopVar)
+				return false;
+			foundLoopVar = true;
+			loopVarPos = i;
+			continue;
+		}
+
+		// Other indices must be the same for all iterations: constants,
+		// full ranges or variables not written in the loop
+		switch (pArgExpr->getExprType())
+		{
+			case Expression::ExprType::INT_CONST:
+			case Expression::ExprType::FP_CONST:
+			break;
+
+			case Expression::ExprType::RANGE:
+			if (((const RangeExpr*)pArgExpr)->isFullRange() == false)
+				return false;
+			break;
+
+			case Expression::ExprType::SYMBOL:
+			if (loop.bodyDefs.find((SymbolExpr*)pArgExpr) != loop.bodyDefs.end())
+				return false;
+			break;
+
+			default:
+			return false;
+		}
+	}
+
+	return foundLoopVar;
+}
+
+/***************************************************************
+* Function: isSameIndex()
+* Purpose : Test if two slice indices select the same slice
+* Initial : agent on October 18, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+static bool isSameIndex(const Expression::ExprVector& argsA, const Expression::ExprVector& argsB)
+{
+	// The number of indices must match
+	if (argsA.size() != argsB.size())
+		return false;
+
+	// For each index
+	for (size_t i = 0; i < argsA.size(); ++i)
+	{
+		// Symbols are unique, so identical symbols are the same node
+		if (argsA[i] == argsB[i])
+			continue;
+
+		// Otherwise, the indices must be equal constants or full ranges
+		if (argsA[i]->getExprType() != argsB[i]->getExprType())
+			return false;
+		switch (argsA[i]->getExprType())
+		{
+			case Expression::ExprType::INT_CONST:
+			if (((const IntConstExpr*)argsA[i])->getValue() != ((const IntConstExpr*)argsB[i])->getValue())
+				return false;
+			break;
+
+			case Expression::ExprType::FP_CONST:
+			if (((const FPConstExpr*)argsA[i])->getValue() != ((const FPConstExpr*)argsB[i])->getValue())
+				return false;
+			break;
+
+			case Expression::ExprType::RANGE:
+			break;
+
+			default:
+			return false;
+		}
+	}
+
+	return true;
+}
+
+/***************************************************************
+* Function: isSlicedAccess()
+* Purpose : Test if all the accesses to a variable in an
+*           expression read or write the same slice
+* Initial : agent on October 18, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+static bool isSlicedAccess(
+	const Expression* pExpr,
+	const SymbolExpr* pVar,
+	const ParallelLoop& loop,
+	const Expression::ExprVector*& pSliceIndex,
+	size_t& loopVarPos
+)
+{
+	// Range expressions may have missing sub-expressions
+	if (pExpr == NULL)
+		return true;
+
+	// Switch on the expression type
+	switch (pExpr->getExprType())
+	{
+		// Indexing of the variable
+		case Expression::ExprType::PARAM:
+		{
+			const ParamExpr* pParamExpr = (const ParamExpr*)pExpr;
+			if (pParamExpr->getExpr() != pVar)
+				break;
+
+			// The indices must select a slice
+			const Expression::ExprVector& arguments = pParamExpr->getArguments();
+			size_t argPos;
+			if (isSliceIndex(arguments, loop, argPos) == false)
+				return false;
+
+			// All accesses must use the same indices as the first one
+			if (pSliceIndex == NULL)
+			{
+				pSliceIndex = &arguments;
+				loopVarPos = argPos;
+				return true;
+			}
+			return argPos == loopVarPos && isSameIndex(arguments, *pSliceIndex);
+		}
+
+		// Any other reference to the variable accesses the whole array
+		case Expression::ExprType::SYMBOL:
+		return pExpr != pVar;
+
+		// Lambda expressions capture the whole array
+		case Expression::ExprType::LAMBDA:
+		{
+			Expression::SymbolSet uses = pExpr->getSymbolUses();
+			return uses.find((SymbolExpr*)pVar) == uses.end();
+		}
+
+		default:
+		break;
+	}
+
+	// Check the sub-expressions
+	Expression::ExprVector subExprs = pExpr->getSubExprs();
+	for (size_t i = 0; i < subExprs.size(); ++i)
+		if (isSlicedAccess(subExprs[i], pVar, loop, pSliceIndex, loopVarPos) == false)
+			return false;
+
+	return true;
+}
+
+/***************************************************************
+* Function: isSlicedVar()
+* Purpose : Test if each loop iteration only accesses its own
+*           slice of an array
+* Initial : agent on October 18, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+static bool isSlicedVar(SymbolExpr* pVar, const ParallelLoop& loop, size_t& loopVarPos, size_t& numSubs)
+{
+	// All accesses in the loop body must index the same slice
+	const Expression::ExprVector* pSliceIndex = NULL;
+	for (size_t i = 0; i < loop.bodyStmts.size(); ++i)
+	{
+		Expression::ExprVector exprs = getStmtExprs(loop.bodyStmts[i]);
+		for (size_t j = 0; j < exprs.size(); ++j)
+			if (isSlicedAccess(exprs[j], pVar, loop, pSliceIndex, loopVarPos) == false)
+				return false;
+	}
+	if (pSliceIndex == NULL)
+		return false;
+	numSubs = pSliceIndex->size();
+
+	// The array must exist before the loop, the slices are merged into it
+	return getDefKind(pVar, loop) == VAR_DEF;
+}
+
+/***************************************************************
+* Function: isReductionVar()
+* Purpose : Test if a variable only accumulates values with an
+*           associative operator in a loop
+* Initial : agent on October 18, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+static bool isReductionVar(SymbolExpr* pVar, const ParallelLoop& loop, BinaryOpExpr::Operator& combineOp)
+{
+	// Indicates that an accumulation was found
+	bool foundAccum = false;
+
+	// For each statement of the loop body
+	for (size_t i = 0; i < loop.bodyStmts.size(); ++i)
+	{
+		// Get a pointer to the statement
+		const Statement* pStmt = loop.bodyStmts[i];
+
+		// If this is an assignment to the variable
+		if (pStmt->getStmtType() == Statement::ASSIGN)
+		{
+			const AssignStmt* pAssignStmt = (const AssignStmt*)pStmt;
+			Expression::SymbolSet defs = pAssignStmt->getSymbolDefs();
+			if (defs.find(pVar) != defs.end())
+			{
+				// The statement must accumulate into the variable, without
+				// displaying the partial values
+				if (pAssignStmt->getLeftExprs().size() != 1 || pAssignStmt->getLeftExprs()[0] != pVar ||
+					pAssignStmt->getSuppressFlag() == false ||
+					pAssignStmt->getRightExpr()->getExprType() != Expression::ExprType::BINARY_OP)
+					return false;
+				const BinaryOpExpr* pAccumExpr = (const BinaryOpExpr*)pAssignStmt->getRightExpr();
+				BinaryOpExpr::Operator op = pAccumExpr->getOperator();
+
+				// Sums and products may accumulate on the left, sums and
+				// element-wise products, which commute, also on the right
+				Expression* pTermExpr;
+				if (pAccumExpr->getLeftExpr() == pVar &&
+					(op == BinaryOpExpr::PLUS || op == BinaryOpExpr::MINUS ||
+					 op == BinaryOpExpr::MULT || op == BinaryOpExpr::ARRAY_MULT))
+					pTermExpr = pAccumExpr->getRightExpr();
+				else if (pAccumExpr->getRightExpr() == pVar &&
+					(op == BinaryOpExpr::PLUS || op == BinaryOpExpr::ARRAY_MULT))
+					pTermExpr = pAccumExpr->getLeftExpr();
+				else
+					return false;
+
+				// Differences are accumulated as sums of negated terms
+				if (op == BinaryOpExpr::MINUS)
+					op = BinaryOpExpr::PLUS;
+
+				// All accumulations must use the same operator
+				if (foundAccum && op != combineOp)
+					return false;
+				combineOp = op;
+				foundAccum = true;
+
+				// The accumulated term may not read the partial value
+				Expression::SymbolSet termUses = pTermExpr->getSymbolUses();
+				if (termUses.find(pVar) != termUses.end())
+					return false;
+
+				continue;
+			}
+		}
+
+		// No other statement may read the partial value
+		const IIRNode* pDefNode;
+		Expression::SymbolSet uses = getStmtUses(pStmt, pDefNode);
+		if (uses.find(pVar) != uses.end())
+			return false;
+	}
+
+	// The initial value must exist before the loop
+	return foundAccum && getDefKind(pVar, loop) == VAR_DEF;
+}
+
+/***************************************************************
+* Function: hasLoopBreak()
+* Purpose : Test if a loop body breaks out of its loop
+* Initial : agent on October 18, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+static bool hasLoopBreak(const StmtSequence* pSeq)
+{
+	// Get the statements of the sequence
+	const StmtSequence::StmtVector& stmts = pSeq->getStatements();
+
+	// For each statement
+	for (size_t i = 0; i < stmts.size(); ++i)
+	{
+		// Break statements of nested loops end those loops only
+		if (stmts[i]->getStmtType() == Statement::BREAK)
+			return true;
+		if (stmts[i]->getStmtType() == Statement::IF_ELSE)
+		{
+			const IfElseStmt* pIfStmt = (const IfElseStmt*)stmts[i];
+			if (hasLoopBreak(pIfStmt->getIfBlock()) || hasLoopBreak(pIfStmt->getElseBlock()))
+				return true;
+		}
+	}
+
+	return false;
+}
+
+/***************************************************************
+* Function: classifyLoopVars()
+* Purpose : Classify the variables of a loop body, and test if
+*           its iterations are independent
+* Initial : agent on October 18, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+static bool classifyLoopVars(ParallelLoop& loop)
+{
+	// Get the loop body
+	const StmtSequence* pBodySeq = loop.pLoopStmt->getBodySeq();
+
+	// The loop may not be left early
+	if (hasLoopBreak(pBodySeq))
+		return false;
+
+	// For each statement of the loop body
+	size_t numLoopVarDefs = 0;
+	for (size_t i = 0; i < loop.bodyStmts.size(); ++i)
+	{
+		// Get a pointer to the statement
+		const Statement* pStmt = loop.bodyStmts[i];
+
+		// Returns leave the function from a single iteration
+		if (pStmt->getStmtType() == Statement::RETURN)
+			return false;
+
+		// Displayed values go through the shared output buffer
+		if (pStmt->getStmtType() == Statement::EXPR ||
+			(pStmt->getStmtType() == Statement::ASSIGN && pStmt->getSuppressFlag() == false))
+			return false;
+
+		// The statement may not update state shared by all threads
+		Expression::ExprVector exprs = getStmtExprs(pStmt);
+		for (size_t j = 0; j < exprs.size(); ++j)
+			if (usesSharedState(exprs[j]))
+				return false;
+
+		// Count the assignments to the loop variable
+		Expression::SymbolSet defs = pStmt->getSymbolDefs();
+		if (pStmt->getStmtType() == Statement::ASSIGN && defs.find(loop.pLoopVar) != defs.end())
+			++numLoopVarDefs;
+	}
+
+	// The loop variable may only be assigned the index value
+	if (numLoopVarDefs != 1)
+		return false;
+
+	// Find the variables which may be read in an iteration before
+	// being written in it, by marking their values on loop entry
+	VarDefMap startMap;
+	for (Expression::SymbolSet::const_iterator itr = loop.bodyDefs.begin(); itr != loop.bodyDefs.end(); ++itr)
+		startMap[*itr].insert(loop.pLoopStmt);
+	VarDefMap exitMap;
+	VarDefMap retMap;
+	VarDefMap breakMap;
+	VarDefMap contMap;
+	ReachDefMap bodyReachDefs;
+	getReachDefs(pBodySeq, startMap, exitMap, retMap, breakMap, contMap, bodyReachDefs);
+	Expression::SymbolSet exposedVars;
+	for (size_t i = 0; i < loop.bodyStmts.size(); ++i)
+	{
+		const IIRNode* pDefNode;
+		Expression::SymbolSet uses = getStmtUses(loop.bodyStmts[i], pDefNode);
+		ReachDefMap::const_iterator defItr = bodyReachDefs.find(pDefNode);
+		if (defItr == bodyReachDefs.end())
+			continue;
+		for (Expression::SymbolSet::const_iterator itr = uses.begin(); itr != uses.end(); ++itr)
+		{
+			VarDefMap::const_iterator varItr = defItr->second.find(*itr);
+			if (varItr != defItr->second.end() && varItr->second.find(loop.pLoopStmt) != varItr->second.end())
+				exposedVars.insert(*itr);
+		}
+	}
+
+	// Find the variables whose values written in the loop may be read after it
+	const ReachDefInfo* pReachDefInfo = loop.pFunc->pReachDefInfo;
+	std::set<const IIRNode*> loopStmts(loop.bodyStmts.begin(), loop.bodyStmts.end());
+	std::vector<const Statement*> outerStmts;
+	collectStmts(loop.pFunc->pFuncBody, outerStmts, loop.pLoopStmt);
+	Expression::SymbolSet liveOutVars;
+	for (size_t i = 0; i < outerStmts.size(); ++i)
+	{
+		const IIRNode* pDefNode;
+		Expression::SymbolSet uses = getStmtUses(outerStmts[i], pDefNode);
+		ReachDefMap::const_iterator defItr = pReachDefInfo->reachDefMap.find(pDefNode);
+		if (defItr == pReachDefInfo->reachDefMap.end())
+			continue;
+		for (Expression::SymbolSet::const_iterator itr = uses.begin(); itr != uses.end(); ++itr)
+		{
+			VarDefMap::const_iterator varItr = defItr->second.find(*itr);
+			if (varItr == defItr->second.end())
+				continue;
+			for (VarDefSet::const_iterator defItr = varItr->second.begin(); defItr != varItr->second.end(); ++defItr)
+				if (loopStmts.find(*defItr) != loopStmts.end())
+					liveOutVars.insert(*itr);
+		}
+	}
+	const ProgFunction::ParamVector& outParams = loop.pFunc->pFunction->getOutParams();
+	for (size_t i = 0; i < outParams.size(); ++i)
+	{
+		VarDefMap::const_iterator varItr = pReachDefInfo->exitDefMap.find(outParams[i]);
+		if (varItr == pReachDefInfo->exitDefMap.end())
+			continue;
+		for (VarDefSet::const_iterator defItr = varItr->second.begin(); defItr != varItr->second.end(); ++defItr)
+			if (loopStmts.find(*defItr) != loopStmts.end())
+				liveOutVars.insert(outParams[i]);
+	}
+
+	// For each variable written in the loop body
+	for (Expression::SymbolSet::const_iterator itr = loop.bodyDefs.begin(); itr != loop.bodyDefs.end(); ++itr)
+	{
+		SymbolExpr* pVar = *itr;
+
+		// The loop variable gets its final value after the loop
+		if (pVar == loop.pLoopVar)
+			continue;
+
+		// Variables private to each iteration need no merging
+		if (exposedVars.find(pVar) == exposedVars.end() && liveOutVars.find(pVar) == liveOutVars.end())
+			continue;
+
+		// Arrays of which each iteration accesses its own slice
+		size_t loopVarPos;
+		size_t numSubs;
+		if (isSlicedVar(pVar, loop, loopVarPos, numSubs))
+		{
+			loop.slicedVars.push_back(pVar);
+			loop.slicedPos.push_back(loopVarPos);
+			loop.slicedSubs.push_back(numSubs);
+			continue;
+		}
+
+		// Accumulators, whose reassociation changes floating-point
+		// results, so only in loops marked as parfor loops
+		BinaryOpExpr::Operator combineOp;
+		if (loop.autoParallel == false && isReductionVar(pVar, loop, combineOp))
+		{
+			loop.reductionVars.push_back(pVar);
+			loop.reductionOps.push_back(combineOp);
+			continue;
+		}
+
+		// Other variables carry dependences between iterations
+		return false;
+	}
+
+	// Collect the symbols read in the loop body
+	Expression::SymbolSet bodyUses;
+	for (size_t i = 0; i < loop.bodyStmts.size(); ++i)
+	{
+		const IIRNode* pDefNode;
+		Expression::SymbolSet uses = getStmtUses(loop.bodyStmts[i], pDefNode);
+		bodyUses.insert(uses.begin(), uses.end());
+	}
+
+	// For each symbol read but not written in the loop body
+	for (Expression::SymbolSet::const_iterator itr = bodyUses.begin(); itr != bodyUses.end(); ++itr)
+	{
+		SymbolExpr* pSymbol = *itr;
+		if (loop.bodyDefs.find(pSymbol) != loop.bodyDefs.end() || pSymbol == loop.pIndexVar)
+			continue;
+
+		// The argument counts of the chunk function differ from the caller's
+		if (pSymbol == Interpreter::getNarginSym() || pSymbol == Interpreter::getNargoutSym())
+			return false;
+
+		// Switch on the kind of definitions of the symbol
+		switch (getDefKind(pSymbol, loop))
+		{
+			// Functions, looked up by the chunk function as well
+			case ENV_DEF:
+			if (!isNameIn(pSymbol, PURE_FUNCS, sizeof(PURE_FUNCS) / sizeof(PURE_FUNCS[0])) &&
+				(loop.autoParallel || !isNameIn(pSymbol, PARFOR_FUNCS, sizeof(PARFOR_FUNCS) / sizeof(PARFOR_FUNCS[0]))))
+				return false;
+			break;
+
+			// Variables, passed to the chunk function
+			case VAR_DEF:
+			loop.broadcastVars.push_back(pSymbol);
+			break;
+
+			// Symbols which may be variables or functions
+			case MIXED_DEF:
+			return false;
+		}
+	}
+
+	// The loop iterations are independent
+	return true;
+}
+
+/***************************************************************
+* Function: isAssignOf()
+* Purpose : Test if a statement assigns to a given symbol
+* Initial : agent on October 18, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+static const AssignStmt* isAssignOf(const Statement* pStmt, const SymbolExpr* pSymbol)
+{
+	// The statement must be an assignment of a single symbol
+	if (pStmt->getStmtType() != Statement::ASSIGN)
+		return NULL;
+	const AssignStmt* pAssignStmt = (const AssignStmt*)pStmt;
+	if (pAssignStmt->getLeftExprs().size() != 1 ||
+		pAssignStmt->getLeftExprs()[0]->getExprType() != Expression::ExprType::SYMBOL)
+		return NULL;
+
+	// If a symbol is specified, the assignment must be to this symbol
+	if (pSymbol != NULL && pAssignStmt->getLeftExprs()[0] != pSymbol)
+		return NULL;
+
+	return pAssignStmt;
+}
+
+/***************************************************************
+* Function: localizeSlicedAccess()
+* Purpose : Make the accesses to the sliced arrays in an
+*           expression index the slices passed to a chunk
+* Initial : agent on October 18, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+static void localizeSlicedAccess(Expression* pExpr, const ParallelLoop& loop, SymbolExpr* pLocalVar)
+{
+	// Range expressions may have missing sub-expressions
+	if (pExpr == NULL)
+		return;
+
+	// If this indexes a sliced array, use the index local to the chunk
+	if (pExpr->getExprType() == Expression::ExprType::PARAM)
+	{
+		ParamExpr* pParamExpr = (ParamExpr*)pExpr;
+		for (size_t i = 0; i < loop.slicedVars.size(); ++i)
+			if (pParamExpr->getExpr() == loop.slicedVars[i])
+				pParamExpr->replaceSubExpr(loop.slicedPos[i] + 1, pLocalVar);
+	}
+
+	// Update the sub-expressions
+	Expression::ExprVector subExprs = pExpr->getSubExprs();
+	for (size_t i = 0; i < subExprs.size(); ++i)
+		localizeSlicedAccess(subExprs[i], loop, pLocalVar);
+}
+
+/***************************************************************
+* Function: createChunkFunc()
+* Purpose : Create a function running a range of the iterations
+*           of a parallel loop
+* Initial : agent on October 18, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+static SymbolExpr* createChunkFunc(const ParallelLoop& loop, Expression* pStepExpr)
+{
+	// Get the function containing the loop
+	ProgFunction* pFunction = loop.pFunc->pFunction;
+
+	// Variables holding the first and last index values of the chunk
+	SymbolExpr* pLowVar = SymbolExpr::getSymbol("$lo");
+	SymbolExpr* pHighVar = SymbolExpr::getSymbol("$hi");
+
+	// Variables holding the offset of the chunk slices, and the
+	// index of the current slice in the slices of the chunk
+	SymbolExpr* pOffsetVar = SymbolExpr::getSymbol("$off");
+	SymbolExpr* pLocalVar = SymbolExpr::getSymbol("$k");
+
+	// The chunk function takes the index range, the sliced arrays and the
+	// variables read by the loop, and returns the sliced arrays and the
+	// partial values of the reductions
+	ProgFunction::ParamVector inParams;
+	inParams.push_back(pLowVar);
+	inParams.push_back(pHighVar);
+	inParams.insert(inParams.end(), loop.slicedVars.begin(), loop.slicedVars.end());
+	inParams.insert(inParams.end(), loop.broadcastVars.begin(), loop.broadcastVars.end());
+	ProgFunction::ParamVector outParams;
+	outParams.insert(outParams.end(), loop.slicedVars.begin(), loop.slicedVars.end());
+	outParams.insert(outParams.end(), loop.reductionVars.begin(), loop.reductionVars.end());
+
+	// Start the reductions from the identity of their operator
+	StmtSequence::StmtVector chunkStmts;
+	for (size_t i = 0; i < loop.reductionVars.size(); ++i)
+	{
+		chunkStmts.push_back(new AssignStmt(
+			loop.reductionVars[i],
+			new IntConstExpr((loop.reductionOps[i] == BinaryOpExpr::PLUS)? 0:1)
+		));
+	}
+
+	// The slices of the chunk start at its first index
+	chunkStmts.push_back(new AssignStmt(
+		pOffsetVar,
+		new BinaryOpExpr(BinaryOpExpr::MINUS, pLowVar, new IntConstExpr(1))
+	));
+
+	// Index the sliced arrays relative to the slices of the chunk
+	StmtSequence* pBodySeq = loop.pLoopStmt->getBodySeq()->copy();
+	std::vector<const Statement*> bodyStmts;
+	collectStmts(pBodySeq, bodyStmts, NULL);
+	for (size_t i = 0; i < bodyStmts.size(); ++i)
+	{
+		Expression::ExprVector exprs = getStmtExprs(bodyStmts[i]);
+		for (size_t j = 0; j < exprs.size(); ++j)
+			localizeSlicedAccess(exprs[j], loop, pLocalVar);
+	}
+	StmtSequence::StmtVector iterStmts;
+	iterStmts.push_back(new AssignStmt(
+		pLocalVar,
+		new BinaryOpExpr(BinaryOpExpr::MINUS, loop.pIndexVar, pOffsetVar)
+	));
+	iterStmts.insert(iterStmts.end(), pBodySeq->getStatements().begin(), pBodySeq->getStatements().end());
+
+	// Run the loop over the index range of the chunk
+	StmtSequence::StmtVector initStmts;
+	initStmts.push_back(new AssignStmt(loop.pIndexVar, pLowVar));
+	initStmts.push_back(new AssignStmt(loop.pStepVar, pStepExpr->copy()));
+	initStmts.push_back(new AssignStmt(loop.pEndVar, pHighVar));
+	chunkStmts.push_back(new LoopStmt(
+		loop.pIndexVar,
+		loop.pLoopStmt->getTestVar(),
+		new StmtSequence(initStmts),
+		loop.pLoopStmt->getTestSeq()->copy(),
+		new StmtSequence(iterStmts),
+		loop.pLoopStmt->getIncrSeq()->copy(),
+		loop.pLoopStmt->getAnnotations() & ~Statement::PARALLEL
+	));
+
+	// Create the chunk function
+	std::string chunkName = pFunction->getFuncName() + PARALLEL_CHUNK_SUFFIX + ::toString(++numChunkFuncs);
+	ProgFunction* pChunkFunc = new ProgFunction(
+		chunkName,
+		inParams,
+		outParams,
+		ProgFunction::FuncVector(),
+		new StmtSequence(chunkStmts)
+	);
+
+	// The loop body uses the temporaries of the function, new
+	// temporaries of the chunk function must not clash with them
+	pChunkFunc->reserveTemps(pFunction);
+
+	// The chunk function sees the functions the loop sees
+	Environment* pLocalEnv = ProgFunction::getLocalEnv(pFunction);
+	ProgFunction::setLocalEnv(pChunkFunc, pLocalEnv);
+
+	// Bind the chunk function in the environment of the function
+	SymbolExpr* pChunkSym = SymbolExpr::getSymbol(chunkName);
+	Environment::bind(pLocalEnv, pChunkSym, (DataObject*)pChunkFunc);
+
+	return pChunkSym;
+}
+
+/***************************************************************
+* Function: transformParallelLoop()
+* Purpose : Outline an independent loop so that its iterations
+*           can be run by the worker threads
+* Initial : agent on October 18, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+static bool transformParallelLoop(
+	LoopStmt* pLoopStmt,
+	const Statement* pPrevStmt,
+	const ParallelFunc& func,
+	StmtSequence::StmtVector& output
+)
+{
+	// Only parfor loops, unless all independent loops are run in parallel
+	bool isParfor = pLoopStmt->isParallel() && func.parforLoops;
+	if (isParfor == false && func.autoParallel == false)
+		return false;
+
+	// Get the loop sequences
+	const StmtSequence::StmtVector& initStmts = pLoopStmt->getInitSeq()->getStatements();
+	const StmtSequence::StmtVector& testStmts = pLoopStmt->getTestSeq()->getStatements();
+	const StmtSequence::StmtVector& bodyStmts = pLoopStmt->getBodySeq()->getStatements();
+	const StmtSequence::StmtVector& incrStmts = pLoopStmt->getIncrSeq()->getStatements();
+
+	// The loop must be a range loop as produced by the for loop simplification:
+	// the index, step and end values are initialized in that order
+	SymbolExpr* pIndexVar = pLoopStmt->getIndexVar();
+	if (pIndexVar == NULL || pPrevStmt == NULL || initStmts.size() != 3 ||
+		testStmts.size() != 1 || bodyStmts.empty() || incrStmts.size() != 1)
+		return false;
+	const AssignStmt* pStartAssign = isAssignOf(initStmts[0], pIndexVar);
+	const AssignStmt* pStepAssign = isAssignOf(initStmts[1], NULL);
+	const AssignStmt* pEndAssign = isAssignOf(initStmts[2], NULL);
+	if (pStartAssign == NULL || pStepAssign == NULL || pEndAssign == NULL)
+		return false;
+	SymbolExpr* pStepVar = (SymbolExpr*)pStepAssign->getLeftExprs()[0];
+	SymbolExpr* pEndVar = (SymbolExpr*)pEndAssign->getLeftExprs()[0];
+
+	// The step value must be the constant 1, assigned just before the loop,
+	// as parfor loops require
+	if (pStepAssign->getRightExpr()->getExprType() != Expression::ExprType::SYMBOL)
+		return false;
+	const AssignStmt* pExtStepAssign = isAssignOf(pPrevStmt, (SymbolExpr*)pStepAssign->getRightExpr());
+	if (pExtStepAssign == NULL)
+		return false;
+	Expression* pStepExpr = pExtStepAssign->getRightExpr();
+	if (!(pStepExpr->getExprType() == Expression::ExprType::INT_CONST && ((IntConstExpr*)pStepExpr)->getValue() == 1) &&
+		!(pStepExpr->getExprType() == Expression::ExprType::FP_CONST && ((FPConstExpr*)pStepExpr)->getValue() == 1))
+		return false;
+
+	// The loop must test the index against the end value and increment it by the step
+	const AssignStmt* pTestAssign = isAssignOf(testStmts[0], pLoopStmt->getTestVar());
+	const AssignStmt* pIncrAssign = isAssignOf(incrStmts[0], pIndexVar);
+	if (pTestAssign == NULL || pIncrAssign == NULL ||
+		pTestAssign->getRightExpr()->getExprType() != Expression::ExprType::BINARY_OP ||
+		pIncrAssign->getRightExpr()->getExprType() != Expression::ExprType::BINARY_OP)
+		return false;
+	const BinaryOpExpr* pTestExpr = (const BinaryOpExpr*)pTestAssign->getRightExpr();
+	const BinaryOpExpr* pIncrExpr = (const BinaryOpExpr*)pIncrAssign->getRightExpr();
+	if (pTestExpr->getOperator() != BinaryOpExpr::LESS_THAN_EQ ||
+		pTestExpr->getLeftExpr() != pIndexVar || pTestExpr->getRightExpr() != pEndVar ||
+		pIncrExpr->getOperator() != BinaryOpExpr::PLUS ||
+		pIncrExpr->getLeftExpr() != pIndexVar || pIncrExpr->getRightExpr() != pStepVar)
+		return false;
+
+	// The body must start by assigning the index to the loop variable
+	const AssignStmt* pLoopVarAssign = isAssignOf(bodyStmts[0], NULL);
+	if (pLoopVarAssign == NULL || pLoopVarAssign->getRightExpr() != pIndexVar)
+		return false;
+
+	// Describe the loop
+	ParallelLoop loop;
+	loop.pFunc = &func;
+	loop.autoParallel = !isParfor;
+	loop.pLoopStmt = pLoopStmt;
+	loop.pIndexVar = pIndexVar;
+	loop.pStepVar = pStepVar;
+	loop.pEndVar = pEndVar;
+	loop.pLoopVar = (SymbolExpr*)pLoopVarAssign->getLeftExprs()[0];
+	collectStmts(pLoopStmt->getBodySeq(), loop.bodyStmts, NULL);
+	loop.bodyDefs = pLoopStmt->getBodySeq()->getSymbolDefs();
+	ReachDefMap::const_iterator loopDefItr = func.pReachDefInfo->reachDefMap.find(pLoopStmt);
+	assert (loopDefItr != func.pReachDefInfo->reachDefMap.end());
+	loop.pLoopDefs = &loopDefItr->second;
+
+	// The iterations must be independent
+	if (classifyLoopVars(loop) == false)
+		return false;
+
+	// Loops not marked as parfor loops must compute something
+	if (loop.autoParallel && loop.slicedVars.empty())
+		return false;
+
+	// Outline the loop into a chunk function
+	SymbolExpr* pChunkSym = createChunkFunc(loop, pStepExpr);
+
+	// Run the chunks of the loop: the runtime function takes the chunk
+	// function, the index range, the sliced arrays with the position of
+	// the loop variable among their indices and their number of indices,
+	// the reductions with their operator, and the variables read by the
+	// loop, and returns whether it ran the loop with the merged arrays and
+	// combined reductions
+	SymbolExpr* pRanVar = func.pFunction->createTemp();
+	Expression::ExprVector callArgs;
+	callArgs.push_back(new FnHandleExpr(pChunkSym));
+	callArgs.push_back(pIndexVar);
+	callArgs.push_back(pEndVar);
+	callArgs.push_back(new IntConstExpr(loop.slicedVars.size()));
+	callArgs.push_back(new IntConstExpr(loop.reductionVars.size()));
+	for (size_t i = 0; i < loop.slicedVars.size(); ++i)
+	{
+		callArgs.push_back(loop.slicedVars[i]);
+		callArgs.push_back(new IntConstExpr(loop.slicedPos[i] + 1));
+		callArgs.push_back(new IntConstExpr(loop.slicedSubs[i]));
+	}
+	for (size_t i = 0; i < loop.reductionVars.size(); ++i)
+	{
+		callArgs.push_back(loop.reductionVars[i]);
+		callArgs.push_back(new IntConstExpr(loop.reductionOps[i]));
+	}
+	callArgs.insert(callArgs.end(), loop.broadcastVars.begin(), loop.broadcastVars.end());
+	Expression::ExprVector leftExprs;
+	leftExprs.push_back(pRanVar);
+	leftExprs.insert(leftExprs.end(), loop.slicedVars.begin(), loop.slicedVars.end());
+	leftExprs.insert(leftExprs.end(), loop.reductionVars.begin(), loop.reductionVars.end());
+	StmtSequence::StmtVector parallelStmts;
+	parallelStmts.push_back(new AssignStmt(
+		leftExprs,
+		new ParamExpr(SymbolExpr::getSymbol(PARALLEL_LOOP_FUNC), callArgs)
+	));
+
+	// If the loop was run, the loop variable gets its last value, otherwise,
+	// execute the original loop, whose index, step and end values are
+	// already initialized
+	parallelStmts.push_back(new IfElseStmt(
+		pRanVar,
+		new StmtSequence(new AssignStmt(
+			loop.pLoopVar,
+			new BinaryOpExpr(
+				BinaryOpExpr::PLUS,
+				pIndexVar,
+				new ParamExpr(
+					SymbolExpr::getSymbol("floor"),
+					Expression::ExprVector(1, new BinaryOpExpr(BinaryOpExpr::MINUS, pEndVar, pIndexVar))
+				)
+			)
+		)),
+		new StmtSequence(new LoopStmt(
+			pIndexVar,
+			pLoopStmt->getTestVar(),
+			new StmtSequence(),
+			pLoopStmt->getTestSeq()->copy(),
+			pLoopStmt->getBodySeq()->copy(),
+			pLoopStmt->getIncrSeq()->copy(),
+			pLoopStmt->getAnnotations()
+		))
+	));
+
+	// Initialize the index, step and end values, and run the
+	// loop only if it has at least one iteration
+	for (size_t i = 0; i < initStmts.size(); ++i)
+		output.push_back(initStmts[i]->copy());
+	output.push_back(testStmts[0]->copy());
+	output.push_back(new IfElseStmt(
+		pLoopStmt->getTestVar(),
+		new StmtSequence(parallelStmts),
+		new StmtSequence()
+	));
+
+	// The loop was transformed
+	return true;
+}
+
+/***************************************************************
+* Function: transformParallelSeq()
+* Purpose : Outline the independent loops of a statement sequence
+* Initial : agent on October 18, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+static StmtSequence* transformParallelSeq(const StmtSequence* pSeq, const ParallelFunc& func)
+{
+	// Get the statements of the sequence
+	const StmtSequence::StmtVector& stmts = pSeq->getStatements();
+
+	// Declare a vector for the output statements
+	StmtSequence::StmtVector output;
+
+	// For each statement
+	for (size_t i = 0; i < stmts.size(); ++i)
+	{
+		// Get a pointer to the statement
+		Statement* pStmt = stmts[i];
+
+		// Switch on the statement type
+		switch (pStmt->getStmtType())
+		{
+			// If-else statement
+			case Statement::IF_ELSE:
+			{
+				// Transform the loops in both branches
+				IfElseStmt* pIfStmt = (IfElseStmt*)pStmt;
+				output.push_back(new IfElseStmt(
+					pIfStmt->getCondition(),
+					transformParallelSeq(pIfStmt->getIfBlock(), func),
+					transformParallelSeq(pIfStmt->getElseBlock(), func)
+				));
+			}
+			break;
+
+			// Loop statement
+			case Statement::LOOP:
+			{
+				// Get a typed pointer to the statement
+				LoopStmt* pLoopStmt = (LoopStmt*)pStmt;
+
+				// If the loop can be run in parallel, it is replaced
+				if (transformParallelLoop(pLoopStmt, (i > 0)? stmts[i-1]:NULL, func, output))
+					break;
+
+				// Otherwise, transform the loops nested in its body
+				output.push_back(new LoopStmt(
+					pLoopStmt->getIndexVar(),
+					pLoopStmt->getTestVar(),
+					pLoopStmt->getInitSeq(),
+					pLoopStmt->getTestSeq(),
+					transformParallelSeq(pLoopStmt->getBodySeq(), func),
+					pLoopStmt->getIncrSeq(),
+					pLoopStmt->getAnnotations()
+				));
+			}
+			break;
+
+			// Other statements are kept
+			default:
+			output.push_back(pStmt);
+		}
+	}
+
+	// Return the new sequence
+	return new StmtSequence(output);
+}
+
+/***************************************************************
+* Function: transformParallelLoops()
+* Purpose : Outline the independent loops of a statement sequence
+*           so that their iterations can be run by the worker
+*           threads
+* Initial : agent on October 18, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+StmtSequence* transformParallelLoops(StmtSequence* pSeq, ProgFunction* pFunction, bool parforLoops, bool autoParallel)
+{
+	// Scripts and closures share the workspace of their caller, nested
+	// functions that of their parent, and chunk functions are not split again
+	if (pFunction->isScript() || pFunction->isClosure() || pFunction->getParent() != NULL ||
+		pFunction->getFuncName().find(PARALLEL_CHUNK_SUFFIX) != std::string::npos)
+		return pSeq;
+
+	// With type validation, function bodies are split on creation,
+	// and loops no longer have the shape this transformation expects
+	if (Interpreter::s_validateTypes.getBoolValue() == true)
+		return pSeq;
+
+	// If a function called by the generated code is shadowed, do nothing
+	const ProgFunction::ParamVector& inParams = pFunction->getInParams();
+	const ProgFunction::ParamVector& outParams = pFunction->getOutParams();
+	Expression::SymbolSet funcVars = pSeq->getSymbolDefs();
+	funcVars.insert(inParams.begin(), inParams.end());
+	funcVars.insert(outParams.begin(), outParams.end());
+	if (funcVars.find(SymbolExpr::getSymbol("floor")) != funcVars.end() ||
+		funcVars.find(SymbolExpr::getSymbol(PARALLEL_LOOP_FUNC)) != funcVars.end())
+		return pSeq;
+
+	// Compute the reaching definitions in the function body
+	ParallelFunc func;
+	func.pFunction = pFunction;
+	func.pFuncBody = pSeq;
+	func.pReachDefInfo = (const ReachDefInfo*)computeReachDefs(pFunction, pSeq, TypeSetString(), false);
+	func.parforLoops = parforLoops;
+	func.autoParallel = autoParallel;
+
+	// Transform the loops in the sequence
+	return transformParallelSeq(pSeq, func);
+}
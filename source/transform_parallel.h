@@ -0,0 +1,40 @@
+// =========================================================================== //
+//                                                                             //
+// Copyright 2026 agent.                                                       //
+//                                                                             //
+//   Licensed under the Apache License, Version 2.0 (the "License");           //
+//   you may not use this file except in compliance with the License.          //
+//   You may obtain a copy of the License at                                   //
+//                                                                             //
+//       http://www.apache.org/licenses/LICENSE-2.0                            //
+//                                                                             //
+//   Unless required by applicable law or agreed to in writing, software       //
+//   distributed under the License is distributed on an "AS IS" BASIS,         //
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  //
+//   See the License for the specific language governing permissions and       //
+//  limitations under the License.                                             //
+//                                                                             //
+// =========================================================================== //
+
+// Include guards
+#ifndef TRANSFORM_PARALLEL_H_
+#define TRANSFORM_PARALLEL_H_
+
+// Header files
+#include "iir.h"
+#include "functions.h"
+#include "stmtsequence.h"
+#include "statements.h"
+#include "expressions.h"
+
+// Name of the library function running the chunks of a parallel loop
+#define PARALLEL_LOOP_FUNC "$parallel_loop"
+
+// Suffix of the names of the functions holding parallel loop bodies
+#define PARALLEL_CHUNK_SUFFIX "$parfor"
+
+// Function to outline the independent loops of a sequence of statements
+// so that their iterations can be run by the worker threads
+StmtSequence* transformParallelLoops(StmtSequence* pSeq, ProgFunction* pFunction, bool parforLoops, bool autoParallel);
+
+#endif // #ifndef TRANSFORM_PARALLEL_H_
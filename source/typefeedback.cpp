@@ -0,0 +1,171 @@
+// =========================================================================== //
+//                                                                             //
+// Copyright 2026 agent.                                                       //
+//                                                                             //
+//   Licensed under the Apache License, Version 2.0 (the "License");           //
+//   you may not use this file except in compliance with the License.          //
+//   You may obtain a copy of the License at                                   //
+//                                                                             //
+//       http://www.apache.org/licenses/LICENSE-2.0                            //
+//                                                                             //
+//   Unless required by applicable law or agreed to in writing, software       //
+//   distributed under the License is distributed on an "AS IS" BASIS,         //
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  //
+//   See the License for the specific language governing permissions and       //
+//  limitations under the License.                                             //
+//                                                                             //
+// =========================================================================== //
+
+// Header files
+#include "typefeedback.h"
+#include "matrixobjs.h"
+
+// Observation count required before speculating config variable
+ConfigVar TypeFeedback::s_thresholdVar("type_feedback_threshold", ConfigVar::INT, "16", 1, 1000000);
+
+// Observed types, by expression
+TypeFeedback::SiteMap TypeFeedback::s_siteMap;
+
+/***************************************************************
+* Function: TypeFeedback::registerConfigVars()
+* Purpose : Register the type feedback config variables
+* Initial : agent on October 18, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+void TypeFeedback::registerConfigVars()
+{
+	// Register the observation count threshold
+	ConfigManager::registerVar(&s_thresholdVar);
+}
+
+/***************************************************************
+* Function: TypeFeedback::recordType()
+* Purpose : Record the type of a value produced by an expression
+*           and return true once the type is stable enough to
+*           speculate on
+* Initial : agent on October 18, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+bool TypeFeedback::recordType(const Expression* pExpr, const DataObject* pObject)
+{
+	// Find or create the site information for this expression
+	SiteMap::iterator siteItr = s_siteMap.find(pExpr);
+	if (siteItr == s_siteMap.end())
+	{
+		SiteInfo newSite = { DataObject::Type::UNKNOWN, false, 0, false, false };
+		siteItr = s_siteMap.insert(SiteMap::value_type(pExpr, newSite)).first;
+	}
+	SiteInfo& site = siteItr->second;
+
+	// If types are no longer recorded for this site, stop
+	if (site.polymorphic || site.failed)
+		return false;
+
+	// Only matrix types can be guarded on cheaply
+	DataObject::Type objType = pObject->getType();
+	if (objType < DataObject::Type::MATRIX_I32 || objType > DataObject::Type::CHARARRAY)
+	{
+		site.polymorphic = true;
+		return false;
+	}
+
+	// Test if the value is a scalar
+	bool isScalar = ((const BaseMatrixObj*)pObject)->isScalar();
+
+	// If this is the first value observed
+	if (site.count == 0)
+	{
+		// Store its type
+		site.objType = objType;
+		site.isScalar = isScalar;
+	}
+
+	// Otherwise, if the type differs from those observed before
+	else if (objType != site.objType)
+	{
+		// This site is polymorphic
+		site.polymorphic = true;
+		return false;
+	}
+
+	// Non-scalar values make the speculation cover any matrix size
+	else if (isScalar == false)
+	{
+		site.isScalar = false;
+	}
+
+	// Increment the observation count
+	++site.count;
+
+	// Signal when the threshold is first reached
+	return (site.count == (size_t)s_thresholdVar.getIntValue());
+}
+
+/***************************************************************
+* Function: TypeFeedback::isRecording()
+* Purpose : Test if types are still being recorded for an
+*           expression
+* Initial : agent on October 18, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+bool TypeFeedback::isRecording(const Expression* pExpr)
+{
+	// Find the site information for this expression
+	SiteMap::const_iterator siteItr = s_siteMap.find(pExpr);
+
+	// Types are recorded until the site is known to be unfit for speculation
+	return (siteItr == s_siteMap.end() || (siteItr->second.polymorphic == false && siteItr->second.failed == false));
+}
+
+/***************************************************************
+* Function: TypeFeedback::getSpecType()
+* Purpose : Get the type to speculate on for an expression
+* Initial : agent on October 18, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+bool TypeFeedback::getSpecType(const Expression* pExpr, TypeInfo& type)
+{
+	// Find the site information for this expression
+	SiteMap::const_iterator siteItr = s_siteMap.find(pExpr);
+
+	// If the site was not observed enough or is unfit for speculation, stop
+	if (siteItr == s_siteMap.end() || siteItr->second.polymorphic || siteItr->second.failed ||
+		siteItr->second.count < (size_t)s_thresholdVar.getIntValue())
+		return false;
+
+	// Get the site information
+	const SiteInfo& site = siteItr->second;
+
+	// Build the speculated type
+	// Note: only the object type and the scalar property are guarded
+	type = TypeInfo(
+		site.objType,
+		site.isScalar,
+		site.isScalar,
+		false,
+		site.isScalar,
+		site.isScalar? TypeInfo::DimVector(2, 1):TypeInfo::DimVector(),
+		NULL,
+		TypeSet()
+	);
+
+	// A type is available
+	return true;
+}
+
+/***************************************************************
+* Function: TypeFeedback::markFailed()
+* Purpose : Stop speculating on the type of an expression
+* Initial : agent on October 18, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+void TypeFeedback::markFailed(const Expression* pExpr)
+{
+	// Mark the site as failed, it will no longer be speculated on
+	s_siteMap[pExpr].failed = true;
+}
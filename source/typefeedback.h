@@ -0,0 +1,89 @@
+// =========================================================================== //
+//                                                                             //
+// Copyright 2026 agent.                                                       //
+//                                                                             //
+//   Licensed under the Apache License, Version 2.0 (the "License");           //
+//   you may not use this file except in compliance with the License.          //
+//   You may obtain a copy of the License at                                   //
+//                                                                             //
+//       http://www.apache.org/licenses/LICENSE-2.0                            //
+//                                                                             //
+//   Unless required by applicable law or agreed to in writing, software       //
+//   distributed under the License is distributed on an "AS IS" BASIS,         //
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  //
+//   See the License for the specific language governing permissions and       //
+//  limitations under the License.                                             //
+//                                                                             //
+// =========================================================================== //
+
+
+// Include guards
+#ifndef TYPEFEEDBACK_H_
+#define TYPEFEEDBACK_H_
+
+// Header files
+#include <map>
+#include "objects.h"
+#include "expressions.h"
+#include "typeinfer.h"
+#include "configmanager.h"
+
+/***************************************************************
+* Class   : TypeFeedback
+* Purpose : Record the types of values produced at run time by
+*           expressions whose types cannot be inferred
+* Initial : agent on October 18, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+class TypeFeedback
+{
+public:
+
+	// Method to register the type feedback config variables
+	static void registerConfigVars();
+
+	// Method to record the type of a value produced by an expression
+	static bool recordType(const Expression* pExpr, const DataObject* pObject);
+
+	// Method to test if types are still being recorded for an expression
+	static bool isRecording(const Expression* pExpr);
+
+	// Method to get the type to speculate on for an expression
+	static bool getSpecType(const Expression* pExpr, TypeInfo& type);
+
+	// Method to stop speculating on the type of an expression
+	static void markFailed(const Expression* pExpr);
+
+	// Observation count required before speculating config variable
+	static ConfigVar s_thresholdVar;
+
+private:
+
+	// Observed type information for an expression
+	struct SiteInfo
+	{
+		// Type of the values observed
+		DataObject::Type objType;
+
+		// Indicates that all the values observed were scalars
+		bool isScalar;
+
+		// Number of values observed
+		size_t count;
+
+		// Indicates that values of different types were observed
+		bool polymorphic;
+
+		// Indicates that a speculation on this type failed
+		bool failed;
+	};
+
+	// Site map type definition
+	typedef std::map<const Expression*, SiteInfo> SiteMap;
+
+	// Observed types, by expression
+	static SiteMap s_siteMap;
+};
+
+#endif // #ifndef TYPEFEEDBACK_H_
@@ -17,6 +17,7 @@
 // Header files
 #include "typeinfer.h"
 #include "cellarrayobj.h"
+#include "structobj.h"
 #include "utility.h"
 #include "constexprs.h"
 
@@ -227,9 +228,20 @@ TypeInfo::TypeInfo(const DataObject* pObject, bool storeMatDims, bool scanMatric
             }
         }
 
-    else if (pObject->getType() == DataObject::Type::STRUCTARRAY) {
-      assert(false) ;
-    }
+        // If this is a scalar struct and its contents should be scanned
+        else if (pObject->getType() == DataObject::Type::STRUCTARRAY && scanMatrices && pMatrixObj->isScalar())
+        {
+            // Get the struct element
+            const ScalarStruct* pStruct = ((StructArrayObj*)pObject)->getScalar();
+
+            // Record the type of each field holding a value
+            for (size_t slot = 0; pStruct != NULL && slot < pStruct->size(); ++slot)
+            {
+                DataObject* pValue = pStruct->getSlot(slot);
+                if (pValue != NULL)
+                    m_fields[pStruct->getShape()->getFields()[slot]] = new TypeInfo(pValue, storeMatDims, scanMatrices);
+            }
+        }
     }
 
     // Otherwise, if the object is a function handle
@@ -305,6 +317,24 @@ TypeInfo::TypeInfo(
   m_fields(fields)
 {
 }
+/***************************************************************
+* Function: TypeInfo::getShape()
+* Purpose : Get the shape of struct objects with these fields
+* Initial : agent on October 18, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+const StructShape* TypeInfo::getShape() const
+{
+    // Gather the field names, in sorted order
+    StructShape::FieldVector fields;
+    for (TypeMap::const_iterator itr = m_fields.begin(); itr != m_fields.end(); ++itr)
+        fields.push_back(itr->first);
+
+    // Return the shape shared by structs with these fields
+    return StructShape::get(fields);
+}
+
 /***************************************************************
 * Function: TypeInfo::toString()
 * Purpose : Get a string representation of the type information
@@ -36,6 +36,7 @@ class TypeInfo;
 class ArrayObj;
 class Platform;
 class Expression;
+class StructShape;
 
 typedef std::set<TypeInfo> TypeSet;
 std::ostream& operator<<(std::ostream &strm, const TypeSet &a) ;
@@ -55,6 +56,9 @@ std::ostream& operator<<(std::ostream &strm, const TypeSetMap &a) ;
 * Initial : Maxime Chevalier-Boisvert on April 13, 2009
 ****************************************************************
 Revisions and bug fixes:
+
+agent on October 18, 2026
+Struct types record the shape of their field set.
 */
 class TypeInfo
 {
@@ -148,6 +152,10 @@ public:
         return m_fields ;
     }
 
+    // Accessor to get the shape of struct objects with these fields
+    // Note: the slot of a field is its position in the field map
+    const StructShape* getShape() const;
+
     const DimVector& getMatSize() const { return m_matSize; }
     Function* getFunction() const { return m_pFunction; }
     const std::set<TypeInfo>& getCellTypes() const { return m_cellTypes; }
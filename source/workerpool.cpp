@@ -0,0 +1,247 @@
+// =========================================================================== //
+//                                                                             //
+// Copyright 2026 agent.                                                       //
+//                                                                             //
+//   Licensed under the Apache License, Version 2.0 (the "License");           //
+//   you may not use this file except in compliance with the License.          //
+//   You may obtain a copy of the License at                                   //
+//                                                                             //
+//       http://www.apache.org/licenses/LICENSE-2.0                            //
+//                                                                             //
+//   Unless required by applicable law or agreed to in writing, software       //
+//   distributed under the License is distributed on an "AS IS" BASIS,         //
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  //
+//   See the License for the specific language governing permissions and       //
+//  limitations under the License.                                             //
+//                                                                             //
+// =========================================================================== //
+// Header files
+#include <unistd.h>
+#include <gc/gc.h>
+#include "workerpool.h"
+
+// Number of threads config variable
+ConfigVar WorkerPool::s_numThreadsVar("parallel_threads", ConfigVar::INT, "0", 0, 256);
+
+// Current task function and data
+WorkerPool::TaskFunc WorkerPool::s_pTaskFunc = NULL;
+void* WorkerPool::s_pTaskData = NULL;
+
+// Task counters
+size_t WorkerPool::s_numTasks = 0;
+size_t WorkerPool::s_nextTask = 0;
+size_t WorkerPool::s_numDone = 0;
+
+// Flag indicating tasks are being run
+bool WorkerPool::s_busy = false;
+
+// Number of worker threads started
+size_t WorkerPool::s_numWorkers = 0;
+
+// Index of the current thread
+__thread size_t WorkerPool::s_threadIndex = 0;
+
+// Mutex and conditions synchronizing the pool
+pthread_mutex_t WorkerPool::s_mutex = PTHREAD_MUTEX_INITIALIZER;
+pthread_cond_t WorkerPool::s_workCond = PTHREAD_COND_INITIALIZER;
+pthread_cond_t WorkerPool::s_doneCond = PTHREAD_COND_INITIALIZER;
+
+/***************************************************************
+* Function: WorkerPool::registerConfigVars()
+* Purpose : Register the worker pool config variables
+* Initial : agent on October 18, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+void WorkerPool::registerConfigVars()
+{
+	// Register the number of threads
+	ConfigManager::registerVar(&s_numThreadsVar);
+}
+
+/***************************************************************
+* Function: WorkerPool::run()
+* Purpose : Run a number of tasks and wait for their completion
+* Initial : agent on October 18, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+void WorkerPool::run(TaskFunc pTaskFunc, size_t numTasks, void* pData)
+{
+	// Get the number of threads to use
+	size_t numThreads = getNumThreads();
+
+	pthread_mutex_lock(&s_mutex);
+
+	// If there is a single thread, or tasks are already being run
+	// (a task started more tasks), run the tasks on this thread
+	if (numThreads <= 1 || s_busy == true)
+	{
+		pthread_mutex_unlock(&s_mutex);
+
+		for (size_t i = 0; i < numTasks; ++i)
+			pTaskFunc(i, pData);
+
+		return;
+	}
+
+	// Start the worker threads, if needed
+	// Note: the calling thread also runs tasks
+	startWorkers(numThreads - 1);
+
+	// Post the tasks and wake the workers
+	s_busy = true;
+	s_pTaskFunc = pTaskFunc;
+	s_pTaskData = pData;
+	s_numTasks = numTasks;
+	s_nextTask = 0;
+	s_numDone = 0;
+	pthread_cond_broadcast(&s_workCond);
+
+	// Run tasks on this thread as well
+	runTasks();
+
+	// Wait for the tasks taken by the workers to complete
+	while (s_numDone < s_numTasks)
+		pthread_cond_wait(&s_doneCond, &s_mutex);
+
+	// Reset the pool state
+	s_pTaskFunc = NULL;
+	s_pTaskData = NULL;
+	s_numTasks = 0;
+	s_nextTask = 0;
+	s_numDone = 0;
+	s_busy = false;
+
+	pthread_mutex_unlock(&s_mutex);
+}
+
+/***************************************************************
+* Function: WorkerPool::getNumThreads()
+* Purpose : Get the number of threads tasks are spread over
+* Initial : agent on October 18, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+size_t WorkerPool::getNumThreads()
+{
+#ifdef GC_THREADS
+	// Get the configured number of threads
+	size_t numThreads = s_numThreadsVar.getIntValue();
+
+	// If no number was set, use one thread per processor
+	if (numThreads == 0)
+	{
+		long numProcs = sysconf(_SC_NPROCESSORS_ONLN);
+		numThreads = (numProcs > 0)? numProcs:1;
+	}
+
+	return numThreads;
+#else
+	// Without a thread-safe collector, only the main thread may run code
+	return 1;
+#endif
+}
+
+/***************************************************************
+* Function: WorkerPool::isBusy()
+* Purpose : Test if the pool is running tasks
+* Initial : agent on October 18, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+bool WorkerPool::isBusy()
+{
+	pthread_mutex_lock(&s_mutex);
+	bool busy = s_busy;
+	pthread_mutex_unlock(&s_mutex);
+
+	return busy;
+}
+
+/***************************************************************
+* Function: WorkerPool::workerMain()
+* Purpose : Entry point of the worker threads
+* Initial : agent on October 18, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+void* WorkerPool::workerMain(void* pArg)
+{
+	// Set the index of this thread
+	s_threadIndex = (size_t)pArg;
+
+	pthread_mutex_lock(&s_mutex);
+
+	// Run tasks as they are posted
+	for (;;)
+	{
+		while (s_nextTask >= s_numTasks)
+			pthread_cond_wait(&s_workCond, &s_mutex);
+
+		runTasks();
+	}
+
+	// Never reached, the workers live as long as the process
+	pthread_mutex_unlock(&s_mutex);
+	return NULL;
+}
+
+/***************************************************************
+* Function: WorkerPool::runTasks()
+* Purpose : Run the pending tasks, called with the mutex held
+* Initial : agent on October 18, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+void WorkerPool::runTasks()
+{
+	// While there are tasks left to start
+	while (s_nextTask < s_numTasks)
+	{
+		// Take the next task
+		size_t taskIndex = s_nextTask++;
+		TaskFunc pTaskFunc = s_pTaskFunc;
+		void* pTaskData = s_pTaskData;
+
+		// Run the task outside of the lock
+		pthread_mutex_unlock(&s_mutex);
+		pTaskFunc(taskIndex, pTaskData);
+		pthread_mutex_lock(&s_mutex);
+
+		// If this was the last task to complete, wake the caller
+		if (++s_numDone == s_numTasks)
+			pthread_cond_signal(&s_doneCond);
+	}
+}
+
+/***************************************************************
+* Function: WorkerPool::startWorkers()
+* Purpose : Start worker threads until there are enough of them
+* Initial : agent on October 18, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+void WorkerPool::startWorkers(size_t numWorkers)
+{
+	// Give the workers large stacks, since they run
+	// recursive interpreter and compiled code
+	pthread_attr_t attr;
+	pthread_attr_init(&attr);
+	pthread_attr_setstacksize(&attr, 16 * 1024 * 1024);
+	pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_DETACHED);
+
+	// Note: with GC_THREADS defined, the collector header redirects
+	// pthread_create so that the new threads are registered with it
+	while (s_numWorkers < numWorkers)
+	{
+		pthread_t thread;
+
+		if (pthread_create(&thread, &attr, workerMain, (void*)(s_numWorkers + 1)) != 0)
+			break;
+
+		++s_numWorkers;
+	}
+
+	pthread_attr_destroy(&attr);
+}
@@ -0,0 +1,99 @@
+// =========================================================================== //
+//                                                                             //
+// Copyright 2026 agent.                                                       //
+//                                                                             //
+//   Licensed under the Apache License, Version 2.0 (the "License");           //
+//   you may not use this file except in compliance with the License.          //
+//   You may obtain a copy of the License at                                   //
+//                                                                             //
+//       http://www.apache.org/licenses/LICENSE-2.0                            //
+//                                                                             //
+//   Unless required by applicable law or agreed to in writing, software       //
+//   distributed under the License is distributed on an "AS IS" BASIS,         //
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  //
+//   See the License for the specific language governing permissions and       //
+//  limitations under the License.                                             //
+//                                                                             //
+// =========================================================================== //
+
+// Include guards
+#ifndef WORKERPOOL_H_
+#define WORKERPOOL_H_
+
+// Header files
+#include <pthread.h>
+#include "platform.h"
+#include "configmanager.h"
+
+/***************************************************************
+* Class   : WorkerPool
+* Purpose : Run independent tasks on a pool of worker threads
+* Initial : agent on October 18, 2026
+****************************************************************
+Revisions and bug fixes:
+*/
+class WorkerPool
+{
+public:
+
+	// Task function type (called once per task index)
+	typedef void (*TaskFunc)(size_t taskIndex, void* pData);
+
+	// Method to register the worker pool config variables
+	static void registerConfigVars();
+
+	// Method to run a number of tasks and wait for their completion
+	static void run(TaskFunc pTaskFunc, size_t numTasks, void* pData);
+
+	// Method to get the number of threads tasks are spread over
+	static size_t getNumThreads();
+
+	// Method to test if the pool is running tasks
+	static bool isBusy();
+
+	// Accessor to get the index of the current thread (0 for the main thread)
+	static size_t getThreadIndex() { return s_threadIndex; }
+
+	// Number of threads config variable (0 for one per processor)
+	static ConfigVar s_numThreadsVar;
+
+private:
+
+	// Entry point of the worker threads
+	static void* workerMain(void* pArg);
+
+	// Method to run the pending tasks, called with the mutex held
+	static void runTasks();
+
+	// Method to start worker threads until there are enough of them
+	static void startWorkers(size_t numWorkers);
+
+	// Current task function and data
+	static TaskFunc s_pTaskFunc;
+	static void* s_pTaskData;
+
+	// Number of tasks, next task to start and number of tasks done
+	static size_t s_numTasks;
+	static size_t s_nextTask;
+	static size_t s_numDone;
+
+	// Flag indicating tasks are being run
+	static bool s_busy;
+
+	// Number of worker threads started
+	static size_t s_numWorkers;
+
+	// Index of the current thread
+	static __thread size_t s_threadIndex;
+
+	// Mutex protecting the pool state
+	static pthread_mutex_t s_mutex;
+
+	// Condition signaled when new tasks are available
+	static pthread_cond_t s_workCond;
+
+	// Condition signaled when all tasks are done
+	static pthread_cond_t s_doneCond;
+};
+
+#endif // #ifndef WORKERPOOL_H_